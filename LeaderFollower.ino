@@ -4,13 +4,39 @@
 #include "animations.h"
 #include "protocol.h"
 #include "node_config.h"
+#include "led_channel_inverse.h"
 #include "anim_schema.h"
+#include "dyn_config.h"
+#include "follower_registry.h"
+#include "tdma.h"
+#include "link_rate.h"
+#include "relay.h"
+#include "time_base.h"
+#include "frame_cache.h"
+#include "json_writer.h"
+#include "json_reader.h"
+#include "ws_push.h"
+#include "led_stream.h"
+#include "fav_store.h"
+#include "prefs_writeback.h"
+
+#ifndef NODE_ID
+#define NODE_ID 0
+#endif
+#ifndef SPARKLE_SEED
+#define SPARKLE_SEED 0 // Sparkle RNG key: equal on every node = identical field from the synced clock
+#endif
+#ifndef AUTO_PREFETCH_MS
+#define AUTO_PREFETCH_MS 2000 // auto mode decodes its next favorite this long before switching
+#endif
 
 #if defined(ARDUINO_ARCH_ESP32)
 #include <WiFi.h>
 #include <WebServer.h>
 #include <Preferences.h>
+#include <lwip/sockets.h> // non-blocking send for the LED frame stream
 #include "web_ui.h"
+#include "web_ui_gz.h"
 #endif
 #include "serial_console.h"
 
@@ -30,16 +56,48 @@ struct Node {
   uint32_t framesSincePrint{0};
   // time sync offset (leader_time_ms - local_now_ms). Used by followers.
   int32_t timeOffsetMs{0};
+  TimeBase::Clock64 renderClock; // micros() extended to 64 bits for the renderers
+  FrameCache::Cache<> frameCache; // one period of Wave, keyed on the params
+  Anim::NoisePlanes noisePlanes;  // Perlin noise planes kept between frames
+  Anim::SparkDirty sparkDirty;    // Sparkle LEDs lit in the render buffer
+#if defined(ARDUINO_ARCH_ESP32)
+  Anim::SparkDirty followerSparkDirty; // the same for the follower preview in streamFrames
+#endif
   // Follower sync request bookkeeping
   uint32_t lastSyncRecvMs{0};
   uint32_t lastReqSentMs{0};
-  uint32_t reqInterval{2000}; // follower sends REQ every 2s until synced
+  uint32_t reqDueMs{0};
+  uint8_t reqAttempt{0};  // REQ retries back off exponentially (Proto::reqBackoffMs)
+  bool soloRestart{false}; // reset by software/watchdog: the fleet around us is still running
+  bool cfgKnown{false};   // follower config confirmed by CFG2/JOIN or a SYNC answering our REQ
+  // Follower ACK deferred to its TDMA slot after the SYNC that triggered it
+  bool ackQueued{false};
+  uint32_t ackDueMs{0};
+  uint32_t ackFrame{0};
+  uint32_t syncFrame{0};  // frame of the last SYNC/JOIN, relayed or not
+  int16_t ackErrMs{0};
   
-  // ACK tracking (like Python protocol)
-  bool pendingAck{false};
-  uint32_t pendingAckFrame{0};
-  uint32_t ackTimeout{2000}; // 2 seconds like Python
+  // Node id carried in ACK/REQ (leader = 0)
+  uint8_t nodeId{NODE_ID};
+  // ACK tracking: one entry per follower, retries target only nodes that have not confirmed
+  Fleet::Registry followers;
+  uint32_t ackTimeout{Tdma::kResponseWindowMs}; // SYNC airtime + every follower slot
+  bool lastSyncTargeted{false}; // last SYNC addressed one node -> only Tdma::kTargetedWindowMs to wait
+  uint32_t slotWindowEndMs{0};  // follower ACK slots after the last broadcast SYNC end here
   uint32_t syncInterval{60000}; // 1 minute between regular syncs
+  // Fleet data rate (link_rate.h): the leader picks it from follower SNR, followers obey RATE
+  uint8_t linkRate{LinkRate::kDefault};
+  LinkRate::Controller rateCtl;
+  uint32_t rateRoundFrame{0};   // leader: last closed round fed to rateCtl
+  uint32_t rateResyncAtMs{0};   // leader: broadcast SYNC on the new rate at this time (0 = none)
+  uint32_t lastLeaderMs{0};     // follower: last packet of any kind from the leader
+  uint32_t rateSinceMs{0};      // follower: listening on linkRate since
+#if LORA_RELAY
+  // Relay: REQ from a node the leader may not hear, answered by us unless the leader does
+  uint8_t relayReqNode{0};      // 0 = none pending
+  uint16_t relayReqHash{0};
+  uint32_t relayReqDueMs{0};
+#endif
 
   // Animation indices per role (CFG2-based)
   uint8_t leaderAnimIndex{1};
@@ -56,19 +114,34 @@ struct Node {
   bool autoOn{false};
   uint16_t autoIntervalSec{10};
   bool autoRandom{false};
-  // IDs refer to favorites indices as stored
+  // Stable favorite ids (fav_store.h)
   // We keep selections as a small fixed array for embedded safety
   static const uint8_t kMaxAutoSel = 32;
-  uint8_t autoSel[kMaxAutoSel];
+  uint16_t autoSel[kMaxAutoSel];
   uint8_t autoSelCount{0};
   int8_t autoIdx{-1}; // index into autoSel (-1 = not started)
+  int8_t autoNext{-1}; // selection decided and prefetched ahead of the switch (-1 = none yet)
   uint32_t autoLastMs{0};
 
 #if defined(ARDUINO_ARCH_ESP32)
   // Web UI (leader only)
   WebServer *server{nullptr};
+  // Push sockets for the UI (ws_push.h): slots take the handshake, then only receive frames
+  struct WsSlot { WiFiClient client; bool used{false}, open{false}; uint32_t sinceMs{0}; uint16_t len{0}; uint8_t buf[256];
+                  LedStream::Subscription stream; LedStream::Outbox out; }; // opt-in LED frames (led_stream.h)
+  WiFiServer *wsServer{nullptr};
+  WsSlot wsSlots[WS_MAX_CLIENTS];
+  Ws::Snapshot wsLast;
+  Ws::Message wsMsg;
+  uint32_t wsLastPushMs{0};
+  uint32_t renderSeq{0};  // frames rendered, stamped on streamed frames
+  int16_t wsNameId{-2}; // favorite wsName belongs to
+  String wsName;
   // Persistent storage for globals
   Preferences prefs;
+  PrefsWb::WriteBack<Preferences> prefsWb{prefs}; // settings puts, written back from tick()
+  FavStore::Store<Preferences> favs{prefs};
+  FavStore::Cache<Preferences> favCache{favs}; // decoded favorites for auto mode and names
   float lastSavedGMin{-9999.0f};
   float lastSavedGMax{9999.0f};
 #endif
@@ -84,6 +157,12 @@ struct Node {
     leds->begin();
     leds->setBrightness(brightness);
 
+  // Resolve node id (followers without NODE_ID use the low MAC byte, kept out of 0/0xFF)
+  if (isLeader) nodeId = Proto::NODE_LEADER;
+#if defined(ARDUINO_ARCH_ESP32)
+  else if (nodeId == 0) { nodeId = (uint8_t)(ESP.getEfuseMac() >> 40); if (nodeId == 0 || nodeId == 0xFF) nodeId = 1; }
+#endif
+
   // Initialize per-role animation indices
   leaderAnimIndex = animIndex;
   followerAnimIndex = animIndex;
@@ -91,6 +170,8 @@ struct Node {
 #if defined(ARDUINO_ARCH_ESP32)
   // Init NVS and load persisted global min/max if present; apply to both ParamSets
   prefs.begin("vivid", false);
+  uint16_t migrated = favs.migrate(); // fav_N JSON strings from older firmware
+  if (migrated) { Serial.print("Favorites migrated: "); Serial.println(migrated); }
   bool haveMin = prefs.isKey("gmin");
   bool haveMax = prefs.isKey("gmax");
   if (haveMin && haveMax) {
@@ -116,13 +197,20 @@ struct Node {
     int comma = selStr.indexOf(',', pos);
     int end = (comma >= 0) ? comma : selStr.length();
     int val = selStr.substring(pos, end).toInt();
-    if (val >= 0 && val <= 255) {
-      autoSel[autoSelCount++] = (uint8_t)val;
+    if (val >= 0 && val <= FavStore::MAX_ID) {
+      autoSel[autoSelCount++] = (uint16_t)val;
     }
     if (comma < 0) break; pos = comma + 1;
   }
   autoIdx = prefs.getChar("auto_idx", -1);
   autoLastMs = prefs.getULong("auto_last", 0);
+  // Settings still waiting in prefsWb land before esp_restart() (OTA update, reset from code)
+  shutdownNode() = this;
+  // Only this node restarted (OTA, crash, watchdog); after a power-up the fleet may be booting too
+  esp_reset_reason_t resetWhy = esp_reset_reason();
+  soloRestart = resetWhy == ESP_RST_SW || resetWhy == ESP_RST_PANIC || resetWhy == ESP_RST_INT_WDT ||
+                resetWhy == ESP_RST_TASK_WDT || resetWhy == ESP_RST_WDT;
+  esp_register_shutdown_handler(&flushOnShutdown);
   if (isLeader) {
     setupWiFiAndServer();
   }
@@ -132,6 +220,194 @@ struct Node {
   #endif
   }
 
+  // Follower: apply time sync offset if needed, then ACK unless the SYNC targets another node.
+  // The first SYNC is always answered (in our slot) so the leader learns this node exists
+  // even when it synced off a SYNC addressed to someone else. Relayed SYNCs (msg.hops > 0)
+  // are never ACKed: the leader is out of range.
+  void onFollowerSync(const Message &msg) {
+    bool firstSync = (lastSyncRecvMs == 0);
+    if (firstSync) reqDueMs = 0; // a pending REQ moves to our slot on the leader's grid
+    #ifdef ARDUINO
+    lastSyncRecvMs = millis();
+    int32_t now32 = (int32_t)millis();
+    #else
+    lastSyncRecvMs = 0; int32_t now32 = 0;
+    #endif
+    syncFrame = msg.frame;
+    int32_t newOffset = (int32_t)msg.time_ms - now32;
+    int32_t diff = newOffset - timeOffsetMs;
+    int32_t adiff = diff < 0 ? -diff : diff;
+    // Config self-heal: SYNC carries the leader's follower-config hash. On a mismatch (missed
+    // CFG2) go back to REQing, which the leader answers with a JOIN. From a leader without
+    // hashes, a SYNC addressed to us answers our REQ, i.e. our hash matched.
+    if (msg.type == Message::SYNC) {
+      if (msg.cfgHash) {
+        bool match = (msg.cfgHash == followerCfgHash());
+        if (cfgKnown && !match) { reqAttempt = 0; reqDueMs = 0; }
+        cfgKnown = match;
+      } else if (msg.target == nodeId) {
+        cfgKnown = true;
+      }
+    }
+    if (msg.hops == 0 && (msg.target == Proto::NODE_BROADCAST || msg.target == nodeId || firstSync)) {
+      // Queue the ACK for this node's slot so followers do not answer all at once
+      ackQueued = true;
+      ackFrame = msg.frame;
+      ackErrMs = (int16_t)constrain(diff, (int32_t)INT16_MIN, (int32_t)INT16_MAX);
+      ackDueMs = (uint32_t)now32 + Tdma::ackDelayMs(nodeId, msg.target == nodeId, LinkRate::modem(linkRate));
+    }
+    const int32_t kThresholdMs = 100; // tighter threshold than 150ms
+    if (adiff > kThresholdMs) {
+      // For moderate diffs, slews half-way to avoid visible jumps
+      if (adiff < 200) {
+        timeOffsetMs += diff / 2; // gentle correction
+        #ifdef ARDUINO
+        Serial.print("[SYNC] Slew by ms="); Serial.println(diff / 2);
+        #endif
+      } else {
+        timeOffsetMs = newOffset; // large jump -> snap
+        #ifdef ARDUINO
+        Serial.print("[SYNC] Snap offset to ms="); Serial.println(timeOffsetMs);
+        #endif
+      }
+    } else {
+      // Already close enough
+      // Serial.print("[SYNC] Small diff ms="); Serial.println(adiff);
+    }
+    // SYNC no longer carries animation; animation changes arrive via CFG2 only
+  }
+
+  // Followers apply received dynamic follower config (CFG2 or the config half of a JOIN)
+  void onFollowerCfg(const Message &msg) {
+    followerAnimIndex = msg.cfg2_animIndex;
+    cfgKnown = true;
+    // Update followerParams with received pairs
+    for (uint8_t i=0;i<msg.cfg2_paramCount;i++) {
+      Anim::setParamField(followerParams, msg.cfg2_paramIds[i], msg.cfg2_paramValues[i]);
+    }
+    for (uint8_t i=0;i<msg.cfg2_globalCount;i++) {
+      Anim::setParamField(followerParams, msg.cfg2_globalIds[i], msg.cfg2_globalValues[i]);
+    }
+    // Update globals mirror
+    globalSpeed = followerParams.globalSpeed;
+    globalMin = followerParams.globalMin;
+    globalMax = followerParams.globalMax;
+#if defined(ARDUINO_ARCH_ESP32)
+    // Persist globals if changed significantly
+    auto fabsf_local = [](float x){ return x < 0 ? -x : x; };
+    if (fabsf_local(globalMin - lastSavedGMin) > 0.001f || fabsf_local(globalMax - lastSavedGMax) > 0.001f) {
+      prefsWb.putFloat("gmin", globalMin);
+      prefsWb.putFloat("gmax", globalMax);
+      lastSavedGMin = globalMin; lastSavedGMax = globalMax;
+    }
+#endif
+    #ifdef ARDUINO
+    Serial.println("Applied follower CFG2 from leader");
+    #endif
+  }
+
+  void setLinkRate(uint8_t rate, uint32_t now) {
+    linkRate = rate; rateSinceMs = now;
+    comm->setRate(rate);
+    ackTimeout = Tdma::responseWindowMs(LinkRate::modem(rate));
+  }
+
+  // Leader: feed a closed round to the rate controller. A change is announced on the current
+  // rate, then the leader retunes and re-confirms everyone with a SYNC on the new one.
+  void adaptRate(uint32_t now) {
+    uint8_t r = rateCtl.onRoundDone(followers, now);
+    if (r == linkRate) return;
+    #ifdef ARDUINO
+    Serial.print("RATE: "); Serial.print(linkRate); Serial.print(" -> "); Serial.println(r);
+    #endif
+    comm->sendRate(r);
+    rateResyncAtMs = now + LoraPhy::airtimeMs(sizeof(Proto::RatePacket), LinkRate::modem(linkRate)) + LinkRate::kSettleMs;
+    rateCtl.apply(r);
+    setLinkRate(r, now);
+  }
+
+  uint16_t followerCfgHash() const { return DynCfg::configHash(followerAnimIndex, followerParams); }
+
+#if LORA_RELAY
+  // Relay: a REQ nobody answered within Relay::answerDelayMs probably came from behind us.
+  // Answer it like the leader would, on our synced clock.
+  void onRelayReq(const Message &msg, uint32_t now) {
+    if (relayReqNode || msg.node == Proto::NODE_LEADER) return;
+    relayReqNode = msg.node; relayReqHash = msg.cfgHash;
+    relayReqDueMs = now + Relay::answerDelayMs(LinkRate::modem(linkRate), (uint32_t)random(0x7FFFFFFF));
+  }
+  void tickRelay(uint32_t now) {
+    if (!relayReqNode || (int32_t)(now - relayReqDueMs) < 0) return;
+    uint8_t target = relayReqNode;
+    relayReqNode = 0;
+    if (lastSyncRecvMs == 0 || !cfgKnown) return; // nothing trustworthy to hand out
+    uint32_t leaderNow = (uint32_t)((int32_t)now + timeOffsetMs);
+    uint16_t hash = followerCfgHash();
+    #ifdef ARDUINO
+    Serial.print("RELAY: answering REQ from node "); Serial.println(target);
+    #endif
+    if (relayReqHash && relayReqHash != hash) {
+      uint8_t ids[AnimSchema::PARAM_COUNT]; float vals[AnimSchema::PARAM_COUNT];
+      uint8_t n = collectParams(followerParams, ids, vals);
+      comm->sendJoin(leaderNow, syncFrame, target, followerAnimIndex, ids, vals, n);
+    } else {
+      comm->sendSync(leaderNow, syncFrame, target, hash);
+    }
+  }
+#endif
+
+  // All schema params of a set, in schema order (what CFG2/JOIN put on air)
+  static uint8_t collectParams(const Anim::ParamSet &ps, uint8_t *ids, float *vals) {
+    for (uint8_t i=0;i<AnimSchema::PARAM_COUNT;i++){ ids[i] = AnimSchema::PARAM_IDS[i]; vals[i] = Anim::getParamField(ps, ids[i]); }
+    return AnimSchema::PARAM_COUNT;
+  }
+
+  // Leader: targeted answer for the current round. A follower whose REQ reported a config hash
+  // different from ours gets a JOIN (SYNC + full follower config in one frame) so it renders
+  // the right animation as soon as it is synced; everyone else gets a plain SYNC.
+  void answerFollower(const Fleet::Follower *f, uint32_t now) {
+    uint8_t target = f ? f->id : Proto::NODE_BROADCAST;
+    uint16_t hash = followerCfgHash();
+    if (f && f->cfgHash && f->cfgHash != hash) {
+      uint8_t ids[AnimSchema::PARAM_COUNT]; float vals[AnimSchema::PARAM_COUNT];
+      uint8_t n = collectParams(followerParams, ids, vals);
+      comm->sendJoin(now, followers.roundFrame, target, followerAnimIndex, ids, vals, n);
+    } else {
+      comm->sendSync(now, followers.roundFrame, target, hash);
+    }
+    lastSyncSent = now;
+    lastSyncTargeted = (f != nullptr);
+  }
+
+  // Leader: open a new round with a broadcast, answered by every follower in its slot. At
+  // boot and while followers are joining it carries the follower config (broadcast JOIN), so
+  // nodes that powered up with the leader need no REQ/JOIN exchange each.
+  void broadcastRound(uint32_t now, bool withCfg) {
+    followers.beginRound(now / 33);
+    if (withCfg) {
+      uint8_t ids[AnimSchema::PARAM_COUNT]; float vals[AnimSchema::PARAM_COUNT];
+      uint8_t n = collectParams(followerParams, ids, vals);
+      comm->sendJoin(now, followers.roundFrame, Proto::NODE_BROADCAST, followerAnimIndex, ids, vals, n);
+    } else {
+      comm->sendSync(now, followers.roundFrame, Proto::NODE_BROADCAST, followerCfgHash());
+    }
+    lastSyncSent = now;
+    lastSyncTargeted = false;
+    slotWindowEndMs = now + ackTimeout;
+  }
+
+  // A new follower whose id lands on a slot that is already taken: the two ACKs collide on
+  // every broadcast round until one of them gets another id (mod TDMA_SLOTS)
+  void reportSlotClash(uint8_t id) {
+    const Fleet::Follower *f = followers.find(id);
+    uint8_t peer = f ? followers.slotPeer(*f) : 0;
+    if (!peer) return;
+    #ifdef ARDUINO
+    Serial.print("[TDMA] node "); Serial.print(id); Serial.print(" shares slot "); Serial.print(Tdma::slotFor(id));
+    Serial.print(" with node "); Serial.println(peer);
+    #endif
+  }
+
   void tick() {
     comm->loop();
 #ifdef ARDUINO
@@ -139,96 +415,69 @@ struct Node {
 #endif
     Message msg;
   while (comm->poll(msg)) {
+    #ifdef ARDUINO
+    if (!isLeader && msg.type != Message::ACK && msg.type != Message::REQ) lastLeaderMs = millis();
+    #endif
+#if LORA_RELAY
+    // The leader (or another relay) answered that REQ already
+    if (!isLeader && relayReqNode && (msg.type == Message::SYNC || msg.type == Message::JOIN) && msg.target == relayReqNode) relayReqNode = 0;
+#endif
   if (!isLeader && msg.type == Message::SYNC) {
-        // Follower: ACK and apply time sync offset if needed
-        comm->sendAck(msg.frame);
-  #ifdef ARDUINO
-  lastSyncRecvMs = millis();
-    int32_t now32 = (int32_t)millis();
-  #else
-  lastSyncRecvMs = 0; int32_t now32 = 0;
-  #endif
-        int32_t newOffset = (int32_t)msg.time_ms - now32;
-        int32_t diff = newOffset - timeOffsetMs;
-        int32_t adiff = diff < 0 ? -diff : diff;
-        const int32_t kThresholdMs = 100; // tighter threshold than 150ms
-        if (adiff > kThresholdMs) {
-          // For moderate diffs, slews half-way to avoid visible jumps
-          if (adiff < 200) {
-            timeOffsetMs += diff / 2; // gentle correction
-            #ifdef ARDUINO
-            Serial.print("[SYNC] Slew by ms="); Serial.println(diff / 2);
-            #endif
-          } else {
-            timeOffsetMs = newOffset; // large jump -> snap
-            #ifdef ARDUINO
-            Serial.print("[SYNC] Snap offset to ms="); Serial.println(timeOffsetMs);
-            #endif
-          }
-        } else {
-          // Already close enough
-          // Serial.print("[SYNC] Small diff ms="); Serial.println(adiff);
-        }
-  // SYNC no longer carries animation; animation changes arrive via CFG2 only
+        onFollowerSync(msg);
+      } else if (!isLeader && msg.type == Message::JOIN) {
+        // Join answer: take the config first so output is correct from the first synced frame
+        onFollowerCfg(msg);
+        onFollowerSync(msg);
       } else if (isLeader && msg.type == Message::ACK) {
-        // Handle ACK received by leader
-        if (pendingAck && msg.frame == pendingAckFrame) {
-          pendingAck = false;
+        // Handle ACK received by leader: record it against that follower only
+        #ifdef ARDUINO
+        uint32_t nowAck = millis();
+        #else
+        uint32_t nowAck = 0;
+        #endif
+        uint8_t known = followers.count;
+        bool confirmed = followers.onAck(msg.node, msg.frame, msg.offsetErrMs, nowAck, msg.rssi, msg.snr);
+        if (followers.count != known) reportSlotClash(msg.node);
+        followers.noteSnr(msg.node, LinkRate::refSnrQ4(msg.snr, linkRate));
+        if (confirmed) {
           #ifdef ARDUINO
-          Serial.print("ACK confirmed for frame "); Serial.println(msg.frame);
+          Serial.print("ACK confirmed for frame "); Serial.print(msg.frame);
+          Serial.print(" node="); Serial.print(msg.node);
+          Serial.print(" pending="); Serial.println(followers.pendingCount());
           #endif
         }
       } else if (!isLeader && msg.type == Message::CFG2) {
-  // Followers apply received dynamic follower config
-  followerAnimIndex = msg.cfg2_animIndex;
-        // Update followerParams with received pairs
-        for (uint8_t i=0;i<msg.cfg2_paramCount;i++) {
-          Anim::setParamField(followerParams, msg.cfg2_paramIds[i], msg.cfg2_paramValues[i]);
-        }
-        for (uint8_t i=0;i<msg.cfg2_globalCount;i++) {
-          Anim::setParamField(followerParams, msg.cfg2_globalIds[i], msg.cfg2_globalValues[i]);
-        }
-  // Update globals mirror
-        globalSpeed = followerParams.globalSpeed;
-        globalMin = followerParams.globalMin;
-        globalMax = followerParams.globalMax;
-#if defined(ARDUINO_ARCH_ESP32)
-        // Persist globals if changed significantly
-        auto fabsf_local = [](float x){ return x < 0 ? -x : x; };
-        if (fabsf_local(globalMin - lastSavedGMin) > 0.001f || fabsf_local(globalMax - lastSavedGMax) > 0.001f) {
-          prefs.putFloat("gmin", globalMin);
-          prefs.putFloat("gmax", globalMax);
-          lastSavedGMin = globalMin; lastSavedGMax = globalMax;
-        }
-#endif
+        onFollowerCfg(msg);
+      } else if (!isLeader && msg.type == Message::RATE) {
         #ifdef ARDUINO
-        Serial.println("Applied follower CFG2 from leader");
+        setLinkRate(msg.rate, millis());
         #endif
       } else if (isLeader && msg.type == Message::REQ) {
-          // Leader: if pending, re-send the SAME frame; otherwise start a new in-flight SYNC
+          // Leader: answer the requesting follower for the current round, addressed to it
           #ifdef ARDUINO
           uint32_t nowReq = millis();
           #else
           uint32_t nowReq = 0;
           #endif
-          if (pendingAck) {
-            #ifdef ARDUINO
-            Serial.print("REQ: resending SAME frame "); Serial.println(pendingAckFrame);
-            #endif
-            comm->sendSync(nowReq, pendingAckFrame);
-            lastSyncSent = nowReq;
-          } else {
-            uint32_t currentFrameReq = nowReq / 33;
-            #ifdef ARDUINO
-            Serial.print("REQ: sending NEW frame "); Serial.println(currentFrameReq);
-            #endif
-            comm->sendSync(nowReq, currentFrameReq);
-            lastSyncSent = nowReq;
-            pendingAck = true;
-            pendingAckFrame = currentFrameReq;
-          }
+          if (lastSyncSent == 0) { followers.beginRound(nowReq / 33); }
+          uint8_t known = followers.count;
+          Fleet::Follower *f = followers.onReq(msg.node, nowReq, msg.rssi, msg.snr);
+          if (followers.count != known) reportSlotClash(msg.node);
+          if (f) { f->cfgHash = msg.cfgHash; followers.noteSnr(f->id, LinkRate::refSnrQ4(msg.snr, linkRate)); }
+          #ifdef ARDUINO
+          Serial.print("REQ: node "); Serial.print(msg.node); Serial.print(" -> frame "); Serial.println(followers.roundFrame);
+          #endif
+          // While broadcast ACK slots are running a reply would land on someone's slot;
+          // the node is marked stale and gets its targeted answer once the window closes
+          if ((int32_t)(nowReq - slotWindowEndMs) >= 0) answerFollower(f, nowReq);
   } else if (msg.type == Message::BRIGHTNESS) {
         brightness = msg.brightness; leds->setBrightness(brightness);
+#if LORA_RELAY
+      } else if (!isLeader && msg.type == Message::REQ) {
+        #ifdef ARDUINO
+        onRelayReq(msg, millis());
+        #endif
+#endif
   }
     }
   #ifdef ARDUINO
@@ -237,57 +486,109 @@ struct Node {
   uint32_t now = 0;
   #endif
 
-    // Follower: only request sync until first SYNC is received
-    if (!isLeader && lastSyncRecvMs == 0) {
-      if (lastReqSentMs == 0 || now - lastReqSentMs > reqInterval) {
-        comm->sendReq();
+    // Follower: send the slotted ACK once its slot opens
+    if (!isLeader && ackQueued && (int32_t)(now - ackDueMs) >= 0) {
+      comm->sendAck(ackFrame, nodeId, ackErrMs);
+      ackQueued = false;
+    }
+#if LORA_RELAY
+    if (!isLeader) tickRelay(now);
+#endif
+
+    // Follower: REQ (with our config hash) until synced and configured. Once a SYNC gave us
+    // the leader's clock, every REQ waits for this node's slot. Before that there is no
+    // shared slot grid: the first REQ waits for the leader's boot broadcast and its slots,
+    // then lands anywhere in one frame (Tdma::firstReqDelayMs), and retries back off
+    // exponentially so a fleet that powered up together spreads out instead of colliding
+    // every 2s. Only a node that restarted alone (soloRestart) sends its first REQ after
+    // the short jitter, so it rejoins within ~250 ms.
+    // A follower that has not heard the leader for LinkRate::kLinkLostMs missed a RATE
+    // change and REQs again while scanning the rates.
+    bool linkLost = !isLeader && lastLeaderMs && now - lastLeaderMs > LinkRate::kLinkLostMs;
+    if (!isLeader && (lastSyncRecvMs == 0 || !cfgKnown || linkLost)) {
+      if (reqDueMs == 0) {
+        uint32_t rnd = (uint32_t)random(0x7FFFFFFF);
+        if (lastSyncRecvMs) reqDueMs = Tdma::nextSlotStart(now, timeOffsetMs, nodeId, LinkRate::modem(linkRate));
+        else if (soloRestart) reqDueMs = now + Proto::reqBackoffMs(0, rnd);
+        else reqDueMs = now + Tdma::firstReqDelayMs(rnd, LinkRate::modem(linkRate));
+      } else if ((int32_t)(now - reqDueMs) >= 0) {
+        comm->sendReq(nodeId, followerCfgHash());
         lastReqSentMs = now;
+        soloRestart = false;
+        reqDueMs = now + Proto::reqBackoffMs(++reqAttempt, (uint32_t)random(0x7FFFFFFF));
+        if (lastSyncRecvMs) reqDueMs = Tdma::nextSlotStart(reqDueMs, timeOffsetMs, nodeId, LinkRate::modem(linkRate));
       }
     }
+#if LORA_ADR
+    if (!isLeader && (lastLeaderMs == 0 || linkLost) && now - rateSinceMs > LinkRate::scanDwellMs(linkRate)) {
+      setLinkRate(LinkRate::scanNext(linkRate), now);
+      // No boot broadcast to wait for on a scanned rung, and the old slot grid is gone
+      reqAttempt = 0; reqDueMs = now + Proto::reqBackoffMs(0, (uint32_t)random(0x7FFFFFFF));
+    }
+#endif
     
-    // Leader sync logic with ACK tracking (single in-flight frame)
+    // Leader sync logic with per-follower ACK tracking
     if (isLeader) {
-      if (!pendingAck) {
-        // No pending ACK - send sync every minute or if this is first sync
-        if (lastSyncSent == 0 || (now - lastSyncSent > syncInterval)) {
-          uint32_t currentFrame = now / 33;
+      if (!followers.roundOpen) {
+        // Round complete - send sync every minute, on first sync, or again while followers are still joining
+#if LORA_ADR
+        if (lastSyncSent != 0 && followers.roundFrame != rateRoundFrame) { rateRoundFrame = followers.roundFrame; adaptRate(now); }
+#endif
+        bool discover = followers.grewThisRound() && (int32_t)(now - slotWindowEndMs) >= 0; // after the last slot
+        bool resync = rateResyncAtMs && (int32_t)(now - rateResyncAtMs) >= 0;
+        if (lastSyncSent == 0 || (now - lastSyncSent > syncInterval) || discover || resync) {
           #ifdef ARDUINO
-          Serial.print("SYNC: new frame "); Serial.println(currentFrame);
+          Serial.print("SYNC: new frame "); Serial.println(now / 33);
           #endif
-          comm->sendSync(now, currentFrame);
-          lastSyncSent = now;
-          pendingAck = true;
-          pendingAckFrame = currentFrame;
+          broadcastRound(now, lastSyncSent == 0 || discover);
+          rateResyncAtMs = 0;
         }
-      } else {
-        // Pending ACK - on timeout, resend the SAME frame
-        if (now - lastSyncSent > ackTimeout) {
+      } else if (now - lastSyncSent > (lastSyncTargeted ? Tdma::targetedWindowMs(LinkRate::modem(linkRate)) : ackTimeout)) {
+        // Stale followers remain - resend the SAME frame. Several: broadcast it once, each answers
+        // in its slot; a targeted resend per node would take one window each.
+        uint8_t stale = followers.retryableCount();
+        if (stale > 1 && stale * Tdma::targetedWindowMs(LinkRate::modem(linkRate)) > ackTimeout &&
+            !followers.anyNeedsConfig(followerCfgHash()) && followers.retryAll()) {
           #ifdef ARDUINO
-          Serial.print("ACK timeout - resending SAME frame "); Serial.println(pendingAckFrame);
+          Serial.print("ACK timeout - rebroadcasting frame "); Serial.print(followers.roundFrame);
+          Serial.print(" for "); Serial.print(stale); Serial.println(" nodes");
           #endif
-          comm->sendSync(now, pendingAckFrame);
+          answerFollower(nullptr, now);
+          slotWindowEndMs = now + ackTimeout;
+        } else if (Fleet::Follower *f = followers.nextRetryTarget()) {
+          #ifdef ARDUINO
+          Serial.print("ACK timeout - resending frame "); Serial.print(followers.roundFrame);
+          Serial.print(" to node "); Serial.println(f->id);
+          #endif
+          answerFollower(f, now);
+        } else {
           lastSyncSent = now;
+          lastSyncTargeted = false;
         }
       }
       // Auto mode advancement
       tickAutoMode(now);
     }
     static float buf[Anim::TOTAL_LEDS];
-    // Use synced time for followers
-    uint32_t baseNow = isLeader ? now : (uint32_t)((int32_t)now + timeOffsetMs);
-    // Time in seconds (renderer applies globalSpeed from ParamSet internally)
-    float t = (baseNow / 1000.0f);
+    // Use synced time for followers, as 64-bit µs: float seconds lose ms resolution after a
+    // few hours and millis() wraps after 49.7 days (renderer applies globalSpeed internally)
+    uint64_t localUs = renderClock.extend((uint32_t)micros());
+    uint64_t tUs = isLeader ? localUs : TimeBase::synced(localUs, timeOffsetMs);
     // Render using new schema ParamSet directly
     const Anim::ParamSet &ps = isLeader ? leaderParams : followerParams;
     uint8_t aidx = isLeader ? leaderAnimIndex : followerAnimIndex;
-    Anim::applyAnim(aidx, t, Anim::TOTAL_LEDS, ps, buf);
+    static_assert(Anim::TOTAL_LEDS <= LED_RENDER_MASK_BYTES * 8, "render mask shorter than the LED count");
+    frameCache.render(aidx, tUs, Anim::TOTAL_LEDS, ps, buf, SPARKLE_SEED, LED_RENDER_MASK, &noisePlanes, &sparkDirty);
+    renderSeq++;
 
     // FPS and LED values printing every 500 ms
     framesSincePrint++;
     if (now - lastPrintMs >= 500) {
       float fps = framesSincePrint * 1000.0f / float(now - lastPrintMs);
   #ifdef ARDUINO
-  Serial.print("FPS: "); Serial.println(fps);
+  Serial.print("FPS: "); Serial.print(fps);
+  Serial.print(" cache hit "); Serial.print(frameCache.stats.hitPct()); Serial.print("% ");
+  Serial.print(frameCache.stats.bytes); Serial.println(" B");
   #endif
 
       // Map brightness to 5 levels: 0..4 -> characters from low to high
@@ -321,11 +622,18 @@ struct Node {
 
 #if defined(ARDUINO_ARCH_ESP32)
     if (isLeader && server) server->handleClient();
+    if (isLeader && wsServer) { tickWs(now); streamFrames(now, tUs, buf); }
+    prefsWb.tick(now); // at most one settings write, after the frame is out
 #endif
   }
 
   // (legacy render wrapper removed; rendering uses ParamSet directly)
 
+#if defined(ARDUINO_ARCH_ESP32)
+  static Node *&shutdownNode(){ static Node *n = nullptr; return n; }
+  static void flushOnShutdown(){ if (shutdownNode()) shutdownNode()->prefsWb.flush(); }
+#endif
+
   // --- Serial console ---
   static void cbSendSync(void* u){ Node* self = reinterpret_cast<Node*>(u); 
     #ifdef ARDUINO
@@ -333,7 +641,7 @@ struct Node {
     #else
     uint32_t now = 0;
     #endif
-    uint32_t frame = now/33; self->comm->sendSync(now, frame); }
+    self->broadcastRound(now, false); }
   
   static void cbSetBrightness(void* u, float b){ Node* self = reinterpret_cast<Node*>(u); self->brightness = constrain(b,0.0f,1.0f); self->leds->setBrightness(self->brightness); }
   static void cbApplyFollowerCfg2(void* u, uint8_t animIndex, const uint8_t* ids, const float* vals, uint8_t count){
@@ -359,66 +667,27 @@ struct Node {
   // Helper: build & send full parameter set for a role via CFG2
   void sendAllParams(uint8_t role, uint8_t animIndex, Anim::ParamSet &ps){
     // Gather ALL parameters from schema
-    const size_t MAXP = 24; // safety
-    uint8_t ids[MAXP]; float vals[MAXP]; uint8_t count=0;
-    for (size_t i=0;i<sizeof(AnimSchema::PARAMS)/sizeof(AnimSchema::PARAMS[0]); ++i){
-      AnimSchema::ParamDef pd; memcpy_P(&pd, &AnimSchema::PARAMS[i], sizeof(pd));
-      if (count < MAXP){ ids[count] = pd.id; vals[count] = Anim::getParamField(ps, pd.id); count++; }
-    }
+    uint8_t ids[AnimSchema::PARAM_COUNT]; float vals[AnimSchema::PARAM_COUNT];
+    uint8_t count = collectParams(ps, ids, vals);
     // No separate globals (all in main list)
     comm->sendAnimCfg2(role, animIndex, ids, vals, count, nullptr, nullptr, 0);
   }
 
-  void applyFavoriteToBoth(uint8_t favId){
-    // Load favorite JSON from prefs and apply via cfg2-like path to both leader and follower
-    String key = String("fav_") + String(favId);
-    String cfg = prefs.getString(key.c_str(), "");
-    if (cfg.length()==0) return;
-    // Parse animIndex for leader and follower and param arrays; use a simple pattern-based parser
-    auto findNum=[&](const String &s, const char* key, float defv)->float{
-      int idx = s.indexOf(key); if (idx<0) return defv; idx = s.indexOf(':', idx); if (idx<0) return defv; idx++; while (idx<(int)s.length() && s[idx]==' ') idx++; int end=idx; while (end<(int)s.length() && ( (s[end]>='0'&&s[end]<='9') || s[end]=='-' || s[end]=='+' || s[end]=='.')) end++; return s.substring(idx,end).toFloat(); };
-    uint8_t L_anim = (uint8_t)findNum(cfg, "\"leader\"\s*:\s*\{[\\s\\S]*?\"animIndex\"", leaderAnimIndex); // fallback approach below
-    // Fallback simple: find first "leader" then its animIndex
-    int lPos = cfg.indexOf("\"leader\"");
-    if (lPos>=0){ int aPos = cfg.indexOf("\"animIndex\"", lPos); if (aPos>=0){ int c = cfg.indexOf(':', aPos); if (c>=0){ int st=c+1; while (st<(int)cfg.length() && cfg[st]==' ') st++; int en=st; while (en<(int)cfg.length() && isdigit(cfg[en])) en++; L_anim = (uint8_t)cfg.substring(st,en).toInt(); } } }
-    int fPos = cfg.indexOf("\"follower\""); uint8_t F_anim = followerAnimIndex; if (fPos>=0){ int aPos = cfg.indexOf("\"animIndex\"", fPos); if (aPos>=0){ int c = cfg.indexOf(':', aPos); if (c>=0){ int st=c+1; while (st<(int)cfg.length() && cfg[st]==' ') st++; int en=st; while (en<(int)cfg.length() && isdigit(cfg[en])) en++; F_anim = (uint8_t)cfg.substring(st,en).toInt(); } } }
-    // Fill by scanning all id/value pairs inside leader and follower blocks separately
-    auto fillParams = [&](const char* blockName, Anim::ParamSet &ps){
-      int bpos = cfg.indexOf(blockName); if (bpos<0) return; int brace = cfg.indexOf('{', bpos); if (brace<0) return; int endBlock = cfg.indexOf('}', brace); if (endBlock<0) endBlock = cfg.length();
-      int pos=brace; int safety=0; while (pos<endBlock && safety<128){
-        int idKey = cfg.indexOf("\"id\"", pos); if (idKey<0 || idKey>=endBlock) break; int colon = cfg.indexOf(':', idKey); if (colon<0) break; int idStart=colon+1; while (idStart<endBlock && cfg[idStart]==' ') idStart++; int idEnd=idStart; while (idEnd<endBlock && isdigit(cfg[idEnd])) idEnd++; uint8_t pid=(uint8_t)cfg.substring(idStart,idEnd).toInt();
-        int vKey = cfg.indexOf("\"value\"", idEnd); if (vKey<0 || vKey>=endBlock) { pos = idEnd; safety++; continue; } colon = cfg.indexOf(':', vKey); if (colon<0) break; int vStart=colon+1; while (vStart<endBlock && cfg[vStart]==' ') vStart++; int vEnd=vStart; while (vEnd<endBlock && ( (cfg[vEnd]>='0'&&cfg[vEnd]<='9') || cfg[vEnd]=='-' || cfg[vEnd]=='+' || cfg[vEnd]=='.')) vEnd++; float v = cfg.substring(vStart,vEnd).toFloat();
-        Anim::setParamField(ps, pid, v);
-        pos = vEnd; safety++;
-      }
-    };
-    fillParams("\"leader\"", leaderParams);
-    fillParams("\"follower\"", followerParams);
-
-    // Parse optional globals and apply ONLY globalSpeed (min/max intentionally ignored)
-    auto findNumInRange = [&](int start, int end, const char* key, bool &found, float &out){
-      found = false; out = 0.0f; if (start<0 || end<=start) return; int k = cfg.indexOf(key, start); if (k<0 || k>=end) return; int c = cfg.indexOf(':', k); if (c<0 || c>=end) return; int st=c+1; while (st<end && cfg[st]==' ') st++; int en=st; while (en<end && ((cfg[en]>='0'&&cfg[en]<='9') || cfg[en]=='-' || cfg[en]=='+' || cfg[en]=='.')) en++; out = cfg.substring(st,en).toFloat(); found = true; };
-    int gpos = cfg.indexOf("\"globals\"");
-    if (gpos>=0){
-      int gl = cfg.indexOf('{', gpos);
-      int gr = cfg.indexOf('}', gl);
-      if (gl>=0 && gr>gl){
-        bool hs=false; float vs=0;
-        findNumInRange(gl, gr, "\"globalSpeed\"", hs, vs);
-        if (hs){ Anim::setParamField(leaderParams, AnimSchema::PID_GLOBAL_SPEED, vs); Anim::setParamField(followerParams, AnimSchema::PID_GLOBAL_SPEED, vs); }
-        // NOTE: we intentionally ignore globalMin/globalMax in favorites to avoid overriding user settings
-      }
-    }
-
-    leaderAnimIndex = L_anim; followerAnimIndex = F_anim;
+  void applyFavoriteToBoth(uint16_t favId){
+    // Decoded favorite from the cache (flash is read only on a miss), applied to both roles.
+    // Of the globals ONLY globalSpeed is applied (min/max intentionally ignored to avoid overriding user settings)
+    const FavStore::Entry *fav = favCache.get(favId);
+    if (!fav) return;
+    fav->apply(0, leaderParams, leaderAnimIndex);
+    fav->apply(1, followerParams, followerAnimIndex);
     // Update globals mirrors from leader params
     globalSpeed = leaderParams.globalSpeed; globalMin = leaderParams.globalMin; globalMax = leaderParams.globalMax;
 #if defined(ARDUINO_ARCH_ESP32)
     // Persist global min/max if changed significantly
     auto fabsf_local = [](float x){ return x < 0 ? -x : x; };
     if (fabsf_local(globalMin - lastSavedGMin) > 0.001f || fabsf_local(globalMax - lastSavedGMax) > 0.001f) {
-      prefs.putFloat("gmin", globalMin);
-      prefs.putFloat("gmax", globalMax);
+      prefsWb.putFloat("gmin", globalMin);
+      prefsWb.putFloat("gmax", globalMax);
       lastSavedGMin = globalMin; lastSavedGMax = globalMax;
     }
 #endif
@@ -429,109 +698,93 @@ struct Node {
   void tickAutoMode(uint32_t nowMs){
     if (!autoOn) return;
     if (autoSelCount == 0) { autoOn = false; return; }
-    if (autoIdx < 0 || (nowMs - autoLastMs) >= (uint32_t)autoIntervalSec*1000u){
-      // advance index
+    uint32_t dur = (uint32_t)autoIntervalSec*1000u, elapsed = nowMs - autoLastMs;
+    bool due = autoIdx < 0 || elapsed >= dur;
+    // Pick and decode the next favorite AUTO_PREFETCH_MS ahead, so the switch reads no flash
+    if (autoNext < 0 && (due || elapsed + AUTO_PREFETCH_MS >= dur)){
       if (autoRandom){
         // simple random choice different from previous when possible
         uint8_t newi = (uint8_t)random(0, autoSelCount);
         if (autoSelCount > 1 && autoIdx>=0 && newi == (uint8_t)autoIdx){ newi = (newi + 1) % autoSelCount; }
-        autoIdx = (int8_t)newi;
+        autoNext = (int8_t)newi;
       } else {
-        autoIdx = (autoIdx < 0) ? 0 : ((autoIdx + 1) % autoSelCount);
+        autoNext = (autoIdx < 0) ? 0 : ((autoIdx + 1) % autoSelCount);
       }
+      favCache.prefetch(autoSel[(uint8_t)autoNext]);
+    }
+    if (due){
+      autoIdx = autoNext; autoNext = -1;
       autoLastMs = nowMs;
       // Apply selected favorite to both
-      uint8_t favId = autoSel[(uint8_t)autoIdx];
-      applyFavoriteToBoth(favId);
+      applyFavoriteToBoth(autoSel[(uint8_t)autoIdx]);
       // Persist progress
-      prefs.putChar("auto_idx", autoIdx);
-      prefs.putULong("auto_last", autoLastMs);
+      prefsWb.putChar("auto_idx", autoIdx);
+      prefsWb.putULong("auto_last", autoLastMs);
     }
   }
 
   // --- Favorites (leader only) ---
-  String extractNameFromJson(const String &js){
-    int idx = js.indexOf("\"name\"");
-    if (idx<0) return String("favorite");
-    idx = js.indexOf(':', idx); if (idx<0) return String("favorite"); idx++;
-    while (idx < (int)js.length() && (js[idx]==' ')) idx++;
-    if (idx < (int)js.length() && js[idx]=='\"'){
-      int end = js.indexOf('"', idx+1);
-      if (end>idx) return js.substring(idx+1, end);
-    }
-    // Fallback: number or bare
-    int end = idx; while (end<(int)js.length() && js[end]!=',' && js[end] != '}' && js[end] != '\n') end++;
-    return js.substring(idx,end);
+  // Stored name of a favorite, "" if there is none
+  String favoriteName(uint16_t id){
+    const FavStore::Entry *fav = favCache.get(id);
+    return fav ? String(fav->name) : String("");
   }
 
   void serveFavorites(){
-    uint8_t count = prefs.getUChar("fav_count", 0);
-    String j = "{\"items\":[";
-    for(uint8_t i=0;i<count;i++){
-      if (i) j += ',';
-      String key = String("fav_") + String(i);
-      String cfg = prefs.getString(key.c_str(), "{}");
-      String nm = extractNameFromJson(cfg);
-      j += "{\"id\":" + String(i) + ",\"name\":\"" + nm + "\",\"cfg\":" + cfg + "}";
+    const uint16_t *ids = favCache.ids();
+    uint16_t count = favCache.count();
+    beginJsonResponse();
+    Json::Writer<> w(&sendJsonChunk, server);
+    w.beginObject().key("items").beginArray();
+    // One stored favorite in RAM at a time
+    for(uint16_t i=0;i<count;i++){
+      FavStore::Favorite fav;
+      if (!favs.load(ids[i], fav)) continue;
+      w.beginObject().key("id").num((unsigned)ids[i]).key("name").rawStr(fav.name, fav.nameLen).key("cfg");
+      FavStore::writeJson(w, fav);
+      w.endObject();
     }
-    j += "]}";
-    server->send(200, "application/json", j);
+    w.endArray().endObject();
+    endJsonResponse(w);
   }
 
   void handleFavAdd(){
     String body = server->arg("plain");
-    uint8_t count = prefs.getUChar("fav_count", 0);
-    String key = String("fav_") + String(count);
-    prefs.putString(key.c_str(), body);
-    prefs.putUChar("fav_count", (uint8_t)(count+1));
-    server->send(200, "application/json", "{\"ok\":true,\"id\":" + String(count) + "}");
+    FavStore::Favorite fav;
+    if (!FavStore::fromJson(body.c_str(), body.length(), fav)) { server->send(400, "application/json", "{\"ok\":false,\"error\":\"bad json\"}"); return; }
+    int32_t id = favCache.add(fav);
+    if (id < 0) { server->send(400, "application/json", "{\"ok\":false,\"error\":\"favorites full\"}"); return; }
+    server->send(200, "application/json", "{\"ok\":true,\"id\":" + String(id) + "}");
   }
 
   void handleFavDelete(){
     // Accept id either as query arg or in JSON body {id:n}
-    int id = -1;
+    long id = -1;
     if (server->hasArg("id")) { id = server->arg("id").toInt(); }
     if (id < 0) {
       String body = server->arg("plain");
-      int idx = body.indexOf("\"id\"");
-      if (idx >= 0) { idx = body.indexOf(':', idx); if (idx>=0){ idx++; while (idx<(int)body.length() && body[idx]==' ') idx++; int end=idx; while (end<(int)body.length() && isdigit(body[end])) end++; id = body.substring(idx,end).toInt(); } }
-    }
-    uint8_t count = prefs.getUChar("fav_count", 0);
-    if (id < 0 || id >= count) { server->send(400, "application/json", "{\"ok\":false,\"error\":\"bad id\"}"); return; }
-    // Shift entries down from id+1 .. count-1
-    for (int i=id; i<(int)count-1; ++i){
-      String srcKey = String("fav_") + String(i+1);
-      String dstKey = String("fav_") + String(i);
-      String val = prefs.getString(srcKey.c_str(), "{}");
-      prefs.putString(dstKey.c_str(), val);
-    }
-    // Remove last
-    String lastKey = String("fav_") + String(count-1);
-    #if ESP_IDF_VERSION_MAJOR >= 4 || defined(ESP_ARDUINO_VERSION)
-    prefs.remove(lastKey.c_str());
-    #else
-    prefs.putString(lastKey.c_str(), "");
-    #endif
-    prefs.putUChar("fav_count", (uint8_t)(count-1));
-    // Remap auto selections: drop deleted id and decrement higher ones
+      Json::Doc<8> doc(body.c_str(), body.length());
+      id = doc.integer(doc.get(0, "id"), -1);
+    }
+    // Ids are stable: the index drops this one and its record goes, nothing else is rewritten
+    if (id < 0 || id > FavStore::MAX_ID || !favCache.remove((uint16_t)id)) { server->send(400, "application/json", "{\"ok\":false,\"error\":\"bad id\"}"); return; }
+    // Drop the deleted id from auto selections
     if (autoSelCount>0){
-      uint8_t out[kMaxAutoSel]; uint8_t outCount=0;
-      for (uint8_t i=0;i<autoSelCount;i++){
-        uint8_t v = autoSel[i];
-        if (v == id) continue; // drop
-        if (v > id) v = v - 1; // shift
-        if (outCount < kMaxAutoSel) out[outCount++] = v;
+      uint8_t outCount=0;
+      for (uint8_t i=0;i<autoSelCount;i++) if (autoSel[i] != id) autoSel[outCount++] = autoSel[i];
+      if (outCount != autoSelCount){
+        autoSelCount = outCount;
+        // Clamp autoIdx
+        if (autoSelCount==0){ autoOn=false; autoIdx=-1; }
+        else if (autoIdx >= (int8_t)autoSelCount) autoIdx = autoSelCount-1;
+        // Persist updated selections
+        String s=""; for(uint8_t i=0;i<autoSelCount;i++){ if(i) s+=","; s+=String(autoSel[i]); }
+        prefsWb.putString("auto_sel", s.c_str());
+        prefsWb.putChar("auto_idx", autoIdx);
       }
-      for (uint8_t i=0;i<outCount;i++) autoSel[i]=out[i];
-      autoSelCount = outCount;
-      // Clamp autoIdx
-      if (autoSelCount==0){ autoOn=false; autoIdx=-1; }
-      else if (autoIdx >= (int8_t)autoSelCount) autoIdx = autoSelCount-1;
-      // Persist updated selections
-      String s=""; for(uint8_t i=0;i<autoSelCount;i++){ if(i) s+=","; s+=String(autoSel[i]); }
-      prefs.putString("auto_sel", s);
-      prefs.putChar("auto_idx", autoIdx);
     }
+    if (id == wsNameId) wsNameId = -2;
+    autoNext = -1;
     server->send(200, "application/json", "{\"ok\":true}");
   }
 
@@ -545,6 +798,8 @@ struct Node {
     Serial.print("AP start: "); Serial.println(ok ? "OK" : "FAIL");
     Serial.print("AP IP: "); Serial.println(WiFi.softAPIP());
 
+  static const char *kIndexHeaders[] = { "If-None-Match", "Accept-Encoding" };
+  server->collectHeaders(kIndexHeaders, 2);
   server->on("/", HTTP_GET, [this]() { serveIndex(); });
   server->on("/api/state", HTTP_GET, [this]() { serveState(); });
   server->on("/api/apply", HTTP_POST, [this]() { handleApply(); }); // legacy form
@@ -559,16 +814,150 @@ struct Node {
   server->on("/api/auto/stop", HTTP_POST, [this]() { handleAutoStop(); });
   // Globals-only update (does not stop Auto)
   server->on("/api/globals", HTTP_POST, [this]() { handleGlobals(); });
+  // Follower registry (read-only)
+  server->on("/api/followers", HTTP_GET, [this]() { serveFollowers(); });
     server->begin();
+    static WiFiServer ws(WS_PORT);
+    wsServer = &ws;
+    wsServer->begin();
   }
 
+  // --- WebSocket push (ws_push.h) ---
+  void wsSnapshot(Ws::Snapshot &s, uint32_t now){
+    s.autoOn = autoOn && autoSelCount > 0 && autoIdx >= 0 && autoIdx < (int8_t)autoSelCount;
+    s.autoId = s.autoOn ? autoSel[(uint8_t)autoIdx] : -1;
+    s.autoMark = autoLastMs; s.intervalSec = autoIntervalSec;
+    uint32_t elapsed = now - autoLastMs, dur = (uint32_t)autoIntervalSec * 1000u;
+    s.remaining = s.autoOn && elapsed < dur ? (dur - elapsed) / 1000u : 0;
+    if (s.autoId != wsNameId) { // one prefs read per favorite switch
+      wsName = s.autoId >= 0 ? favoriteName((uint16_t)s.autoId) : String("");
+      wsNameId = s.autoId;
+    }
+    s.setName(wsName.c_str(), wsName.length());
+    s.anim[Ws::LEADER] = leaderAnimIndex; s.anim[Ws::FOLLOWER] = followerAnimIndex;
+    s.params[Ws::LEADER] = leaderParams; s.params[Ws::FOLLOWER] = followerParams;
+  }
+  void wsClose(WsSlot &sl){ sl.client.stop(); sl.used = sl.open = false; sl.stream = LedStream::Subscription(); sl.out = LedStream::Outbox(); }
+  // Blocking write for pushes; a LED frame still in flight goes out first so messages stay whole
+  void wsSend(WsSlot &sl, const uint8_t *data, size_t len){
+    if (sl.out.busy()) {
+      size_t rest = sl.out.len - sl.out.off;
+      if (sl.client.write(sl.out.buf + sl.out.off, rest) != rest) { wsClose(sl); return; }
+      sl.out = LedStream::Outbox();
+    }
+    if (sl.client.write(data, len) != len) wsClose(sl);
+  }
+  void wsSendText(WsSlot &sl, const char *text){
+    uint8_t h[10]; size_t n = strlen(text), hl = Ws::frameHeader(Ws::OP_TEXT, n, h);
+    wsSend(sl, h, hl); if (sl.used) wsSend(sl, (const uint8_t *)text, n);
+  }
+  static int wsTrySend(void *u, const uint8_t *d, size_t n){
+    int r = ::send(static_cast<WsSlot *>(u)->client.fd(), d, n, MSG_DONTWAIT);
+    if (r < 0) return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    return r;
+  }
+  // {"frames":fps,"roles":mask} from a push socket; answers with the granted rate
+  void wsSubscribe(WsSlot &sl, const char *js, size_t len, uint32_t now){
+    Json::Doc<8> doc(js, len);
+    if (!doc.ok() || doc.get(0, "frames") < 0) return;
+    uint8_t fps = sl.stream.subscribe(doc.integer(doc.get(0, "frames"), 0), doc.integer(doc.get(0, "roles"), LedStream::WANT_LEADER), now);
+    char reply[48];
+    snprintf(reply, sizeof(reply), "{\"frames\":%u,\"roles\":%u,\"leds\":%u}", fps, sl.stream.roles, (unsigned)Anim::TOTAL_LEDS);
+    wsSendText(sl, reply);
+  }
+  // Due frames to subscribed sockets without blocking; the follower role is rendered here from
+  // followerParams on the shared clock, only when someone asked for it
+  void streamFrames(uint32_t now, uint64_t tUs, const float *leaderBuf){
+    static_assert(Anim::TOTAL_LEDS <= LED_STREAM_MAX_LEDS, "LED_STREAM_MAX_LEDS below the LED count");
+    static float followerBuf[Anim::TOTAL_LEDS];
+    bool followerReady = false;
+    for (WsSlot &sl : wsSlots) {
+      if (!sl.used || !sl.open || !sl.stream.due(now)) continue;
+      for (uint8_t role = LedStream::ROLE_LEADER; role <= LedStream::ROLE_FOLLOWER && sl.used; ++role) {
+        if (!(sl.stream.roles & (1u << role))) continue;
+        if (role == LedStream::ROLE_FOLLOWER && !followerReady) {
+          Anim::applyAnim(followerAnimIndex, tUs, Anim::TOTAL_LEDS, followerParams, followerBuf, SPARKLE_SEED, LED_RENDER_MASK, nullptr, &followerSparkDirty);
+          followerReady = true;
+        }
+        uint8_t msg[10 + LedStream::MAX_FRAME];
+        size_t h = Ws::frameHeader(Ws::OP_BINARY, LedStream::HEADER + Anim::TOTAL_LEDS, msg);
+        size_t n = LedStream::encode(msg + h, sizeof(msg) - h, role, renderSeq, (uint32_t)(tUs / 1000u), role ? followerBuf : leaderBuf, Anim::TOTAL_LEDS);
+        switch (sl.out.offer(msg, h + n, &wsTrySend, &sl)) {
+          case LedStream::Outbox::SENT: sl.stream.sent++; break;
+          case LedStream::Outbox::SKIPPED: sl.stream.skipped++; break;
+          case LedStream::Outbox::FAILED: wsClose(sl); break;
+        }
+      }
+    }
+  }
+  void tickWs(uint32_t now){
+    WiFiClient c = wsServer->available();
+    if (c) {
+      WsSlot *free = nullptr;
+      for (WsSlot &sl : wsSlots) if (!sl.used) { free = &sl; break; }
+      if (free) { free->client = c; free->used = true; free->open = false; free->len = 0; free->sinceMs = now; free->client.setNoDelay(true); }
+      else c.stop();
+    }
+    for (WsSlot &sl : wsSlots) {
+      if (!sl.used) continue;
+      if (!sl.client.connected()) { wsClose(sl); continue; }
+      while (sl.client.available() > 0 && sl.len < sizeof(sl.buf)) sl.buf[sl.len++] = (uint8_t)sl.client.read();
+      if (!sl.open) {
+        // Handshake: the whole request head must arrive within a second and fit the buffer
+        const char *head = (const char *)sl.buf;
+        bool complete = false;
+        for (uint16_t i = 3; i < sl.len && !complete; ++i) complete = head[i] == '\n' && head[i - 1] == '\r' && head[i - 2] == '\n';
+        if (!complete) { if (sl.len == sizeof(sl.buf) || now - sl.sinceMs > 1000) { sl.client.stop(); sl.used = false; } continue; }
+        char resp[160];
+        size_t n = Ws::handshake(head, sl.len, resp, sizeof(resp));
+        if (!n) { sl.client.write((const uint8_t *)"HTTP/1.1 400 Bad Request\r\n\r\n", 28); sl.client.stop(); sl.used = false; continue; }
+        sl.client.write((const uint8_t *)resp, n);
+        sl.open = true; sl.len = 0;
+        Ws::Snapshot cur; wsSnapshot(cur, now);
+        Ws::buildPush(wsMsg, nullptr, cur);
+        size_t fl; const uint8_t *f = wsMsg.frame(fl);
+        wsSend(sl, f, fl);
+        continue;
+      }
+      // Client frames: answer ping, honour close, ignore the rest
+      Ws::Frame fr;
+      size_t used;
+      while (sl.open && (used = Ws::parseFrame(sl.buf, sl.len, fr)) != 0) {
+        if (used == Ws::BAD_FRAME || fr.op == Ws::OP_CLOSE) { wsClose(sl); break; }
+        if (fr.op == Ws::OP_PING && fr.len <= 125) { uint8_t h[10]; size_t hl = Ws::frameHeader(Ws::OP_PONG, fr.len, h); wsSend(sl, h, hl); if (sl.used) wsSend(sl, fr.payload, fr.len); }
+        if (fr.op == Ws::OP_TEXT && fr.fin) wsSubscribe(sl, (const char *)fr.payload, fr.len, now);
+        if (!sl.used) break;
+        memmove(sl.buf, sl.buf + used, sl.len - used); sl.len -= (uint16_t)used;
+      }
+      if (sl.open && sl.len == sizeof(sl.buf)) wsClose(sl); // oversized frame
+    }
+    if (now - wsLastPushMs < WS_PUSH_MS) return;
+    wsLastPushMs = now;
+    Ws::Snapshot cur; wsSnapshot(cur, now);
+    if (Ws::buildPush(wsMsg, &wsLast, cur)) {
+      size_t fl; const uint8_t *f = wsMsg.frame(fl);
+      for (WsSlot &sl : wsSlots) if (sl.used && sl.open) wsSend(sl, f, fl);
+    }
+    wsLast = cur;
+  }
+
+ // Page pre-built by test-ui/gen_index_gz (web_ui_gz.h): gzip bytes straight from flash, and
+ // 304 while the browser's copy is current. Clients without gzip get the PROGMEM parts chunked.
  void serveIndex() {
-  String fullHtml;
-  fullHtml.reserve(4096); // Pre-allocate to avoid reallocs
-  fullHtml += FPSTR(INDEX_HTML_PREFIX);
-  fullHtml += FPSTR(ANIM_SCHEMA_JSON);
-  fullHtml += FPSTR(INDEX_HTML_SUFFIX);
-  server->send(200, "text/html; charset=utf-8", fullHtml);
+  server->sendHeader("ETag", INDEX_HTML_ETAG);
+  server->sendHeader("Cache-Control", "no-cache"); // revalidate each load, served as 304
+  if (server->header("If-None-Match") == INDEX_HTML_ETAG) { server->send(304); return; }
+  if (server->header("Accept-Encoding").indexOf("gzip") >= 0) {
+    server->sendHeader("Content-Encoding", "gzip");
+    server->send_P(200, "text/html; charset=utf-8", (const char *)INDEX_HTML_GZ, INDEX_HTML_GZ_LEN);
+    return;
+  }
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(200, "text/html; charset=utf-8", "");
+  server->sendContent_P(INDEX_HTML_PREFIX, sizeof(INDEX_HTML_PREFIX) - 1);
+  server->sendContent_P(ANIM_SCHEMA_JSON, sizeof(ANIM_SCHEMA_JSON) - 1);
+  server->sendContent_P(INDEX_HTML_SUFFIX, sizeof(INDEX_HTML_SUFFIX) - 1);
+  server->sendContent(""); // last chunk
  }
 
   // --- Auto endpoints ---
@@ -582,50 +971,51 @@ struct Node {
     #endif
     if (autoOn && autoSelCount>0 && autoIdx>=0 && autoIdx < (int8_t)autoSelCount){
       curId = autoSel[(uint8_t)autoIdx];
-      String key = String("fav_") + String(curId);
-      String cfg = prefs.getString(key.c_str(), "");
-      curName = extractNameFromJson(cfg);
+      curName = favoriteName((uint16_t)curId);
       if (now >= autoLastMs) {
         uint32_t elapsed = now - autoLastMs;
         uint32_t dur = (uint32_t)autoIntervalSec * 1000u;
         if (elapsed < dur) remaining = (dur - elapsed)/1000u; else remaining = 0;
       }
     }
-    // selections as JSON array
-    String selJson="["; for(uint8_t i=0;i<autoSelCount;i++){ if(i) selJson += ","; selJson += String(autoSel[i]); } selJson += "]";
-    String j = "{";
-    j += "\"on\":" + String(autoOn?"true":"false") + ",";
-    j += "\"interval\":" + String((int)(autoIntervalSec/60)) + ",";
-    j += "\"random\":" + String(autoRandom?"true":"false") + ",";
-    j += "\"selections\":" + selJson + ",";
-    j += "\"current\":{\"name\":\"" + curName + "\",\"id\":" + String(curId) + ",\"remaining\":" + String((int)remaining) + "}";
-    j += "}";
-    server->send(200, "application/json", j);
+    beginJsonResponse();
+    Json::Writer<> w(&sendJsonChunk, server);
+    w.beginObject();
+    w.key("on").boolean(autoOn);
+    w.key("interval").num((int)(autoIntervalSec/60));
+    w.key("random").boolean(autoRandom);
+    w.key("selections").beginArray();
+    for(uint8_t i=0;i<autoSelCount;i++) w.num(autoSel[i]);
+    w.endArray();
+    w.key("current").beginObject().key("name").rawStr(curName.c_str(), curName.length()).key("id").num(curId).key("remaining").num((int)remaining).endObject();
+    w.endObject();
+    endJsonResponse(w);
   }
 
   void handleAutoSettings(){
     String body = server->arg("plain");
-    // parse interval
-    auto extractNum=[&](const char *key, int defv)->int{
-      int idx = body.indexOf(key); if (idx<0) return defv; idx = body.indexOf(':', idx); if (idx<0) return defv; idx++; while (idx<(int)body.length() && body[idx]==' ') idx++; int end=idx; while (end<(int)body.length() && isdigit(body[end])) end++; return body.substring(idx,end).toInt(); };
-    auto extractBool=[&](const char *key, bool defv)->bool{
-      int idx = body.indexOf(key); if (idx<0) return defv; idx = body.indexOf(':', idx); if (idx<0) return defv; idx++; while (idx<(int)body.length() && (body[idx]==' ')) idx++; if (body.startsWith("true", idx)) return true; if (body.startsWith("false", idx)) return false; return defv; };
+    Json::Doc<> doc(body.c_str(), body.length());
+    if (!doc.ok()) { server->send(400, "application/json", "{\"ok\":false,\"error\":\"bad json\"}"); return; }
     // Treat incoming interval as minutes, store seconds
     {
-      int ivMin = extractNum("\"interval\"", autoIntervalSec/60);
+      long ivMin = doc.integer(doc.get(0, "interval"), autoIntervalSec/60);
       if (ivMin < 1) ivMin = 1;
       autoIntervalSec = (uint16_t)(ivMin * 60);
     }
-    autoRandom = extractBool("\"random\"", autoRandom);
-    // parse selections array
+    autoRandom = doc.boolean(doc.get(0, "random"), autoRandom);
+    // selections array
     autoSelCount = 0;
-    int sidx = body.indexOf("\"selections\"");
-    if (sidx>=0){ int lb = body.indexOf('[', sidx); int rb = body.indexOf(']', lb); if (lb>=0 && rb>lb){ int pos=lb+1; while (pos<rb && autoSelCount<kMaxAutoSel){ while (pos<rb && (body[pos]==' '||body[pos]==',')) pos++; int start=pos; while (pos<rb && isdigit(body[pos])) pos++; if (pos>start){ int v = body.substring(start,pos).toInt(); if (v>=0 && v<=255) autoSel[autoSelCount++] = (uint8_t)v; } while (pos<rb && body[pos]!=',' ) pos++; } } }
+    int sel = doc.get(0, "selections");
+    for (int i = doc.first(sel); i >= 0 && autoSelCount < kMaxAutoSel; i = doc.next(sel, i)){
+      long v = doc.integer(i, -1);
+      if (v>=0 && v<=FavStore::MAX_ID) autoSel[autoSelCount++] = (uint16_t)v;
+    }
     // persist
-    prefs.putUShort("auto_iv", autoIntervalSec);
-    prefs.putBool("auto_rand", autoRandom);
+    prefsWb.putUShort("auto_iv", autoIntervalSec);
+    prefsWb.putBool("auto_rand", autoRandom);
     String s=""; for(uint8_t i=0;i<autoSelCount;i++){ if(i) s+=","; s+=String(autoSel[i]); }
-    prefs.putString("auto_sel", s);
+    prefsWb.putString("auto_sel", s.c_str());
+    autoNext = -1;
     server->send(200, "application/json", "{\"ok\":true}");
   }
 
@@ -654,23 +1044,23 @@ struct Node {
     uint32_t now = 0;
     #endif
     autoLastMs = now;
+    autoNext = -1;
     applyFavoriteToBoth(autoSel[(uint8_t)autoIdx]);
-    prefs.putBool("auto_on", true);
-    prefs.putChar("auto_idx", autoIdx);
-    prefs.putULong("auto_last", autoLastMs);
+    prefsWb.putBool("auto_on", true);
+    prefsWb.putChar("auto_idx", autoIdx);
+    prefsWb.putULong("auto_last", autoLastMs);
     server->send(200, "application/json", "{\"ok\":true}");
   }
 
   void handleAutoStop(){
     autoOn = false;
-    prefs.putBool("auto_on", false);
+    prefsWb.putBool("auto_on", false);
     server->send(200, "application/json", "{\"ok\":true}");
   }
 
 
 
   void serveState() {  
-    String j = "{";
     // Auto flags for UI convenience
     #ifdef ARDUINO
     uint32_t now = millis();
@@ -685,67 +1075,91 @@ struct Node {
         if (elapsed < dur) remaining = (dur - elapsed)/1000u; else remaining = 0;
       }
     }
-    j += "\"autoOn\":" + String(autoOn?"true":"false") + ",";
-    j += "\"autoRemaining\":" + String((int)remaining) + ",";
-    // Leader: dynamic only
-    j += "\"leader\":{";
-    j += "\"animIndex\":" + String(leaderAnimIndex) + ",";
-    j += "\"params\":[";
-    for (size_t i=0;i<sizeof(AnimSchema::PARAMS)/sizeof(AnimSchema::PARAMS[0]); ++i){
-      AnimSchema::ParamDef pd; memcpy_P(&pd, &AnimSchema::PARAMS[i], sizeof(pd));
-      if (i) j += ',';
-      j += '{';
-      j += "\"id\":" + String(pd.id) + ",\"value\":" + String(Anim::getParamField(leaderParams, pd.id), 5);
-      j += '}';
-    }
-    j += "]},";
-    // Follower: dynamic only
-    j += "\"follower\":{";
-    j += "\"animIndex\":" + String(followerAnimIndex) + ",";
-    j += "\"params\":[";
+    beginJsonResponse();
+    Json::Writer<> w(&sendJsonChunk, server);
+    w.beginObject();
+    w.key("autoOn").boolean(autoOn);
+    w.key("autoRemaining").num((int)remaining);
+    // Leader/follower: dynamic only
+    writeRoleState(w, "leader", leaderAnimIndex, leaderParams);
+    writeRoleState(w, "follower", followerAnimIndex, followerParams);
+    // Render frame cache (frame_cache.h)
+    const FrameCache::Stats &cs = frameCache.stats;
+    w.key("frameCache").beginObject();
+    w.key("hits").num(cs.hits).key("misses").num(cs.misses).key("bypass").num(cs.bypass);
+    w.key("hitPct").num(cs.hitPct()).key("frames").num(cs.frames).key("bytes").num(cs.bytes);
+    w.key("budget").num((uint32_t)FRAME_CACHE_BYTES).endObject();
+    // Settings write-back (prefs_writeback.h)
+    const PrefsWb::Stats &ns = prefsWb.stats;
+    w.key("nvs").beginObject();
+    w.key("puts").num(ns.puts).key("writes").num(ns.writes).key("merged").num(ns.merged).key("unchanged").num(ns.unchanged);
+    w.key("direct").num(ns.direct).key("failed").num(ns.failed).key("pending").num(prefsWb.pending());
+    w.key("lastWriteUs").num(ns.lastWriteUs).key("maxWriteUs").num(ns.maxWriteUs).key("totalWriteUs").num(ns.totalWriteUs).endObject();
+    w.endObject();
+    endJsonResponse(w);
+  }
+
+  void writeRoleState(Json::Writer<> &w, const char *role, uint8_t animIndex, const Anim::ParamSet &ps){
+    w.key(role).beginObject();
+    w.key("animIndex").num(animIndex);
+    w.key("params").beginArray();
     for (size_t i=0;i<sizeof(AnimSchema::PARAMS)/sizeof(AnimSchema::PARAMS[0]); ++i){
       AnimSchema::ParamDef pd; memcpy_P(&pd, &AnimSchema::PARAMS[i], sizeof(pd));
-      if (i) j += ',';
-      j += '{';
-      j += "\"id\":" + String(pd.id) + ",\"value\":" + String(Anim::getParamField(followerParams, pd.id), 5);
-      j += '}';
+      w.beginObject().key("id").num(pd.id).key("value").num(Anim::getParamField(ps, pd.id), 5).endObject();
     }
-    j += "]}";
-    j += "}";
-    server->send(200, "application/json", j);
+    w.endArray().endObject();
+  }
+
+  // Chunked JSON responses: headers first, then the body in JSON_CHUNK_BYTES pieces, so heap
+  // use does not grow with the response
+  static void sendJsonChunk(void *user, const char *data, size_t len){ static_cast<WebServer*>(user)->sendContent(data, len); }
+  void beginJsonResponse(){
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/json", "");
+  }
+  void endJsonResponse(Json::Writer<> &w){
+    w.flush();
+    server->sendContent(""); // last chunk
   }
 
 
+  // Known followers with their last ACK / clock error / link quality
+  void serveFollowers() {
+    uint32_t now = millis();
+    beginJsonResponse();
+    Json::Writer<> w(&sendJsonChunk, server);
+    w.beginObject();
+    w.key("frame").num(followers.roundFrame).key("pending").num(followers.pendingCount());
+    w.key("slotClashes").num(followers.slotClashCount());
+    w.key("sf").num(LinkRate::modem(linkRate).sf).key("bwKHz").num(LinkRate::modem(linkRate).bwHz / 1000);
+    w.key("items").beginArray();
+    for (uint8_t i=0;i<followers.count;i++){
+      const Fleet::Follower &f = followers.nodes[i];
+      w.beginObject();
+      w.key("id").num(f.id).key("slot").num(Tdma::slotFor(f.id)).key("slotPeer").num(followers.slotPeer(f));
+      w.key("acked").boolean(!followers.isStale(f));
+      w.key("lastAckAgoMs").num(f.lastAckMs ? (long)(int32_t)(now - f.lastAckMs) : -1L);
+      w.key("lastSeenAgoMs").num((long)(int32_t)(now - f.lastSeenMs));
+      w.key("offsetErrMs").num(f.offsetErrMs).key("rssi").num(f.rssi).key("snr").num(f.snr);
+      w.key("maxRate").num(f.snrValid ? (int)LinkRate::fastestFor(f.snrRefQ4) : -1);
+      w.key("retries").num(f.retries);
+      w.endObject();
+    }
+    w.endArray().endObject();
+    endJsonResponse(w);
+  }
+
   // Very light JSON parser for cfg2 {role,animIndex,params:[{id,value}],globals:[{id,value}]}
   void handleCfg2() {
     String body = server->arg("plain");
-    auto extractNum=[&](const char *key, float defv)->float{
-      int idx = body.indexOf(key);
-      if (idx<0) return defv; idx = body.indexOf(':', idx); if (idx<0) return defv; idx++;
-      while (idx<(int)body.length() && (body[idx]==' ')) idx++;
-      int end=idx; while (end<(int)body.length() && ( (body[end]>='0'&&body[end]<='9') || body[end]=='-' || body[end]=='+' || body[end]=='.' || body[end]=='e' || body[end]=='E')) end++;
-      return body.substring(idx,end).toFloat();
-    };
-  uint8_t role = (uint8_t)extractNum("\"role\"", 1);
-  uint8_t animIndex = (uint8_t)extractNum("\"animIndex\"", followerAnimIndex);
-    // Update target param set
+    Json::Doc<> doc(body.c_str(), body.length());
+    if (!doc.ok()) { server->send(400, "application/json", "{\"ok\":false,\"error\":\"bad json\"}"); return; }
+    uint8_t role = (uint8_t)doc.integer(doc.get(0, "role"), 1);
+    uint8_t animIndex = (uint8_t)doc.integer(doc.get(0, "animIndex"), followerAnimIndex);
+    // Update target param set from params and globals ({id,value} arrays)
     Anim::ParamSet &ps = (role==0)? leaderParams : followerParams;
-    // Parse all occurrences of "id":X and following "value":Y (simple approximation)
-    int pos=0; int safety=0;
-    while (safety<64) {
-      int idKey = body.indexOf("\"id\"", pos); if (idKey<0) break;
-      int colon = body.indexOf(':', idKey); if (colon<0) break; int idStart=colon+1;
-      while (idStart<(int)body.length() && body[idStart]==' ') idStart++;
-      int idEnd=idStart; while (idEnd<(int)body.length() && isdigit(body[idEnd])) idEnd++;
-      uint8_t pid = (uint8_t)body.substring(idStart,idEnd).toInt();
-      int valKey = body.indexOf("\"value\"", idEnd); if (valKey<0) { pos = idEnd; safety++; continue; }
-      colon = body.indexOf(':', valKey); if (colon<0) break; int vStart=colon+1; while (vStart<(int)body.length() && body[vStart]==' ') vStart++;
-      int vEnd=vStart; while (vEnd<(int)body.length() && ( (body[vEnd]>='0'&&body[vEnd]<='9') || body[vEnd]=='-' || body[vEnd]=='+' || body[vEnd]=='.')) vEnd++;
-      float v = body.substring(vStart,vEnd).toFloat();
-      Anim::setParamField(ps, pid, v);
-      pos = vEnd; safety++;
-    }
-    // Also parse globals array similarly (already covered by generic loop since arrays share structure)
+    doc.bindParams(doc.get(0, "params"), ps);
+    doc.bindParams(doc.get(0, "globals"), ps);
     if (role==0){
       // Update leader index and globals mirror; renderer uses leaderParams
       leaderAnimIndex = animIndex;
@@ -754,8 +1168,8 @@ struct Node {
       // Persist globals if changed significantly
       auto fabsf_local = [](float x){ return x < 0 ? -x : x; };
       if (fabsf_local(globalMin - lastSavedGMin) > 0.001f || fabsf_local(globalMax - lastSavedGMax) > 0.001f) {
-        prefs.putFloat("gmin", globalMin);
-        prefs.putFloat("gmax", globalMax);
+        prefsWb.putFloat("gmin", globalMin);
+        prefsWb.putFloat("gmax", globalMax);
         lastSavedGMin = globalMin; lastSavedGMax = globalMax;
       }
 #endif
@@ -769,15 +1183,15 @@ struct Node {
       // Persist globals if changed significantly (follower side could be remote UI too)
       auto fabsf_local = [](float x){ return x < 0 ? -x : x; };
       if (fabsf_local(globalMin - lastSavedGMin) > 0.001f || fabsf_local(globalMax - lastSavedGMax) > 0.001f) {
-        prefs.putFloat("gmin", globalMin);
-        prefs.putFloat("gmax", globalMax);
+        prefsWb.putFloat("gmin", globalMin);
+        prefsWb.putFloat("gmax", globalMax);
         lastSavedGMin = globalMin; lastSavedGMax = globalMax;
       }
 #endif
     }
     if (autoOn) {
       autoOn = false;
-      prefs.putBool("auto_on", false);
+      prefsWb.putBool("auto_on", false);
       #ifdef ARDUINO
       Serial.println("Auto stopped due to manual cfg2");
       #endif
@@ -787,28 +1201,17 @@ struct Node {
 
   void handleGlobals(){
     String body = server->arg("plain");
-    // Parse all occurrences of id/value and apply only globalSpeed/globalMin/globalMax to BOTH roles
+    // Apply only globalSpeed/globalMin/globalMax to BOTH roles
     auto applyIfGlobal = [&](uint8_t pid, float v){
       if (pid==AnimSchema::PID_GLOBAL_SPEED || pid==AnimSchema::PID_GLOBAL_MIN || pid==AnimSchema::PID_GLOBAL_MAX){
         Anim::setParamField(leaderParams, pid, v);
         Anim::setParamField(followerParams, pid, v);
       }
     };
-    int pos = 0; int safety = 0;
-    while (safety < 128) {
-      int idKey = body.indexOf("\"id\"", pos); if (idKey < 0) break;
-      int colon = body.indexOf(':', idKey); if (colon < 0) break; int idStart = colon + 1;
-      while (idStart < (int)body.length() && body[idStart]==' ') idStart++;
-      int idEnd = idStart; while (idEnd < (int)body.length() && isdigit(body[idEnd])) idEnd++;
-      uint8_t pid = (uint8_t)body.substring(idStart, idEnd).toInt();
-      int valKey = body.indexOf("\"value\"", idEnd); if (valKey < 0) { pos = idEnd; safety++; continue; }
-      colon = body.indexOf(':', valKey); if (colon < 0) break; int vStart = colon + 1;
-      while (vStart < (int)body.length() && body[vStart] == ' ') vStart++;
-      int vEnd = vStart; while (vEnd < (int)body.length() && ( (body[vEnd]>='0'&&body[vEnd]<='9') || body[vEnd]=='-' || body[vEnd]=='+' || body[vEnd]=='.')) vEnd++;
-      float v = body.substring(vStart, vEnd).toFloat();
-      applyIfGlobal(pid, v);
-      pos = vEnd; safety++;
-    }
+    Json::Doc<> doc(body.c_str(), body.length());
+    if (!doc.ok()) { server->send(400, "application/json", "{\"ok\":false,\"error\":\"bad json\"}"); return; }
+    // Body is the bare [{id,value}] array the UI sends, or {globals:[...]}
+    doc.forEachParam(doc.is(0, Json::T_ARRAY) ? 0 : doc.get(0, "globals"), applyIfGlobal);
     // Ensure min/max are sane (max >= min) on both sets
     if (leaderParams.globalMax < leaderParams.globalMin){
       leaderParams.globalMax = leaderParams.globalMin;
@@ -824,8 +1227,8 @@ struct Node {
     // Persist global min/max if changed significantly
     auto fabsf_local = [](float x){ return x < 0 ? -x : x; };
     if (fabsf_local(globalMin - lastSavedGMin) > 0.001f || fabsf_local(globalMax - lastSavedGMax) > 0.001f) {
-      prefs.putFloat("gmin", globalMin);
-      prefs.putFloat("gmax", globalMax);
+      prefsWb.putFloat("gmin", globalMin);
+      prefsWb.putFloat("gmax", globalMax);
       lastSavedGMin = globalMin; lastSavedGMax = globalMax;
     }
 #endif
@@ -871,15 +1274,15 @@ struct Node {
   // Persist globals if changed significantly
   auto fabsf_local = [](float x){ return x < 0 ? -x : x; };
   if (fabsf_local(globalMin - lastSavedGMin) > 0.001f || fabsf_local(globalMax - lastSavedGMax) > 0.001f) {
-    prefs.putFloat("gmin", globalMin);
-    prefs.putFloat("gmax", globalMax);
+    prefsWb.putFloat("gmin", globalMin);
+    prefsWb.putFloat("gmax", globalMax);
     lastSavedGMin = globalMin; lastSavedGMax = globalMax;
   }
 #endif
 
     if (autoOn) {
       autoOn = false;
-      prefs.putBool("auto_on", false);
+      prefsWb.putBool("auto_on", false);
       #ifdef ARDUINO
       Serial.println("Auto stopped due to legacy apply");
       #endif
@@ -8,6 +8,8 @@
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 
 namespace AnimSchema {
 
@@ -61,7 +63,8 @@ struct AnimDef { uint8_t index; const char *name; const uint8_t *paramIds; uint8
   X(CAL_MAX,      24, PT_RANGE, "calMax",      float,   calMax,       0.0f,    1.0f,  0.84f,10) \
   X(DELTA,        25, PT_RANGE, "delta",       float,   delta,        0.0f,    5.0f,  2.0f, 10) \
   X(SPARKLE_MIN,  26, PT_INT,   "sparkMin",    uint8_t, minSparkles,  0.0f,   63.0f,  8.0f, 6 ) \
-  X(SPARKLE_MAX,  27, PT_INT,   "sparkMax",    uint8_t, maxSparkles,  0.0f,   63.0f, 12.0f, 6 )
+  X(SPARKLE_MAX,  27, PT_INT,   "sparkMax",    uint8_t, maxSparkles,  0.0f,   63.0f, 12.0f, 6 ) \
+  X(OCTAVES,      28, PT_INT,   "octaves",     uint8_t, octaves,      1.0f,    4.0f,  1.0f, 2 )
 
 // Generate PIDs
 #define DECL_PID(NAME, ID, TYPE, UI, CTYPE, FIELD, MIN, MAX, DEF, BITS) static constexpr uint8_t PID_##NAME = ID;
@@ -83,7 +86,7 @@ static const ParamDef PARAMS[] PROGMEM = { PARAM_LIST(PARAM_DEF_ROW) };
   X(3, "Chase",   1, 3, 4) /* SPEED, WIDTH, BRANCH */ \
   X(4, "Single",  7) /* SINGLE_IDX */ \
   X(5, "Sparkle", 1, 8, 26, 27) /* SPEED, RANDOM_MODE, SPARKLE_MIN, SPARKLE_MAX */ \
-  X(6, "Perlin",  1, 3, 23, 24, 25) /* SPEED, WIDTH, CAL_MIN, CAL_MAX, DELTA */
+  X(6, "Perlin",  1, 3, 23, 24, 25, 28) /* SPEED, WIDTH, CAL_MIN, CAL_MAX, DELTA, OCTAVES */
 
 
 
@@ -97,17 +100,56 @@ ANIM_ITEMS(DEF_ANIM_PARAMS_ARRAY)
 static const AnimDef ANIM_ITEMS[] PROGMEM = { ANIM_ITEMS(DEF_ANIM_ROW) };
 #undef DEF_ANIM_ROW
 
+// Dense lookup tables generated from the lists above so findParam/findAnim and the
+// ParamSet accessors are plain array indexing instead of linear PROGMEM scans.
+#define PARAM_ID_ROW(NAME, ID, TYPE, UI, CTYPE, FIELD, MIN, MAX, DEF, BITS) ID,
+static constexpr uint8_t PARAM_IDS[] = { PARAM_LIST(PARAM_ID_ROW) };
+#undef PARAM_ID_ROW
+#define ANIM_INDEX_ROW(INDEX, NAME, ...) INDEX,
+static constexpr uint8_t ANIM_INDEXES[] = { ANIM_ITEMS(ANIM_INDEX_ROW) };
+#undef ANIM_INDEX_ROW
+static constexpr uint8_t PARAM_COUNT = (uint8_t)sizeof(PARAM_IDS);
+static constexpr uint8_t ANIM_COUNT = (uint8_t)sizeof(ANIM_INDEXES);
+static constexpr uint8_t NO_ROW = 0xFF;
+
+constexpr uint8_t _rowOf(const uint8_t *keys, uint8_t n, int key, uint8_t i = 0) {
+  return (i >= n) ? NO_ROW : (keys[i] == key ? i : _rowOf(keys, n, key, (uint8_t)(i + 1)));
+}
+constexpr uint8_t _maxKey(const uint8_t *keys, uint8_t n, uint8_t i = 0, uint8_t m = 0) {
+  return (i >= n) ? m : _maxKey(keys, n, (uint8_t)(i + 1), keys[i] > m ? keys[i] : m);
+}
+static constexpr uint8_t ANIM_INDEX_MAX = _maxKey(ANIM_INDEXES, ANIM_COUNT);
+
+template<int... I> struct _key_seq { };
+template<int N, int... I> struct _make_key_seq : _make_key_seq<N-1, N-1, I...> { };
+template<int... I> struct _make_key_seq<0, I...> { typedef _key_seq<I...> type; };
+
+template<typename Seq> struct _param_rows;
+template<int... I> struct _param_rows<_key_seq<I...>> { static constexpr uint8_t data[sizeof...(I)] = { _rowOf(PARAM_IDS, PARAM_COUNT, I)... }; };
+template<int... I> constexpr uint8_t _param_rows<_key_seq<I...>>::data[sizeof...(I)];
+template<typename Seq> struct _anim_rows;
+template<int... I> struct _anim_rows<_key_seq<I...>> { static constexpr uint8_t data[sizeof...(I)] = { _rowOf(ANIM_INDEXES, ANIM_COUNT, I)... }; };
+template<int... I> constexpr uint8_t _anim_rows<_key_seq<I...>>::data[sizeof...(I)];
+
+// id -> PARAMS[] row (NO_ROW if unknown). Covers the full uint8_t range so no bounds check is needed.
+static constexpr uint8_t const (&PARAM_ROW)[256] = _param_rows<_make_key_seq<256>::type>::data;
+// anim index -> ANIM_ITEMS[] row (NO_ROW if unknown)
+static constexpr uint8_t const (&ANIM_ROW)[ANIM_INDEX_MAX + 1] = _anim_rows<_make_key_seq<ANIM_INDEX_MAX + 1>::type>::data;
+
 inline const ParamDef* findParam(uint8_t id){
-  for(size_t i=0;i<sizeof(PARAMS)/sizeof(PARAMS[0]);++i){ ParamDef tmp; memcpy_P(&tmp,&PARAMS[i],sizeof(tmp)); if(tmp.id==id) return &PARAMS[i]; }
-  return nullptr;
+  uint8_t row = PARAM_ROW[id];
+  return (row != NO_ROW) ? &PARAMS[row] : nullptr;
 }
 inline const AnimDef* findAnim(uint8_t index){
-  for(size_t i=0;i<sizeof(ANIM_ITEMS)/sizeof(ANIM_ITEMS[0]);++i){ AnimDef tmp; memcpy_P(&tmp,&ANIM_ITEMS[i],sizeof(tmp)); if(tmp.index==index) return &ANIM_ITEMS[i]; }
-  return nullptr;
+  if (index > ANIM_INDEX_MAX) return nullptr;
+  uint8_t row = ANIM_ROW[index];
+  return (row != NO_ROW) ? &ANIM_ITEMS[row] : nullptr;
 }
 inline uint8_t valueBytes(const ParamDef &pd){ if(pd.type==PT_BOOL) return 1; if(pd.bits<=8) return 1; if(pd.bits<=16) return 2; if(pd.bits<=24) return 3; return 4; }
 inline uint32_t encodeValue(float v,const ParamDef &pd){ if(pd.type==PT_BOOL) return (v!=0.0f)?1u:0u; float mn=pd.minVal,mx=pd.maxVal; if(v<mn) v=mn; else if(v>mx) v=mx; uint32_t maxq=(pd.bits>=31)?0xFFFFFFFFu:((1u<<pd.bits)-1u); if(maxq==0) return 0; float qf=(v-mn)*(float)maxq/(mx-mn); return (uint32_t)lroundf(qf); }
-inline float decodeValue(uint32_t q,const ParamDef &pd){ if(pd.type==PT_BOOL) return (q&1u)?1.0f:0.0f; uint32_t maxq=(pd.bits>=31)?0xFFFFFFFFu:((1u<<pd.bits)-1u); if(maxq==0) return pd.minVal; return pd.minVal + (float)q*(pd.maxVal-pd.minVal)/(float)maxq; }
+// PT_INT decodes to the nearest integer: e.g. width 2 goes on air as 2.14/15 steps and
+// would otherwise come back as 1.93 and truncate to 1 in the uint8_t field
+inline float decodeValue(uint32_t q,const ParamDef &pd){ if(pd.type==PT_BOOL) return (q&1u)?1.0f:0.0f; uint32_t maxq=(pd.bits>=31)?0xFFFFFFFFu:((1u<<pd.bits)-1u); if(maxq==0) return pd.minVal; float v = pd.minVal + (float)q*(pd.maxVal-pd.minVal)/(float)maxq; return pd.type==PT_INT ? roundf(v) : v; }
 
 } // namespace AnimSchema
 
@@ -119,22 +161,39 @@ struct ParamSet {
 #undef PARAM_FIELD
 };
 
+// Per-row storage descriptor into ParamSet (same row order as AnimSchema::PARAMS)
+enum FieldKind : uint8_t { FK_FLOAT=0, FK_U8=1, FK_BOOL=2 };
+struct FieldSlot { uint8_t offset; uint8_t kind; };
+template<typename T> struct _field_kind;
+template<> struct _field_kind<float>   { static constexpr uint8_t value = FK_FLOAT; };
+template<> struct _field_kind<uint8_t> { static constexpr uint8_t value = FK_U8; };
+template<> struct _field_kind<bool>    { static constexpr uint8_t value = FK_BOOL; };
+
+#define PARAM_SLOT_ROW(NAME, ID, TYPE, UI, CTYPE, FIELD, MIN, MAX, DEF, BITS) \
+  { (uint8_t)offsetof(ParamSet, FIELD), _field_kind<CTYPE>::value },
+static constexpr FieldSlot PARAM_SLOTS[] = { PARAM_LIST(PARAM_SLOT_ROW) };
+#undef PARAM_SLOT_ROW
+static_assert(sizeof(PARAM_SLOTS)/sizeof(PARAM_SLOTS[0]) == AnimSchema::PARAM_COUNT, "PARAM_SLOTS out of sync with PARAM_LIST");
+
+// Typed copy through PARAM_SLOTS: one float-vs-byte test on the kind, no per-field switch.
+// bool fields hold 0/1, so the byte rows read back the same way for FK_U8 and FK_BOOL.
 inline bool setParamField(ParamSet &ps, uint8_t id, float v){
-  switch(id){
-#define PARAM_SET_CASE(NAME, ID, TYPE, UI, CTYPE, FIELD, MIN, MAX, DEF, BITS) \
-    case AnimSchema::PID_##NAME: ps.FIELD = (CTYPE)((TYPE)==AnimSchema::PT_BOOL? (v!=0.0f): v); return true;
-    PARAM_LIST(PARAM_SET_CASE)
-#undef PARAM_SET_CASE
-    default: return false;
-  }
+  uint8_t row = AnimSchema::PARAM_ROW[id];
+  if (row == AnimSchema::NO_ROW) return false;
+  const FieldSlot &fs = PARAM_SLOTS[row];
+  uint8_t *p = reinterpret_cast<uint8_t*>(&ps) + fs.offset;
+  if (fs.kind == FK_FLOAT) memcpy(p, &v, sizeof(v));
+  else *p = (fs.kind == FK_BOOL) ? (uint8_t)(v != 0.0f) : (uint8_t)v;
+  return true;
 }
 inline float getParamField(const ParamSet &ps, uint8_t id){
-  switch(id){
-#define PARAM_GET_CASE(NAME, ID, TYPE, UI, CTYPE, FIELD, MIN, MAX, DEF, BITS) \
-    case AnimSchema::PID_##NAME: return (TYPE)==AnimSchema::PT_BOOL ? (ps.FIELD?1.0f:0.0f) : (float)ps.FIELD;
-    PARAM_LIST(PARAM_GET_CASE)
-#undef PARAM_GET_CASE
-    default: return 0.0f;
-  }
+  uint8_t row = AnimSchema::PARAM_ROW[id];
+  if (row == AnimSchema::NO_ROW) return 0.0f;
+  const FieldSlot &fs = PARAM_SLOTS[row];
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(&ps) + fs.offset;
+  if (fs.kind != FK_FLOAT) return (float)*p;
+  float f;
+  memcpy(&f, p, sizeof(f));
+  return f;
 }
 } // namespace Anim
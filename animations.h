@@ -9,47 +9,82 @@
 #endif
 
 #include "anim_schema.h" // brings in Anim::ParamSet & helpers
+#include "time_base.h"   // renderers take the synced clock as 64-bit µs
 
 namespace Anim {
 static constexpr uint8_t BRANCHES = 4;
 static constexpr uint8_t LEDS_PER_BRANCH = 7;
 static constexpr uint8_t TOTAL_LEDS = BRANCHES * LEDS_PER_BRANCH;
 
-// Legacy core primitives (kept so existing code keeps working)
-inline void staticOn(float t, uint16_t n, float level, float *out) {
-  (void)t;
+static constexpr float TWO_PI_F = 6.28318530718f;
+
+// Render mask: bit i of mask[i / 8] set when logical LED i is physically connected (firmware
+// builds it from LED_CHANNEL_INV); nullptr renders every LED. Per-LED kernels (Wave, Sparkle,
+// Perlin) leave unmapped LEDs at 0 without evaluating them.
+inline bool rendered(const uint8_t *mask, uint16_t i) { return !mask || ((mask[i >> 3] >> (i & 7)) & 1u); }
+// Rendered LEDs below n, and the index of the r-th of them (r below that count)
+inline uint16_t renderedCount(const uint8_t *mask, uint16_t n) {
+  if (!mask) return n;
+  uint16_t c = 0;
+  for (uint16_t b = 0; b < n >> 3; ++b) c += (uint16_t)__builtin_popcount(mask[b]);
+  if (n & 7) c += (uint16_t)__builtin_popcount(mask[n >> 3] & ((1u << (n & 7)) - 1u));
+  return c;
+}
+inline uint16_t nthRendered(const uint8_t *mask, uint16_t r) {
+  if (!mask) return r;
+  uint16_t b = 0;
+  for (uint16_t c; (c = (uint16_t)__builtin_popcount(mask[b])) <= r; ++b) r -= c;
+  uint8_t m = mask[b];
+  while (r--) m &= (uint8_t)(m - 1); // drop the lowest set bits before the one we want
+  return (uint16_t)(b * 8 + __builtin_ctz(m));
+}
+
+// Legacy core primitives (kept so existing code keeps working). Time is the synced clock in
+// µs; periodic motion comes from TimeBase turns so it stays exact at any uptime.
+inline void staticOn(uint64_t tUs, uint16_t n, float level, float *out) {
+  (void)tUs;
   level = constrain(level, 0.0f, 1.0f);
   for (uint16_t i = 0; i < n; ++i) out[i] = level;
 }
 
-inline void wave(float t, uint16_t n, float speed, float phase, bool branchMode, bool invert, float *out) {
-  const float twoPi = 6.28318530718f;
+// Wave, Pulse and Chase are pure functions of one turn fraction (t * speed over their
+// period); the *At forms take that turn directly so FrameCache can sample one period.
+inline void waveAt(float turn, uint16_t n, float phase, bool branchMode, bool invert, float *out, const uint8_t *mask = nullptr) {
+  const float twoPi = TWO_PI_F;
+  float tp = turn * twoPi; // t * speed, mod 2pi
   if (branchMode) {
     for (uint8_t b = 0; b < BRANCHES; ++b) {
       float bp = phase + b * 0.78539816339f; // pi/4
       for (uint8_t i = 0; i < LEDS_PER_BRANCH; ++i) {
         uint16_t idx = b * LEDS_PER_BRANCH + i;
         if (idx >= n) break;
+        if (!rendered(mask, idx)) { out[idx] = 0.0f; continue; }
         uint8_t ii = invert ? (uint8_t)(LEDS_PER_BRANCH - 1 - i) : i;
-        float angle = (float)ii / (float)LEDS_PER_BRANCH * twoPi + t * speed + bp;
+        float angle = (float)ii / (float)LEDS_PER_BRANCH * twoPi + tp + bp;
         float v = 0.5f + 0.5f * sinf(angle);
         out[idx] = v;
       }
     }
   } else {
     for (uint16_t i = 0; i < n; ++i) {
+      if (!rendered(mask, i)) { out[i] = 0.0f; continue; }
       uint16_t ii = invert ? (uint16_t)(n - 1 - i) : i;
-      float angle = (float)ii / (float)n * twoPi + t * speed + phase;
+      float angle = (float)ii / (float)n * twoPi + tp + phase;
       out[i] = 0.5f + 0.5f * sinf(angle);
     }
   }
 }
 
-inline void pulse(float t, uint16_t n, float speed, float phase, bool branchMode, float *out) {
+inline void wave(uint64_t tUs, uint16_t n, float speed, float phase, bool branchMode, bool invert, float *out, const uint8_t *mask = nullptr) {
+  waveAt(TimeBase::turns(tUs, speed / TWO_PI_F), n, phase, branchMode, invert, out, mask);
+}
+
+inline void pulseAt(float turn, uint16_t n, float phase, bool branchMode, float *out) {
+  float tp = turn * TWO_PI_F; // t * speed, mod 2pi
   if (branchMode) {
     for (uint8_t b = 0; b < BRANCHES; ++b) {
       float bp = phase + b * 1.57079632679f; // pi/2
-      float v = 0.5f + 0.5f * sinf(t * speed + bp);
+      float v = 0.5f + 0.5f * sinf(tp + bp);
       for (uint8_t i = 0; i < LEDS_PER_BRANCH; ++i) {
         uint16_t idx = b * LEDS_PER_BRANCH + i;
         if (idx >= n) break;
@@ -57,209 +92,136 @@ inline void pulse(float t, uint16_t n, float speed, float phase, bool branchMode
       }
     }
   } else {
-    float v = 0.5f + 0.5f * sinf(t * speed + phase);
+    float v = 0.5f + 0.5f * sinf(tp + phase);
     for (uint16_t i = 0; i < n; ++i) out[i] = v;
   }
 }
 
-inline void chase(float t, uint16_t n, float speed, uint8_t width, bool branchMode, float *out) {
+inline void pulse(uint64_t tUs, uint16_t n, float speed, float phase, bool branchMode, float *out) {
+  pulseAt(TimeBase::turns(tUs, speed / TWO_PI_F), n, phase, branchMode, out);
+}
+
+// turn: one lap of the strip (n steps), or of a branch (LEDS_PER_BRANCH steps) in branchMode
+inline void chaseAt(float turn, uint16_t n, uint8_t width, bool branchMode, float *out) {
   for (uint16_t i = 0; i < n; ++i) out[i] = 0.0f;
+  if (!n) return;
   if (branchMode) {
     for (uint8_t b = 0; b < BRANCHES; ++b) {
-      uint16_t pos = (uint16_t)(fmodf(t * speed + b * (LEDS_PER_BRANCH / 2.0f), (float)LEDS_PER_BRANCH));
+      float lap = turn + b * 0.5f; // branches half a lap apart
+      if (lap >= 1.0f) lap -= 1.0f;
+      uint16_t pos = (uint16_t)(lap * (float)LEDS_PER_BRANCH) % LEDS_PER_BRANCH;
       for (uint8_t w = 0; w < width; ++w) {
         uint16_t idx = b * LEDS_PER_BRANCH + (pos + w) % LEDS_PER_BRANCH;
         if (idx < n) out[idx] = 1.0f;
       }
     }
   } else {
-    uint16_t pos = (uint16_t)fmodf(t * speed, (float)n);
+    uint16_t pos = (uint16_t)(turn * (float)n) % n;
     for (uint8_t w = 0; w < width; ++w) out[(pos + w) % n] = 1.0f;
   }
 }
 
-inline void single(float /*t*/, uint16_t n, uint16_t index, float *out) {
+inline float chaseCyclesPerSec(uint16_t n, float speed, bool branchMode) {
+  return speed / (float)(branchMode ? LEDS_PER_BRANCH : (n ? n : 1));
+}
+
+inline void chase(uint64_t tUs, uint16_t n, float speed, uint8_t width, bool branchMode, float *out) {
+  chaseAt(TimeBase::turns(tUs, chaseCyclesPerSec(n, speed, branchMode)), n, width, branchMode, out);
+}
+
+inline void single(uint64_t /*tUs*/, uint16_t n, uint16_t index, float *out) {
   for (uint16_t i = 0; i < n; ++i) out[i] = 0.0f;
   if (index < n) out[index] = 1.0f;
 }
 
 using ParamSet = Anim::ParamSet; // alias for local convenience
 
-// Sparkle animation (time-based, approximates step-wise Python version with internal state)
-inline void sparkle(float t, uint16_t n, float speed, bool randomMode, const ParamSet &ps, float *out) {
-  // Cap n to our compile-time maximum to keep static storage bounded
-  if (n > TOTAL_LEDS) n = TOTAL_LEDS;
-
-  // Time-based refactor: rise is linear (units brightness / sec), fade is exponential (decay rate / sec)
-  struct SparkState { float brightness; uint8_t state; float rise; float decay; bool active; };
-  enum : uint8_t { GROWING = 0, FADING = 1 };
-  static SparkState sparks[TOTAL_LEDS];
-  static bool initialized = false;
-  static float lastTime = 0.0f;
-  static float lastTargetChangeTime = 0.0f;
-  static uint32_t rng = 0x12345678u;
-
-  // Dynamic target spawn modulation
-  static float spawnRate = 10.0f;       // current spawn attempts per second (smoothed)
-  static float spawnRateTarget = 10.0f; // target spawn attempts per second
-
-  // Constants (chosen to approximate previous behavior at speed=1)
-  // Defaults used when ParamSet does not override
+// Counter-based RNG: a hash of (seed, slot, led, stream) instead of a stepped generator, so
+// the value never depends on how many frames a node has rendered. Three rounds of the
+// SplitMix/murmur finalizer over the inputs.
+inline uint32_t mix32(uint32_t x) { x ^= x >> 16; x *= 0x85EBCA6Bu; x ^= x >> 13; x *= 0xC2B2AE35u; x ^= x >> 16; return x; }
+inline uint32_t crng(uint32_t seed, uint32_t slot, uint32_t led, uint32_t stream = 0) {
+  uint32_t x = mix32(seed + 0x9E3779B9u * (stream + 1));
+  x = mix32(x ^ slot);
+  return mix32(x + 0x9E3779B9u * led);
+}
+inline float crngf(uint32_t seed, uint32_t slot, uint32_t led, uint32_t stream) {
+  return (crng(seed, slot, led, stream) & 0xFFFFFFu) / 16777216.0f; // 24-bit fraction
+}
+
+// LEDs the last sparkle() call lit, so the next one only has to clear those instead of all n,
+// and the rendered LEDs of its mask, so a spark finds its LED without scanning the mask.
+// Keep one per output buffer; it falls back to a full clear when more LEDs were lit than fit,
+// and applyAnim() drops the list when another animation (or the global range) wrote the buffer.
+static constexpr uint16_t SPARK_DIRTY_MAX = 256;
+struct SparkDirty {
+  uint16_t idx[SPARK_DIRTY_MAX];
+  uint16_t count{0};
+  bool valid{false}; // idx covers every lit LED of the buffer
+  uint16_t mapped[TOTAL_LEDS]; // rendered LEDs, in order (up to TOTAL_LEDS)
+  uint16_t mappedCount{0};
+  uint16_t n{0}; const uint8_t *mask{nullptr}; // what idx and mapped were built for
+};
+
+// Sparkle animation. Stateless: the sparks run in sparkMax lanes, each cut into cells of its
+// own length (0.7 - 1.3 x meanLife, scaled by speed) and phase. A cell holds one spark whose
+// LED, brightness and rise come from crng(seed, cell, lane); it fades to offLevel exactly at
+// the cell end, where the next one starts. The first sparkMin lanes light every cell, the
+// others every other cell on average, so a frame shows between sparkMin and sparkMax sparks
+// ((min + max) / 2 on average) and never more. Nodes with the same seed and synced clock show
+// the same field without exchanging packets; different seeds give independent fields. The
+// work is O(sparkMax) whatever n is; with a SparkDirty the output pass is too. Sparks are
+// drawn from the rendered LEDs of the mask only.
+inline void sparkle(uint64_t tUs, uint16_t n, float speed, bool randomMode, const ParamSet &ps, float *out,
+                    uint32_t seed = 0, const uint8_t *mask = nullptr, SparkDirty *dirty = nullptr) {
+  // Rise is linear (units brightness / sec at speed=1); the fade is exponential and ends the cell
   const uint8_t minSparkles = 8;
   const uint8_t maxSparkles = 12;
-  const float changeInterval = 2.0f;   // how often to retarget spawn tempo
-  const float smoothing = 0.8f;         // smoothing factor (used with dt scaling)
-  const float baseRise = 2.5f;          // ~0.4s to peak at speed=1 (1 / 2.5)
-  const float baseDecay = 1.3f;         // exp(-1.3) ≈ 0.27 (matches old 0.95^25)
-  const float minDecay = 0.4f;          // safety lower bound (too low -> very long trails)
-  const float maxDecay = 8.0f;          // safety upper bound (avoid instant vanish)
-  const float spawnRateMin = 6.0f;      // lower bound spawn attempts / sec
-  const float spawnRateMax = 18.0f;     // upper bound spawn attempts / sec
-  const float minTempoVal = 0.015f;     // reuses old minDelay notion for modulation mapping
-  const float maxTempoVal = 0.070f;     // reuses old maxDelay notion
-
-  // Pseudo-random number generator (LCG) producing [0,1)
-  auto frand = [&]() -> float {
-    rng = 1664525u * rng + 1013904223u;
-    return (rng & 0xFFFFFFu) / 16777216.0f; // 24-bit fraction
-  };
-
-  if (!initialized) {
-    for (uint16_t i = 0; i < TOTAL_LEDS; ++i) {
-      sparks[i].brightness = 0.0f;
-      sparks[i].state = GROWING;
-      sparks[i].rise = baseRise;
-      sparks[i].decay = baseDecay;
-      sparks[i].active = false;
-    }
-    // Seed initial random sparkles so they are de-synchronized from the first frame
-    uint8_t seedCount = minSparkles;
-    for (uint8_t s = 0; s < seedCount; ++s) {
-      uint16_t idx = (uint16_t)(frand() * TOTAL_LEDS);
-      SparkState &sp = sparks[idx];
-      sp.active = true;
-      sp.state = (frand() < 0.5f) ? GROWING : FADING;
-      sp.brightness = frand();
-      // Randomize rise/decay a bit for variety
-      float riseVar = 0.6f + frand() * 0.8f;   // 0.6 - 1.4
-      float decayVar = 0.6f + frand() * 0.8f;  // 0.6 - 1.4
-      sp.rise = baseRise * riseVar;
-      sp.decay = baseDecay * decayVar;
-    }
-    initialized = true;
-    lastTime = t;
-    lastTargetChangeTime = t;
-  }
+  const float baseRise = 2.5f;   // ~0.4s to peak at speed=1 (1 / 2.5)
+  const float offLevel = 0.02f;  // a spark has faded to this at the end of its cell
+  const float meanLife = 3.35f;  // average cell length in speed-scaled seconds
+  const uint32_t laneKey = 0xFFFFFFFFu; // crng slot for per-lane constants
 
-  // Compute dt
-  float dt = t - lastTime;
-  if (dt < 0.0f) dt = 0.0f; // guard against time reset
-  // Clamp overly large dt (e.g., frame hitch) to keep behavior stable
-  if (dt > 0.25f) dt = 0.25f;
-  lastTime = t;
+  if (dirty && (dirty->n != n || dirty->mask != mask)) {
+    dirty->valid = false; dirty->n = n; dirty->mask = mask;
+    dirty->mappedCount = 0;
+    if (mask && n <= TOTAL_LEDS) for (uint16_t i = 0; i < n; ++i) if (rendered(mask, i)) dirty->mapped[dirty->mappedCount++] = i;
+  }
+  if (dirty && dirty->valid) { for (uint16_t j = 0; j < dirty->count; ++j) out[dirty->idx[j]] = 0.0f; }
+  else for (uint16_t i = 0; i < n; ++i) out[i] = 0.0f;
+  if (dirty) { dirty->count = 0; dirty->valid = true; }
+  const bool useList = dirty && mask && n <= TOTAL_LEDS;
+  uint16_t leds = useList ? dirty->mappedCount : renderedCount(mask, n);
+  if (!leds) return;
 
-  // Speed scaling (clamp to avoid extreme runaway)
   float speedScale = (speed <= 0.0f) ? 0.000001f : speed;
   if (speedScale > 10.0f) speedScale = 10.0f;
 
-  // Periodically retarget spawn tempo (map random tempo value -> spawnRateTarget)
-  if (t - lastTargetChangeTime >= changeInterval) {
-    float r = frand();
-    float expFactor = r * r; // bias toward center
-    float tempoVal = minTempoVal + expFactor * (maxTempoVal - minTempoVal);
-    // Invert mapping: shorter tempoVal -> higher spawnRateTarget
-    float norm = (maxTempoVal - tempoVal) / (maxTempoVal - minTempoVal); // 0..1
-    spawnRateTarget = spawnRateMin + norm * (spawnRateMax - spawnRateMin);
-    lastTargetChangeTime = t;
-  }
-  // Smooth spawnRate toward target (dt-based blending)
-  float blend = 1.0f - expf(-smoothing * dt * 5.0f); // quicker convergence independent of frame rate
-  spawnRate += (spawnRateTarget - spawnRate) * blend;
-
-  // Update existing sparkles & count actives
-  uint8_t activeCount = 0;
-  for (uint16_t i = 0; i < n; ++i) {
-    SparkState &sp = sparks[i];
-    if (!sp.active) continue;
-    ++activeCount;
-
-    // Per-spark jitter factor (small) to further desync behavior over time
-    float jitter = 0.9f + frand() * 0.2f; // 0.9 - 1.1
-
-    if (sp.state == GROWING) {
-      float riseRate = sp.rise * speedScale * jitter; // linear rise
-      sp.brightness += riseRate * dt;
-      if (sp.brightness >= 1.0f) {
-        sp.brightness = 1.0f;
-        sp.state = FADING;
-      }
-    } else { // FADING
-      float decayRate = sp.decay * speedScale * jitter;
-      if (decayRate < minDecay) decayRate = minDecay;
-      if (decayRate > maxDecay) decayRate = maxDecay;
-      // Exponential decay
-      sp.brightness *= expf(-decayRate * dt);
-      if (sp.brightness < 0.02f) {
-        sp.active = false;
-        --activeCount;
-        continue;
-      }
-    }
-  }
-
-  // Decide current target sparkle count (allow ParamSet overrides)
   uint8_t curMin = (ps.minSparkles > 0) ? ps.minSparkles : minSparkles;
   uint8_t curMax = (ps.maxSparkles > 0) ? ps.maxSparkles : maxSparkles;
-  uint8_t targetSparkles = curMin;
-  if (curMax > curMin) {
-    targetSparkles = (uint8_t)(curMin + (uint8_t)(frand() * (float)(curMax - curMin + 1)));
-    if (targetSparkles > curMax) targetSparkles = curMax;
-  }
-  if (targetSparkles > n) targetSparkles = n;
-
-  // Spawn probability for this frame; accelerate with speedScale
-  float attemptsPerSec = spawnRate * speedScale;
-  if (attemptsPerSec < 0.1f) attemptsPerSec = 0.1f;
-  float spawnProb = 1.0f - expf(-attemptsPerSec * dt); // probability at least one attempt
-
-  // Try spawning until we reach target (stochastic each frame)
-  // Cap loop iterations to prevent pathological long loops when n is small.
-  uint8_t guard = 0;
-  while (activeCount < targetSparkles && guard < 20) {
-    ++guard;
-    if (frand() > spawnProb) break; // no spawn this frame
-    uint16_t idx = (uint16_t)(frand() * n);
-    if (idx >= n) continue;
-    SparkState &sp = sparks[idx];
-    if (sp.active) continue;
-    sp.active = true;
-    sp.state = GROWING;
-    // Base parameters
-    float rise = baseRise;
-    float decay = baseDecay;
-    if (randomMode) {
-      rise *= (0.6f + frand() * 0.8f);   // 0.6 - 1.4
-      decay *= (0.6f + frand() * 0.8f);  // 0.6 - 1.4
-    }
-    sp.rise = rise;
-    sp.decay = decay;
-    sp.brightness = 0.05f + frand() * 0.20f; // small random initial brightness
-    ++activeCount;
-  }
+  if (curMax < curMin) curMax = curMin;
+  if (curMax > leds) curMax = (uint8_t)leds;
+  if (curMin > curMax) curMin = curMax;
 
-  // Write out buffer
-  for (uint16_t i = 0; i < n; ++i) {
-    float v = sparks[i].active ? sparks[i].brightness : 0.0f;
-    if (v < 0.0f) v = 0.0f; else if (v > 1.0f) v = 1.0f;
+  for (uint8_t lane = 0; lane < curMax; ++lane) {
+    float cellLen = meanLife * (0.7f + 0.6f * crngf(seed, laneKey, lane, 0));
+    uint64_t pos = TimeBase::cyclesQ32(tUs, speedScale / cellLen) + ((uint64_t)crng(seed, laneKey, lane, 1) << 8);
+    uint32_t cell = (uint32_t)(pos >> 32);
+    if (lane >= curMin && crng(seed, cell, lane, 2) & 1u) continue; // optional lane, dark this cell
+    float age = (float)((uint32_t)pos >> 8) * (1.0f / 16777216.0f) * cellLen;
+    float rise = baseRise;
+    if (randomMode) rise *= (0.6f + crngf(seed, cell, lane, 3) * 0.8f); // 0.6 - 1.4
+    float b0 = 0.05f + crngf(seed, cell, lane, 5) * 0.20f; // small random initial brightness
+    float peakAt = (1.0f - b0) / rise;
+    float decay = 3.912f / (cellLen - peakAt); // ln(1 / offLevel)
+    float v = (age < peakAt) ? b0 + rise * age : expf(-decay * (age - peakAt));
+    if (v < offLevel) v = offLevel;
+    uint16_t r = (uint16_t)(crng(seed, cell, lane, 6) % leds);
+    uint16_t i = useList ? dirty->mapped[r] : nthRendered(mask, r);
+    if (v <= out[i]) continue;
+    if (dirty && out[i] == 0.0f) { if (dirty->count < SPARK_DIRTY_MAX) dirty->idx[dirty->count++] = i; else dirty->valid = false; }
     out[i] = v;
   }
-  // Clear & reset any beyond n
-  for (uint16_t i = n; i < TOTAL_LEDS; ++i) {
-    if (sparks[i].active) {
-      sparks[i].active = false;
-      sparks[i].brightness = 0.0f;
-    }
-  }
 }
 
 
@@ -281,6 +243,7 @@ enum ParamId : uint8_t {
  ,PID_DELTA   = 25
  ,PID_SPARKLE_MIN = 26
  ,PID_SPARKLE_MAX = 27
+ ,PID_OCTAVES = 28
 };
 
 // (ParamSet already defined above for sparkle)
@@ -290,105 +253,206 @@ inline uint32_t vh(uint32_t x, uint32_t y, uint32_t z){ uint32_t h = x*374761393
 inline float vhash(uint32_t x, uint32_t y, uint32_t z){ return (vh(x,y,z) & 0xFFFFFFu)/16777216.0f; }
 inline float vfade(float t){ return t*t*(3.0f-2.0f*t); }
 inline float vlerp(float a,float b,float t){ return a + (b-a)*t; }
+// z (the time axis) repeats every NOISE_Z_PERIOD lattice cells, so time can be wrapped into
+// [0, NOISE_Z_PERIOD) without a seam and keep full float resolution
+static constexpr uint32_t NOISE_Z_PERIOD = 4096;
+// 2D kernel: bilinear noise in the xy plane at z lattice plane Zk (4 hashes). Value noise is
+// the z-fade blend of the planes at Z0 and Z1, so callers that share z (the Perlin time axis)
+// can keep planes across frames and get bit-identical output.
+inline float noiseCell(int X,int Y,float u,float v,uint32_t Zk){
+  float nx0=vlerp(vhash(X,Y,Zk),vhash(X+1,Y,Zk),u), nx1=vlerp(vhash(X,Y+1,Zk),vhash(X+1,Y+1,Zk),u);
+  return vlerp(nx0,nx1,v);
+}
+inline float noisePlane(float x,float y,uint32_t Zk){
+  int X=(int)floorf(x), Y=(int)floorf(y);
+  return noiseCell(X,Y,vfade(x-X),vfade(y-Y),Zk);
+}
+// z lattice plane pair and fade for a time-axis coordinate in [0, NOISE_Z_PERIOD]
+inline float noiseZ(float z,uint32_t &Z0,uint32_t &Z1){
+  int Z=(int)floorf(z); Z0=(uint32_t)Z & (NOISE_Z_PERIOD-1); Z1=(uint32_t)(Z+1) & (NOISE_Z_PERIOD-1); return vfade(z-Z);
+}
+// 3D value noise with the z planes and fade from noiseZ
+inline float valueNoiseZ(float x,float y,uint32_t Z0,uint32_t Z1,float w){
+  int X=(int)floorf(x), Y=(int)floorf(y);
+  float u=vfade(x-X), v=vfade(y-Y);
+  return vlerp(noiseCell(X,Y,u,v,Z0),noiseCell(X,Y,u,v,Z1),w);
+}
 inline float valueNoise(float x,float y,float z){
-  int X=(int)floorf(x), Y=(int)floorf(y), Z=(int)floorf(z);
-  float fx=x-X, fy=y-Y, fz=z-Z;
-  float u=vfade(fx), v=vfade(fy), w=vfade(fz);
-  float n000=vhash(X,Y,Z), n100=vhash(X+1,Y,Z); float n010=vhash(X,Y+1,Z), n110=vhash(X+1,Y+1,Z);
-  float n001=vhash(X,Y,Z+1), n101=vhash(X+1,Y,Z+1); float n011=vhash(X,Y+1,Z+1), n111=vhash(X+1,Y+1,Z+1);
-  float nx00=vlerp(n000,n100,u), nx10=vlerp(n010,n110,u); float nx01=vlerp(n001,n101,u), nx11=vlerp(n011,n111,u);
-  float nxy0=vlerp(nx00,nx10,v), nxy1=vlerp(nx01,nx11,v); return vlerp(nxy0,nxy1,w);
+  uint32_t Z0,Z1; float w=noiseZ(z,Z0,Z1);
+  return valueNoiseZ(x,y,Z0,Z1,w);
 }
 inline float ridgeNoise(float x,float y,float z,int octaves,float lacu,float gain,float offset){
   float sum=0.0f,f=1.0f,amp=0.5f; for(int i=0;i<octaves;i++){ float v=valueNoise(x*f,y*f,z*f); v=v*2.0f-1.0f; v=offset - fabsf(v); v=v*v; sum += v*amp; f*=lacu; amp*=gain; } return sum;
 }
 
-inline void applyAnim(uint8_t animIndex, float t, uint16_t n, const ParamSet &ps, float *out) {
+// Perlin: ridge noise over the LED layout, time on the z axis. LED positions never change
+// and z is shared by all LEDs, so each octave at an LED is vlerp(plane(Z0), plane(Z1), w).
+// With NoisePlanes the per-LED planes are kept across frames and only the one entering
+// is hashed when z crosses a lattice plane (every few seconds at usual speeds): 4 hashes per
+// LED and crossing instead of 8 per LED, octave and frame. Output is identical either way.
+static constexpr uint8_t NOISE_MAX_OCTAVES = 4;
+struct NoisePlanes {
+  float p[NOISE_MAX_OCTAVES][2][TOTAL_LEDS]; // per octave: planes at z0 and z0 + 1
+  uint32_t z0[NOISE_MAX_OCTAVES];
+  bool have[NOISE_MAX_OCTAVES]{};
+  uint16_t n{0}; float delta{0.0f}; bool branch{false}; const uint8_t *mask{nullptr};
+  uint32_t planes{0}; // LED planes hashed so far (4 hashes each)
+};
+
+// Noise-space position of LED idx: spatial frequency 3 with a half-cell offset. Branch
+// layout puts the 4 branches along +x, -x, +y, -y with delta spacing.
+inline void perlinXY(uint16_t idx, const ParamSet &ps, float &x, float &y){
+  float px = (float)idx * ps.delta, py = 0.0f;
+  if (ps.branch){
+    uint8_t b = idx / LEDS_PER_BRANCH, i = idx % LEDS_PER_BRANCH;
+    float dist = ps.delta * i + ps.delta * 0.5f;
+    px = b == 0 ? dist : b == 1 ? -dist : 0.0f;
+    py = b == 2 ? dist : b == 3 ? -dist : 0.0f;
+  }
+  x = px*3.0f + 0.5f; y = py*3.0f + 0.5f;
+}
+
+inline void perlin(uint64_t tUs, uint16_t n, const ParamSet &ps, float *out, const uint8_t *mask = nullptr, NoisePlanes *planes = nullptr){
+  // width (1..8) -> ridge offset, 3 -> 1.5
+  float offset = 1.5f/3.0f*float(ps.width);
+  const float lacu = 1.3f, gain = 0.75f;
+  uint8_t octaves = ps.octaves < 1 ? 1 : ps.octaves > NOISE_MAX_OCTAVES ? NOISE_MAX_OCTAVES : ps.octaves;
+  // Ridge normalization (max occurs when each octave hits offset^2 * amp)
+  float ampSum = 0.5f * (1.0f - powf(gain, (float)octaves)) / (1.0f - gain);
+  float maxRidge = offset*offset * ampSum;
+  float invMax = (maxRidge>1e-6f)?(1.0f/maxRidge):1.0f;
+  // Time axis per octave: ts*3 noise cells (speed 1 => 0.02 cells/s per unit) times the
+  // octave frequency, each taken from the clock at its own rate and wrapped to the z period
+  // so every octave stays seamless
+  float f[NOISE_MAX_OCTAVES], amp[NOISE_MAX_OCTAVES], w[NOISE_MAX_OCTAVES];
+  uint32_t Z0[NOISE_MAX_OCTAVES], Z1[NOISE_MAX_OCTAVES];
+  float fo = 1.0f, ao = 0.5f;
+  for (uint8_t o = 0; o < octaves; ++o){
+    uint64_t zq = TimeBase::cyclesQ32(tUs, ps.speed * 0.02f * ps.globalSpeed * 3.0f * fo);
+    float zt = (float)((uint32_t)(zq >> 32) & (NOISE_Z_PERIOD - 1)) + (float)((uint32_t)zq >> 8) * (1.0f / 16777216.0f);
+    w[o] = noiseZ(zt, Z0[o], Z1[o]); f[o] = fo; amp[o] = ao;
+    fo *= lacu; ao *= gain;
+  }
+  // Branch layout covers the 4 x 7 LEDs only
+  uint16_t count = ps.branch ? (n < TOTAL_LEDS ? n : (uint16_t)TOTAL_LEDS) : n;
+  if (planes && count > TOTAL_LEDS) planes = nullptr;
+  if (planes){
+    if (planes->n != count || planes->delta != ps.delta || planes->branch != ps.branch || planes->mask != mask){
+      planes->n = count; planes->delta = ps.delta; planes->branch = ps.branch; planes->mask = mask;
+      for (uint8_t o = 0; o < NOISE_MAX_OCTAVES; ++o) planes->have[o] = false;
+    }
+    for (uint8_t o = 0; o < octaves; ++o){
+      if (planes->have[o] && planes->z0[o] == Z0[o]) continue;
+      // z moved up one plane (the usual case): the old upper plane becomes the lower one
+      bool shift = planes->have[o] && Z0[o] == ((planes->z0[o] + 1) & (NOISE_Z_PERIOD - 1));
+      for (uint16_t i = 0; i < count; ++i){
+        if (!rendered(mask, i)) continue;
+        float x, y; perlinXY(i, ps, x, y);
+        if (shift) planes->p[o][0][i] = planes->p[o][1][i];
+        else { planes->p[o][0][i] = noisePlane(x*f[o], y*f[o], Z0[o]); planes->planes++; }
+        planes->p[o][1][i] = noisePlane(x*f[o], y*f[o], Z1[o]); planes->planes++;
+      }
+      planes->z0[o] = Z0[o]; planes->have[o] = true;
+    }
+  }
+  for (uint16_t i = 0; i < count; ++i){
+    if (!rendered(mask, i)) { out[i] = 0.0f; continue; }
+    float x = 0.0f, y = 0.0f;
+    if (!planes) perlinXY(i, ps, x, y);
+    float p = 0.0f;
+    for (uint8_t o = 0; o < octaves; ++o){
+      float nv = planes ? vlerp(planes->p[o][0][i], planes->p[o][1][i], w[o])
+                        : valueNoiseZ(x*f[o], y*f[o], Z0[o], Z1[o], w[o]);
+      nv = nv*2.0f - 1.0f; nv = offset - fabsf(nv); nv = nv*nv; p += nv*amp[o];
+    }
+    p *= invMax; p = p*p;
+    float v = 0.0f;
+    if (p <= 0.1f) v = 0.0f; else if (p >= 1.0f) v = 1.0f; else v = (p-0.1f)/(1.0f-0.1f);
+    v = v*v;
+    // Calibration clamp & remap
+    if (ps.calMax > ps.calMin){
+      if (v <= ps.calMin) v = 0.0f; else if (v >= ps.calMax) v = 1.0f; else v = (v - ps.calMin)/(ps.calMax - ps.calMin);
+    }
+    out[i] = v;
+  }
+}
+
+// Global min/max scaling, applied after every animation
+inline void applyGlobalRange(const ParamSet &ps, uint16_t n, float *out) {
+  if (ps.globalMin != 0.0f || ps.globalMax != 1.0f) {
+    float gmin = ps.globalMin;
+    float gscale = (ps.globalMax > ps.globalMin) ? (ps.globalMax - ps.globalMin) : 0.0f;
+    for (uint16_t i = 0; i < n; ++i) {
+      float v = out[i];
+      v = gmin + v * gscale;
+      if (v < 0.0f) v = 0.0f; else if (v > 1.0f) v = 1.0f;
+      out[i] = v;
+    }
+  }
+}
+
+// tUs: synced clock in µs. seed keys the counter-based RNG of stochastic animations (Sparkle),
+// mask limits per-LED kernels to connected LEDs (see rendered()), planes keeps Perlin noise
+// planes across frames (see NoisePlanes), spark the Sparkle lit list of out (see SparkDirty)
+inline void applyAnim(uint8_t animIndex, uint64_t tUs, uint16_t n, const ParamSet &ps, float *out, uint32_t seed = 0, const uint8_t *mask = nullptr, NoisePlanes *planes = nullptr, SparkDirty *spark = nullptr) {
+  // The lit list only holds while out is Sparkle output as is: the global range rewrites every LED
+  if (spark && (animIndex != 5 || ps.globalMin != 0.0f || ps.globalMax != 1.0f)) { spark->valid = false; spark = nullptr; }
   switch (animIndex) {
     case 0: // Static
-      staticOn(t, n, ps.level, out);
+      staticOn(tUs, n, ps.level, out);
       break;
     case 1: // Wave
-      wave(t, n, ps.speed * ps.globalSpeed, ps.phase, ps.branch, ps.invert, out);
+      wave(tUs, n, ps.speed * ps.globalSpeed, ps.phase, ps.branch, ps.invert, out, mask);
       break;
     case 2: // Pulse (reuse pulse primitive with branch)
-      pulse(t, n, ps.speed * ps.globalSpeed, ps.phase, ps.branch, out);
+      pulse(tUs, n, ps.speed * ps.globalSpeed, ps.phase, ps.branch, out);
       break;
     case 3: // Chase
-      chase(t, n, ps.speed * ps.globalSpeed, ps.width == 0 ? 1 : ps.width, ps.branch, out);
+      chase(tUs, n, ps.speed * ps.globalSpeed, ps.width == 0 ? 1 : ps.width, ps.branch, out);
       break;
     case 4: // Single
-      single(t, n, ps.singleIndex, out);
+      single(tUs, n, ps.singleIndex, out);
       break;
     case 5: // Sparkle
-      sparkle(t, n, ps.speed * ps.globalSpeed, ps.randomMode, ps, out);
+      sparkle(tUs, n, ps.speed * ps.globalSpeed, ps.randomMode, ps, out, seed, mask, spark);
+      break;
+    case 6: // Perlin (ridge) pattern on virtual 3D rotation collapsed to 2D; branch layout uses delta spacing
+      perlin(tUs, n, ps, out, mask, planes);
       break;
-    case 6: { // Perlin (ridge) pattern on virtual 3D rotation collapsed to 2D; branch layout uses delta spacing
-      // Map width param (1..8) -> offset for ridge (1 -> 1.5 baseline). We'll treat 'width' directly: offset = 1.5 + (width-1)*0.25
-      float offset = 1.5f/3.0f*float(ps.width); // simple mapping; user asked 1 -> 1.5
-      int octaves = 1; // fixed as requested
-      float lacu = 1.3f; float gain=0.75f;
-      // Effective time speed: user speed * 0.002 base scaling (speed=1 => 0.002)
-      float ts = t * (ps.speed * 0.02f) * ps.globalSpeed;
-      // Precompute ridge normalization (max occurs when each octave hits offset^2 * amp)
-      float ampSum = 0.5f * (1.0f - powf(gain, (float)octaves)) / (1.0f - gain);
-      float maxRidge = offset*offset * ampSum;
-      float invMax = (maxRidge>1e-6f)?(1.0f/maxRidge):1.0f;
-      // Branch geometry: if branch flag set, we compute per branch LED coords along axes separated by delta spacing
-      if (ps.branch){
-        for (uint8_t b=0;b<BRANCHES;b++){
-          for (uint8_t i=0;i<LEDS_PER_BRANCH;i++){
-            uint16_t idx = b*LEDS_PER_BRANCH + i; if (idx>=n) continue;
-            float dist = ps.delta * i + ps.delta * 0.5f; // start at half delta similar to UI first=0.5 maybe adjust
-            float x=0,y=0,z=0;
-            switch(b){
-              case 0: x = dist; break; // Right
-              case 1: x = -dist; break; // Left
-              case 2: y = dist; break; // Up
-              case 3: y = -dist; break; // Down
-            }
-            // sample ridge (spatialFreq ~3 like JS) compress coordinates
-            float p = ridgeNoise(x*3.0f + 0.5f, y*3.0f + 0.5f, z*3.0f + ts*3.0f, octaves, lacu, gain, offset);
-            p *= invMax; p = p*p;
-            float v = 0.0f;
-            if (p <= 0.1f) v=0.0f; else if (p >= 1.0f) v=1.0f; else v=(p-0.1f)/(1.0f-0.1f);
-            v = v*v;
-            // Apply calibration clamp & remap
-            if (ps.calMax > ps.calMin){
-              if (v <= ps.calMin) v=0.0f; else if (v >= ps.calMax) v=1.0f; else v = (v - ps.calMin)/(ps.calMax - ps.calMin);
-            }
-            out[idx] = v;
-          }
-        }
-      } else {
-        // Linear layout across n
-        for (uint16_t i=0;i<n;i++){
-          float x = (float)i * ps.delta; float y=0,z=0;
-          float p = ridgeNoise(x*3.0f + 0.5f, y*3.0f + 0.5f, z*3.0f + ts*3.0f, octaves, lacu, gain, offset);
-          p*=invMax; p=p*p; float v=0; if (p<=0.1f) v=0; else if (p>=1.0f) v=1.0f; else v=(p-0.1f)/(0.9f); v=v*v;
-          if (ps.calMax > ps.calMin){
-            if (v <= ps.calMin) v=0.0f; else if (v >= ps.calMax) v=1.0f; else v = (v - ps.calMin)/(ps.calMax - ps.calMin);
-          }
-          out[i]=v;
-        }
-      }
-      break; }
     default:
       // Fallback: clear
       for (uint16_t i = 0; i < n; ++i) out[i] = 0.0f;
       break;
   }
 
-  // Apply global min/max scaling if needed
-  if (ps.globalMin != 0.0f || ps.globalMax != 1.0f) {
-    float gmin = ps.globalMin;
-    float gscale = (ps.globalMax > ps.globalMin) ? (ps.globalMax - ps.globalMin) : 0.0f;
-    for (uint16_t i = 0; i < n; ++i) {
-      float v = out[i];
-      v = gmin + v * gscale;
-      if (v < 0.0f) v = 0.0f; else if (v > 1.0f) v = 1.0f;
-      out[i] = v;
-    }
+  applyGlobalRange(ps, n, out);
+}
+
+// Float seconds (web simulator, host tools)
+inline void applyAnim(uint8_t animIndex, float t, uint16_t n, const ParamSet &ps, float *out, uint32_t seed = 0, const uint8_t *mask = nullptr) {
+  applyAnim(animIndex, TimeBase::fromSeconds(t), n, ps, out, seed, mask);
+}
+
+// Animations worth serving from FrameCache: the turn rate for TimeBase and, for stepwise ones,
+// the number of distinct frames per turn (0 = continuous). Only Wave: Pulse and Chase are
+// periodic too, but render directly faster than a cached frame is unpacked and interpolated
+// (28 LEDs: Pulse 110 vs 134 ns, Pulse branch 148 vs 231 ns, Chase 99 vs 149 ns).
+inline bool periodOf(uint8_t animIndex, uint16_t n, const ParamSet &ps, float &cyclesPerSec, uint16_t &steps) {
+  (void)n;
+  switch (animIndex) {
+    case 1: cyclesPerSec = ps.speed * ps.globalSpeed / TWO_PI_F; steps = 0; return true;
+    default: return false;
+  }
+}
+
+// A periodic animation at a given turn, global range applied (same output as applyAnim)
+inline void applyAnimAt(uint8_t animIndex, float turn, uint16_t n, const ParamSet &ps, float *out, const uint8_t *mask = nullptr) {
+  switch (animIndex) {
+    case 1: waveAt(turn, n, ps.phase, ps.branch, ps.invert, out, mask); break;
+    case 2: pulseAt(turn, n, ps.phase, ps.branch, out); break;
+    case 3: chaseAt(turn, n, ps.width == 0 ? 1 : ps.width, ps.branch, out); break;
+    default: for (uint16_t i = 0; i < n; ++i) out[i] = 0.0f; break;
   }
+  applyGlobalRange(ps, n, out);
 }
 }
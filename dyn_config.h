@@ -1,5 +1,9 @@
 #pragma once
-#include <Arduino.h>
+#if defined(__EMSCRIPTEN__) || defined(_LP64)
+  #include "web-sim2/Arduino.h"
+#else
+  #include <Arduino.h>
+#endif
 #include "protocol.h"
 #include "anim_schema.h"
 
@@ -71,4 +75,41 @@ inline bool decodeCfg2(const uint8_t *data, uint8_t len,
   return true;
 }
 
+// 16-bit fingerprint of a follower config (animIndex + every schema param) taken over the
+// quantized wire values, so leader and follower agree after a CFG2 round trip. Never 0,
+// which marks "no hash" in legacy packets.
+inline uint16_t configHash(uint8_t animIndex, const Anim::ParamSet &ps) {
+  uint32_t h = 2166136261u; // FNV-1a
+  auto mix=[&](uint8_t b){ h ^= b; h *= 16777619u; };
+  mix(animIndex);
+  for (uint8_t i=0;i<AnimSchema::PARAM_COUNT;i++) {
+    const ParamDef *pdPGM = AnimSchema::findParam(AnimSchema::PARAM_IDS[i]); if (!pdPGM) continue;
+    ParamDef pd; memcpy_P(&pd, pdPGM, sizeof(pd));
+    uint32_t q = encodeValue(Anim::getParamField(ps, pd.id), pd);
+    mix(pd.id); for (uint8_t b=0;b<valueBytes(pd);b++) mix((uint8_t)(q>>(8*b)));
+  }
+  uint16_t f = (uint16_t)(h ^ (h >> 16));
+  return f ? f : 1;
+}
+
+// Join answer: SYNC header + full follower CFG2 in one frame (see Proto::JoinHeader)
+inline uint8_t encodeJoin(uint32_t time_ms, uint32_t frame, uint8_t target,
+                          uint8_t animIndex, const ParamValue *params, uint8_t paramCount,
+                          uint8_t *out, uint8_t outMax) {
+  Proto::JoinHeader h; h.time_ms = time_ms; h.frame = frame; h.target = target;
+  if (outMax < sizeof(h)) return 0;
+  memcpy(out, &h, sizeof(h));
+  uint8_t len = encodeCfg2(1, animIndex, params, paramCount, nullptr, 0, out + sizeof(h), (uint8_t)(outMax - sizeof(h)));
+  return len ? (uint8_t)(sizeof(h) + len) : 0;
+}
+
+inline bool decodeJoin(const uint8_t *data, uint8_t len, Proto::JoinHeader &hdr,
+                       uint8_t &role, uint8_t &animIndex,
+                       ParamValue *outParams, uint8_t &outCount,
+                       ParamValue *outGlobals, uint8_t &outGCount) {
+  if (len < sizeof(Proto::JoinHeader) || data[0] != Proto::MSG_JOIN) return false;
+  memcpy(&hdr, data, sizeof(hdr));
+  return decodeCfg2(data + sizeof(hdr), (uint8_t)(len - sizeof(hdr)), role, animIndex, outParams, outCount, outGlobals, outGCount);
+}
+
 } // namespace DynCfg
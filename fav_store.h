@@ -0,0 +1,420 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "anim_schema.h"
+#include "json_reader.h"
+#include "json_writer.h"
+
+// Favorites in NVS as compact binary records plus one index record. Each favorite is stored
+// under "fv<id>" with ids that never change once handed out, so deleting one is two writes
+// (the index and the removed record) however many favorites follow it, and auto mode
+// selections stay valid. A record holds the name and, per section (globals, leader,
+// follower), the animation index, a bitmap over AnimSchema::PARAMS rows and each present
+// value quantized like CFG2 (encodeValue / valueBytes), usually 30-60 bytes where the JSON
+// text was several hundred:
+//
+//   0 version (1)   1 bitmap bytes   2 name length   3.. name (JSON-escaped)
+//   then 3 x { anim (0xFF = none), bitmap, values in row order, little endian }
+//
+// PARAM_LIST is append-only as far as stored records go: a record written with fewer rows
+// still reads, a row that changes its bits does not. The index ("fav_idx") is version,
+// reserved, next id u16, count u16, then the ids in list order. Store is templated on the
+// Preferences class so the host tests run it against test-ui/mock_preferences.h.
+#ifndef FAV_MAX
+#define FAV_MAX 200 // stored favorites (2 bytes each in the index record)
+#endif
+#ifndef FAV_NAME_MAX
+#define FAV_NAME_MAX 39 // bytes of a favorite's name as stored (JSON-escaped); longer names are cut
+#endif
+#ifndef FAV_LEGACY_JSON_MAX
+#define FAV_LEGACY_JSON_MAX 1024 // largest fav_N JSON string migrate() reads (stack)
+#endif
+#ifndef FAV_CACHE_ENTRIES
+#define FAV_CACHE_ENTRIES 8 // decoded favorites Cache keeps in RAM (~170 bytes each)
+#endif
+
+namespace FavStore {
+
+static const uint8_t RECORD_VERSION = 1, INDEX_VERSION = 1;
+static const uint8_t ROW_BYTES = (AnimSchema::PARAM_COUNT + 7) / 8;
+static const uint8_t NO_ANIM = 0xFF;
+static const uint16_t MAX_ID = 0x7FFF; // ids fit Ws::Snapshot::autoId
+static const char *const INDEX_KEY = "fav_idx";
+
+enum Section : uint8_t { GLOBALS = 0, LEADER = 1, FOLLOWER = 2, SECTIONS = 3 };
+static const char *const SECTION_KEYS[SECTIONS] = { "globals", "leader", "follower" };
+
+inline AnimSchema::ParamDef paramDef(uint8_t row) {
+  AnimSchema::ParamDef pd;
+  memcpy_P(&pd, &AnimSchema::PARAMS[row], sizeof(pd));
+  return pd;
+}
+
+// Shortest decimal that quantizes back to q, so a speed of 3 stored as 1024/4095 of 0..12
+// reads back as 3 and not 3.0007
+inline float value(uint32_t q, const AnimSchema::ParamDef &pd, uint8_t *decimals = nullptr) {
+  float v = AnimSchema::decodeValue(q, pd), scale = 1.0f;
+  for (uint8_t d = 0; d <= 6; ++d, scale *= 10.0f) {
+    float r = roundf(v * scale) / scale;
+    if (r >= pd.minVal && r <= pd.maxVal && AnimSchema::encodeValue(r, pd) == q) { if (decimals) *decimals = d; return r; }
+  }
+  if (decimals) *decimals = 6;
+  return v;
+}
+
+struct Part {
+  uint8_t anim = NO_ANIM;
+  uint8_t mask[ROW_BYTES] = {};
+  uint32_t q[AnimSchema::PARAM_COUNT] = {};
+
+  bool has(uint8_t row) const { return (mask[row >> 3] >> (row & 7)) & 1; }
+  void set(uint8_t id, float v) {
+    uint8_t row = AnimSchema::PARAM_ROW[id];
+    if (row == AnimSchema::NO_ROW) return;
+    mask[row >> 3] |= (uint8_t)(1u << (row & 7));
+    q[row] = AnimSchema::encodeValue(v, paramDef(row));
+  }
+  bool get(uint8_t id, float &v) const {
+    uint8_t row = AnimSchema::PARAM_ROW[id];
+    if (row == AnimSchema::NO_ROW || !has(row)) return false;
+    v = value(q[row], paramDef(row));
+    return true;
+  }
+  bool empty() const { for (uint8_t b : mask) if (b) return false; return anim == NO_ANIM; }
+  // Every stored param into ps; returns how many were set
+  uint8_t apply(Anim::ParamSet &ps) const {
+    uint8_t n = 0;
+    for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row)
+      if (has(row)) n += Anim::setParamField(ps, AnimSchema::PARAM_IDS[row], value(q[row], paramDef(row)));
+    return n;
+  }
+};
+
+struct Favorite {
+  uint8_t nameLen = 0;
+  char name[FAV_NAME_MAX + 1] = "";
+  Part part[SECTIONS];
+
+  // Raw JSON string contents; cut to FAV_NAME_MAX on a code point (Json::escapedPrefix)
+  void setName(const char *s, size_t n) {
+    size_t i = Json::escapedPrefix(s, n, FAV_NAME_MAX);
+    memcpy(name, s, i);
+    name[i] = 0;
+    nameLen = (uint8_t)i;
+  }
+};
+
+// Body of POST /api/favorites/add: {name, globals:{globalSpeed}, leader:{animIndex, params:[{id,value}]}, follower:{...}}
+inline bool fromJson(const char *js, size_t len, Favorite &f) {
+  Json::Doc<> doc(js, len);
+  if (!doc.ok() || !doc.is(0, Json::T_OBJECT)) return false;
+  f = Favorite();
+  int nm = doc.get(0, "name");
+  if (doc.is(nm, Json::T_STRING) || doc.is(nm, Json::T_PRIMITIVE)) f.setName(js + doc.tok[nm].start, doc.tok[nm].end - doc.tok[nm].start);
+  else f.setName("favorite", 8);
+  // Globals by name, as the UI exports them
+  int g = doc.get(0, SECTION_KEYS[GLOBALS]);
+  if (doc.is(g, Json::T_OBJECT)) {
+    for (int k = g + 1; k + 1 < doc.count && doc.tok[k].start < doc.tok[g].end; k = Json::skip(doc.tok, doc.count, k + 1))
+      for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row)
+        if (Json::eq(js, doc.tok[k], paramDef(row).name)) { f.part[GLOBALS].set(AnimSchema::PARAM_IDS[row], doc.num(k + 1, 0.0f)); break; }
+  }
+  for (uint8_t s = LEADER; s <= FOLLOWER; ++s) {
+    int b = doc.get(0, SECTION_KEYS[s]);
+    if (b < 0) continue;
+    long a = doc.integer(doc.get(b, "animIndex"), NO_ANIM);
+    f.part[s].anim = a >= 0 && a < NO_ANIM ? (uint8_t)a : NO_ANIM;
+    Part &p = f.part[s];
+    doc.forEachParam(doc.get(b, "params"), [&](uint8_t id, float v) { p.set(id, v); });
+  }
+  return true;
+}
+
+// The favorite as the UI stored it (the "cfg" of GET /api/favorites)
+template<size_t C>
+void writeJson(Json::Writer<C> &w, const Favorite &f) {
+  w.beginObject().key("v").num(1).key("name").rawStr(f.name, f.nameLen);
+  for (uint8_t s = GLOBALS; s < SECTIONS; ++s) {
+    const Part &p = f.part[s];
+    if (p.empty()) continue;
+    w.key(SECTION_KEYS[s]).beginObject();
+    if (s != GLOBALS) w.key("animIndex").num((unsigned)p.anim).key("params").beginArray();
+    for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row) {
+      if (!p.has(row)) continue;
+      AnimSchema::ParamDef pd = paramDef(row);
+      uint8_t d;
+      float v = value(p.q[row], pd, &d);
+      if (s == GLOBALS) w.key(pd.name).num(v, d);
+      else w.beginObject().key("id").num((unsigned)pd.id).key("value").num(v, d).endObject();
+    }
+    if (s != GLOBALS) w.endArray();
+    w.endObject();
+  }
+  w.endObject();
+}
+
+static const size_t MAX_RECORD = 3 + FAV_NAME_MAX + SECTIONS * (1 + ROW_BYTES + 4 * AnimSchema::PARAM_COUNT);
+
+inline size_t encode(const Favorite &f, uint8_t *out, size_t cap) {
+  if (cap < 3u + f.nameLen) return 0;
+  uint8_t *p = out, *end = out + cap;
+  *p++ = RECORD_VERSION; *p++ = ROW_BYTES; *p++ = f.nameLen;
+  memcpy(p, f.name, f.nameLen); p += f.nameLen;
+  for (const Part &s : f.part) {
+    if ((size_t)(end - p) < 1u + ROW_BYTES) return 0;
+    *p++ = s.anim;
+    memcpy(p, s.mask, ROW_BYTES); p += ROW_BYTES;
+    for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row) {
+      if (!s.has(row)) continue;
+      uint8_t vb = AnimSchema::valueBytes(paramDef(row));
+      if ((size_t)(end - p) < vb) return 0;
+      for (uint8_t b = 0; b < vb; ++b) *p++ = (uint8_t)(s.q[row] >> (8 * b));
+    }
+  }
+  return (size_t)(p - out);
+}
+
+inline bool decode(const uint8_t *in, size_t len, Favorite &f) {
+  if (len < 3 || in[0] != RECORD_VERSION || in[1] > ROW_BYTES || in[2] > FAV_NAME_MAX || len < 3u + in[2]) return false;
+  f = Favorite();
+  const uint8_t rowBytes = in[1], *p = in + 3 + in[2], *end = in + len;
+  f.nameLen = in[2];
+  memcpy(f.name, in + 3, f.nameLen);
+  f.name[f.nameLen] = 0;
+  for (Part &s : f.part) {
+    if ((size_t)(end - p) < 1u + rowBytes) return false;
+    s.anim = *p++;
+    memcpy(s.mask, p, rowBytes); p += rowBytes;
+    for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row) {
+      if (!s.has(row)) continue;
+      uint8_t vb = AnimSchema::valueBytes(paramDef(row));
+      if ((size_t)(end - p) < vb) return false;
+      s.q[row] = 0;
+      for (uint8_t b = 0; b < vb; ++b) s.q[row] |= (uint32_t)*p++ << (8 * b);
+    }
+  }
+  return p == end;
+}
+
+template<typename Prefs>
+class Store {
+public:
+  explicit Store(Prefs &prefs) : _prefs(prefs) {}
+
+  // Ids in list order; returns the count
+  uint16_t list(uint16_t *ids, uint16_t cap) {
+    Index idx;
+    readIndex(idx);
+    uint16_t n = idx.count < cap ? idx.count : cap;
+    memcpy(ids, idx.ids, n * sizeof(uint16_t));
+    return n;
+  }
+  bool load(uint16_t id, Favorite &f) {
+    char k[8]; key(k, id);
+    uint8_t buf[MAX_RECORD];
+    size_t n = _prefs.getBytes(k, buf, sizeof(buf));
+    return n && decode(buf, n, f);
+  }
+  // New favorite at the end of the list; its id, or -1 when full or the write failed
+  int32_t add(const Favorite &f) {
+    Index idx;
+    readIndex(idx);
+    if (idx.count >= FAV_MAX) return -1;
+    uint16_t id = idx.next;
+    while (idx.find(id) >= 0) id = id >= MAX_ID ? 0 : (uint16_t)(id + 1);
+    uint8_t buf[MAX_RECORD];
+    size_t n = encode(f, buf, sizeof(buf));
+    char k[8]; key(k, id);
+    if (!n || _prefs.putBytes(k, buf, n) != n) return -1;
+    idx.ids[idx.count++] = id;
+    idx.next = id >= MAX_ID ? 0 : (uint16_t)(id + 1);
+    if (!writeIndex(idx)) { _prefs.remove(k); return -1; }
+    return id;
+  }
+  // Index first: a reset in between leaves an unlisted record, never a listed hole
+  bool remove(uint16_t id) {
+    Index idx;
+    readIndex(idx);
+    int at = idx.find(id);
+    if (at < 0) return false;
+    memmove(idx.ids + at, idx.ids + at + 1, (idx.count - at - 1) * sizeof(uint16_t));
+    idx.count--;
+    if (!writeIndex(idx)) return false;
+    char k[8]; key(k, id);
+    _prefs.remove(k);
+    return true;
+  }
+
+  // One-time conversion of the JSON strings under fav_0..fav_<fav_count-1>. Position N keeps
+  // id N so stored auto selections still point at the same favorites. Entries that do not
+  // parse are dropped. Returns the number converted.
+  uint16_t migrate() {
+    if (!_prefs.isKey("fav_count")) return 0;
+    uint8_t n = _prefs.getUChar("fav_count", 0);
+    uint16_t done = 0;
+    if (!_prefs.isKey(INDEX_KEY)) {
+      Index idx;
+      idx.next = n;
+      for (uint8_t i = 0; i < n; ++i) {
+        char k[8]; snprintf(k, sizeof(k), "fav_%u", (unsigned)i);
+        char js[FAV_LEGACY_JSON_MAX];
+        Favorite f;
+        uint8_t buf[MAX_RECORD];
+        size_t len = 0;
+        if (!_prefs.getString(k, js, sizeof(js)) || !fromJson(js, strlen(js), f) || !(len = encode(f, buf, sizeof(buf)))) continue;
+        key(k, i);
+        if (_prefs.putBytes(k, buf, len) != len) continue;
+        idx.ids[idx.count++] = i;
+      }
+      if (!writeIndex(idx)) return 0; // legacy keys stay for the next boot
+      done = idx.count;
+    }
+    // Reached again only if a reset came between the index write and this cleanup
+    for (uint8_t i = 0; i < n; ++i) { char k[8]; snprintf(k, sizeof(k), "fav_%u", (unsigned)i); _prefs.remove(k); }
+    _prefs.remove("fav_count");
+    return done;
+  }
+
+private:
+  struct Index {
+    uint16_t next = 0, count = 0;
+    uint16_t ids[FAV_MAX];
+    int find(uint16_t id) const { for (uint16_t i = 0; i < count; ++i) if (ids[i] == id) return i; return -1; }
+  };
+  static void key(char out[8], uint16_t id) { snprintf(out, 8, "fv%u", (unsigned)id); }
+
+  void readIndex(Index &idx) {
+    uint8_t buf[6 + 2 * FAV_MAX];
+    size_t n = _prefs.isKey(INDEX_KEY) ? _prefs.getBytes(INDEX_KEY, buf, sizeof(buf)) : 0;
+    idx.next = idx.count = 0;
+    if (n < 6 || buf[0] != INDEX_VERSION) return;
+    idx.next = (uint16_t)(buf[2] | buf[3] << 8);
+    uint16_t c = (uint16_t)(buf[4] | buf[5] << 8);
+    if (c > FAV_MAX || n < 6u + 2u * c) return;
+    for (uint16_t i = 0; i < c; ++i) idx.ids[i] = (uint16_t)(buf[6 + 2 * i] | buf[7 + 2 * i] << 8);
+    idx.count = c;
+  }
+  bool writeIndex(const Index &idx) {
+    uint8_t buf[6 + 2 * FAV_MAX];
+    buf[0] = INDEX_VERSION; buf[1] = 0;
+    buf[2] = (uint8_t)idx.next; buf[3] = (uint8_t)(idx.next >> 8);
+    buf[4] = (uint8_t)idx.count; buf[5] = (uint8_t)(idx.count >> 8);
+    for (uint16_t i = 0; i < idx.count; ++i) { buf[6 + 2 * i] = (uint8_t)idx.ids[i]; buf[7 + 2 * i] = (uint8_t)(idx.ids[i] >> 8); }
+    size_t n = 6u + 2u * idx.count;
+    return _prefs.putBytes(INDEX_KEY, buf, n) == n;
+  }
+
+  Prefs &_prefs;
+};
+
+// A favorite decoded for applying: per role the stored params already in ParamSet fields, so
+// switching to it is a masked field copy with no flash read and no value snapping
+struct Entry {
+  static const uint16_t NONE = 0xFFFF;
+  uint16_t id = NONE;
+  uint32_t used = 0; // LRU stamp
+  uint8_t nameLen = 0;
+  char name[FAV_NAME_MAX + 1] = "";
+  uint8_t anim[2] = { NO_ANIM, NO_ANIM }; // leader, follower
+  uint8_t mask[2][ROW_BYTES] = {};
+  Anim::ParamSet ps[2];
+  bool hasSpeed = false; // globals: only globalSpeed is applied
+  float globalSpeed = 0.0f;
+
+  void set(uint16_t favId, const Favorite &f) {
+    id = favId;
+    nameLen = f.nameLen;
+    memcpy(name, f.name, sizeof(name));
+    for (uint8_t r = 0; r < 2; ++r) {
+      const Part &p = f.part[LEADER + r];
+      anim[r] = p.anim;
+      memcpy(mask[r], p.mask, ROW_BYTES);
+      ps[r] = Anim::ParamSet();
+      p.apply(ps[r]);
+    }
+    hasSpeed = f.part[GLOBALS].get(AnimSchema::PID_GLOBAL_SPEED, globalSpeed);
+  }
+  bool has(uint8_t role, uint8_t row) const { return (mask[role][row >> 3] >> (row & 7)) & 1; }
+  // Role 0 leader, 1 follower: the stored fields over dst, and the animation unless it has none
+  void apply(uint8_t role, Anim::ParamSet &dst, uint8_t &animIndex) const {
+    for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row) {
+      if (!has(role, row)) continue;
+      const Anim::FieldSlot &fs = Anim::PARAM_SLOTS[row];
+      memcpy((uint8_t *)&dst + fs.offset, (const uint8_t *)&ps[role] + fs.offset, fs.kind == Anim::FK_FLOAT ? sizeof(float) : 1);
+    }
+    if (hasSpeed) dst.globalSpeed = globalSpeed;
+    if (anim[role] != NO_ANIM) animIndex = anim[role];
+  }
+};
+
+// The id list and the last FAV_CACHE_ENTRIES favorites used, decoded, in front of a Store.
+// get() reads flash only on a miss and then evicts the least recently used entry, except the
+// one prefetch() pinned: auto mode decodes its next selection ahead of the deadline, so the
+// switch itself is RAM only. add / remove go through to the store and drop what they change.
+template<typename Prefs>
+class Cache {
+public:
+  struct Stats { uint32_t hits = 0, misses = 0; };
+  Stats stats;
+
+  explicit Cache(Store<Prefs> &store) : _store(store) {}
+
+  uint16_t count() { loadIds(); return _count; }
+  const uint16_t *ids() { loadIds(); return _ids; }
+  bool contains(uint16_t id) { loadIds(); for (uint16_t i = 0; i < _count; ++i) if (_ids[i] == id) return true; return false; }
+
+  // Decoded favorite or nullptr; the pointer is good until the next get / prefetch / add / remove
+  const Entry *get(uint16_t id) {
+    _tick++;
+    for (Entry &e : _entries) if (e.id == id) { e.used = _tick; stats.hits++; return &e; }
+    if (!contains(id)) return nullptr;
+    stats.misses++;
+    Favorite f;
+    if (!_store.load(id, f)) return nullptr;
+    Entry *v = nullptr;
+    for (Entry &e : _entries) {
+      if (e.id == Entry::NONE) { v = &e; break; }
+      if (e.id != _pinned && (!v || e.used < v->used)) v = &e;
+    }
+    if (!v) v = _entries; // a single entry, pinned
+    v->set(id, f);
+    v->used = _tick;
+    return v;
+  }
+  // get() ahead of use; the entry is not evicted until the next prefetch
+  bool prefetch(uint16_t id) {
+    _pinned = Entry::NONE;
+    if (!get(id)) return false;
+    _pinned = id;
+    return true;
+  }
+
+  int32_t add(const Favorite &f) {
+    int32_t id = _store.add(f);
+    if (id >= 0 && _loaded) _ids[_count++] = (uint16_t)id; // the store refuses more than FAV_MAX
+    return id;
+  }
+  bool remove(uint16_t id) {
+    if (!_store.remove(id)) return false;
+    for (Entry &e : _entries) if (e.id == id) e.id = Entry::NONE;
+    if (_pinned == id) _pinned = Entry::NONE;
+    for (uint16_t i = 0; i < _count; ++i)
+      if (_ids[i] == id) { memmove(_ids + i, _ids + i + 1, (_count - i - 1) * sizeof(uint16_t)); _count--; break; }
+    return true;
+  }
+
+private:
+  void loadIds() { if (!_loaded) { _count = _store.list(_ids, FAV_MAX); _loaded = true; } }
+
+  Store<Prefs> &_store;
+  bool _loaded = false;
+  uint16_t _count = 0, _pinned = Entry::NONE;
+  uint16_t _ids[FAV_MAX];
+  uint32_t _tick = 0;
+  Entry _entries[FAV_CACHE_ENTRIES];
+};
+
+} // namespace FavStore
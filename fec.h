@@ -0,0 +1,136 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "protocol.h"
+
+// Erasure coding for config pushes. A packet (CFG2) is cut into k data fragments and m
+// parity fragments are added, each sent as its own MSG_FEC frame; any k of the n = k + m
+// rebuild the packet. Parity rows come from a Cauchy matrix over GF(2^8) (systematic
+// Reed-Solomon), so every k x k choice of rows is invertible. With m = 1 this is plain XOR
+// parity. The data fragments are the packet bytes themselves, so a clean link needs no math.
+#ifndef CFG_FEC_K
+#define CFG_FEC_K 0 // data fragments per CFG2, 0 = send CFG2 as one plain frame
+#endif
+#ifndef CFG_FEC_M
+#define CFG_FEC_M 1 // parity fragments per CFG2 (when CFG_FEC_K > 0)
+#endif
+
+namespace Fec {
+
+static constexpr uint8_t kMaxFrags = 8;      // k + m
+static constexpr uint8_t kMaxFragBytes = 32; // payload per fragment
+static constexpr uint8_t kHeaderBytes = 5;
+static constexpr uint8_t kMaxMsgBytes = Proto::BATCH_MAX_BYTES; // rebuilt packet
+
+// GF(2^8) with the 0x11D polynomial, log/exp tables built on first use
+struct Gf {
+  uint8_t exp[512];
+  uint8_t log[256];
+  Gf() {
+    uint16_t x = 1;
+    for (int i = 0; i < 255; ++i) { exp[i] = (uint8_t)x; log[x] = (uint8_t)i; x <<= 1; if (x & 0x100) x ^= 0x11D; }
+    for (int i = 255; i < 512; ++i) exp[i] = exp[i - 255];
+    log[0] = 0;
+  }
+  uint8_t mul(uint8_t a, uint8_t b) const { return (a && b) ? exp[log[a] + log[b]] : 0; }
+  uint8_t inv(uint8_t a) const { return exp[255 - log[a]]; }
+};
+inline const Gf &gf() { static const Gf g; return g; }
+
+// Parity row r, data column j: 1 / (x_r + y_j) with x_r = k + r, y_j = j
+inline uint8_t coef(uint8_t k, uint8_t r, uint8_t j) { return gf().inv((uint8_t)((k + r) ^ j)); }
+
+inline uint8_t fragBytes(uint8_t len, uint8_t k) { return (uint8_t)((len + k - 1) / k); }
+
+// Layout: type(1) | msgId(1) | k(4 bits) n(4 bits) | index(1) | len(1) | payload(ceil(len/k))
+// Returns the fragment size, 0 when the parameters do not fit.
+inline uint8_t encodeFragment(const uint8_t *msg, uint8_t len, uint8_t k, uint8_t m, uint8_t msgId,
+                              uint8_t idx, uint8_t *out, uint8_t outMax) {
+  uint8_t n = (uint8_t)(k + m);
+  if (k == 0 || len == 0 || len > kMaxMsgBytes || n > kMaxFrags || idx >= n) return 0;
+  uint8_t s = fragBytes(len, k);
+  if (s > kMaxFragBytes || kHeaderBytes + s > outMax) return 0;
+  out[0] = Proto::MSG_FEC; out[1] = msgId; out[2] = (uint8_t)((k << 4) | n); out[3] = idx; out[4] = len;
+  uint8_t *p = out + kHeaderBytes;
+  if (idx < k) {
+    for (uint8_t b = 0; b < s; ++b) { uint16_t at = (uint16_t)(idx * s + b); p[b] = at < len ? msg[at] : 0; }
+  } else {
+    const Gf &g = gf();
+    uint8_t c[kMaxFrags];
+    for (uint8_t j = 0; j < k; ++j) c[j] = coef(k, (uint8_t)(idx - k), j);
+    for (uint8_t b = 0; b < s; ++b) {
+      uint8_t acc = 0;
+      for (uint8_t j = 0; j < k; ++j) { uint16_t at = (uint16_t)(j * s + b); if (at < len) acc ^= g.mul(c[j], msg[at]); }
+      p[b] = acc;
+    }
+  }
+  return (uint8_t)(kHeaderBytes + s);
+}
+
+// Receiver side: collects the fragments of the latest message and rebuilds it once k
+// distinct ones are in. A fragment with another msgId/shape starts over.
+struct Assembler {
+  uint8_t msgId{0}, k{0}, n{0}, len{0};
+  uint8_t have{0}; // bitmask of fragment indices received
+  bool done{false};
+  uint8_t frag[kMaxFrags][kMaxFragBytes];
+
+  // Returns the rebuilt length (bytes in out, room for kMaxMsgBytes) or 0 while incomplete
+  uint8_t add(const uint8_t *pkt, uint8_t pktLen, uint8_t *out) {
+    if (pktLen < kHeaderBytes || pkt[0] != Proto::MSG_FEC) return 0;
+    uint8_t fk = (uint8_t)(pkt[2] >> 4), fn = (uint8_t)(pkt[2] & 0x0F), idx = pkt[3], flen = pkt[4];
+    if (fk == 0 || fn < fk || fn > kMaxFrags || idx >= fn || flen == 0 || flen > kMaxMsgBytes) return 0;
+    uint8_t s = fragBytes(flen, fk);
+    if (s > kMaxFragBytes || pktLen < kHeaderBytes + s) return 0;
+    if (pkt[1] != msgId || fk != k || fn != n || flen != len || !have) {
+      msgId = pkt[1]; k = fk; n = fn; len = flen; have = 0; done = false;
+    }
+    if (done || (have & (1u << idx))) return 0;
+    memcpy(frag[idx], pkt + kHeaderBytes, s);
+    have = (uint8_t)(have | (1u << idx));
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < n; ++i) count += (have >> i) & 1u;
+    if (count < k) return 0;
+    done = true;
+    return rebuild(s, out) ? len : 0;
+  }
+
+ private:
+  bool rebuild(uint8_t s, uint8_t *out) {
+    const Gf &g = gf();
+    // First k fragments we hold, data before parity; missing data rows are solved for
+    uint8_t rows[kMaxFrags], r = 0;
+    for (uint8_t i = 0; i < n && r < k; ++i) if (have & (1u << i)) rows[r++] = i;
+    uint8_t a[kMaxFrags][kMaxFrags], inv[kMaxFrags][kMaxFrags];
+    for (uint8_t i = 0; i < k; ++i) for (uint8_t j = 0; j < k; ++j) {
+      a[i][j] = rows[i] < k ? (uint8_t)(rows[i] == j) : coef(k, (uint8_t)(rows[i] - k), j);
+      inv[i][j] = (uint8_t)(i == j);
+    }
+    // Gauss-Jordan over GF(2^8)
+    for (uint8_t c = 0; c < k; ++c) {
+      uint8_t p = c;
+      while (p < k && !a[p][c]) ++p;
+      if (p == k) return false;
+      if (p != c) for (uint8_t j = 0; j < k; ++j) { uint8_t t = a[p][j]; a[p][j] = a[c][j]; a[c][j] = t; t = inv[p][j]; inv[p][j] = inv[c][j]; inv[c][j] = t; }
+      uint8_t f = g.inv(a[c][c]);
+      for (uint8_t j = 0; j < k; ++j) { a[c][j] = g.mul(a[c][j], f); inv[c][j] = g.mul(inv[c][j], f); }
+      for (uint8_t i = 0; i < k; ++i) {
+        if (i == c || !a[i][c]) continue;
+        uint8_t e = a[i][c];
+        for (uint8_t j = 0; j < k; ++j) { a[i][j] ^= g.mul(e, a[c][j]); inv[i][j] ^= g.mul(e, inv[c][j]); }
+      }
+    }
+    for (uint8_t j = 0; j < k; ++j) {
+      for (uint8_t b = 0; b < s; ++b) {
+        uint16_t at = (uint16_t)(j * s + b);
+        if (at >= len) break;
+        uint8_t acc = 0;
+        for (uint8_t i = 0; i < k; ++i) acc ^= g.mul(inv[j][i], frag[rows[i]][b]);
+        out[at] = acc;
+      }
+    }
+    return true;
+  }
+};
+
+} // namespace Fec
@@ -0,0 +1,157 @@
+#pragma once
+#include <stdint.h>
+#include "protocol.h"
+#include "tdma.h"
+
+// Leader-side table of followers that have announced themselves via ACK/REQ.
+// Fixed capacity (no heap); when full the least recently heard node is evicted.
+namespace Fleet {
+
+static constexpr uint8_t kMaxFollowers = 64;
+static constexpr uint8_t kMaxRetries = 3; // targeted SYNC resends per node per round
+
+struct Follower {
+  uint8_t id{0};          // 0 = free slot
+  uint8_t retries{0};     // targeted resends spent in the current round
+  int8_t snr{0};          // dB, last packet
+  int16_t rssi{0};        // dBm, last packet
+  int16_t offsetErrMs{0}; // follower-reported clock error before correction
+  uint32_t ackedFrame{0}; // last SYNC frame this node confirmed
+  uint32_t lastAckMs{0};  // leader time of last ACK (0 = never)
+  uint32_t lastSeenMs{0}; // leader time of last packet of any kind
+  uint16_t cfgHash{0};    // config hash from the node's last REQ (0 = unknown / legacy)
+  int16_t snrRefQ4{0};    // smoothed SNR, quarter dB referenced to 125 kHz (LinkRate)
+  bool snrValid{false};
+};
+
+struct Registry {
+  Follower nodes[kMaxFollowers];
+  uint8_t count{0};
+  uint32_t roundFrame{0}; // frame every follower is expected to ACK
+  bool roundOpen{false};
+  uint8_t rrCursor{0};    // round-robin cursor for targeted retries
+  uint8_t roundStartCount{0}; // registry size when the round began
+  uint8_t passes{0};          // broadcast retry passes spent in the current round
+
+  Follower* find(uint8_t id) {
+    for (uint8_t i = 0; i < count; ++i) if (nodes[i].id == id) return &nodes[i];
+    return nullptr;
+  }
+
+  // Find or insert; evicts the least recently seen node when the table is full.
+  Follower* touch(uint8_t id, uint32_t nowMs, int16_t rssi, int8_t snr) {
+    if (id == Proto::NODE_LEADER || id == Proto::NODE_BROADCAST) return nullptr;
+    Follower *f = find(id);
+    if (!f) {
+      if (count < kMaxFollowers) {
+        f = &nodes[count++];
+      } else {
+        f = &nodes[0];
+        for (uint8_t i = 1; i < count; ++i) if ((int32_t)(nodes[i].lastSeenMs - f->lastSeenMs) < 0) f = &nodes[i];
+      }
+      *f = Follower();
+      f->id = id;
+    }
+    f->lastSeenMs = nowMs; f->rssi = rssi; f->snr = snr;
+    return f;
+  }
+
+  // Link quality for rate selection: drops weigh 1/2, recoveries 1/4, so the fleet falls
+  // back quickly and climbs cautiously.
+  void noteSnr(uint8_t id, int16_t refQ4) {
+    Follower *f = find(id);
+    if (!f) return;
+    if (!f->snrValid) f->snrRefQ4 = refQ4;
+    else if (refQ4 < f->snrRefQ4) f->snrRefQ4 = (int16_t)((f->snrRefQ4 + refQ4) / 2);
+    else f->snrRefQ4 = (int16_t)((3 * f->snrRefQ4 + refQ4) / 4);
+    f->snrValid = true;
+  }
+
+  void beginRound(uint32_t frame) {
+    roundFrame = frame; roundOpen = true; roundStartCount = count; passes = 0;
+    for (uint8_t i = 0; i < count; ++i) nodes[i].retries = 0;
+  }
+
+  // Returns true when this ACK confirmed the open round for that node.
+  bool onAck(uint8_t id, uint32_t frame, int16_t offsetErrMs, uint32_t nowMs, int16_t rssi, int8_t snr) {
+    Follower *f = touch(id, nowMs, rssi, snr);
+    if (!f) return false;
+    f->offsetErrMs = offsetErrMs;
+    if (frame != roundFrame) return false;
+    f->ackedFrame = frame; f->lastAckMs = nowMs;
+    f->cfgHash = 0; // synced now; a node still missing its config keeps REQing with its hash
+    if (roundOpen && pendingCount() == 0) roundOpen = false;
+    return true;
+  }
+
+  // A REQ means that node lost sync: mark only it stale (reopening the round if needed)
+  // so the leader answers it without re-polling followers that already confirmed.
+  Follower* onReq(uint8_t id, uint32_t nowMs, int16_t rssi, int8_t snr) {
+    Follower *f = touch(id, nowMs, rssi, snr);
+    if (f) { f->ackedFrame = roundFrame - 1; f->retries = 0; roundOpen = true; }
+    return f;
+  }
+
+  // New nodes showed up during this round. Nodes that synced off someone else's SYNC
+  // and lost their first ACK are invisible to retries, so the leader follows up with
+  // another broadcast while the fleet is still growing.
+  bool grewThisRound() const { return count > roundStartCount; }
+
+  bool isStale(const Follower &f) const { return roundOpen && (f.lastAckMs == 0 || f.ackedFrame != roundFrame); }
+
+  uint8_t pendingCount() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < count; ++i) if (isStale(nodes[i])) n++;
+    return n;
+  }
+
+  // Stale nodes that still have retry budget
+  uint8_t retryableCount() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < count; ++i) if (isStale(nodes[i]) && nodes[i].retries < kMaxRetries) n++;
+    return n;
+  }
+
+  // Another registered node on f's TDMA slot (Tdma::slotFor), 0 = none. Both answer every
+  // broadcast SYNC at the same moment and lose their ACKs.
+  uint8_t slotPeer(const Follower &f) const {
+    for (uint8_t i = 0; i < count; ++i)
+      if (nodes[i].id != f.id && Tdma::slotFor(nodes[i].id) == Tdma::slotFor(f.id)) return nodes[i].id;
+    return 0;
+  }
+
+  // Registered nodes sharing their slot with another one
+  uint8_t slotClashCount() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < count; ++i) if (slotPeer(nodes[i])) n++;
+    return n;
+  }
+
+  // A stale node reported a config other than hash: its retry must be a targeted JOIN
+  bool anyNeedsConfig(uint16_t hash) const {
+    for (uint8_t i = 0; i < count; ++i) if (isStale(nodes[i]) && nodes[i].cfgHash && nodes[i].cfgHash != hash) return true;
+    return false;
+  }
+
+  // Retry pass for a broadcast resend of the round's SYNC: every stale node answers in its
+  // own slot, so one response window covers them all instead of one targeted window each.
+  // Passes have their own budget, nodes keep their targeted retries for the stragglers.
+  bool retryAll() {
+    if (passes >= kMaxRetries) return false;
+    passes++;
+    return true;
+  }
+
+  // Next stale node with retry budget left (round-robin), or nullptr when the round is done.
+  Follower* nextRetryTarget() {
+    for (uint8_t k = 0; k < count; ++k) {
+      uint8_t i = (uint8_t)((rrCursor + k) % count);
+      Follower &f = nodes[i];
+      if (isStale(f) && f.retries < kMaxRetries) { rrCursor = (uint8_t)(i + 1); f.retries++; return &f; }
+    }
+    roundOpen = false; // everyone confirmed or gave up
+    return nullptr;
+  }
+};
+
+} // namespace Fleet
@@ -0,0 +1,133 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "animations.h"
+
+// Frame cache for periodic animations. An animation that only depends on one turn fraction
+// (t * speed over its period) has one period sampled into keyframes of 12-bit levels, and
+// later frames are served by phase lookup: continuous animations interpolate between the two
+// neighbouring keyframes, stepwise ones store exactly one keyframe per state. Anim::periodOf
+// picks what is cached; today only Wave, where the lookup beats rendering. Keyframes are rendered lazily the first time a frame needs them, so the cost of a
+// new parameter set is spread over the first period. The cache is keyed on the animation,
+// LED count and the full ParamSet, so any config change (CFG2, web UI) starts it over.
+#ifndef FRAME_CACHE_BYTES
+#define FRAME_CACHE_BYTES 6144 // RAM for cached keyframes, 0 = render every frame
+#endif
+
+namespace FrameCache {
+
+static constexpr uint16_t kMaxFrames = 256; // keyframes per period
+static constexpr uint16_t kMinFrames = 32;  // fewer than this interpolates too coarsely: render instead
+static constexpr uint16_t kLevelMax = 4095;
+
+// 12-bit levels, two per 3 bytes
+inline uint32_t frameBytes(uint16_t n) { return ((uint32_t)n * 3 + 1) / 2; }
+inline uint16_t quant12(float v) { return v <= 0.0f ? 0 : v >= 1.0f ? kLevelMax : (uint16_t)(v * kLevelMax + 0.5f); }
+inline void pack12(const float *v, uint16_t n, uint8_t *p) {
+  for (uint16_t i = 0; i < n; i += 2) {
+    uint16_t a = quant12(v[i]);
+    uint16_t b = (i + 1 < n) ? quant12(v[i + 1]) : 0;
+    *p++ = (uint8_t)a; *p++ = (uint8_t)((a >> 8) | (b << 4)); if (i + 1 < n) *p++ = (uint8_t)(b >> 4);
+  }
+}
+inline uint16_t level12(const uint8_t *p, uint16_t i) {
+  const uint8_t *q = p + (i >> 1) * 3;
+  return (i & 1) ? (uint16_t)((q[1] >> 4) | (q[2] << 4)) : (uint16_t)(q[0] | ((q[1] & 0x0F) << 8));
+}
+
+struct Stats {
+  uint32_t hits{0};    // frames served from keyframes already cached
+  uint32_t misses{0};  // frames that had to render a keyframe first
+  uint32_t bypass{0};  // frames rendered directly (not periodic, or over budget)
+  uint32_t bytes{0};   // keyframe storage of the current period
+  uint16_t frames{0};  // keyframes per period
+  uint8_t hitPct() const { uint32_t all = hits + misses + bypass; return all ? (uint8_t)(100ull * hits / all) : 0; }
+};
+
+template<uint32_t Bytes = FRAME_CACHE_BYTES>
+struct Cache {
+  Stats stats;
+
+  void invalidate() { _valid = false; }
+
+  // Same output as Anim::applyAnim, within 12-bit quantisation (+ interpolation when continuous)
+  void render(uint8_t animIndex, uint64_t tUs, uint16_t n, const Anim::ParamSet &ps, float *out, uint32_t seed = 0, const uint8_t *mask = nullptr,
+              Anim::NoisePlanes *planes = nullptr, Anim::SparkDirty *spark = nullptr) {
+    float cps; uint16_t steps;
+    if (!Bytes || !Anim::periodOf(animIndex, n, ps, cps, steps) || !prepare(animIndex, n, ps, steps, mask)) {
+      stats.bypass++; stats.bytes = 0; stats.frames = 0;
+      Anim::applyAnim(animIndex, tUs, n, ps, out, seed, mask, planes, spark);
+      return;
+    }
+    if (spark) spark->valid = false; // out is about to hold a cached frame
+    uint32_t fb = frameBytes(n);
+    if (steps) {
+      // Same turn and index math as the renderer, so the state matches exactly
+      uint16_t k = (uint16_t)(TimeBase::turns(tUs, cps) * (float)steps) % steps;
+      bool miss = ensure(animIndex, n, ps, k, out);
+      (miss ? stats.misses : stats.hits)++;
+      const uint8_t *p = _buf + k * fb;
+      const float s = 1.0f / kLevelMax;
+      uint16_t i = 0;
+      for (; i + 1 < n; i += 2, p += 3) {
+        out[i] = (float)(p[0] | ((p[1] & 0x0F) << 8)) * s;
+        out[i + 1] = (float)((p[1] >> 4) | (p[2] << 4)) * s;
+      }
+      if (i < n) out[i] = level12(p, 0) * s;
+      return;
+    }
+    uint64_t pos = (uint64_t)TimeBase::turnsQ32(tUs, cps) * _frames;
+    uint16_t k0 = (uint16_t)(pos >> 32), k1 = (uint16_t)((k0 + 1) % _frames);
+    float f = (float)((uint32_t)pos >> 8) * (1.0f / 16777216.0f);
+    bool miss = ensure(animIndex, n, ps, k0, out);
+    miss = ensure(animIndex, n, ps, k1, out) || miss;
+    (miss ? stats.misses : stats.hits)++;
+    const uint8_t *p0 = _buf + k0 * fb, *p1 = _buf + k1 * fb;
+    // out = a * (1 - f) + b * f, with the 1/4095 scale folded into the weights
+    const float wa = (1.0f - f) * (1.0f / kLevelMax), wb = f * (1.0f / kLevelMax);
+    uint16_t i = 0;
+    for (; i + 1 < n; i += 2, p0 += 3, p1 += 3) {
+      out[i] = (float)(p0[0] | ((p0[1] & 0x0F) << 8)) * wa + (float)(p1[0] | ((p1[1] & 0x0F) << 8)) * wb;
+      out[i + 1] = (float)((p0[1] >> 4) | (p0[2] << 4)) * wa + (float)((p1[1] >> 4) | (p1[2] << 4)) * wb;
+    }
+    if (i < n) out[i] = level12(p0, 0) * wa + level12(p1, 0) * wb;
+  }
+
+ private:
+  uint8_t _buf[Bytes ? Bytes : 1];
+  uint8_t _have[kMaxFrames / 8];
+  bool _valid{false};
+  uint8_t _anim{0};
+  bool _stepwise{false};
+  uint16_t _n{0}, _frames{0};
+  const uint8_t *_mask{nullptr};
+  Anim::ParamSet _ps;
+
+  // Key check; sizes the keyframe table for a new animation/parameter set
+  bool prepare(uint8_t animIndex, uint16_t n, const Anim::ParamSet &ps, uint16_t steps, const uint8_t *mask) {
+    if (_valid && _anim == animIndex && _n == n && _mask == mask && memcmp(&_ps, &ps, sizeof(ps)) == 0) return _frames != 0;
+    _valid = true; _anim = animIndex; _n = n; _mask = mask; memcpy(&_ps, &ps, sizeof(ps));
+    memset(_have, 0, sizeof(_have));
+    _stepwise = steps != 0;
+    uint32_t fit = Bytes / frameBytes(n);
+    if (steps) _frames = (steps <= kMaxFrames && steps <= fit) ? steps : 0;
+    else _frames = (uint16_t)(fit < kMaxFrames ? fit : kMaxFrames);
+    if (!steps && _frames < kMinFrames) _frames = 0;
+    stats.frames = _frames;
+    stats.bytes = _frames * frameBytes(n);
+    return _frames != 0;
+  }
+
+  // Renders keyframe k (scratch: n floats) if it is not cached yet; true when it had to
+  bool ensure(uint8_t animIndex, uint16_t n, const Anim::ParamSet &ps, uint16_t k, float *scratch) {
+    if (_have[k >> 3] & (1u << (k & 7))) return false;
+    // Stepwise: the middle of state k; continuous: keyframe k sits at turn k / frames
+    float turn = ((float)k + (_stepwise ? 0.5f : 0.0f)) / (float)_frames;
+    Anim::applyAnimAt(animIndex, turn, n, ps, scratch, _mask);
+    pack12(scratch, n, _buf + k * frameBytes(n));
+    _have[k >> 3] |= (uint8_t)(1u << (k & 7));
+    return true;
+  }
+};
+
+} // namespace FrameCache
@@ -3,9 +3,12 @@
 #include <Adafruit_PWMServoDriver.h>
 #include <LoRaWan_APP.h>
 #include "interfaces.h"
+#include "node_config.h" // first: it may override the option macros of the headers below
 #include "protocol.h"
 #include "dyn_config.h"
-#include "node_config.h"
+#include "link_rate.h"
+#include "fec.h"
+#include "relay.h"
 #include "led_channel_inverse.h"
 
 // I2C pin configuration
@@ -15,6 +18,16 @@
 #ifndef SCL_PIN
 #define SCL_PIN 6
 #endif
+// Listen-before-talk: run CAD before each transmit and back off while the channel is busy
+#ifndef LORA_LBT
+#define LORA_LBT 0
+#endif
+// Packets queued within this window (or while the radio is busy) leave as one MSG_BATCH
+// frame. Off by default: it only pays when the leader queues several packets at once
+// (test-ui netsim, burst rows), and older followers cannot parse MSG_BATCH.
+#ifndef LORA_BATCH_MS
+#define LORA_BATCH_MS 0
+#endif
 
 // Heltec Radio events structure instance (required by library)
 static RadioEvents_t RadioEvents;
@@ -79,24 +92,32 @@ class HeltecLoRa : public CommunicationInterface {
     RadioEvents.TxDone = onTxDoneStatic;
     RadioEvents.TxTimeout = onTxTimeoutStatic;
     RadioEvents.RxDone = onRxDoneStatic;
+    RadioEvents.CadDone = onCadDoneStatic;
     Radio.Init(&RadioEvents);
     Radio.SetChannel(915000000);
-    Radio.SetTxConfig(MODEM_LORA, 5, 0, 0, 7, 1, 8, false, true, 0, 0, false, 3000);
-    Radio.SetRxConfig(MODEM_LORA, 0, 7, 1, 0, 8, 0, false, 0, true, 0, 0, false, true);
-    Radio.Rx(0);
+    applyRate(LinkRate::kDefault);
+#if LORA_RELAY
+    _relaySeq = (uint16_t)random(1, 0xFFFF); // a rebooted leader must not replay seqs followers remember
+#endif
+#if CFG_FEC_K
+    _fecMsgId = (uint8_t)esp_random(); // a rebooted leader must not reuse a msgId followers still assemble
+#endif
     instance_ = this;
   }
 
-  bool sendSync(uint32_t time_ms, uint32_t frame) override {
-  Proto::SyncPacket p; p.time_ms = time_ms; p.frame = frame;
+  bool sendSync(uint32_t time_ms, uint32_t frame, uint8_t target, uint16_t cfgHash) override {
+  Proto::SyncPacket p; p.time_ms = time_ms; p.frame = frame; p.target = target; p.cfgHash = cfgHash;
   // Log transmit
   Serial.print("TX SYNC time_ms="); Serial.print(p.time_ms);
   Serial.print(" frame="); Serial.print(p.frame);
+  Serial.print(" target="); Serial.print(p.target);
+  Serial.print(" cfg="); Serial.println(p.cfgHash, HEX);
   return sendRaw((uint8_t*)&p, sizeof(p));
   }
-  bool sendAck(uint32_t frame) override {
-  Proto::AckPacket p; p.frame = frame;
-  Serial.print("TX ACK frame="); Serial.println(p.frame);
+  bool sendAck(uint32_t frame, uint8_t node, int16_t offsetErrMs) override {
+  Proto::AckPacket p; p.frame = frame; p.node = node; p.offsetErrMs = offsetErrMs;
+  Serial.print("TX ACK frame="); Serial.print(p.frame);
+  Serial.print(" node="); Serial.println(p.node);
   return sendRaw((uint8_t*)&p, sizeof(p));
   }
   bool sendBrightness(float brightness) override {
@@ -104,8 +125,38 @@ class HeltecLoRa : public CommunicationInterface {
   Serial.print("TX BRIGHTNESS percent="); Serial.println(p.percent);
   return sendRaw((uint8_t*)&p, sizeof(p));
   }
-  bool sendReq() override {
-  Proto::ReqPacket p; Serial.println("TX REQ"); return sendRaw((uint8_t*)&p, sizeof(p));
+  bool sendReq(uint8_t node, uint16_t cfgHash) override {
+  Proto::ReqPacket p; p.node = node; p.cfgHash = cfgHash;
+  Serial.print("TX REQ node="); Serial.print(node); Serial.print(" cfg="); Serial.println(cfgHash, HEX);
+  return sendRaw((uint8_t*)&p, sizeof(p));
+  }
+  bool sendRate(uint8_t rate) override {
+  Proto::RatePacket p; p.rate = rate;
+  Serial.print("TX RATE "); Serial.println(rate);
+  return sendRaw((uint8_t*)&p, sizeof(p));
+  }
+  // Frames queued so far keep the old rate; the radio retunes when it reaches the new ones
+  void setRate(uint8_t rate) override {
+#if LORA_BATCH_MS
+    flushBatch();
+#endif
+    _queueRate = rate < LinkRate::kCount ? rate : LinkRate::kDefault;
+    pump();
+  }
+  bool sendJoin(uint32_t time_ms, uint32_t frame, uint8_t target,
+                uint8_t animIndex, const uint8_t *paramIds, const float *paramValues, uint8_t paramCount) override {
+    DynCfg::ParamValue local[24];
+    if (paramCount > 24) paramCount = 24;
+    for (uint8_t i=0;i<paramCount;i++){ local[i] = { paramIds[i], paramValues[i] }; }
+    uint8_t buf[64];
+    uint8_t len = DynCfg::encodeJoin(time_ms, frame, target, animIndex, local, paramCount, buf, sizeof(buf));
+    if (!len) return false;
+    Serial.print("TX JOIN time_ms="); Serial.print(time_ms);
+    Serial.print(" frame="); Serial.print(frame);
+    Serial.print(" target="); Serial.print(target);
+    Serial.print(" anim="); Serial.print(animIndex);
+    Serial.print(" len="); Serial.println(len);
+    return sendRaw(buf, len);
   }
   // Removed legacy sendAnimCfg; use sendAnimCfg2
 
@@ -127,30 +178,106 @@ class HeltecLoRa : public CommunicationInterface {
     Serial.print(" anim="); Serial.print(animIndex);
     Serial.print(" aParams="); Serial.print(animParamCount);
     Serial.print(" gParams="); Serial.println(globalParamCount);
+#if CFG_FEC_K
+    if (sendFec(buf, len)) return true;
+#endif
     return sendRaw(buf, len);
   }
 
   bool poll(Message &outMsg) override {
+    // Hand out the records of a received MSG_BATCH one per call
+    while (_subPos < _subEnd) {
+      uint8_t len = _rxBuf[_subPos];
+      const uint8_t *rec = &_rxBuf[_subPos + 1];
+      if (len == 0 || _subPos + 1u + len > _subEnd) { _subPos = _subEnd; break; }
+      _subPos = (uint16_t)(_subPos + 1u + len);
+      outMsg.rssi = _rxRssi; outMsg.snr = _rxSnr;
+      if (parse(rec, len, outMsg)) return true;
+    }
     if (!_hasRx) return false;
     _hasRx = false;
-    // parse rx buffer
     if (_rxSize < 1) return false;
-    uint8_t type = _rxBuf[0];
-    if (type == Proto::MSG_SYNC && _rxSize >= sizeof(Proto::SyncPacket)) {
-      auto *p = reinterpret_cast<Proto::SyncPacket*>(_rxBuf);
+    if (_rxBuf[0] == Proto::MSG_BATCH) {
+      Serial.print("RX BATCH len="); Serial.println(_rxSize);
+      _subPos = 1; _subEnd = _rxSize;
+      return poll(outMsg);
+    }
+    outMsg.rssi = _rxRssi; outMsg.snr = _rxSnr;
+    return parse(_rxBuf, (uint8_t)_rxSize, outMsg);
+  }
+
+  void loop() override {
+    Radio.IrqProcess();
+#if LORA_BATCH_MS
+    // Flush once the radio is free and the window ran out; an ACK must keep its TDMA slot
+    if (_batchCount && radioIdle() && (_batchUrgent || millis() - _batchAt[0] >= LORA_BATCH_MS)) flushBatch();
+#endif
+#if LORA_RELAY
+    uint8_t fwd[Proto::BATCH_MAX_BYTES];
+    while (uint8_t n = _fwd.pop(millis(), fwd)) {
+      Serial.print("TX RELAY hops="); Serial.print(fwd[1]); Serial.print(" len="); Serial.println(n);
+      if (fwd[Relay::kHeaderBytes] == Proto::MSG_FEC) transmit(fwd, n); else enqueue(fwd, n);
+    }
+#endif
+    pump();
+  }
+
+ private:
+  // Decode one packet (a whole frame or one MSG_BATCH record)
+  bool parse(const uint8_t *buf, uint8_t len, Message &outMsg) {
+    uint8_t type = buf[0];
+    outMsg.hops = 0;
+    if (type == Proto::MSG_RELAY) {
+      Proto::RelayHeader h; const uint8_t *in; uint8_t inLen;
+      if (!Relay::unwrap(buf, len, h, in, inLen)) return false;
+      if (!_seen.fresh(h.seq)) {
+#if LORA_RELAY
+        _fwd.cancel(h.seq, h.hops);
+#endif
+        return false;
+      }
+#if LORA_RELAY
+      if (!IS_LEADER && h.hops + 2 <= Relay::kMaxHops && Relay::forwardable(in, inLen)) {
+        const LoraPhy::Modem &m = LinkRate::modem(_radioRate);
+        _fwd.push(buf, len, _rxAtMs, Relay::forwardDelayMs(in, h.hops, m, (uint32_t)random(0x7FFFFFFF)), LoraPhy::airtimeMs((uint8_t)_rxSize, m));
+      }
+#endif
+      if (!parse(in, inLen, outMsg)) return false;
+      outMsg.hops = h.hops;
+      Serial.print("RX RELAY hops="); Serial.print(h.hops); Serial.print(" seq="); Serial.println(h.seq);
+      return true;
+    }
+    if (type == Proto::MSG_FEC) {
+      // Decoded regardless of CFG_FEC_K, so followers need no matching setting
+      uint8_t cfg[Fec::kMaxMsgBytes];
+      uint8_t n = _fec.add(buf, len, cfg);
+      if (!n) return false;
+      Serial.print("RX FEC rebuilt len="); Serial.print(n);
+      Serial.print(" frags="); Serial.println(__builtin_popcount(_fec.have));
+      return cfg[0] == Proto::MSG_CFG2 && parse(cfg, n, outMsg);
+    }
+    if (type == Proto::MSG_SYNC && len >= Proto::SYNC_NOHASH_SIZE - 1) {
+      auto *p = reinterpret_cast<const Proto::SyncPacket*>(buf);
       outMsg.type = (Message::Type)Proto::MSG_SYNC;
       outMsg.time_ms = p->time_ms; outMsg.frame = p->frame; outMsg.anim_code = 0;
+      outMsg.target = (len >= Proto::SYNC_NOHASH_SIZE) ? p->target : Proto::NODE_BROADCAST;
+      outMsg.cfgHash = (len >= sizeof(Proto::SyncPacket)) ? p->cfgHash : 0;
   Serial.print("RX SYNC time_ms="); Serial.print(p->time_ms);
   Serial.print(" frame="); Serial.print(p->frame);
+  Serial.print(" target="); Serial.print(outMsg.target);
+  Serial.print(" cfg="); Serial.print(outMsg.cfgHash, HEX);
   Serial.println();
       return true;
-    } else if (type == Proto::MSG_ACK && _rxSize >= sizeof(Proto::AckPacket)) {
-  auto *p = reinterpret_cast<Proto::AckPacket*>(_rxBuf);
+    } else if (type == Proto::MSG_ACK && len >= Proto::ACK_LEGACY_SIZE) {
+  auto *p = reinterpret_cast<const Proto::AckPacket*>(buf);
   outMsg.type = (Message::Type)Proto::MSG_ACK; outMsg.frame = p->frame;
-  Serial.print("RX ACK frame="); Serial.println(p->frame);
+  bool full = len >= sizeof(Proto::AckPacket);
+  outMsg.node = full ? p->node : 0; outMsg.offsetErrMs = full ? p->offsetErrMs : 0;
+  Serial.print("RX ACK frame="); Serial.print(p->frame);
+  Serial.print(" node="); Serial.println(outMsg.node);
   return true;
-    } else if (type == Proto::MSG_BRIGHTNESS && _rxSize >= sizeof(Proto::BrightnessPacket)) {
-  auto *p = reinterpret_cast<Proto::BrightnessPacket*>(_rxBuf);
+    } else if (type == Proto::MSG_BRIGHTNESS && len >= sizeof(Proto::BrightnessPacket)) {
+  auto *p = reinterpret_cast<const Proto::BrightnessPacket*>(buf);
   outMsg.type = (Message::Type)Proto::MSG_BRIGHTNESS; outMsg.brightness = p->percent/100.0f;
   Serial.print("RX BRIGHTNESS percent="); Serial.println(p->percent);
   return true;
@@ -159,41 +286,231 @@ class HeltecLoRa : public CommunicationInterface {
       DynCfg::ParamValue animVals[16]; uint8_t animCount=0;
       DynCfg::ParamValue globalVals[8]; uint8_t globalCount=0;
       uint8_t role=0, animIndex=0;
-      if (!DynCfg::decodeCfg2(_rxBuf, (uint8_t)_rxSize, role, animIndex, animVals, animCount, globalVals, globalCount)) {
+      if (!DynCfg::decodeCfg2(buf, len, role, animIndex, animVals, animCount, globalVals, globalCount)) {
         Serial.println("RX CFG2 decode failed");
         return false;
       }
       outMsg.type = Message::CFG2;
-      outMsg.cfg2_role = role;
-      outMsg.cfg2_animIndex = animIndex;
-      outMsg.cfg2_paramCount = animCount;
-      outMsg.cfg2_globalCount = globalCount;
-      for (uint8_t i=0;i<animCount && i<16;i++){ outMsg.cfg2_paramIds[i]=animVals[i].id; outMsg.cfg2_paramValues[i]=animVals[i].value; }
-      for (uint8_t i=0;i<globalCount && i<8;i++){ outMsg.cfg2_globalIds[i]=globalVals[i].id; outMsg.cfg2_globalValues[i]=globalVals[i].value; }
+      fillCfg2(outMsg, role, animIndex, animVals, animCount, globalVals, globalCount);
       Serial.print("RX CFG2 role="); Serial.print(role);
       Serial.print(" anim="); Serial.print(animIndex);
       Serial.print(" aParams="); Serial.print(animCount);
       Serial.print(" gParams="); Serial.println(globalCount);
       return true;
-    } else if (type == Proto::MSG_REQ && _rxSize >= sizeof(Proto::ReqPacket)) {
+    } else if (type == Proto::MSG_JOIN) {
+      DynCfg::ParamValue animVals[16]; uint8_t animCount=0;
+      DynCfg::ParamValue globalVals[8]; uint8_t globalCount=0;
+      uint8_t role=0, animIndex=0; Proto::JoinHeader h;
+      if (!DynCfg::decodeJoin(buf, len, h, role, animIndex, animVals, animCount, globalVals, globalCount)) {
+        Serial.println("RX JOIN decode failed");
+        return false;
+      }
+      outMsg.type = Message::JOIN;
+      outMsg.time_ms = h.time_ms; outMsg.frame = h.frame; outMsg.target = h.target;
+      fillCfg2(outMsg, role, animIndex, animVals, animCount, globalVals, globalCount);
+      Serial.print("RX JOIN time_ms="); Serial.print(h.time_ms);
+      Serial.print(" frame="); Serial.print(h.frame);
+      Serial.print(" target="); Serial.print(h.target);
+      Serial.print(" anim="); Serial.println(animIndex);
+      return true;
+    } else if (type == Proto::MSG_RATE && len >= sizeof(Proto::RatePacket)) {
+  outMsg.type = Message::RATE; outMsg.rate = buf[1];
+  Serial.print("RX RATE "); Serial.println(outMsg.rate);
+  return true;
+    } else if (type == Proto::MSG_REQ) {
   outMsg.type = (Message::Type)Proto::MSG_REQ;
-  Serial.println("RX REQ");
+  outMsg.node = (len >= Proto::REQ_LEGACY_SIZE) ? buf[1] : 0;
+  outMsg.cfgHash = (len >= sizeof(Proto::ReqPacket)) ? reinterpret_cast<const Proto::ReqPacket*>(buf)->cfgHash : 0;
+  Serial.print("RX REQ node="); Serial.print(outMsg.node); Serial.print(" cfg="); Serial.println(outMsg.cfgHash, HEX);
   return true;
     }
     return false;
   }
 
-  void loop() override {
-    Radio.IrqProcess();
+  static void fillCfg2(Message &m, uint8_t role, uint8_t animIndex,
+                       const DynCfg::ParamValue *animVals, uint8_t animCount,
+                       const DynCfg::ParamValue *globalVals, uint8_t globalCount) {
+    m.cfg2_role = role;
+    m.cfg2_animIndex = animIndex;
+    m.cfg2_paramCount = animCount;
+    m.cfg2_globalCount = globalCount;
+    for (uint8_t i=0;i<animCount && i<16;i++){ m.cfg2_paramIds[i]=animVals[i].id; m.cfg2_paramValues[i]=animVals[i].value; }
+    for (uint8_t i=0;i<globalCount && i<8;i++){ m.cfg2_globalIds[i]=globalVals[i].id; m.cfg2_globalValues[i]=globalVals[i].value; }
   }
+  // TX queue: frames leave in order, each on the rate that was current when it was queued,
+  // so a RATE announcement still goes out on the old rate. Deep enough for a full FEC set.
+  static constexpr uint8_t kTxQueue = Fec::kMaxFrags + 2;
+  bool radioIdle() const { return !_txBusy && !_cadBusy && !_txCount; }
+  bool transmit(const uint8_t *data, uint8_t len) {
+    if (_txCount >= kTxQueue || len > sizeof(_txBuf[0])) return false;
+    uint8_t slot = (uint8_t)((_txHead + _txCount) % kTxQueue);
+    memcpy(_txBuf[slot], data, len); _txLen[slot] = len; _txRate[slot] = _queueRate;
+    if (_txCount++ == 0) { _cadTries = 0; _cadAtMs = millis(); }
+    pump();
+    return true;
+  }
+  // Retune and start the next frame (or its CAD) once the radio is free
+  void pump() {
+    if (_txBusy || _cadBusy) return;
+    uint8_t want = _txCount ? _txRate[_txHead] : _queueRate;
+    if (want != _radioRate) applyRate(want);
+    if (!_txCount) return;
+#if LORA_LBT
+    if ((int32_t)(millis() - _cadAtMs) < 0) return;
+    _cadBusy = true;
+    Radio.Standby();
+    Radio.StartCad();
+#else
+    sendHead();
+#endif
+  }
+  void sendHead() {
+    _txBusy = true;
+    Radio.Send(_txBuf[_txHead], _txLen[_txHead]);
+    _txHead = (uint8_t)((_txHead + 1) % kTxQueue); _txCount--;
+    _cadTries = 0; _cadAtMs = millis(); // next queued frame runs CAD after TxDone
+  }
+  void applyRate(uint8_t rate) {
+    const LoraPhy::Modem &m = LinkRate::modem(rate);
+    uint32_t bw = m.bwHz >= 500000 ? 2 : (m.bwHz >= 250000 ? 1 : 0); // SX126x driver index
+    Radio.Standby();
+    Radio.SetTxConfig(MODEM_LORA, 5, 0, bw, m.sf, m.cr, m.preamble, false, true, 0, 0, false, 3000);
+    Radio.SetRxConfig(MODEM_LORA, bw, m.sf, m.cr, 0, m.preamble, 0, false, 0, true, 0, 0, false, true);
+    Radio.Rx(0);
+    _radioRate = rate;
+    Serial.print("RADIO: rate "); Serial.print(rate); Serial.print(" SF"); Serial.print(m.sf);
+    Serial.print(" BW"); Serial.println(m.bwHz / 1000);
+  }
+#if LORA_LBT
+  static constexpr uint8_t kMaxCadTries = 4;   // then transmit anyway
+  static constexpr uint16_t kCadBackoffMinMs = 10;
+  static constexpr uint16_t kCadBackoffMaxMs = 60;
+  void onCadDone(bool activity) {
+    _cadBusy = false;
+    if (!_txCount) { Radio.Rx(0); return; }
+    if (activity && ++_cadTries < kMaxCadTries) {
+      _cadAtMs = millis() + (uint32_t)random(kCadBackoffMinMs, kCadBackoffMaxMs);
+      Radio.Rx(0);
+      return;
+    }
+    sendHead();
+  }
+#else
+  void onCadDone(bool) {}
+#endif
+  uint8_t _txBuf[kTxQueue][Proto::BATCH_MAX_BYTES]{};
+  uint8_t _txLen[kTxQueue]{};
+  uint8_t _txRate[kTxQueue]{};
+  uint8_t _txHead{0}, _txCount{0}, _cadTries{0};
+  bool _cadBusy{false};
+  uint32_t _cadAtMs{0};
+  uint8_t _queueRate{LinkRate::kDefault}, _radioRate{0xFF};
 
- private:
-  bool sendRaw(uint8_t *data, uint8_t len) {
-    Radio.Send(data, len); return true;
+  // Every packet leaves through here
+  bool sendRaw(const uint8_t *data, uint8_t len) {
+#if LORA_RELAY
+    uint8_t seqd[Proto::BATCH_MAX_BYTES];
+    if (uint8_t n = sequence(data, len, seqd)) return enqueue(seqd, n);
+#endif
+    return enqueue(data, len);
+  }
+#if LORA_RELAY
+  // Leader: broadcasts get a relay header (hops 0, next seq) so relays can forward them
+  uint8_t sequence(const uint8_t *data, uint8_t len, uint8_t *out) {
+    if (!IS_LEADER || !Relay::forwardable(data, len)) return 0;
+    if (++_relaySeq == 0) _relaySeq = 1;
+    return Relay::wrap(data, len, 0, _relaySeq, out, Proto::BATCH_MAX_BYTES);
   }
+  uint16_t _relaySeq{1};
+  Relay::Queue _fwd;
+#endif
+  Relay::Seen _seen;
+
+#if LORA_BATCH_MS
+  bool enqueue(const uint8_t *data, uint8_t len) {
+    if (len == 0 || 2u + len > Proto::BATCH_MAX_BYTES) { flushBatch(); return transmit(data, len); }
+    if ((_batchCount == Proto::BATCH_MAX_RECORDS || _batchLen + 1u + len > Proto::BATCH_MAX_BYTES ||
+         (_batchCount && _batchRate != _queueRate)) && !flushBatch()) {
+      // TX queue full and the batch kept for loop(): this record has nowhere to go
+      _batchDrops++;
+      Serial.print("TX DROP type="); Serial.print(data[0]); Serial.print(" drops="); Serial.println(_batchDrops);
+      return false;
+    }
+    if (!_batchCount) _batchRate = _queueRate;
+    _batchAt[_batchCount] = millis(); _batchOff[_batchCount] = _batchLen;
+    _batchCount++;
+    _batch[_batchLen++] = len;
+    memcpy(&_batch[_batchLen], data, len); _batchLen = (uint8_t)(_batchLen + len);
+    if (data[0] == Proto::MSG_ACK) _batchUrgent = true;
+    if (_batchUrgent && radioIdle()) flushBatch();
+    return true;
+  }
+  // SYNC/JOIN carry the leader clock at queue time; add the time they waited here so
+  // batching does not skew follower time. A lone packet goes out without the container.
+  // With the TX queue full the batch stays and loop() tries again once the radio is idle;
+  // false then.
+  bool flushBatch() {
+    if (!_batchCount) return true;
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < _batchCount; ++i) {
+      Relay::addTime(&_batch[_batchOff[i] + 1], _batch[_batchOff[i]], now - _batchAt[i]);
+      _batchAt[i] = now; // a retry adds only the time since
+    }
+    uint8_t rate = _queueRate;
+    _queueRate = _batchRate; // records queued before a setRate() keep the rate they were meant for
+    bool ok;
+    if (_batchCount == 1) {
+      ok = transmit(&_batch[2], _batch[1]);
+    } else {
+      Serial.print("TX BATCH records="); Serial.print(_batchCount);
+      Serial.print(" len="); Serial.println(_batchLen);
+      ok = transmit(_batch, _batchLen);
+    }
+    _queueRate = rate;
+    if (!ok) { Serial.println("TX queue full, batch kept"); return false; }
+    _batchCount = 0; _batchLen = 1; _batchUrgent = false;
+    return true;
+  }
+  uint8_t _batch[Proto::BATCH_MAX_BYTES]{Proto::MSG_BATCH};
+  uint8_t _batchLen{1}, _batchCount{0}, _batchRate{LinkRate::kDefault};
+  uint8_t _batchOff[Proto::BATCH_MAX_RECORDS]{};
+  uint32_t _batchAt[Proto::BATCH_MAX_RECORDS]{};
+  uint32_t _batchDrops{0};
+  bool _batchUrgent{false};
+#else
+  bool enqueue(const uint8_t *data, uint8_t len) { return transmit(data, len); }
+#endif
+
+#if CFG_FEC_K
+  // Each fragment is its own frame (never batched) so losses hit them independently
+  bool sendFec(const uint8_t *data, uint8_t len) {
+    uint8_t k = CFG_FEC_K, m = CFG_FEC_M, n = (uint8_t)(k + m);
+    if (n > Fec::kMaxFrags || Fec::fragBytes(len, k) > Fec::kMaxFragBytes || kTxQueue - _txCount < n + 1) return false;
+#if LORA_BATCH_MS
+    flushBatch();
+#endif
+    uint8_t frag[Proto::BATCH_MAX_BYTES];
+    for (uint8_t i = 0; i < n; ++i) {
+      uint8_t fl = Fec::encodeFragment(data, len, k, m, _fecMsgId, i, frag, sizeof(frag));
+      if (!fl) return false;
+#if LORA_RELAY
+      uint8_t seqd[Proto::BATCH_MAX_BYTES];
+      if (uint8_t sl = sequence(frag, fl, seqd)) { transmit(seqd, sl); continue; }
+#endif
+      transmit(frag, fl);
+    }
+    Serial.print("TX FEC id="); Serial.print(_fecMsgId);
+    Serial.print(" k="); Serial.print(k); Serial.print(" n="); Serial.println(n);
+    _fecMsgId++;
+    return true;
+  }
+  uint8_t _fecMsgId{0};
+#endif
+  Fec::Assembler _fec;
 
   static void onTxDoneStatic() { if (instance_) instance_->onTxDone(); }
   static void onTxTimeoutStatic() { if (instance_) instance_->onTxTimeout(); }
+  static void onCadDoneStatic(bool activity) { if (instance_) instance_->onCadDone(activity); }
   static void onRxDoneStatic(uint8_t *payload, uint16_t size, int16_t rssi, int8_t snr) {
     if (instance_) instance_->onRxDone(payload, size, rssi, snr);
   }
@@ -201,25 +518,34 @@ class HeltecLoRa : public CommunicationInterface {
   void onTxDone() {
     // After any transmission, immediately go back to RX to listen for responses (e.g., ACK)
     Serial.println("RADIO: TX done -> RX");
+    _txBusy = false;
     Radio.Sleep();
     Radio.Rx(0);
   }
-  void onTxTimeout() { Radio.Sleep(); Radio.Rx(0); }
+  void onTxTimeout() { _txBusy = false; Radio.Sleep(); Radio.Rx(0); }
   void onRxDone(uint8_t *payload, uint16_t size, int16_t rssi, int8_t snr) {
+    _rxAtMs = millis();
     _rxSize = min<uint16_t>(size, sizeof(_rxBuf));
     memcpy(_rxBuf, payload, _rxSize);
+    _subPos = _subEnd = 0;
     Serial.print("RADIO: RX done size="); Serial.print(_rxSize);
     Serial.print(" rssi="); Serial.print(rssi);
     Serial.print(" snr="); Serial.println(snr);
+    _rxRssi = rssi; _rxSnr = snr;
     Radio.Sleep();
     _hasRx = true;
     Radio.Rx(0);
   }
 
   static HeltecLoRa *instance_;
+  bool _txBusy{false};
   bool _hasRx{false};
   uint16_t _rxSize{0};
-  uint8_t _rxBuf[64]{};
+  uint8_t _rxBuf[Proto::BATCH_MAX_BYTES]{};
+  uint16_t _subPos{0}, _subEnd{0}; // unread MSG_BATCH records in _rxBuf
+  int16_t _rxRssi{0};
+  int8_t _rxSnr{0};
+  uint32_t _rxAtMs{0};
 };
 HeltecLoRa* HeltecLoRa::instance_ = nullptr;
 
@@ -2,13 +2,22 @@
 #include <Arduino.h>
 
 struct Message {
-  enum Type : uint8_t { REQ=0x01, SYNC=0x02, BRIGHTNESS=0x03, ACK=0x04, CFG2=0x06 };
+  enum Type : uint8_t { REQ=0x01, SYNC=0x02, BRIGHTNESS=0x03, ACK=0x04, CFG2=0x06, JOIN=0x07, RATE=0x09 };
   Type type;
   uint32_t time_ms{0};
   uint32_t frame{0};
   uint16_t anim_code{0};
   float brightness{1.0f};
-  // Dynamic configuration payload (when type==CFG2)
+  // Addressing / link info (SYNC target, ACK/REQ sender)
+  uint8_t target{0xFF};
+  uint8_t node{0};
+  int16_t offsetErrMs{0};
+  int16_t rssi{0};
+  int8_t snr{0};
+  uint16_t cfgHash{0}; // REQ: follower config fingerprint, SYNC: leader's (0 = not sent)
+  uint8_t rate{0};     // RATE: LinkRate::kRates index
+  uint8_t hops{0};     // relays the packet passed (relay.h), 0 = heard from the leader
+  // Dynamic configuration payload (when type==CFG2 or JOIN)
   uint8_t cfg2_role{0};
   uint8_t cfg2_animIndex{0};
   uint8_t cfg2_paramCount{0};
@@ -24,15 +33,22 @@ class CommunicationInterface {
  public:
   virtual ~CommunicationInterface() {}
   virtual void begin() = 0;
-  virtual bool sendSync(uint32_t time_ms, uint32_t frame) = 0;
-  virtual bool sendAck(uint32_t frame) = 0;
+  virtual bool sendSync(uint32_t time_ms, uint32_t frame, uint8_t target = 0xFF, uint16_t cfgHash = 0) = 0;
+  virtual bool sendAck(uint32_t frame, uint8_t node, int16_t offsetErrMs) = 0;
   virtual bool sendBrightness(float brightness) = 0;
-  virtual bool sendReq() = 0;
+  virtual bool sendReq(uint8_t node, uint16_t cfgHash) = 0;
+  // SYNC + complete follower config in one frame (answer to a REQ with a stale config hash)
+  virtual bool sendJoin(uint32_t time_ms, uint32_t frame, uint8_t target,
+                        uint8_t animIndex, const uint8_t *paramIds, const float *paramValues, uint8_t paramCount) = 0;
   // Send dynamic configuration (CFG2). Caller provides per-animation param id/value pairs and global param pairs.
   virtual bool sendAnimCfg2(uint8_t role,
                             uint8_t animIndex,
                             const uint8_t *animParamIds, const float *animParamValues, uint8_t animParamCount,
                             const uint8_t *globalParamIds, const float *globalParamValues, uint8_t globalParamCount) = 0;
+  // Fleet data rate (LinkRate::kRates index). sendRate announces it on the current rate;
+  // setRate retunes once everything queued before it is on air.
+  virtual bool sendRate(uint8_t rate) = 0;
+  virtual void setRate(uint8_t rate) = 0;
   virtual bool poll(Message &outMsg) = 0; // non-blocking; true when got a message
   virtual void loop() = 0;                // service IRQs if needed
 };
@@ -0,0 +1,190 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "anim_schema.h" // Anim::ParamSet for bindParams
+
+// Single-pass JSON tokenizer for web API request bodies (jsmn-style). parse() walks the text
+// once and fills a caller-provided token array with typed spans into the original buffer:
+// nothing is copied or allocated, numbers are converted straight from the text. Tokens are
+// in document order, a container followed by its contents, so everything inside token i is
+// the run of tokens that start before tok[i].end. Object members are key tokens (size 1)
+// each followed by their value.
+#ifndef JSON_MAX_TOKENS
+#define JSON_MAX_TOKENS 256 // tokens per parsed request body, 10 bytes each (stack)
+#endif
+
+namespace Json {
+
+enum TokenType : uint8_t { T_NONE = 0, T_OBJECT, T_ARRAY, T_STRING, T_PRIMITIVE };
+enum ParseError : int { E_NOMEM = -1, E_INVALID = -2, E_PARTIAL = -3 };
+
+struct Token {
+  uint16_t start, end; // [start, end) in the text, strings without quotes; end 0 while a container is open
+  uint16_t size;       // object: members, array: elements, key: 1
+  int16_t parent;      // enclosing container or key, -1 at the top
+  uint8_t type;
+};
+
+// End of a primitive (NUL included)
+inline bool delim(char c) {
+  switch (c) { case 0: case ' ': case '\t': case '\r': case '\n': case ',': case ']': case '}': case ':': return true; default: return false; }
+}
+
+// Token count, or a ParseError. Stops at a NUL byte. Bodies up to 64 KiB.
+inline int parse(const char *js, size_t len, Token *tok, uint16_t maxTok) {
+  if (len > 0xFFFF) return E_NOMEM;
+  uint16_t n = 0;
+  int16_t up = -1; // token new values belong to
+  for (size_t pos = 0; pos < len && js[pos]; ++pos) {
+    char c = js[pos];
+    switch (c) {
+      case '{': case '[': {
+        if (n >= maxTok) return E_NOMEM;
+        if (up >= 0) { if (tok[up].type == T_OBJECT) return E_INVALID; tok[up].size++; } // object values need a key
+        Token &t = tok[n];
+        t.type = c == '{' ? T_OBJECT : T_ARRAY; t.start = (uint16_t)pos; t.end = 0; t.size = 0; t.parent = up;
+        up = (int16_t)n++;
+        break;
+      }
+      case '}': case ']': {
+        uint8_t type = c == '}' ? T_OBJECT : T_ARRAY;
+        // Innermost open container, past a key whose value just ended
+        int16_t i = up;
+        if (i >= 0 && tok[i].type == T_STRING) i = tok[i].parent;
+        if (i < 0 || tok[i].type != type || tok[i].end) return E_INVALID;
+        tok[i].end = (uint16_t)(pos + 1);
+        up = tok[i].parent;
+        break;
+      }
+      case '"': {
+        size_t start = ++pos;
+        for (; pos < len && js[pos] && js[pos] != '"'; ++pos) {
+          if (js[pos] != '\\') continue;
+          if (++pos >= len) return E_PARTIAL;
+          if (js[pos] == 'u') pos += 4;
+        }
+        if (pos >= len || !js[pos]) return E_PARTIAL;
+        if (n >= maxTok) return E_NOMEM;
+        if (up >= 0) tok[up].size++;
+        Token &t = tok[n++];
+        t.type = T_STRING; t.start = (uint16_t)start; t.end = (uint16_t)pos; t.size = 0; t.parent = up;
+        break;
+      }
+      case ':':
+        if (!n || tok[n - 1].type != T_STRING || tok[n - 1].parent != up || up < 0 || tok[up].type != T_OBJECT) return E_INVALID;
+        up = (int16_t)(n - 1); // the key owns the value
+        break;
+      case ',':
+        if (up >= 0 && tok[up].type == T_STRING) up = tok[up].parent;
+        break;
+      case ' ': case '\t': case '\r': case '\n':
+        break;
+      default: {
+        if (!((c >= '0' && c <= '9') || c == '-' || c == 't' || c == 'f' || c == 'n')) return E_INVALID;
+        if (up >= 0 && tok[up].type == T_OBJECT) return E_INVALID;
+        size_t start = pos;
+        while (pos + 1 < len && !delim(js[pos + 1])) pos++;
+        if (n >= maxTok) return E_NOMEM;
+        if (up >= 0) tok[up].size++;
+        Token &t = tok[n++];
+        t.type = T_PRIMITIVE; t.start = (uint16_t)start; t.end = (uint16_t)(pos + 1); t.size = 0; t.parent = up;
+        break;
+      }
+    }
+  }
+  for (uint16_t i = 0; i < n; ++i) if ((tok[i].type == T_OBJECT || tok[i].type == T_ARRAY) && !tok[i].end) return E_PARTIAL;
+  return n;
+}
+
+inline bool eq(const char *js, const Token &t, const char *s) {
+  size_t len = strlen(s);
+  return t.type == T_STRING && (size_t)(t.end - t.start) == len && memcmp(js + t.start, s, len) == 0;
+}
+
+// Index past token i and everything inside it
+inline int skip(const Token *tok, int count, int i) {
+  int j = i + 1;
+  while (j < count && tok[j].start < tok[i].end) j++;
+  return j;
+}
+
+// Numbers straight from the text; true/false as 1/0. Plain decimals (up to 15 digits) are
+// mantissa / 10^k in double, both exact, so the result matches atof (Arduino's toFloat);
+// exponents and longer numbers go through strtod.
+inline float toFloat(const char *js, const Token &t) {
+  if (t.type != T_PRIMITIVE) return 0.0f;
+  static const double kPow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+  const char *p = js + t.start, *e = js + t.end;
+  if (*p == 't') return 1.0f;
+  if (*p == 'f' || *p == 'n') return 0.0f;
+  bool neg = *p == '-';
+  if (neg) p++;
+  uint64_t m = 0; int frac = -1, digits = 0;
+  for (; p < e && digits <= 15; ++p) {
+    if (*p >= '0' && *p <= '9') { m = m * 10 + (uint64_t)(*p - '0'); digits++; if (frac >= 0) frac++; }
+    else if (*p == '.' && frac < 0) frac = 0;
+    else break;
+  }
+  if (p != e || digits == 0 || digits > 15) return (float)strtod(js + t.start, nullptr);
+  double v = (double)m;
+  if (frac > 0) v /= kPow10[frac];
+  return (float)(neg ? -v : v);
+}
+inline long toLong(const char *js, const Token &t) {
+  if (t.type != T_PRIMITIVE) return 0;
+  const char *p = js + t.start, *e = js + t.end;
+  if (*p == 't') return 1;
+  if (*p == 'f' || *p == 'n') return 0;
+  bool neg = *p == '-';
+  if (neg) p++;
+  long v = 0;
+  for (; p < e && *p >= '0' && *p <= '9'; ++p) v = v * 10 + (*p - '0');
+  return neg ? -v : v;
+}
+
+// A parsed body with lookups; tokens live in the object (JSON_MAX_TOKENS * 10 bytes)
+template<uint16_t N = JSON_MAX_TOKENS>
+struct Doc {
+  const char *js;
+  Token tok[N];
+  int count;
+
+  Doc(const char *text, size_t len) : js(text), count(parse(text, len, tok, N)) {}
+  bool ok() const { return count > 0; }
+  bool is(int i, uint8_t type) const { return i >= 0 && i < count && tok[i].type == type; }
+
+  // Value of member key in object obj, -1 if absent (or obj is not an object)
+  int get(int obj, const char *key) const {
+    if (!is(obj, T_OBJECT)) return -1;
+    for (int k = obj + 1; k + 1 < count && tok[k].start < tok[obj].end; k = skip(tok, count, k + 1))
+      if (eq(js, tok[k], key)) return k + 1;
+    return -1;
+  }
+  // Children of an array: for (int i = first(a); i >= 0; i = next(a, i))
+  int first(int arr) const { return is(arr, T_ARRAY) && tok[arr].size ? arr + 1 : -1; }
+  int next(int arr, int i) const { int j = skip(tok, count, i); return j < count && tok[j].start < tok[arr].end ? j : -1; }
+
+  float num(int i, float def) const { return is(i, T_PRIMITIVE) ? toFloat(js, tok[i]) : def; }
+  long integer(int i, long def) const { return is(i, T_PRIMITIVE) ? toLong(js, tok[i]) : def; }
+  bool boolean(int i, bool def) const { return is(i, T_PRIMITIVE) ? toFloat(js, tok[i]) != 0.0f : def; }
+
+  // fn(id, value) for each {id, value} object in array arr (CFG2 / favorites layout)
+  template<typename F>
+  void forEachParam(int arr, F fn) const {
+    for (int i = first(arr); i >= 0; i = next(arr, i)) {
+      int id = get(i, "id"), v = get(i, "value");
+      if (id >= 0 && v >= 0) fn((uint8_t)integer(id, 0), num(v, 0.0f));
+    }
+  }
+  // Typed binding of an {id, value} array into a ParamSet; unknown ids are skipped. Returns
+  // the number of fields set.
+  uint8_t bindParams(int arr, Anim::ParamSet &ps) const {
+    uint8_t set = 0;
+    forEachParam(arr, [&](uint8_t id, float v) { if (Anim::setParamField(ps, id, v)) set++; });
+    return set;
+  }
+};
+
+} // namespace Json
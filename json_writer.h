@@ -0,0 +1,148 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// Streaming JSON writer for the web API. Output goes into a fixed chunk buffer that is
+// handed to a sink whenever it fills (the firmware sends each chunk with chunked transfer
+// encoding), so peak memory is the chunk size whatever the response size. No heap use.
+// Commas between members and elements are inserted from the nesting state:
+//
+//   Json::Writer<> w(sink, user);
+//   w.beginObject().key("id").num(3).key("items").beginArray().num(1).num(2).endArray().endObject();
+//   w.flush();
+#ifndef JSON_CHUNK_BYTES
+#define JSON_CHUNK_BYTES 512 // bytes buffered per chunk of a streamed JSON response (stack)
+#endif
+
+namespace Json {
+
+typedef void (*Sink)(void *user, const char *data, size_t len);
+
+// Longest prefix of already escaped string contents s[0..n) that fits in max bytes and ends
+// on a code point: never inside an escape, a \uD8xx\uDCxx surrogate pair or a UTF-8 sequence
+inline size_t escapedPrefix(const char *s, size_t n, size_t max) {
+  size_t i = 0;
+  while (i < n) {
+    unsigned char c = (unsigned char)s[i];
+    size_t unit = c < 0x80 ? 1 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+    if (c == '\\') {
+      unit = i + 1 < n && s[i + 1] == 'u' ? 6 : 2;
+      char h = i + 3 < n ? (char)(s[i + 3] | 0x20) : 0; // high surrogates are D800..DBFF
+      bool high = unit == 6 && i + 3 < n && (s[i + 2] | 0x20) == 'd' && (h == '8' || h == '9' || h == 'a' || h == 'b');
+      if (high && i + 7 < n && s[i + 6] == '\\' && s[i + 7] == 'u') unit = 12;
+    }
+    if (i + unit > n || i + unit > max) break;
+    i += unit;
+  }
+  return i;
+}
+
+template<size_t Chunk = JSON_CHUNK_BYTES>
+class Writer {
+ public:
+  static constexpr uint8_t kMaxDepth = 32; // deeper levels get no commas
+
+  Writer(Sink sink, void *user) : _sink(sink), _user(user) {}
+
+  Writer &beginObject() { value(); put('{'); return open(); }
+  Writer &endObject() { return close('}'); }
+  Writer &beginArray() { value(); put('['); return open(); }
+  Writer &endArray() { return close(']'); }
+
+  Writer &key(const char *k) { value(); quoted(k, strlen(k), true); put(':'); _afterKey = true; return *this; }
+
+  Writer &str(const char *s) { value(); quoted(s, strlen(s), true); return *this; }
+  // Quoted string whose content is already JSON-escaped (e.g. cut out of stored JSON)
+  Writer &rawStr(const char *s, size_t len) { value(); quoted(s, len, false); return *this; }
+  // A complete JSON value as is (stored favorites)
+  Writer &raw(const char *json, size_t len) { value(); put(json, len); return *this; }
+
+  Writer &boolean(bool b) { value(); if (b) put("true", 4); else put("false", 5); return *this; }
+  Writer &null() { value(); put("null", 4); return *this; }
+  // Fundamental types, so uint32_t (unsigned or unsigned long, by toolchain) always matches
+  Writer &num(int v) { value(); return integer(v < 0, v < 0 ? 0u - (unsigned)v : (unsigned)v); }
+  Writer &num(unsigned v) { value(); return integer(false, v); }
+  Writer &num(long v) { value(); return integer(v < 0, v < 0 ? 0ul - (unsigned long)v : (unsigned long)v); }
+  Writer &num(unsigned long v) { value(); return integer(false, v); }
+  // Fixed decimals like Arduino's String(v, decimals); NaN/inf are not JSON, written as null
+  Writer &num(float v, uint8_t decimals) {
+    if (isnan(v) || isinf(v)) return null();
+    value();
+    char tmp[24];
+    int len = snprintf(tmp, sizeof(tmp), "%.*f", (int)decimals, (double)v);
+    if (len > 0) put(tmp, (size_t)len < sizeof(tmp) ? (size_t)len : sizeof(tmp) - 1);
+    return *this;
+  }
+
+  // Hands buffered output to the sink; call once after the last value
+  void flush() { if (_len) { _sink(_user, _buf, _len); _len = 0; } }
+  uint32_t total() const { return _total; } // bytes written so far
+
+ private:
+  Sink _sink;
+  void *_user;
+  char _buf[Chunk];
+  size_t _len{0};
+  uint32_t _total{0};
+  uint32_t _hasItems{0}; // bit d: level d already holds a value
+  uint8_t _depth{0};
+  bool _afterKey{false};
+
+  void put(char c) { if (_len == Chunk) flush(); _buf[_len++] = c; _total++; }
+  void put(const char *s, size_t n) {
+    _total += (uint32_t)n;
+    while (n) {
+      if (_len == Chunk) flush();
+      size_t k = Chunk - _len < n ? Chunk - _len : n;
+      memcpy(_buf + _len, s, k); _len += k; s += k; n -= k;
+    }
+  }
+
+  // Comma before every value but the first of its level; a member value follows its key
+  void value() {
+    if (_afterKey) { _afterKey = false; return; }
+    if (_depth == 0 || _depth > kMaxDepth) return;
+    uint32_t bit = 1u << (_depth - 1);
+    if (_hasItems & bit) put(',');
+    _hasItems |= bit;
+  }
+  Writer &open() { _depth++; if (_depth <= kMaxDepth) _hasItems &= ~(1u << (_depth - 1)); return *this; }
+  Writer &close(char c) { if (_depth) _depth--; put(c); return *this; }
+
+  template<typename U>
+  Writer &integer(bool neg, U v) {
+    char tmp[20]; uint8_t i = sizeof(tmp);
+    do { tmp[--i] = (char)('0' + v % 10); v /= 10; } while (v);
+    if (neg) put('-');
+    put(tmp + i, sizeof(tmp) - i);
+    return *this;
+  }
+
+  void quoted(const char *s, size_t n, bool escape) {
+    put('"');
+    if (!escape) { put(s, n); put('"'); return; }
+    static const char hex[] = "0123456789abcdef";
+    size_t run = 0; // unescaped bytes go out in runs
+    for (size_t i = 0; i < n; ++i) {
+      unsigned char c = (unsigned char)s[i];
+      if (c >= 0x20 && c != '"' && c != '\\') continue;
+      put(s + run, i - run); run = i + 1;
+      put('\\');
+      switch (c) {
+        case '"': put('"'); break;
+        case '\\': put('\\'); break;
+        case '\n': put('n'); break;
+        case '\r': put('r'); break;
+        case '\t': put('t'); break;
+        default: put("u00", 3); put(hex[c >> 4]); put(hex[c & 15]); break;
+      }
+    }
+    put(s + run, n - run);
+    put('"');
+  }
+};
+
+} // namespace Json
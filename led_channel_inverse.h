@@ -106,3 +106,21 @@ constexpr int16_t _inv_builder<_idx_seq<I...>>::data[sizeof...(I)];
 using _inv_seq = typename _make_idx_seq<LED_CHANNEL_COUNT>::type;
 using _inv_data = _inv_builder<_inv_seq>;
 static constexpr int16_t const (&LED_CHANNEL_INV)[LED_CHANNEL_COUNT] = _inv_data::data;
+
+// Render mask for the animation kernels (Anim::rendered): bit i of byte i / 8 is set when
+// logical LED i drives a physical channel, so kernels skip LEDs that are not connected
+constexpr uint8_t _render_mask_byte(int byte, int bit = 0) {
+    return bit >= 8 ? 0 : (uint8_t)(((byte * 8 + bit < LED_CHANNEL_COUNT && LED_CHANNEL_INV[byte * 8 + bit] >= 0) ? (1u << bit) : 0u) | _render_mask_byte(byte, bit + 1));
+}
+
+template<typename Seq> struct _mask_builder;
+
+template<int... I>
+struct _mask_builder<_idx_seq<I...>> { static constexpr uint8_t data[sizeof...(I)] = { _render_mask_byte(I)... }; };
+
+template<int... I>
+constexpr uint8_t _mask_builder<_idx_seq<I...>>::data[sizeof...(I)];
+
+static constexpr uint16_t LED_RENDER_MASK_BYTES = (LED_CHANNEL_COUNT + 7) / 8;
+using _mask_data = _mask_builder<typename _make_idx_seq<LED_RENDER_MASK_BYTES>::type>;
+static constexpr uint8_t const (&LED_RENDER_MASK)[LED_RENDER_MASK_BYTES] = _mask_data::data;
@@ -0,0 +1,124 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Binary LED frame stream for the web UI preview and host recorders. A push socket
+// (ws_push.h) subscribes with the text message {"frames":fps,"roles":mask}; the leader answers
+// with the rate it granted and from then on sends each due frame as one binary WebSocket
+// message. Frames go out without blocking: while the previous one still sits in the socket,
+// new frames are skipped (seq shows the gaps), so a slow phone never slows the render loop.
+//
+//   0  'L'            magic
+//   1  version (1)
+//   2  role           ROLE_LEADER, or ROLE_FOLLOWER as rendered by the leader from the
+//                     follower config and the shared clock (followers do not send frames)
+//   3  flags          reserved, 0
+//   4  seq   u32 LE   render frame counter of the node
+//   8  tMs   u32 LE   render clock
+//   12 count u16 LE   LEDs
+//   14 count bytes    brightness 0..255
+//
+// Recordings are the same frames back to back, each prefixed by its u16 LE length.
+#ifndef LED_STREAM_MAX_FPS
+#define LED_STREAM_MAX_FPS 30 // highest frame rate granted to a preview subscriber
+#endif
+#ifndef LED_STREAM_MAX_LEDS
+#define LED_STREAM_MAX_LEDS 128 // LEDs per streamed frame (one frame buffer per subscriber)
+#endif
+
+namespace LedStream {
+
+static const uint8_t MAGIC = 'L', VERSION = 1, HEADER = 14;
+enum Role : uint8_t { ROLE_LEADER = 0, ROLE_FOLLOWER = 1 };
+enum RoleMask : uint8_t { WANT_LEADER = 1, WANT_FOLLOWER = 2 };
+static const size_t MAX_FRAME = HEADER + LED_STREAM_MAX_LEDS;
+
+struct Header { uint8_t role, flags; uint32_t seq, tMs; uint16_t count; };
+
+inline uint8_t quantize(float v) {
+  if (!(v > 0.0f)) return 0; // NaN too
+  if (v >= 1.0f) return 255;
+  return (uint8_t)(v * 255.0f + 0.5f);
+}
+
+// Frame for n LEDs into out; returns its size, 0 if it does not fit
+inline size_t encode(uint8_t *out, size_t cap, uint8_t role, uint32_t seq, uint32_t tMs, const float *v, uint16_t n) {
+  if (n > LED_STREAM_MAX_LEDS || cap < (size_t)HEADER + n) return 0;
+  out[0] = MAGIC; out[1] = VERSION; out[2] = role; out[3] = 0;
+  for (int i = 0; i < 4; ++i) { out[4 + i] = (uint8_t)(seq >> (8 * i)); out[8 + i] = (uint8_t)(tMs >> (8 * i)); }
+  out[12] = (uint8_t)n; out[13] = (uint8_t)(n >> 8);
+  for (uint16_t i = 0; i < n; ++i) out[HEADER + i] = quantize(v[i]);
+  return (size_t)HEADER + n;
+}
+
+// Header and values of one frame; false if it is not a complete version-1 frame
+inline bool decode(const uint8_t *in, size_t len, Header &h, const uint8_t *&values) {
+  if (len < HEADER || in[0] != MAGIC || in[1] != VERSION) return false;
+  h.role = in[2]; h.flags = in[3]; h.seq = 0; h.tMs = 0;
+  for (int i = 3; i >= 0; --i) { h.seq = h.seq << 8 | in[4 + i]; h.tMs = h.tMs << 8 | in[8 + i]; }
+  h.count = (uint16_t)(in[12] | in[13] << 8);
+  if (len != (size_t)HEADER + h.count) return false;
+  values = in + HEADER;
+  return true;
+}
+
+// A subscriber's negotiated rate and what it has been sent
+struct Subscription {
+  uint8_t fps = 0;   // 0 = not subscribed
+  uint8_t roles = 0; // RoleMask
+  uint32_t nextMs = 0;
+  uint32_t startMs = 0; uint8_t n = 0; // frame n of the current second, so 1000/fps keeps its remainder
+  uint32_t sent = 0, skipped = 0;
+
+  // Grants min(want, LED_STREAM_MAX_FPS); returns the granted rate
+  uint8_t subscribe(long want, long roleMask, uint32_t now) {
+    fps = want <= 0 ? 0 : want > LED_STREAM_MAX_FPS ? LED_STREAM_MAX_FPS : (uint8_t)want;
+    roles = (uint8_t)(roleMask & (WANT_LEADER | WANT_FOLLOWER));
+    if (!roles) roles = WANT_LEADER;
+    nextMs = startMs = now; n = 0; sent = skipped = 0;
+    return fps;
+  }
+  // True once per 1/fps; a late caller does not get a burst of catch-up frames
+  bool due(uint32_t now) {
+    if (!fps || (int32_t)(now - nextMs) < 0) return false;
+    if (++n == fps) { startMs += 1000; n = 0; }
+    nextMs = startMs + n * 1000u / fps;
+    if ((int32_t)(now - nextMs) >= 0) { startMs = now; n = 0; nextMs = now + 1000u / fps; }
+    return true;
+  }
+};
+
+// Bytes taken by a non-blocking socket: 0 while its buffer is full, -1 on error
+typedef int (*TrySend)(void *user, const uint8_t *data, size_t len);
+
+// At most one frame in flight per socket. offer() first pushes out what is left of the
+// previous frame; if that still does not drain, the new frame is dropped.
+struct Outbox {
+  uint8_t buf[10 + MAX_FRAME]; // WebSocket header + frame
+  uint16_t len = 0, off = 0;
+
+  bool busy() const { return off < len; }
+  // Remainder of the frame in flight; false on a socket error
+  bool drain(TrySend send, void *user) {
+    while (busy()) {
+      int r = send(user, buf + off, len - off);
+      if (r < 0) return false;
+      if (r == 0) return true;
+      off = (uint16_t)(off + r);
+    }
+    len = off = 0;
+    return true;
+  }
+  enum Result : uint8_t { SENT, SKIPPED, FAILED };
+  Result offer(const uint8_t *msg, size_t n, TrySend send, void *user) {
+    if (!drain(send, user)) return FAILED;
+    if (busy()) return SKIPPED;
+    if (n > sizeof(buf)) return SKIPPED;
+    memcpy(buf, msg, n);
+    len = (uint16_t)n; off = 0;
+    return drain(send, user) ? SENT : FAILED;
+  }
+};
+
+} // namespace LedStream
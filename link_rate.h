@@ -0,0 +1,112 @@
+#pragma once
+#include <stdint.h>
+#include "lora_airtime.h"
+#include "follower_registry.h"
+#include "tdma.h"
+
+// Fleet-wide adaptive data rate. SYNC/CFG2 are broadcasts and a receiver decodes only the
+// SF/BW it is tuned to, so the whole fleet shares one rate: the fastest rung of the ladder
+// that still leaves LORA_ADR_MARGIN_DB above the demodulator floor for the weakest follower.
+// The leader measures uplink SNR on every ACK/REQ and assumes a symmetric link.
+// Off by default: the rate is not persisted and nodes boot on kDefault, so a rebooted
+// follower hunts for a fleet that moved, and followers are stranded after a leader reboot.
+// Leave it off with LORA_RELAY too: the leader cannot measure the links behind relays.
+#ifndef LORA_ADR
+#define LORA_ADR 0
+#endif
+#ifndef LORA_ADR_MARGIN_DB
+#define LORA_ADR_MARGIN_DB 6
+#endif
+
+namespace LinkRate {
+
+// Most robust first; kDefault is what HeltecLoRa::begin programs and where nodes boot
+static constexpr LoraPhy::Modem kRates[] = {
+  {10, 125000, 1, 8}, {9, 125000, 1, 8}, {8, 125000, 1, 8},
+  {7, 125000, 1, 8}, {7, 250000, 1, 8}, {7, 500000, 1, 8},
+};
+static constexpr uint8_t kCount = sizeof(kRates) / sizeof(kRates[0]);
+static constexpr uint8_t kDefault = 3;
+static constexpr int16_t kMarginQ4 = LORA_ADR_MARGIN_DB * 4;
+static constexpr uint8_t kUpRounds = 2;          // clean rounds before stepping up
+static constexpr uint32_t kUpHoldMs = 600000;    // no step-up for this long after a rollback
+// Follower: no leader packet for this long means it moved to a rate we missed
+static constexpr uint32_t kLinkLostMs = 150000;
+// Leader: gap between the RATE frame and the first SYNC on the new rate, so followers
+// have retuned before its preamble starts
+static constexpr uint32_t kSettleMs = 50;
+
+inline const LoraPhy::Modem &modem(uint8_t rate) { return kRates[rate < kCount ? rate : kDefault]; }
+
+// SNR values are kept in quarter dB. SX126x demodulation floor: -7.5 dB at SF7, 2.5 dB
+// lower per SF step. Noise power grows with bandwidth, so 250/500 kHz lose 3/6 dB.
+constexpr int16_t floorQ4(uint8_t sf) { return (int16_t)(-30 - 10 * ((int16_t)sf - 7)); }
+constexpr int16_t bwPenaltyQ4(uint32_t bwHz) { return bwHz >= 500000 ? 24 : (bwHz >= 250000 ? 12 : 0); }
+
+// Packet SNR (dB) received at `rate`, normalized to 125 kHz so samples from different
+// rates can be averaged together
+inline int16_t refSnrQ4(int8_t snrDb, uint8_t rate) { return (int16_t)(snrDb * 4 + bwPenaltyQ4(modem(rate).bwHz)); }
+
+inline int16_t marginQ4(int16_t refQ4, uint8_t rate) {
+  const LoraPhy::Modem &m = modem(rate);
+  return (int16_t)(refQ4 - bwPenaltyQ4(m.bwHz) - floorQ4(m.sf));
+}
+
+// Fastest rate keeping the margin for a link with this 125 kHz-referenced SNR
+inline uint8_t fastestFor(int16_t refQ4) {
+  for (uint8_t r = kCount; r-- > 1;) if (marginQ4(refQ4, r) >= kMarginQ4) return r;
+  return 0;
+}
+
+// Follower side: next rate to listen on while the leader cannot be found. Tries the faster
+// rungs first (a healthy fleet is usually there) and wraps, so every rung is visited.
+constexpr uint8_t scanNext(uint8_t rate) { return (uint8_t)((rate + 1) % kCount); }
+// Time to wait for an answer on one rung: a full slot window plus a few REQ retries
+inline uint32_t scanDwellMs(uint8_t rate) { return Tdma::responseWindowMs(modem(rate)) + 2 * Proto::REQ_BACKOFF_MAX_MS; }
+
+// Leader side. Called when a round closes (everyone ACKed or retries ran out); returns the
+// rate to switch to, or `rate` to stay. Step-ups go one rung at a time after kUpRounds
+// clean rounds and are verified: if the next round leaves a follower unconfirmed (it
+// missed the RATE packet or cannot hear the faster rate) the leader rolls back and holds.
+// Step-downs go straight to what the weakest follower needs, or one rung when a node that
+// was heard recently stopped answering.
+struct Controller {
+  uint8_t rate{kDefault};
+  uint8_t prevRate{kDefault};
+  bool verifying{false};
+  uint8_t goodRounds{0};
+  uint32_t holdUntilMs{0};
+
+  uint8_t onRoundDone(const Fleet::Registry &reg, uint32_t nowMs) {
+    // Confirmed nodes set the target; unconfirmed ones heard from recently block step-ups
+    // (nodes silent for kLinkLostMs have left and no longer count)
+    uint8_t target = 0xFF, missing = 0;
+    for (uint8_t i = 0; i < reg.count; ++i) {
+      const Fleet::Follower &f = reg.nodes[i];
+      if (f.lastAckMs == 0 || f.ackedFrame != reg.roundFrame) {
+        if (nowMs - f.lastSeenMs < kLinkLostMs) missing++;
+        continue;
+      }
+      uint8_t r = f.snrValid ? fastestFor(f.snrRefQ4) : rate;
+      if (r < target) target = r;
+    }
+    if (verifying) {
+      verifying = false;
+      if (missing) { goodRounds = 0; holdUntilMs = nowMs + kUpHoldMs; return prevRate; }
+    }
+    if (reg.grewThisRound()) { goodRounds = 0; return rate; } // let a joining fleet settle first
+    // A node we heard lately went quiet: its link may have faded below this rung, and a
+    // scanning node can only find us on one it can decode. Step toward the robust end.
+    if (missing && rate > 0) { goodRounds = 0; return target < rate - 1 ? target : (uint8_t)(rate - 1); }
+    if (target == 0xFF) return rate; // nobody answered: nothing to go on
+    if (target < rate) { goodRounds = 0; return target; }
+    if (target == rate) { goodRounds = 0; return rate; }
+    if (++goodRounds < kUpRounds || (int32_t)(nowMs - holdUntilMs) < 0) return rate;
+    goodRounds = 0; verifying = true; prevRate = rate;
+    return (uint8_t)(rate + 1);
+  }
+
+  void apply(uint8_t r) { rate = r; }
+};
+
+} // namespace LinkRate
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+
+// LoRa time-on-air (Semtech AN1200.13 / SX126x datasheet formula), integer-only so it
+// can size TDMA slots at compile time and run cheaply on the host simulator.
+namespace LoraPhy {
+
+struct Modem {
+  uint8_t sf;        // spreading factor 7..12
+  uint32_t bwHz;     // 125000 / 250000 / 500000
+  uint8_t cr;        // coding rate index 1..4 => 4/5..4/8
+  uint16_t preamble; // programmed preamble symbols
+};
+
+// What HeltecLoRa::begin programs: SF7 / BW125 / CR4/5 / 8-symbol preamble
+static constexpr Modem DEFAULT_MODEM{7, 125000, 1, 8};
+
+constexpr uint32_t symbolUs(const Modem &m) { return (uint32_t)(((uint64_t)1000000u << m.sf) / m.bwHz); }
+// Low data rate optimisation is mandated when a symbol exceeds 16 ms
+constexpr bool lowDataRate(const Modem &m) { return symbolUs(m) > 16000u; }
+
+constexpr int32_t _ceilDiv(int32_t a, int32_t b) { return a <= 0 ? 0 : (a + b - 1) / b; }
+constexpr uint32_t payloadSymbols(uint8_t len, const Modem &m, bool crc = true, bool implicitHeader = false) {
+  return 8u + (uint32_t)_ceilDiv(8 * (int32_t)len - 4 * m.sf + 28 + (crc ? 16 : 0) - (implicitHeader ? 20 : 0),
+                                 4 * (m.sf - (lowDataRate(m) ? 2 : 0))) * (uint32_t)(m.cr + 4);
+}
+// Preamble lasts (n + 4.25) symbols
+constexpr uint32_t preambleUs(const Modem &m) { return (uint32_t)(((uint64_t)(4u * m.preamble + 17u) * symbolUs(m)) / 4u); }
+constexpr uint32_t airtimeUs(uint8_t len, const Modem &m = DEFAULT_MODEM) { return preambleUs(m) + payloadSymbols(len, m) * symbolUs(m); }
+constexpr uint32_t airtimeMs(uint8_t len, const Modem &m = DEFAULT_MODEM) { return (airtimeUs(len, m) + 999u) / 1000u; }
+
+} // namespace LoraPhy
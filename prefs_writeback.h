@@ -0,0 +1,194 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+// Write-back cache in front of Preferences (NVS). A put only lands in RAM and marks its key
+// dirty; tick() writes dirty keys once puts have been quiet for PREFS_WB_DEBOUNCE_MS, or a
+// key has waited PREFS_WB_MAX_DELAY_MS under a steady stream of puts, and at most one key
+// per call, so the render loop takes a single flash write per pass at worst instead of
+// several per config change. Repeated puts to a waiting key merge into one write, and a put
+// of the value last written is dropped. flush() writes everything at once (before a
+// restart). A key that finds no free slot, or a string longer than PREFS_WB_STR_MAX, is
+// written through at put time. Reads still go to Preferences: the firmware reads these keys
+// at boot only, before anything is put. Templated on the Preferences class like
+// FavStore::Store, so the host tests run it on test-ui/mock_preferences.h.
+#ifndef PREFS_WB_SLOTS
+#define PREFS_WB_SLOTS 10 // keys held (the firmware puts 8)
+#endif
+#ifndef PREFS_WB_STR_SLOTS
+#define PREFS_WB_STR_SLOTS 2 // of those, string values
+#endif
+#ifndef PREFS_WB_STR_MAX
+#define PREFS_WB_STR_MAX 192 // longest string held (auto_sel: 32 ids)
+#endif
+#ifndef PREFS_WB_DEBOUNCE_MS
+#define PREFS_WB_DEBOUNCE_MS 3000 // quiet time after the last put before dirty keys are written
+#endif
+#ifndef PREFS_WB_MAX_DELAY_MS
+#define PREFS_WB_MAX_DELAY_MS 30000 // longest a dirty key waits while puts keep coming
+#endif
+
+namespace PrefsWb {
+
+enum Kind : uint8_t { FLOAT, BOOL, U8, I8, U16, U32, STR };
+
+struct Stats {
+  uint32_t puts = 0;      // put calls
+  uint32_t merged = 0;    // puts onto a key still waiting: one flash write saved each
+  uint32_t unchanged = 0; // puts of the value last written, dropped
+  uint32_t writes = 0;    // flash writes made from the cache
+  uint32_t direct = 0;    // flash writes made at put time (no slot)
+  uint32_t failed = 0;    // writes Preferences refused; the key stays dirty
+  uint32_t lastWriteUs = 0, maxWriteUs = 0, totalWriteUs = 0; // time in the write calls
+};
+
+template<typename Prefs>
+class WriteBack {
+public:
+  Stats stats;
+
+  explicit WriteBack(Prefs &prefs) : _prefs(prefs) {}
+
+  void putFloat(const char *key, float v) { uint32_t b; memcpy(&b, &v, sizeof(b)); put(key, FLOAT, b); }
+  void putBool(const char *key, bool v) { put(key, BOOL, v ? 1u : 0u); }
+  void putUChar(const char *key, uint8_t v) { put(key, U8, v); }
+  void putChar(const char *key, int8_t v) { put(key, I8, (uint8_t)v); }
+  void putUShort(const char *key, uint16_t v) { put(key, U16, v); }
+  void putULong(const char *key, uint32_t v) { put(key, U32, v); }
+  void putString(const char *key, const char *v) {
+    size_t n = strlen(v);
+    stats.puts++;
+    Slot *s = n <= PREFS_WB_STR_MAX ? slot(key, STR) : nullptr;
+    if (!s) { writeDirect(key, STR, 0, v); return; }
+    char *t = _text[s->text];
+    if (s->len == n && !memcmp(t, v, n) && s->valid) { mark(*s, false); return; }
+    memcpy(t, v, n + 1);
+    s->len = (uint16_t)n;
+    mark(*s, true);
+  }
+
+  uint8_t pending() const { uint8_t n = 0; for (const Slot &s : _slots) n += s.dirty; return n; }
+
+  // Call every loop pass: writes the longest-waiting dirty key once due. True if it wrote.
+  bool tick(uint32_t nowMs) {
+    _nowMs = nowMs;
+    Slot *s = oldest();
+    if (!s) return false;
+    if (nowMs - _lastPutMs < PREFS_WB_DEBOUNCE_MS && nowMs - s->since < PREFS_WB_MAX_DELAY_MS) return false;
+    return write(*s);
+  }
+  // Every dirty key now (before a restart); returns how many were written
+  uint8_t flush() {
+    uint8_t n = 0;
+    for (Slot &s : _slots) if (s.dirty) n += write(s);
+    return n;
+  }
+
+private:
+  struct Slot {
+    char key[16] = "";
+    Kind kind = U8;
+    bool used = false, dirty = false, valid = false; // valid: value is what the last put stored
+    uint8_t text = 0xFF; // STR: row of _text
+    uint16_t len = 0;
+    uint32_t v = 0, since = 0;
+  };
+
+  void put(const char *key, Kind kind, uint32_t v) {
+    stats.puts++;
+    Slot *s = slot(key, kind);
+    if (!s) { writeDirect(key, kind, v, nullptr); return; }
+    if (s->valid && s->v == v) { mark(*s, false); return; }
+    s->v = v;
+    mark(*s, true);
+  }
+  // changed: the held value was replaced. An unchanged put of a still-dirty key merges.
+  void mark(Slot &s, bool changed) {
+    s.valid = true;
+    if (s.dirty) { stats.merged++; _lastPutMs = _nowMs; return; }
+    if (!changed) { stats.unchanged++; return; }
+    s.dirty = true; s.since = _nowMs; _lastPutMs = _nowMs;
+  }
+
+  Slot *slot(const char *key, Kind kind) {
+    if (strlen(key) >= sizeof(Slot::key)) return nullptr;
+    Slot *free = nullptr;
+    for (Slot &s : _slots) {
+      if (s.used && !strcmp(s.key, key)) {
+        if (s.kind == kind) return &s;
+        if (s.dirty) write(s); // same key, new type: the old value must not land after the new one
+        free = &s;
+        break;
+      }
+      if (!s.used && !free) free = &s;
+    }
+    if (!free) return nullptr;
+    *free = Slot();
+    uint8_t text = 0xFF;
+    if (kind == STR) {
+      bool taken[PREFS_WB_STR_SLOTS] = {};
+      for (const Slot &s : _slots) if (s.used && s.kind == STR) taken[s.text] = true;
+      for (uint8_t i = 0; i < PREFS_WB_STR_SLOTS && text == 0xFF; ++i) if (!taken[i]) text = i;
+      if (text == 0xFF) return nullptr;
+    }
+    strcpy(free->key, key);
+    free->kind = kind; free->used = true; free->text = text;
+    return free;
+  }
+  Slot *oldest() {
+    Slot *o = nullptr;
+    for (Slot &s : _slots) if (s.dirty && (!o || _nowMs - s.since > _nowMs - o->since)) o = &s;
+    return o;
+  }
+
+  bool write(Slot &s) {
+    uint32_t t0 = clockUs();
+    bool ok = store(s.key, s.kind, s.v, s.kind == STR ? _text[s.text] : nullptr);
+    took(clockUs() - t0);
+    if (!ok) { stats.failed++; s.since = _nowMs; _lastPutMs = _nowMs; return false; } // retry after another quiet spell
+    stats.writes++;
+    s.dirty = false;
+    return true;
+  }
+  void writeDirect(const char *key, Kind kind, uint32_t v, const char *text) {
+    uint32_t t0 = clockUs();
+    bool ok = store(key, kind, v, text);
+    took(clockUs() - t0);
+    if (ok) stats.direct++; else stats.failed++;
+  }
+  bool store(const char *key, Kind kind, uint32_t v, const char *text) {
+    switch (kind) {
+      case FLOAT: { float f; memcpy(&f, &v, sizeof(f)); return _prefs.putFloat(key, f) != 0; }
+      case BOOL:  return _prefs.putBool(key, v != 0) != 0;
+      case U8:    return _prefs.putUChar(key, (uint8_t)v) != 0;
+      case I8:    return _prefs.putChar(key, (int8_t)(uint8_t)v) != 0;
+      case U16:   return _prefs.putUShort(key, (uint16_t)v) != 0;
+      case U32:   return _prefs.putULong(key, v) != 0;
+      default:    return _prefs.putString(key, text) != 0 || !*text;
+    }
+  }
+  void took(uint32_t us) {
+    stats.lastWriteUs = us;
+    stats.totalWriteUs += us;
+    if (us > stats.maxWriteUs) stats.maxWriteUs = us;
+  }
+  static uint32_t clockUs() {
+#ifdef ARDUINO
+    return (uint32_t)micros();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+  }
+
+  Prefs &_prefs;
+  Slot _slots[PREFS_WB_SLOTS];
+  char _text[PREFS_WB_STR_SLOTS][PREFS_WB_STR_MAX + 1];
+  uint32_t _nowMs = 0, _lastPutMs = 0; // puts are stamped with the time of the last tick()
+};
+
+} // namespace PrefsWb
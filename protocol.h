@@ -1,5 +1,9 @@
 #pragma once
-#include <Arduino.h>
+#if defined(__EMSCRIPTEN__) || defined(_LP64)
+  #include "web-sim2/Arduino.h"
+#else
+  #include <Arduino.h>
+#endif
 
 namespace Proto {
 static constexpr uint8_t MSG_REQ = 0x01;
@@ -8,6 +12,16 @@ static constexpr uint8_t MSG_BRIGHTNESS = 0x03;
 static constexpr uint8_t MSG_ACK = 0x04;
 // New dynamic configuration packet (variable length, see dyn_config.h)
 static constexpr uint8_t MSG_CFG2 = 0x06;
+// Join answer: SYNC header immediately followed by a complete follower CFG2
+static constexpr uint8_t MSG_JOIN = 0x07;
+// Container frame: several of the packets above sent as one radio frame (see below)
+static constexpr uint8_t MSG_BATCH = 0x08;
+// Fleet data-rate change (see link_rate.h)
+static constexpr uint8_t MSG_RATE = 0x09;
+// Erasure-coded fragment of a CFG2 (see fec.h)
+static constexpr uint8_t MSG_FEC = 0x0A;
+// Leader broadcast with hop count and sequence number, forwarded by relays (see relay.h)
+static constexpr uint8_t MSG_RELAY = 0x0B;
 
 // Flag bits for legacy compact config flags (retained for reference)
 // bit0: branchMode (non-single animations)
@@ -17,27 +31,93 @@ static constexpr uint8_t FLAG_BRANCH    = 0x01;
 static constexpr uint8_t FLAG_INVERT    = 0x02;
 static constexpr uint8_t FLAG_SINGLE_SHIFT = 2; // store index starting at bit2
 
-// Layout: type(1) | time_ms(4) | frame(4)
-// total 9 bytes
+// Node addressing: leader is 0, followers 1..254, 0xFF = all followers
+static constexpr uint8_t NODE_LEADER = 0x00;
+static constexpr uint8_t NODE_BROADCAST = 0xFF;
+
+// Layout: type(1) | time_ms(4) | frame(4) | target(1) | cfgHash(2)
+// total 12 bytes. target != NODE_BROADCAST asks only that follower to ACK (targeted retry).
+// cfgHash: DynCfg::configHash of the leader's follower config; a follower whose own hash
+// differs asks for a resend (REQ), so a missed CFG2 heals at the next SYNC. 0 = not sent.
 struct SyncPacket {
   uint8_t type{MSG_SYNC};
   uint32_t time_ms{0};
   uint32_t frame{0};
+  uint8_t target{NODE_BROADCAST};
+  uint16_t cfgHash{0};
 } __attribute__((packed));
+static constexpr uint8_t SYNC_NOHASH_SIZE = 10; // pre config-hash firmware
 
+// Layout: type(1) | frame(4) | node(1) | offsetErr(2)
+// offsetErr: follower clock error in ms measured on that SYNC (before correction), saturated to int16
 struct AckPacket {
   uint8_t type{MSG_ACK};
   uint32_t frame{0};
+  uint8_t node{0};
+  int16_t offsetErrMs{0};
 } __attribute__((packed));
+static constexpr uint8_t ACK_LEGACY_SIZE = 5; // type + frame (pre node-id firmware)
 
 struct BrightnessPacket {
   uint8_t type{MSG_BRIGHTNESS};
   uint8_t percent{100};
 } __attribute__((packed));
 
+// Layout: type(1) | node(1) | cfgHash(2)
+// cfgHash: DynCfg::configHash of the follower's current config; the leader only attaches
+// the config to its answer when it differs. 2-byte legacy REQs carry no hash.
 struct ReqPacket {
   uint8_t type{MSG_REQ};
+  uint8_t node{0};
+  uint16_t cfgHash{0};
+} __attribute__((packed));
+static constexpr uint8_t REQ_LEGACY_SIZE = 2;
+
+// Layout: type(1) | time_ms(4) | frame(4) | target(1) | CFG2 packet (starting with MSG_CFG2)
+// Sent instead of a targeted SYNC when a joining follower's config is stale, so one frame
+// carries both time and config. Every follower applies it (config is fleet-wide), only
+// target ACKs right away. The leader's boot round and rounds that welcome new followers
+// open with a broadcast JOIN, ACKed in the TDMA slots like a broadcast SYNC.
+struct JoinHeader {
+  uint8_t type{MSG_JOIN};
+  uint32_t time_ms{0};
+  uint32_t frame{0};
+  uint8_t target{NODE_BROADCAST};
+} __attribute__((packed));
+
+// Layout: type(1) | rate(1)
+// rate: index into LinkRate::kRates. Sent by the leader on the old rate; followers retune
+// right away and the leader follows once the frame is out.
+struct RatePacket {
+  uint8_t type{MSG_RATE};
+  uint8_t rate{0};
+} __attribute__((packed));
+
+// Layout: type(1) | hops(1) | seq(2) | packet
+// hops: relays the packet passed (0 = straight from the leader). seq: leader-assigned,
+// never 0; every node handles a seq once and relays forward it once.
+struct RelayHeader {
+  uint8_t type{MSG_RELAY};
+  uint8_t hops{0};
+  uint16_t seq{0};
 } __attribute__((packed));
 
+// Layout: type(1) | { len(1) | packet(len) }*
+// Each record is a complete packet from above, starting with its own type byte, so the
+// receiver hands them to the normal parser one by one. Saves the preamble, header and RX
+// turnaround of every packet but the first. Whole frame <= BATCH_MAX_BYTES (radio buffer).
+static constexpr uint8_t BATCH_MAX_BYTES = 64;
+static constexpr uint8_t BATCH_MAX_RECORDS = 8;
+
+// Follower REQ retry delay: exponential backoff (base << attempt, capped) with equal
+// jitter so nodes that booted together spread out. rnd is any uniform 32-bit value.
+static constexpr uint32_t REQ_BACKOFF_BASE_MS = 250;
+static constexpr uint32_t REQ_BACKOFF_MAX_MS = 4000;
+inline uint32_t reqBackoffMs(uint8_t attempt, uint32_t rnd) {
+  uint32_t d = REQ_BACKOFF_BASE_MS << (attempt < 5 ? attempt : 5);
+  if (d > REQ_BACKOFF_MAX_MS) d = REQ_BACKOFF_MAX_MS;
+  return d / 2 + rnd % (d / 2 + 1);
+}
+
 inline uint16_t encodeAnimCode(uint8_t animIndex) { return animIndex; }
 }
@@ -0,0 +1,132 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "protocol.h"
+#include "lora_airtime.h"
+#include "tdma.h"
+
+// Multi-hop relaying for installations wider than one radio hop. A leader built with
+// LORA_RELAY puts a RelayHeader (hop count + sequence number) on its broadcasts: SYNC,
+// JOIN, CFG2 and its FEC fragments, BRIGHTNESS (a JOIN too long to wrap goes out bare). A follower built with LORA_RELAY forwards every
+// new seq once with hops + 1, and moves the leader clock in a SYNC/JOIN forward by the time it
+// held the packet plus the inbound frame's airtime, so nodes behind it sync like direct
+// ones. Followers only ACK what they heard from the leader itself (it cannot hear them
+// otherwise); a relay answers REQs the leader leaves unanswered with its own SYNC/JOIN.
+// Every node drops sequence numbers it has already handled.
+#ifndef LORA_RELAY
+#define LORA_RELAY 0 // leader: sequence broadcasts for relays; follower: act as a relay
+#endif
+#ifndef RELAY_MAX_HOPS
+#define RELAY_MAX_HOPS 3 // radio hops from the leader to the farthest follower
+#endif
+
+namespace Relay {
+
+static constexpr uint8_t kMaxHops = RELAY_MAX_HOPS;
+static constexpr uint8_t kHeaderBytes = sizeof(Proto::RelayHeader);
+static constexpr uint8_t kSeenSize = 16;  // recent sequence numbers remembered
+static constexpr uint8_t kQueueSize = 4;  // packets a relay holds for forwarding
+
+// Leader broadcasts worth carrying further out
+inline bool forwardable(const uint8_t *p, uint8_t len) {
+  if (!len) return false;
+  switch (p[0]) {
+    case Proto::MSG_SYNC: return len >= Proto::SYNC_NOHASH_SIZE && p[9] == Proto::NODE_BROADCAST;
+    case Proto::MSG_JOIN: return len >= sizeof(Proto::JoinHeader) && p[9] == Proto::NODE_BROADCAST;
+    case Proto::MSG_CFG2: case Proto::MSG_FEC: case Proto::MSG_BRIGHTNESS: return true;
+    default: return false;
+  }
+}
+
+inline uint8_t wrap(const uint8_t *p, uint8_t len, uint8_t hops, uint16_t seq, uint8_t *out, uint8_t outMax) {
+  if (kHeaderBytes + len > outMax) return 0;
+  Proto::RelayHeader h; h.hops = hops; h.seq = seq;
+  memcpy(out, &h, kHeaderBytes);
+  memcpy(out + kHeaderBytes, p, len);
+  return (uint8_t)(kHeaderBytes + len);
+}
+
+inline bool unwrap(const uint8_t *frame, uint8_t len, Proto::RelayHeader &h, const uint8_t *&inner, uint8_t &innerLen) {
+  if (len <= kHeaderBytes || frame[0] != Proto::MSG_RELAY || frame[kHeaderBytes] == Proto::MSG_RELAY) return false;
+  memcpy(&h, frame, kHeaderBytes);
+  inner = frame + kHeaderBytes; innerLen = (uint8_t)(len - kHeaderBytes);
+  return h.seq != 0;
+}
+
+// Advance the leader clock carried by a SYNC/JOIN (relayed or not) by ms
+inline void addTime(uint8_t *p, uint8_t len, uint32_t ms) {
+  if (len > kHeaderBytes && p[0] == Proto::MSG_RELAY) { p += kHeaderBytes; len = (uint8_t)(len - kHeaderBytes); }
+  if ((p[0] != Proto::MSG_SYNC && p[0] != Proto::MSG_JOIN) || len < 5) return;
+  uint32_t t; memcpy(&t, p + 1, 4); t += ms; memcpy(p + 1, &t, 4);
+}
+
+// Random spread over several slots: relays that heard the same frame key up at different
+// times, and whichever goes first suppresses the others (Queue::cancel)
+inline uint32_t spreadMs(const LoraPhy::Modem &m, uint32_t rnd) { return 10 + rnd % (8 * Tdma::slotMs(m)); }
+
+// Delay before a relay forwards a packet it just received. A broadcast SYNC/JOIN from the
+// leader is followed by every direct follower's ACK slot and the leader's first targeted retry, so
+// its copy waits for those. The hold time is added to the forwarded clock, so waiting costs
+// no accuracy.
+inline uint32_t forwardDelayMs(const uint8_t *p, uint8_t hops, const LoraPhy::Modem &m, uint32_t rnd) {
+  uint32_t spread = spreadMs(m, rnd);
+  if (hops == 0 && (p[0] == Proto::MSG_SYNC || p[0] == Proto::MSG_JOIN)) return Tdma::kGuardMs + (uint32_t)Tdma::kSlots * Tdma::slotMs(m) + Tdma::targetedWindowMs(m) + spread;
+  return spread;
+}
+
+// A relay answers a REQ itself only after the leader had its slot window and one targeted
+// retry to do so
+inline uint32_t answerDelayMs(const LoraPhy::Modem &m, uint32_t rnd) {
+  return Tdma::responseWindowMs(m) + Tdma::targetedWindowMs(m) + spreadMs(m, rnd);
+}
+
+// Sequence numbers handled recently (0 is never a valid seq)
+struct Seen {
+  uint16_t seq[kSeenSize]{};
+  uint8_t next{0};
+  bool fresh(uint16_t s) {
+    for (uint8_t i = 0; i < kSeenSize; ++i) if (seq[i] == s) return false;
+    seq[next] = s; next = (uint8_t)((next + 1) % kSeenSize);
+    return true;
+  }
+};
+
+// Packets a relay is holding until their forward time
+struct Queue {
+  struct Entry { uint8_t buf[Proto::BATCH_MAX_BYTES]; uint8_t len; uint32_t rxAtMs, dueMs, inAirMs; };
+  Entry e[kQueueSize];
+  uint8_t count{0};
+
+  // frame: relay header + packet as received; inAirMs: airtime of the frame it arrived in
+  bool push(const uint8_t *frame, uint8_t len, uint32_t nowMs, uint32_t delayMs, uint32_t inAirMs) {
+    if (count == kQueueSize || len > sizeof(e[0].buf)) return false;
+    Entry &x = e[count++];
+    memcpy(x.buf, frame, len); x.len = len; x.buf[1]++; // hops
+    x.rxAtMs = nowMs; x.dueMs = nowMs + delayMs; x.inAirMs = inAirMs;
+    return true;
+  }
+  // Another relay already sent this seq at least as far out as our copy would go
+  void cancel(uint16_t seq, uint8_t hops) {
+    for (uint8_t i = 0; i < count;) {
+      uint16_t s; memcpy(&s, e[i].buf + 2, 2);
+      if (s == seq && hops >= e[i].buf[1]) { for (uint8_t j = i; j + 1 < count; ++j) e[j] = e[j + 1]; count--; }
+      else ++i;
+    }
+  }
+  // Next packet due at nowMs, its leader clock advanced by the time it spent here plus the
+  // inbound airtime (correct = false keeps the original stamp). Returns its length or 0.
+  uint8_t pop(uint32_t nowMs, uint8_t *out, bool correct = true) {
+    for (uint8_t i = 0; i < count; ++i) {
+      if ((int32_t)(nowMs - e[i].dueMs) < 0) continue;
+      uint8_t len = e[i].len;
+      memcpy(out, e[i].buf, len);
+      if (correct) addTime(out, len, nowMs - e[i].rxAtMs + e[i].inAirMs);
+      for (uint8_t j = i; j + 1 < count; ++j) e[j] = e[j + 1];
+      count--;
+      return len;
+    }
+    return 0;
+  }
+};
+
+} // namespace Relay
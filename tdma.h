@@ -0,0 +1,73 @@
+#pragma once
+#include <stdint.h>
+#include "protocol.h"
+#include "lora_airtime.h"
+
+// Slotted follower transmissions. After a broadcast SYNC every follower answers in its own
+// slot (node id modulo slot count) measured from the SYNC reception, so ACKs no longer
+// collide on the shared channel. REQs of a synced follower wait for its slot on the
+// leader's clock; before the first SYNC there is no shared grid, so the first one is
+// spread over a whole frame (firstReqDelayMs) and retries back off randomly
+// (Proto::reqBackoffMs).
+// Slot timing scales with the modem; the k* constants are for the default one.
+#ifndef TDMA_SLOTS
+#define TDMA_SLOTS 64 // assign follower ids 1..TDMA_SLOTS for collision-free slots
+#endif
+#ifndef TDMA_GUARD_MS
+#define TDMA_GUARD_MS 16 // per-slot margin: RX->TX turnaround + loop() period jitter
+#endif
+
+namespace Tdma {
+
+static constexpr uint8_t kSlots = TDMA_SLOTS;
+static constexpr uint32_t kGuardMs = TDMA_GUARD_MS;
+static constexpr uint8_t kMaxFrameBytes = Proto::BATCH_MAX_BYTES;
+
+// Slot width covers the largest follower reply plus guard
+constexpr uint32_t slotMs(const LoraPhy::Modem &m = LoraPhy::DEFAULT_MODEM) {
+  return LoraPhy::airtimeMs(sizeof(Proto::AckPacket), m) + kGuardMs;
+}
+// Leader needs this long after a SYNC (its own TX + all slots) before calling a node stale
+constexpr uint32_t responseWindowMs(const LoraPhy::Modem &m = LoraPhy::DEFAULT_MODEM) {
+  return LoraPhy::airtimeMs(sizeof(Proto::SyncPacket), m) + kGuardMs + (uint32_t)kSlots * slotMs(m);
+}
+// A targeted SYNC/JOIN is answered right away, so its retry timer can be short. Sized for
+// the longest targeted frame, a JOIN filling the 64-byte radio buffer.
+constexpr uint32_t targetedWindowMs(const LoraPhy::Modem &m = LoraPhy::DEFAULT_MODEM) {
+  return LoraPhy::airtimeMs(kMaxFrameBytes, m) + 2 * kGuardMs + slotMs(m);
+}
+
+static constexpr uint32_t kSlotMs = slotMs();
+static constexpr uint32_t kFrameMs = (uint32_t)kSlots * kSlotMs;
+static constexpr uint32_t kResponseWindowMs = responseWindowMs();
+static constexpr uint32_t kTargetedWindowMs = targetedWindowMs();
+
+constexpr uint8_t slotFor(uint8_t nodeId) { return (uint8_t)(nodeId % kSlots); }
+
+// Delay from SYNC reception to this node's ACK. A SYNC addressed to one node has no
+// competing responders, so it answers right after the guard.
+constexpr uint32_t ackDelayMs(uint8_t nodeId, bool targeted, const LoraPhy::Modem &m = LoraPhy::DEFAULT_MODEM) {
+  return kGuardMs + (targeted ? 0u : (uint32_t)slotFor(nodeId) * slotMs(m));
+}
+
+// Earliest local time >= earliestMs that starts this node's slot on the leader's TDMA grid.
+// offsetMs is leader time - local time as learnt from SYNC, so every synced node works on
+// the same grid. Before the first SYNC there is no grid and callers back off randomly.
+inline uint32_t nextSlotStart(uint32_t earliestMs, int32_t offsetMs, uint8_t nodeId, const LoraPhy::Modem &m = LoraPhy::DEFAULT_MODEM) {
+  uint32_t frame = (uint32_t)kSlots * slotMs(m);
+  uint32_t leaderMs = earliestMs + (uint32_t)offsetMs;
+  uint32_t t = leaderMs - leaderMs % frame + (uint32_t)slotFor(nodeId) * slotMs(m);
+  if ((int32_t)(t - leaderMs) < 0) t += frame;
+  return t - (uint32_t)offsetMs;
+}
+
+// Delay before the first REQ of a follower that has not heard a SYNC yet. After a power-up
+// the whole fleet may be booting together: the leader's first broadcast (a JOIN carrying
+// the config) and its ACK slots come first, then the REQs of nodes that missed it land at
+// random points of one frame instead of all within the first backoff step. rnd is any
+// uniform 32-bit value.
+inline uint32_t firstReqDelayMs(uint32_t rnd, const LoraPhy::Modem &m = LoraPhy::DEFAULT_MODEM) {
+  return responseWindowMs(m) + rnd % ((uint32_t)kSlots * slotMs(m));
+}
+
+} // namespace Tdma
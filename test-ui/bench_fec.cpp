@@ -0,0 +1,91 @@
+// Host benchmark for the CFG2 erasure code (fec.h): checks that every set of k fragments
+// rebuilds the packet, then times encode/rebuild and lists the airtime of each k+m shape.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "../anim_schema.h"
+#include "../dyn_config.h"
+#include "../fec.h"
+#include "../lora_airtime.h"
+
+using Clock = std::chrono::steady_clock;
+
+template<typename F>
+static double nsPerOp(uint32_t iters, F &&fn){
+  auto t0 = Clock::now();
+  fn(iters);
+  auto t1 = Clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / (double)iters;
+}
+
+static volatile uint32_t g_sink;
+
+struct Shape { uint8_t k, m; };
+static const Shape kShapes[] = { {2,1}, {3,1}, {2,2}, {3,2}, {4,2}, {4,3}, {6,2} };
+
+// Feed the fragments in `mask` (in index order) to a fresh assembler
+static uint8_t rebuildFrom(uint8_t frags[][Proto::BATCH_MAX_BYTES], const uint8_t *fl, uint8_t n, uint32_t mask, uint8_t *out){
+  Fec::Assembler a;
+  uint8_t got = 0;
+  for (uint8_t i = 0; i < n; ++i) if (mask & (1u << i)) { uint8_t r = a.add(frags[i], fl[i], out); if (r) got = r; }
+  return got;
+}
+
+static int checkAllErasures(const uint8_t *msg, uint8_t len){
+  int bad = 0;
+  for (const Shape &s : kShapes){
+    uint8_t n = (uint8_t)(s.k + s.m);
+    uint8_t frags[Fec::kMaxFrags][Proto::BATCH_MAX_BYTES], fl[Fec::kMaxFrags];
+    for (uint8_t i = 0; i < n; ++i) fl[i] = Fec::encodeFragment(msg, len, s.k, s.m, 7, i, frags[i], sizeof(frags[i]));
+    for (uint32_t mask = 0; mask < (1u << n); ++mask){
+      uint8_t have = (uint8_t)__builtin_popcount(mask), out[Fec::kMaxMsgBytes];
+      memset(out, 0, sizeof(out));
+      uint8_t r = rebuildFrom(frags, fl, n, mask, out);
+      bool ok = have >= s.k ? (r == len && memcmp(out, msg, len) == 0) : r == 0;
+      if (!ok) { std::printf("k=%u m=%u mask=0x%02x: %s\n", s.k, s.m, (unsigned)mask, have >= s.k ? "bad rebuild" : "rebuilt too early"); bad++; }
+    }
+  }
+  // Fragments of another message id must not mix with the current set
+  uint8_t f0[Proto::BATCH_MAX_BYTES], f1[Proto::BATCH_MAX_BYTES], out[Fec::kMaxMsgBytes];
+  uint8_t l0 = Fec::encodeFragment(msg, len, 2, 1, 1, 0, f0, sizeof(f0));
+  uint8_t l1 = Fec::encodeFragment(msg, len, 2, 1, 2, 1, f1, sizeof(f1));
+  Fec::Assembler a;
+  if (a.add(f0, l0, out) || a.add(f1, l1, out)) { std::printf("mixed message ids rebuilt\n"); bad++; }
+  return bad;
+}
+
+int main(int argc, char **argv){
+  uint32_t iters = (argc > 1) ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 200000u;
+
+  // A CFG2 carrying every schema param, as sendAllParams pushes it
+  Anim::ParamSet ps;
+  DynCfg::ParamValue pv[AnimSchema::PARAM_COUNT];
+  for (uint8_t i=0;i<AnimSchema::PARAM_COUNT;i++) pv[i] = { AnimSchema::PARAM_IDS[i], Anim::getParamField(ps, AnimSchema::PARAM_IDS[i]) };
+  uint8_t msg[64];
+  uint8_t len = DynCfg::encodeCfg2(1, 1, pv, AnimSchema::PARAM_COUNT, nullptr, 0, msg, sizeof(msg));
+  if (!len) { std::printf("FAILED: CFG2 does not fit\n"); return 1; }
+  if (int bad = checkAllErasures(msg, len)) { std::printf("FAILED: %d bad erasure patterns\n", bad); return 1; }
+
+  uint32_t plainMs = LoraPhy::airtimeMs(len, LoraPhy::DEFAULT_MODEM);
+  std::printf("CFG2 %u bytes, %u ms on air at SF7/125 (plain x2 %u ms, x3 %u ms)\n", len, plainMs, 2 * plainMs, 3 * plainMs);
+  std::printf(" k+m  frag bytes  set airtime  encode set  rebuild (m data lost)\n");
+  for (const Shape &s : kShapes){
+    uint8_t n = (uint8_t)(s.k + s.m);
+    uint8_t frags[Fec::kMaxFrags][Proto::BATCH_MAX_BYTES], fl[Fec::kMaxFrags];
+    double enc = nsPerOp(iters, [&](uint32_t it){
+      for (uint32_t i=0;i<it;i++){ for (uint8_t f=0;f<n;f++) fl[f] = Fec::encodeFragment(msg, len, s.k, s.m, (uint8_t)i, f, frags[f], sizeof(frags[f])); g_sink += frags[n-1][Fec::kHeaderBytes]; }
+    });
+    // Worst case: the first m data fragments lost, every parity row used
+    uint32_t mask = ((1u << n) - 1) & ~((1u << s.m) - 1);
+    double dec = nsPerOp(iters, [&](uint32_t it){
+      uint8_t out[Fec::kMaxMsgBytes];
+      for (uint32_t i=0;i<it;i++) g_sink += rebuildFrom(frags, fl, n, mask, out);
+    });
+    uint32_t setMs = 0;
+    for (uint8_t f=0;f<n;f++) setMs += LoraPhy::airtimeMs(fl[f], LoraPhy::DEFAULT_MODEM);
+    std::printf(" %u+%u  %10u  %8u ms  %7.0f ns  %7.0f ns\n", s.k, s.m, (unsigned)fl[0], setMs, enc, dec);
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Host benchmark for the periodic-animation frame cache (frame_cache.h): renders Wave, Pulse
+// and Chase through the cache and directly, checks the cached Wave frames against the direct
+// ones and that a parameter change starts the cache over, checks that Pulse and Chase bypass
+// the cache (rendering them is cheaper than the lookup), and times both paths.
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../frame_cache.h"
+
+using Clock = std::chrono::steady_clock;
+
+static volatile float g_sink;
+static const uint64_t kFrameUs = 33333;
+
+struct Case { const char *name; uint8_t anim; float speed; bool branch; uint8_t width; };
+static const Case kCases[] = {
+  { "Wave", 1, 3.0f, false, 3 }, { "Wave branch", 1, 0.7f, true, 3 }, { "Pulse", 2, 3.0f, false, 3 },
+  { "Pulse branch", 2, 12.0f, true, 3 }, { "Chase", 3, 3.0f, false, 2 }, { "Chase branch", 3, 5.0f, true, 1 },
+};
+
+int main(int argc, char **argv){
+  uint32_t frames = (argc > 1) ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 20000u;
+  const uint16_t n = Anim::TOTAL_LEDS;
+  int bad = 0;
+
+  std::printf("FRAME_CACHE_BYTES %u, %u LEDs, %u frames at 30 fps\n", (unsigned)FRAME_CACHE_BYTES, n, frames);
+  std::printf("%-13s %7s %7s %6s %10s %10s %9s\n", "animation", "frames", "bytes", "hit %", "direct ns", "cached ns", "max err");
+  for (const Case &c : kCases){
+    Anim::ParamSet ps;
+    ps.speed = c.speed; ps.branch = c.branch; ps.width = c.width; ps.globalMax = 0.9f;
+    FrameCache::Cache<> cache;
+    float a[Anim::TOTAL_LEDS], b[Anim::TOTAL_LEDS], maxErr = 0.0f;
+    uint64_t t0 = 3ull * 86400ull * 1000000ull; // some uptime
+    for (uint32_t f = 0; f < frames; ++f){
+      uint64_t t = t0 + f * kFrameUs;
+      cache.render(c.anim, t, n, ps, a);
+      Anim::applyAnim(c.anim, t, n, ps, b);
+      for (uint16_t i = 0; i < n; ++i) maxErr = std::fmax(maxErr, std::fabs(a[i] - b[i]));
+    }
+    // 12-bit quantisation, plus linear interpolation between keyframes for continuous curves
+    float allowed = c.anim == 3 ? 1.0f / FrameCache::kLevelMax : 0.002f;
+    if (maxErr > allowed) { std::printf("%s: cached frame off by %.5f\n", c.name, maxErr); bad++; }
+    const bool useCache = c.anim == 1;
+    if (!useCache && cache.stats.bypass != frames) { std::printf("%s was cached\n", c.name); bad++; }
+
+    // Timing: the cache is warm now
+    auto s0 = Clock::now();
+    for (uint32_t f = 0; f < frames; ++f){ Anim::applyAnim(c.anim, t0 + f * kFrameUs, n, ps, b); g_sink += b[f % n]; }
+    auto s1 = Clock::now();
+    for (uint32_t f = 0; f < frames; ++f){ cache.render(c.anim, t0 + f * kFrameUs, n, ps, a); g_sink += a[f % n]; }
+    auto s2 = Clock::now();
+    double direct = std::chrono::duration<double, std::nano>(s1 - s0).count() / frames;
+    double cached = std::chrono::duration<double, std::nano>(s2 - s1).count() / frames;
+    const FrameCache::Stats &st = cache.stats;
+    std::printf("%-13s %7u %7u %6u %10.0f %10.0f %9.5f\n", c.name, st.frames, (unsigned)st.bytes, st.hitPct(), direct, cached, maxErr);
+
+    // A config change (new speed/phase) must not serve frames of the old parameter set
+    ps.phase = 1.0f; ps.speed *= 1.5f;
+    uint32_t missesBefore = st.misses;
+    cache.render(c.anim, t0, n, ps, a);
+    Anim::applyAnim(c.anim, t0, n, ps, b);
+    float err = 0.0f;
+    for (uint16_t i = 0; i < n; ++i) err = std::fmax(err, std::fabs(a[i] - b[i]));
+    if ((useCache && st.misses == missesBefore) || err > allowed) { std::printf("%s: stale frame after a parameter change (err %.4f)\n", c.name, err); bad++; }
+  }
+
+  // Non-periodic animations go straight to the renderer
+  {
+    FrameCache::Cache<> cache; Anim::ParamSet ps; float a[Anim::TOTAL_LEDS];
+    for (int f = 0; f < 10; ++f) cache.render(5, (uint64_t)f * kFrameUs, n, ps, a);
+    if (cache.stats.bypass != 10 || cache.stats.bytes) { std::printf("Sparkle was cached\n"); bad++; }
+  }
+  if (bad) { std::printf("FAILED: %d\n", bad); return 1; }
+  return 0;
+}
@@ -0,0 +1,185 @@
+// Host benchmark for the streaming JSON writer (json_writer.h) against the String
+// concatenation the web handlers used before: /api/state and /api/favorites with 10, 50 and
+// 200 stored favorites. Counts heap allocations and peak heap through operator new, checks
+// that both paths produce the same bytes, and exits non-zero if they differ or the writer
+// touches the heap.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../anim_schema.h"
+#include "../json_writer.h"
+
+using Clock = std::chrono::steady_clock;
+
+// --- heap accounting ---
+static size_t g_live = 0, g_peak = 0, g_allocs = 0;
+void *operator new(size_t n) {
+  size_t *p = (size_t *)std::malloc(n + sizeof(size_t));
+  if (!p) throw std::bad_alloc();
+  *p = n; g_live += n; g_allocs++; if (g_live > g_peak) g_peak = g_live;
+  return p + 1;
+}
+void operator delete(void *q) noexcept { if (!q) return; size_t *p = (size_t *)q - 1; g_live -= *p; std::free(p); }
+void operator delete(void *q, size_t) noexcept { operator delete(q); }
+struct HeapScope {
+  size_t live0, allocs0;
+  HeapScope() : live0(g_live), allocs0(g_allocs) { g_peak = g_live; }
+  size_t peak() const { return g_peak - live0; }
+  size_t allocs() const { return g_allocs - allocs0; }
+};
+
+// Arduino String stand-ins for the previous handlers
+typedef std::string String;
+static String S(int v) { return std::to_string(v); }
+static String S(float v, int decimals) { char b[32]; std::snprintf(b, sizeof(b), "%.*f", decimals, (double)v); return b; }
+
+static volatile uint32_t g_sink;
+static void sinkDiscard(void *, const char *data, size_t len) { g_sink += (uint32_t)len + (uint8_t)data[0]; }
+static void sinkAppend(void *user, const char *data, size_t len) { static_cast<std::string *>(user)->append(data, len); }
+
+static Anim::ParamSet g_leader, g_follower;
+
+// What the favorites store hands out (prefs.getString copies)
+static std::vector<std::string> g_store;
+static String getFav(size_t i) { return g_store[i]; }
+static String nameOf(const String &js) {
+  size_t a = js.find("\"name\":\"") + 8;
+  return js.substr(a, js.find('"', a) - a);
+}
+
+static String stateString() {
+  String j = "{";
+  j += "\"autoOn\":" + String("false") + ",";
+  j += "\"autoRemaining\":" + S(0) + ",";
+  const char *roles[] = { "leader", "follower" };
+  for (int r = 0; r < 2; ++r) {
+    const Anim::ParamSet &ps = r ? g_follower : g_leader;
+    j += "\"" + String(roles[r]) + "\":{";
+    j += "\"animIndex\":" + S(r + 1) + ",";
+    j += "\"params\":[";
+    for (size_t i = 0; i < sizeof(AnimSchema::PARAMS) / sizeof(AnimSchema::PARAMS[0]); ++i) {
+      const AnimSchema::ParamDef &pd = AnimSchema::PARAMS[i];
+      if (i) j += ',';
+      j += '{';
+      j += "\"id\":" + S(pd.id) + ",\"value\":" + S(Anim::getParamField(ps, pd.id), 5);
+      j += '}';
+    }
+    j += "]}";
+    j += r ? "" : ",";
+  }
+  j += "}";
+  return j;
+}
+
+template<size_t N>
+static void stateWriter(Json::Writer<N> &w) {
+  w.beginObject();
+  w.key("autoOn").boolean(false);
+  w.key("autoRemaining").num(0);
+  const char *roles[] = { "leader", "follower" };
+  for (int r = 0; r < 2; ++r) {
+    const Anim::ParamSet &ps = r ? g_follower : g_leader;
+    w.key(roles[r]).beginObject().key("animIndex").num(r + 1).key("params").beginArray();
+    for (size_t i = 0; i < sizeof(AnimSchema::PARAMS) / sizeof(AnimSchema::PARAMS[0]); ++i) {
+      const AnimSchema::ParamDef &pd = AnimSchema::PARAMS[i];
+      w.beginObject().key("id").num(pd.id).key("value").num(Anim::getParamField(ps, pd.id), 5).endObject();
+    }
+    w.endArray().endObject();
+  }
+  w.endObject();
+  w.flush();
+}
+
+static String favoritesString(size_t count) {
+  String j = "{\"items\":[";
+  for (size_t i = 0; i < count; i++) {
+    if (i) j += ',';
+    String cfg = getFav(i);
+    String nm = nameOf(cfg);
+    j += "{\"id\":" + S((int)i) + ",\"name\":\"" + nm + "\",\"cfg\":" + cfg + "}";
+  }
+  j += "]}";
+  return j;
+}
+
+template<size_t N>
+static void favoritesWriter(Json::Writer<N> &w, size_t count) {
+  w.beginObject().key("items").beginArray();
+  for (size_t i = 0; i < count; i++) {
+    String cfg = getFav(i);
+    String nm = nameOf(cfg);
+    w.beginObject().key("id").num((unsigned)i).key("name").rawStr(nm.data(), nm.size()).key("cfg").raw(cfg.data(), cfg.size()).endObject();
+  }
+  w.endArray().endObject();
+  w.flush();
+}
+
+template<typename F>
+static double nsPerCall(uint32_t iters, F &&fn) {
+  auto t0 = Clock::now();
+  for (uint32_t i = 0; i < iters; ++i) fn();
+  return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / iters;
+}
+
+// A stored favorite as the web UI saves it: name plus both full parameter sets
+static std::string makeFavorite(int i) {
+  std::string s = "{\"name\":\"Favorite " + std::to_string(i) + " \\\"warm\\\"\"";
+  const char *roles[] = { "leader", "follower" };
+  for (int r = 0; r < 2; ++r) {
+    s += ",\"" + std::string(roles[r]) + "\":{\"animIndex\":" + std::to_string((i + r) % 7) + ",\"params\":[";
+    for (size_t k = 0; k < AnimSchema::PARAM_COUNT; ++k) s += (k ? ",{\"id\":" : "{\"id\":") + std::to_string(AnimSchema::PARAMS[k].id) + ",\"value\":" + std::to_string(AnimSchema::PARAMS[k].defVal) + "}";
+    s += "]}";
+  }
+  return s + ",\"globals\":{\"globalSpeed\":1}}";
+}
+
+int main(int argc, char **argv) {
+  uint32_t iters = (argc > 1) ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 2000u;
+  int bad = 0;
+  g_leader.speed = 2.5f; g_follower.phase = -1.25f; g_follower.width = 5;
+  for (int i = 0; i < 200; ++i) g_store.push_back(makeFavorite(i));
+
+  std::printf("JSON_CHUNK_BYTES %u, favorite ~%zu bytes, %u iterations\n", (unsigned)JSON_CHUNK_BYTES, g_store[0].size(), iters);
+  std::printf("%-16s %8s | %10s %8s %9s | %10s %8s %9s\n", "response", "bytes", "String ns", "allocs", "peak B", "writer ns", "allocs", "peak B");
+
+  struct Row { const char *name; size_t favs; };
+  const Row rows[] = { { "/api/state", 0 }, { "favorites x10", 10 }, { "favorites x50", 50 }, { "favorites x200", 200 } };
+  for (const Row &row : rows) {
+    bool state = row.favs == 0;
+    // Same bytes from both paths
+    String ref = state ? stateString() : favoritesString(row.favs);
+    std::string streamed;
+    { Json::Writer<> w(&sinkAppend, &streamed); if (state) stateWriter(w); else favoritesWriter(w, row.favs); }
+    if (streamed != ref) { std::printf("%s: writer output differs\n", row.name); bad++; }
+
+    size_t sAllocs, sPeak, wAllocs, wPeak;
+    { HeapScope h; String j = state ? stateString() : favoritesString(row.favs); g_sink += (uint32_t)j.size(); sAllocs = h.allocs(); sPeak = h.peak(); }
+    { HeapScope h; Json::Writer<> w(&sinkDiscard, nullptr); if (state) stateWriter(w); else favoritesWriter(w, row.favs); wAllocs = h.allocs(); wPeak = h.peak(); }
+    // Favorites: one stored entry copy at a time is all the writer path allocates
+    size_t favCopy = state ? 0 : g_store[0].size() + 64;
+    if (wPeak > favCopy * 2) { std::printf("%s: writer peak heap %zu B\n", row.name, wPeak); bad++; }
+    if (state && wAllocs) { std::printf("%s: writer allocated\n", row.name); bad++; }
+
+    uint32_t n = state ? iters * 10 : iters * 10 / (uint32_t)row.favs + 1;
+    double sNs = nsPerCall(n, [&]() { String j = state ? stateString() : favoritesString(row.favs); g_sink += (uint32_t)j.size(); });
+    double wNs = nsPerCall(n, [&]() { Json::Writer<> w(&sinkDiscard, nullptr); if (state) stateWriter(w); else favoritesWriter(w, row.favs); });
+    std::printf("%-16s %8zu | %10.0f %8zu %9zu | %10.0f %8zu %9zu\n", row.name, ref.size(), sNs, sAllocs, sPeak, wNs, wAllocs, wPeak);
+  }
+
+  // Escaping, numbers and nesting
+  {
+    std::string out;
+    { Json::Writer<8> w(&sinkAppend, &out);
+      w.beginObject().key("s").str("a\"b\\c\n\x01").key("n").beginArray().num(-2147483647 - 1).num(4294967295u).num(-0.5f, 2).num(1.0f / 0.0f, 3).endArray()
+       .key("e").beginObject().endObject().key("b").boolean(true).endObject();
+      w.flush(); }
+    const char *want = "{\"s\":\"a\\\"b\\\\c\\n\\u0001\",\"n\":[-2147483648,4294967295,-0.50,null],\"e\":{},\"b\":true}";
+    if (out != want) { std::printf("writer: %s\n  want: %s\n", out.c_str(), want); bad++; }
+  }
+  if (bad) { std::printf("FAILED: %d\n", bad); return 1; }
+  return 0;
+}
@@ -0,0 +1,167 @@
+// Host benchmark for the request-body tokenizer (json_reader.h) against the indexOf/substring
+// scanning it replaced: CFG2 bodies and stored favorites from 2 to 200 parameters per role.
+// Counts heap allocations through operator new, checks that both paths find the same
+// {id, value} pairs and that malformed bodies are rejected, and exits non-zero otherwise.
+// The old path runs on a String stand-in with Arduino's heap behaviour (see below).
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../json_reader.h"
+
+using Clock = std::chrono::steady_clock;
+
+static size_t g_allocs = 0;
+void *operator new(size_t n) {
+  void *p = std::malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  g_allocs++;
+  return p;
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+static volatile float g_sink;
+
+// Arduino String as the old parser used it: the text lives in a heap block of its own
+// (WString as on AVR/ESP8266 and arduino-esp32 1.x, no inline small-string buffer), so every
+// substring() costs an allocation, counted by operator new above. std::string would keep
+// these few-character numbers inline and hide exactly that cost.
+class String {
+ public:
+  String() = default;
+  String(const char *s, unsigned int n) { copy(s, n); }
+  explicit String(const std::string &s) { copy(s.data(), (unsigned int)s.size()); }
+  String(const String &o) { copy(o.buf_, o.len_); }
+  String &operator=(const String &) = delete;
+  ~String() { delete[] buf_; }
+  unsigned int length() const { return len_; }
+  char operator[](unsigned int i) const { return i < len_ ? buf_[i] : 0; }
+  int indexOf(char c, unsigned int from = 0) const {
+    const char *p = from < len_ ? std::strchr(buf_ + from, c) : nullptr;
+    return p ? (int)(p - buf_) : -1;
+  }
+  int indexOf(const char *str, unsigned int from = 0) const {
+    const char *p = from < len_ ? std::strstr(buf_ + from, str) : nullptr;
+    return p ? (int)(p - buf_) : -1;
+  }
+  String substring(unsigned int left, unsigned int right) const {
+    if (right > len_) right = len_;
+    if (left > right) left = right;
+    return String(buf_ + left, right - left);
+  }
+  long toInt() const { return buf_ ? std::atol(buf_) : 0; }
+  float toFloat() const { return buf_ ? (float)std::atof(buf_) : 0.0f; }
+ private:
+  void copy(const char *s, unsigned int n) {
+    buf_ = new char[n + 1];
+    std::memcpy(buf_, s, n); buf_[n] = '\0'; len_ = n;
+  }
+  char *buf_{nullptr};
+  unsigned int len_{0};
+};
+
+// The previous parser: every "id" after `start`, then the next "value", one substring per number
+static int oldScan(const String &cfg, int start, int end, float *sum) {
+  int found = 0; int pos = start; int safety = 0;
+  while (safety < 1024) {
+    int idKey = cfg.indexOf("\"id\"", pos); if (idKey < 0 || idKey >= end) break;
+    int colon = cfg.indexOf(':', idKey); if (colon < 0) break;
+    int idStart = colon + 1; while (idStart < end && cfg[idStart] == ' ') idStart++;
+    int idEnd = idStart; while (idEnd < end && isdigit((unsigned char)cfg[idEnd])) idEnd++;
+    uint8_t pid = (uint8_t)cfg.substring(idStart, idEnd).toInt();
+    int vKey = cfg.indexOf("\"value\"", idEnd); if (vKey < 0 || vKey >= end) { pos = idEnd; safety++; continue; }
+    colon = cfg.indexOf(':', vKey); if (colon < 0) break;
+    int vStart = colon + 1; while (vStart < end && cfg[vStart] == ' ') vStart++;
+    int vEnd = vStart; while (vEnd < end && (isdigit((unsigned char)cfg[vEnd]) || cfg[vEnd] == '-' || cfg[vEnd] == '+' || cfg[vEnd] == '.')) vEnd++;
+    float v = cfg.substring(vStart, vEnd).toFloat();
+    *sum += v * (float)pid; found++;
+    pos = vEnd; safety++;
+  }
+  return found;
+}
+
+static int newScan(const Json::Doc<4096> &doc, int arr, float *sum) {
+  int found = 0;
+  doc.forEachParam(arr, [&](uint8_t id, float v) { *sum += v * (float)id; found++; });
+  return found;
+}
+
+static std::string paramArray(int count, int salt) {
+  std::string s = "[";
+  for (int k = 0; k < count; ++k) {
+    char b[64];
+    std::snprintf(b, sizeof(b), "%s{\"id\":%d,\"value\":%.4f}", k ? "," : "", 1 + k % 200, (float)((k * 37 + salt) % 1000) / 97.0f - 3.0f);
+    s += b;
+  }
+  return s + "]";
+}
+
+template<typename F>
+static double nsPerCall(uint32_t iters, F &&fn) {
+  auto t0 = Clock::now();
+  for (uint32_t i = 0; i < iters; ++i) fn();
+  return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / iters;
+}
+
+int main(int argc, char **argv) {
+  uint32_t iters = (argc > 1) ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 2000u;
+  int bad = 0;
+
+  std::printf("%-10s %7s %7s | %10s %8s | %10s %8s %7s\n", "body", "params", "bytes", "old ns", "allocs", "new ns", "allocs", "tokens");
+  const int counts[] = { 2, 19, 50, 200 };
+  for (int kind = 0; kind < 2; ++kind) {
+    for (int count : counts) {
+      // kind 0: CFG2 {role, animIndex, params, globals}; kind 1: a stored favorite, both roles
+      std::string body = kind == 0
+        ? "{\"role\":1,\"animIndex\":6,\"params\":" + paramArray(count, 1) + ",\"globals\":" + paramArray(3, 2) + "}"
+        : "{\"name\":\"Sunset {slow}, \\\"warm\\\"\",\"v\":1,\"globals\":{\"globalSpeed\":1.5},\"leader\":{\"animIndex\":3,\"params\":" + paramArray(count, 3) +
+          "},\"follower\":{\"animIndex\":6,\"params\":" + paramArray(count, 4) + "}}";
+      const int pairs = kind == 0 ? count + 3 : 2 * count;
+
+      float sOld = 0.0f, sNew = 0.0f;
+      const String arduinoBody(body); // server.arg("plain")
+      size_t a0 = g_allocs;
+      int nOld = oldScan(arduinoBody, 0, (int)arduinoBody.length(), &sOld);
+      size_t oldAllocs = g_allocs - a0;
+      a0 = g_allocs;
+      int nNew = 0;
+      { Json::Doc<4096> doc(body.data(), body.size());
+        if (kind == 0) { nNew += newScan(doc, doc.get(0, "params"), &sNew); nNew += newScan(doc, doc.get(0, "globals"), &sNew); }
+        else { nNew += newScan(doc, doc.get(doc.get(0, "leader"), "params"), &sNew); nNew += newScan(doc, doc.get(doc.get(0, "follower"), "params"), &sNew); }
+        size_t newAllocs = g_allocs - a0;
+        if (nOld != pairs || nNew != pairs || sOld != sNew || newAllocs) { std::printf("%s x%d: old %d new %d pairs (want %d), sums %f %f, %zu allocs\n", kind ? "favorite" : "cfg2", count, nOld, nNew, pairs, sOld, sNew, newAllocs); bad++; }
+
+        double oldNs = nsPerCall(iters, [&]() { float s = 0; oldScan(arduinoBody, 0, (int)arduinoBody.length(), &s); g_sink += s; });
+        double newNs = nsPerCall(iters, [&]() {
+          Json::Doc<4096> d(body.data(), body.size()); float s = 0;
+          if (kind == 0) { newScan(d, d.get(0, "params"), &s); newScan(d, d.get(0, "globals"), &s); }
+          else { newScan(d, d.get(d.get(0, "leader"), "params"), &s); newScan(d, d.get(d.get(0, "follower"), "params"), &s); }
+          g_sink += s; });
+        std::printf("%-10s %7d %7zu | %10.0f %8zu | %10.0f %8zu %7d\n", kind ? "favorite" : "cfg2", count, body.size(), oldNs, oldAllocs, newNs, newAllocs, doc.count);
+      }
+    }
+  }
+
+  // Typed binding, and what the tokenizer must refuse
+  {
+    const char *js = "{\"role\":0,\"params\":[{\"id\":1,\"value\":2.5},{\"value\":1,\"id\":4},{\"id\":3,\"value\":true},{\"id\":99,\"value\":1}]}";
+    Json::Doc<> doc(js, strlen(js));
+    Anim::ParamSet ps;
+    uint8_t set = doc.bindParams(doc.get(0, "params"), ps);
+    if (set != 3 || ps.speed != 2.5f || !ps.branch || ps.width != 1) { std::printf("bindParams: %u set, speed %f branch %d width %u\n", set, ps.speed, ps.branch, ps.width); bad++; }
+    const char *broken[] = { "{\"a\":1", "{\"a\":[1,2}", "{1:2}", "{\"a\" 1}", "[\"abc", "{\"a\":{\"b\":1}]", "{\"a\":x}" };
+    for (const char *b : broken) {
+      Json::Doc<> d(b, strlen(b));
+      if (d.ok()) { std::printf("accepted malformed body %s\n", b); bad++; }
+    }
+    Json::Token few[4];
+    if (Json::parse(js, strlen(js), few, 4) != Json::E_NOMEM) { std::printf("token overflow not reported\n"); bad++; }
+  }
+  if (bad) { std::printf("FAILED: %d\n", bad); return 1; }
+  return 0;
+}
@@ -0,0 +1,94 @@
+// Host benchmark for the Perlin noise kernels: the previous renderer (one octave), the
+// current one without state (8 hashes per LED, octave and frame) and with NoisePlanes kept
+// across frames, for the linear and branch layouts and 1..4 octaves. Exits non-zero if the
+// two paths differ bit for bit, or the single-octave output from the previous renderer.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "../animations.h"
+
+using Clock = std::chrono::steady_clock;
+
+static volatile float g_sink;
+static const uint64_t kFrameUs = 33333;
+
+// The previous Perlin case of applyAnim: one octave, full 3D value noise per LED
+static void perlinPrev(uint64_t tUs, uint16_t n, const Anim::ParamSet &ps, float *out){
+  float offset = 1.5f/3.0f*float(ps.width);
+  int octaves = 1; float lacu = 1.3f, gain = 0.75f;
+  uint64_t zq = TimeBase::cyclesQ32(tUs, ps.speed * 0.02f * ps.globalSpeed * 3.0f);
+  float zt = (float)((uint32_t)(zq >> 32) & (Anim::NOISE_Z_PERIOD - 1)) + (float)((uint32_t)zq >> 8) * (1.0f / 16777216.0f);
+  float ampSum = 0.5f * (1.0f - powf(gain, (float)octaves)) / (1.0f - gain);
+  float maxRidge = offset*offset * ampSum;
+  float invMax = (maxRidge>1e-6f)?(1.0f/maxRidge):1.0f;
+  for (uint16_t idx = 0; idx < n; idx++){
+    float x = (float)idx * ps.delta, y = 0.0f;
+    if (ps.branch){
+      if (idx >= Anim::TOTAL_LEDS) break;
+      uint8_t b = idx / Anim::LEDS_PER_BRANCH, i = idx % Anim::LEDS_PER_BRANCH;
+      float dist = ps.delta * i + ps.delta * 0.5f;
+      x = 0; switch (b){ case 0: x = dist; break; case 1: x = -dist; break; case 2: y = dist; break; case 3: y = -dist; break; }
+    }
+    float p = Anim::ridgeNoise(x*3.0f + 0.5f, y*3.0f + 0.5f, 0.0f*3.0f + zt, octaves, lacu, gain, offset);
+    p*=invMax; p=p*p; float v=0; if (p<=0.1f) v=0; else if (p>=1.0f) v=1.0f; else v=(p-0.1f)/(0.9f); v=v*v;
+    if (ps.calMax > ps.calMin){
+      if (v <= ps.calMin) v=0.0f; else if (v >= ps.calMax) v=1.0f; else v = (v - ps.calMin)/(ps.calMax - ps.calMin);
+    }
+    out[idx] = v;
+  }
+}
+
+template<typename F>
+static double nsPerFrame(uint32_t frames, F &&fn){
+  auto t0 = Clock::now();
+  for (uint32_t f = 0; f < frames; ++f) fn(f);
+  return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / frames;
+}
+
+int main(int argc, char **argv){
+  uint32_t frames = (argc > 1) ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 20000u;
+  const uint16_t n = Anim::TOTAL_LEDS;
+  const uint64_t t0 = 2ull * 86400ull * 1000000ull;
+  int bad = 0;
+
+  std::printf("%u LEDs, %u frames at 30 fps, speed 3 (z crosses a plane every %.1f s)\n", n, frames, 1.0f / (3.0f * 0.02f * 3.0f));
+  std::printf("%-7s %4s %10s %10s %10s %12s\n", "layout", "oct", "prev ns", "direct ns", "planes ns", "hashes/frame");
+  for (int branch = 0; branch < 2; ++branch){
+    for (uint8_t oct = 1; oct <= Anim::NOISE_MAX_OCTAVES; ++oct){
+      Anim::ParamSet ps;
+      ps.branch = branch != 0; ps.octaves = oct;
+      Anim::NoisePlanes planes;
+      float a[Anim::TOTAL_LEDS], b[Anim::TOTAL_LEDS], c[Anim::TOTAL_LEDS];
+      for (uint32_t f = 0; f < frames; ++f){
+        uint64_t t = t0 + f * kFrameUs;
+        Anim::perlin(t, n, ps, a);
+        Anim::perlin(t, n, ps, b, nullptr, &planes);
+        if (std::memcmp(a, b, sizeof(a)) != 0) { std::printf("%s, %u octaves: planes differ at frame %u\n", branch ? "branch" : "linear", oct, f); bad++; break; }
+        if (oct == 1){
+          perlinPrev(t, n, ps, c);
+          if (std::memcmp(a, c, sizeof(a)) != 0) { std::printf("%s: differs from the previous renderer at frame %u\n", branch ? "branch" : "linear", f); bad++; break; }
+        }
+      }
+      // A delta change must rebuild the planes
+      ps.delta = 1.25f;
+      Anim::perlin(t0, n, ps, a); Anim::perlin(t0, n, ps, b, nullptr, &planes);
+      if (std::memcmp(a, b, sizeof(a)) != 0) { std::printf("stale planes after a delta change\n"); bad++; }
+      ps.delta = 2.0f;
+
+      Anim::NoisePlanes warm;
+      Anim::perlin(t0, n, ps, b, nullptr, &warm);
+      uint32_t planes0 = warm.planes;
+      double prev = oct == 1 ? nsPerFrame(frames, [&](uint32_t f){ perlinPrev(t0 + f * kFrameUs, n, ps, c); g_sink += c[f % n]; }) : 0.0;
+      double direct = nsPerFrame(frames, [&](uint32_t f){ Anim::perlin(t0 + f * kFrameUs, n, ps, a); g_sink += a[f % n]; });
+      double kept = nsPerFrame(frames, [&](uint32_t f){ Anim::perlin(t0 + f * kFrameUs, n, ps, b, nullptr, &warm); g_sink += b[f % n]; });
+      char prevCol[16] = "-";
+      if (oct == 1) std::snprintf(prevCol, sizeof(prevCol), "%.0f", prev);
+      std::printf("%-7s %4u %10s %10.0f %10.0f %5u -> %4.1f\n", branch ? "branch" : "linear", oct, prevCol, direct, kept,
+                  8u * n * oct, 4.0 * (warm.planes - planes0) / frames);
+    }
+  }
+  if (bad) { std::printf("FAILED: %d\n", bad); return 1; }
+  return 0;
+}
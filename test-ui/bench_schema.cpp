@@ -0,0 +1,111 @@
+// Host microbenchmark for schema lookups: dense ID tables vs. the previous linear scans.
+// Also cross-checks that both paths resolve every id identically.
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../anim_schema.h"
+#include "../dyn_config.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Reference implementations (what anim_schema.h used to do)
+static const AnimSchema::ParamDef* linearFindParam(uint8_t id){
+  for(size_t i=0;i<sizeof(AnimSchema::PARAMS)/sizeof(AnimSchema::PARAMS[0]);++i){ AnimSchema::ParamDef tmp; memcpy_P(&tmp,&AnimSchema::PARAMS[i],sizeof(tmp)); if(tmp.id==id) return &AnimSchema::PARAMS[i]; }
+  return nullptr;
+}
+static bool switchSetParamField(Anim::ParamSet &ps, uint8_t id, float v){
+  using namespace AnimSchema;
+  switch(id){
+#define PARAM_SET_CASE(NAME, ID, TYPE, UI, CTYPE, FIELD, MIN, MAX, DEF, BITS) \
+    case AnimSchema::PID_##NAME: ps.FIELD = (CTYPE)((TYPE)==AnimSchema::PT_BOOL? (v!=0.0f): v); return true;
+    PARAM_LIST(PARAM_SET_CASE)
+#undef PARAM_SET_CASE
+    default: return false;
+  }
+}
+static float switchGetParamField(const Anim::ParamSet &ps, uint8_t id){
+  using namespace AnimSchema;
+  switch(id){
+#define PARAM_GET_CASE(NAME, ID, TYPE, UI, CTYPE, FIELD, MIN, MAX, DEF, BITS) \
+    case AnimSchema::PID_##NAME: return (TYPE)==AnimSchema::PT_BOOL ? (ps.FIELD?1.0f:0.0f) : (float)ps.FIELD;
+    PARAM_LIST(PARAM_GET_CASE)
+#undef PARAM_GET_CASE
+    default: return 0.0f;
+  }
+}
+
+// Best of 5 runs, so a busy host does not decide which path looks faster
+template<typename F>
+static double nsPerOp(uint32_t iters, F &&fn){
+  double best = 0;
+  for (int r = 0; r < 5; ++r){
+    auto t0 = Clock::now();
+    fn(iters);
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / (double)iters;
+    if (r == 0 || ns < best) best = ns;
+  }
+  return best;
+}
+
+static volatile uintptr_t g_sink;
+
+static int checkEquivalence(){
+  int bad = 0;
+  for (int id = 0; id < 256; ++id){
+    if (AnimSchema::findParam((uint8_t)id) != linearFindParam((uint8_t)id)) { std::printf("findParam mismatch id=%d\n", id); bad++; }
+    Anim::ParamSet a, b;
+    float v = 0.75f + (float)id;
+    bool ra = Anim::setParamField(a, (uint8_t)id, v), rb = switchSetParamField(b, (uint8_t)id, v);
+    if (ra != rb || Anim::getParamField(a, (uint8_t)id) != switchGetParamField(b, (uint8_t)id)) { std::printf("set/get mismatch id=%d\n", id); bad++; }
+    if (ra && memcmp(&a, &b, sizeof(a)) != 0) { std::printf("set id=%d touched another field\n", id); bad++; }
+  }
+  {
+    Anim::ParamSet a;
+    Anim::setParamField(a, AnimSchema::PID_PHASE, -0.0f);
+    Anim::setParamField(a, AnimSchema::PID_BRANCH, 0.5f);
+    if (!std::signbit(Anim::getParamField(a, AnimSchema::PID_PHASE)) || Anim::getParamField(a, AnimSchema::PID_BRANCH) != 1.0f) { std::printf("-0.0f phase or 0.5 branch not kept\n"); bad++; }
+  }
+  for (int idx = 0; idx < 256; ++idx){
+    const AnimSchema::AnimDef *ad = AnimSchema::findAnim((uint8_t)idx);
+    if ((ad != nullptr) != (idx < AnimSchema::ANIM_COUNT) || (ad && ad->index != idx)) { std::printf("findAnim mismatch idx=%d\n", idx); bad++; }
+  }
+  return bad;
+}
+
+int main(int argc, char **argv){
+  uint32_t iters = (argc > 1) ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 2000000u;
+  if (int bad = checkEquivalence()) { std::printf("FAILED: %d mismatches\n", bad); return 1; }
+
+  double lin = nsPerOp(iters, [](uint32_t n){ for (uint32_t i=0;i<n;i++) g_sink += (uintptr_t)linearFindParam(AnimSchema::PARAM_IDS[i % AnimSchema::PARAM_COUNT]); });
+  double tab = nsPerOp(iters, [](uint32_t n){ for (uint32_t i=0;i<n;i++) g_sink += (uintptr_t)AnimSchema::findParam(AnimSchema::PARAM_IDS[i % AnimSchema::PARAM_COUNT]); });
+  std::printf("findParam        linear %7.2f ns   table %7.2f ns\n", lin, tab);
+
+  Anim::ParamSet ps;
+  double swSet = nsPerOp(iters, [&](uint32_t n){ for (uint32_t i=0;i<n;i++) switchSetParamField(ps, AnimSchema::PARAM_IDS[i % AnimSchema::PARAM_COUNT], (float)(i & 7)); });
+  double tbSet = nsPerOp(iters, [&](uint32_t n){ for (uint32_t i=0;i<n;i++) Anim::setParamField(ps, AnimSchema::PARAM_IDS[i % AnimSchema::PARAM_COUNT], (float)(i & 7)); });
+  std::printf("setParamField    switch %7.2f ns   table %7.2f ns\n", swSet, tbSet);
+  float acc = 0.0f;
+  double swGet = nsPerOp(iters, [&](uint32_t n){ for (uint32_t i=0;i<n;i++) acc += switchGetParamField(ps, AnimSchema::PARAM_IDS[i % AnimSchema::PARAM_COUNT]); });
+  double tbGet = nsPerOp(iters, [&](uint32_t n){ for (uint32_t i=0;i<n;i++) acc += Anim::getParamField(ps, AnimSchema::PARAM_IDS[i % AnimSchema::PARAM_COUNT]); });
+  std::printf("getParamField    switch %7.2f ns   table %7.2f ns\n", swGet, tbGet);
+  g_sink += (uintptr_t)acc;
+
+  // Full CFG2 round trip with every schema param (what sendAllParams puts on air)
+  DynCfg::ParamValue pv[AnimSchema::PARAM_COUNT];
+  for (uint8_t i=0;i<AnimSchema::PARAM_COUNT;i++) pv[i] = { AnimSchema::PARAM_IDS[i], Anim::getParamField(ps, AnimSchema::PARAM_IDS[i]) };
+  uint32_t cfgIters = iters / 16 + 1, cfgBad = 0;
+  double rt = nsPerOp(cfgIters, [&](uint32_t n){
+    uint8_t buf[64]; DynCfg::ParamValue outP[AnimSchema::PARAM_COUNT]; DynCfg::ParamValue outG[8];
+    for (uint32_t i=0;i<n;i++){
+      uint8_t len = DynCfg::encodeCfg2(1, 1, pv, AnimSchema::PARAM_COUNT, nullptr, 0, buf, sizeof(buf));
+      uint8_t role = 0, anim = 0, pc = 0, gc = 0;
+      if (!DynCfg::decodeCfg2(buf, len, role, anim, outP, pc, outG, gc) || role != 1 || anim != 1 || pc != AnimSchema::PARAM_COUNT || gc != 0) cfgBad++;
+      g_sink += pc;
+    }
+  });
+  std::printf("encode+decodeCfg2 (%u params) %7.2f ns\n", (unsigned)AnimSchema::PARAM_COUNT, rt);
+  if (cfgBad) { std::printf("FAILED: %u CFG2 round trips did not decode\n", cfgBad); return 1; }
+  return 0;
+}
@@ -0,0 +1,117 @@
+// Host benchmark for Anim::sparkle at 28, 1k and 10k LEDs: the sparse engine (O(sparks) per
+// frame, full clear or dirty-list clear) against the per-LED engine it replaced, which drew
+// one random number per LED and slot. Exits non-zero if the dirty-list output differs from
+// the full clear, the average lit count misses the sparkMin/sparkMax target, a frame lights
+// more than sparkMax LEDs, (1000+ LEDs, where sparks rarely share one) over 1% of frames light
+// fewer than sparkMin, or with a render mask a spark lands on an unconnected LED or the
+// SparkDirty path (mapped-LED list, dropped when another animation wrote the buffer) differs.
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../animations.h"
+
+using Clock = std::chrono::steady_clock;
+
+static volatile float g_sink;
+static const uint64_t kFrameUs = 33333;
+
+// The previous engine: every LED tests for a spark in each live slot
+static void sparklePerLed(uint64_t tUs, uint16_t n, float speed, const Anim::ParamSet &ps, float *out, uint32_t seed){
+  const float slotLen = 3.0f, baseRise = 2.5f, baseDecay = 1.3f, meanLife = 3.35f;
+  uint64_t pos = TimeBase::cyclesQ32(tUs, speed / slotLen);
+  uint32_t slot = (uint32_t)(pos >> 32);
+  float inSlot = (float)((uint32_t)pos >> 8) * (1.0f / 16777216.0f) * slotLen;
+  float pBase = (0.5f * (ps.minSparkles + ps.maxSparkles) / (float)n) * (slotLen / meanLife);
+  for (uint16_t i = 0; i < n; ++i) out[i] = 0.0f;
+  for (uint8_t back = 0; back <= 2 && back <= slot; ++back){
+    uint32_t s = slot - back;
+    float age0 = inSlot + back * slotLen;
+    float p = pBase * (0.7f + 0.6f * Anim::crngf(seed, s, 0xFFFFu, 0));
+    for (uint16_t i = 0; i < n; ++i){
+      if (Anim::crngf(seed, s, i, 1) >= p) continue;
+      float age = age0 - Anim::crngf(seed, s, i, 2) * slotLen;
+      if (age < 0.0f) continue;
+      float rise = baseRise * (0.6f + Anim::crngf(seed, s, i, 3) * 0.8f);
+      float decay = baseDecay * (0.6f + Anim::crngf(seed, s, i, 4) * 0.8f);
+      float b0 = 0.05f + Anim::crngf(seed, s, i, 5) * 0.20f;
+      float peakAt = (1.0f - b0) / rise;
+      float v = (age < peakAt) ? b0 + rise * age : expf(-decay * (age - peakAt));
+      if (v >= 0.02f && v > out[i]) out[i] = v;
+    }
+  }
+}
+
+template<typename F>
+static double nsPerFrame(uint32_t frames, F &&fn){
+  auto t0 = Clock::now();
+  for (uint32_t f = 0; f < frames; ++f) fn(f);
+  return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / frames;
+}
+
+int main(int argc, char **argv){
+  uint32_t frames = (argc > 1) ? (uint32_t)std::strtoul(argv[1], nullptr, 10) : 20000u;
+  const uint16_t sizes[] = { 28, 1000, 10000 };
+  const uint64_t t0 = 86400ull * 1000000ull;
+  int bad = 0;
+
+  Anim::ParamSet ps;
+  ps.randomMode = true;
+  const float target = 0.5f * (ps.minSparkles + ps.maxSparkles);
+  std::printf("%u frames at 30 fps, speed 1, %u-%u sparks\n", frames, ps.minSparkles, ps.maxSparkles);
+  std::printf("%6s %10s %12s %12s %12s\n", "LEDs", "avg lit", "per-LED ns", "sparse ns", "+dirty ns");
+  for (uint16_t n : sizes){
+    std::vector<float> a(n), b(n);
+    Anim::SparkDirty dirty;
+    double lit = 0;
+    uint32_t over = 0, under = 0;
+    for (uint32_t f = 0; f < frames; ++f){
+      uint64_t t = t0 + f * kFrameUs;
+      Anim::sparkle(t, n, 1.0f, true, ps, a.data());
+      Anim::sparkle(t, n, 1.0f, true, ps, b.data(), 0, nullptr, &dirty);
+      if (std::memcmp(a.data(), b.data(), n * sizeof(float)) != 0) { std::printf("n=%u: dirty-list frame %u differs\n", n, f); bad++; break; }
+      uint16_t k = 0;
+      for (uint16_t i = 0; i < n; ++i) k += a[i] > 0.0f;
+      lit += k;
+      over += k > ps.maxSparkles;
+      under += k < ps.minSparkles;
+    }
+    lit /= frames;
+    // Same-LED overlaps only matter on 28 LEDs
+    if (std::fabs(lit - target) > 0.15f * target) { std::printf("n=%u: %.2f lit, target %.1f\n", n, lit, target); bad++; }
+    // Sparks are bounded; lit LEDs can only fall below sparkMin when two sparks share an LED
+    if (over) { std::printf("n=%u: %u frames above sparkMax\n", n, over); bad++; }
+    if (n >= 1000 && under > frames / 100) { std::printf("n=%u: %u frames below sparkMin\n", n, under); bad++; }
+
+    double perLed = nsPerFrame(frames, [&](uint32_t f){ sparklePerLed(t0 + f * kFrameUs, n, 1.0f, ps, a.data(), 0); g_sink += a[f % n]; });
+    double sparse = nsPerFrame(frames, [&](uint32_t f){ Anim::sparkle(t0 + f * kFrameUs, n, 1.0f, true, ps, a.data()); g_sink += a[f % n]; });
+    double withDirty = nsPerFrame(frames, [&](uint32_t f){ Anim::sparkle(t0 + f * kFrameUs, n, 1.0f, true, ps, b.data(), 0, nullptr, &dirty); g_sink += b[f % n]; });
+    std::printf("%6u %10.2f %12.0f %12.0f %12.0f\n", n, lit, perLed, sparse, withDirty);
+  }
+  // A render mask (every third LED unconnected): sparks land on rendered LEDs only, the same ones
+  // whether drawn from the SparkDirty list or the mask bits, and another animation writing the
+  // buffer in between drops the lit list
+  {
+    const uint16_t n = Anim::TOTAL_LEDS;
+    uint8_t mask[(Anim::TOTAL_LEDS + 7) / 8] = {};
+    for (uint16_t i = 0; i < n; ++i) if (i % 3) mask[i >> 3] |= (uint8_t)(1u << (i & 7));
+    float a[Anim::TOTAL_LEDS], b[Anim::TOTAL_LEDS];
+    Anim::SparkDirty dirty;
+    uint32_t offMask = 0, differ = 0;
+    for (uint32_t f = 0; f < frames; ++f){
+      uint64_t t = t0 + f * kFrameUs;
+      if (f % 97 == 0) Anim::applyAnim(1, t, n, ps, b, 0, mask, nullptr, &dirty); // Wave
+      Anim::applyAnim(5, t, n, ps, a, 0, mask);
+      Anim::applyAnim(5, t, n, ps, b, 0, mask, nullptr, &dirty);
+      differ += std::memcmp(a, b, sizeof(a)) != 0;
+      for (uint16_t i = 0; i < n; ++i) offMask += a[i] > 0.0f && !Anim::rendered(mask, i);
+    }
+    if (differ) { std::printf("masked: %u frames differ with a SparkDirty\n", differ); bad++; }
+    if (offMask) { std::printf("masked: %u sparks on unconnected LEDs\n", offMask); bad++; }
+  }
+  if (bad) { std::printf("FAILED: %d\n", bad); return 1; }
+  return 0;
+}
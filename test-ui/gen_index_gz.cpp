@@ -0,0 +1,99 @@
+// Build step for the firmware's index page: assembles INDEX_HTML_PREFIX + ANIM_SCHEMA_JSON +
+// INDEX_HTML_SUFFIX exactly as served, gzips it and writes web_ui_gz.h (PROGMEM bytes, page
+// length and a content-hash ETag). The test-ui build reruns it whenever web_ui.h or
+// anim_schema.h change; the header is committed so Arduino builds need no host tools. Checks
+// that the output inflates back to the page; the bytes only change when the page does.
+//   gen_index_gz <out.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <zlib.h>
+
+#include "../web_ui.h"
+
+static std::string page() {
+  std::string html;
+  html += INDEX_HTML_PREFIX;
+  html += ANIM_SCHEMA_JSON;
+  html += INDEX_HTML_SUFFIX;
+  return html;
+}
+
+// Deterministic gzip: level 9, no name, mtime 0, OS "unknown" so every host emits the same bytes
+static bool gzip(const std::string &in, std::string &out) {
+  z_stream zs{};
+  if (deflateInit2(&zs, 9, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) return false;
+  gz_header h{};
+  h.os = 255;
+  deflateSetHeader(&zs, &h);
+  out.resize(deflateBound(&zs, in.size()));
+  zs.next_in = (Bytef *)in.data(); zs.avail_in = (uInt)in.size();
+  zs.next_out = (Bytef *)&out[0]; zs.avail_out = (uInt)out.size();
+  int rc = deflate(&zs, Z_FINISH);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+  return rc == Z_STREAM_END;
+}
+
+static bool gunzip(const std::string &in, std::string &out) {
+  z_stream zs{};
+  if (inflateInit2(&zs, 15 + 16) != Z_OK) return false;
+  zs.next_in = (Bytef *)in.data(); zs.avail_in = (uInt)in.size();
+  char buf[4096]; int rc;
+  do {
+    zs.next_out = (Bytef *)buf; zs.avail_out = sizeof(buf);
+    rc = inflate(&zs, Z_NO_FLUSH);
+    out.append(buf, sizeof(buf) - zs.avail_out);
+  } while (rc == Z_OK);
+  inflateEnd(&zs);
+  return rc == Z_STREAM_END;
+}
+
+static uint64_t fnv1a64(const std::string &s) {
+  uint64_t h = 0xcbf29ce484222325ull;
+  for (unsigned char c : s) { h ^= c; h *= 0x100000001b3ull; }
+  return h;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 2) { std::fprintf(stderr, "usage: %s <out.h>\n", argv[0]); return 2; }
+  const std::string html = page();
+  std::string gz, back;
+  if (!gzip(html, gz) || !gunzip(gz, back) || back != html) { std::fprintf(stderr, "gen_index_gz: gzip round trip failed\n"); return 1; }
+
+  char etag[24];
+  std::snprintf(etag, sizeof(etag), "%016llx", (unsigned long long)fnv1a64(html));
+  std::ostringstream h;
+  h << "// Generated by test-ui/gen_index_gz from web_ui.h and anim_schema.h; do not edit.\n"
+       "// The index page gzipped for serving with Content-Encoding: gzip, and an ETag over the\n"
+       "// uncompressed page. Rebuild test-ui (or its index_gz target) after changing either input.\n"
+       "#pragma once\n"
+       "#include <stdint.h>\n"
+       "#include <stddef.h>\n"
+       "#ifndef PROGMEM\n"
+       "#define PROGMEM\n"
+       "#endif\n\n"
+    << "#define INDEX_HTML_ETAG \"\\\"" << etag << "\\\"\"\n"
+    << "static const size_t INDEX_HTML_LEN = " << html.size() << "; // uncompressed\n"
+    << "static const uint8_t INDEX_HTML_GZ[] PROGMEM = {\n";
+  for (size_t i = 0; i < gz.size(); ++i) {
+    char b[8];
+    std::snprintf(b, sizeof(b), "0x%02x,", (unsigned char)gz[i]);
+    h << (i % 16 ? "" : "  ") << b << (i % 16 == 15 || i + 1 == gz.size() ? "\n" : "");
+  }
+  h << "};\n"
+    << "static const size_t INDEX_HTML_GZ_LEN = sizeof(INDEX_HTML_GZ);\n";
+
+  std::ifstream cur(argv[1], std::ios::binary);
+  std::stringstream old; old << cur.rdbuf();
+  bool changed = old.str() != h.str();
+  cur.close();
+  std::ofstream out(argv[1], std::ios::binary | std::ios::trunc);
+  out << h.str();
+  if (!out) { std::fprintf(stderr, "gen_index_gz: cannot write %s\n", argv[1]); return 1; }
+  if (changed) std::printf("gen_index_gz: %zu B page -> %zu B gzip, ETag %s\n", html.size(), gz.size(), etag);
+  return 0;
+}
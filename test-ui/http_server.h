@@ -0,0 +1,406 @@
+#pragma once
+// Event-driven HTTP/1.1 server for the desktop harness. One epoll thread owns the sockets
+// (accept, non-blocking reads, incremental parsing, ordered writes) and a pool of workers
+// runs the handler. Connections are kept alive by default on HTTP/1.1, and pipelined requests
+// are answered in order with one in flight per connection, so a pipelined POST never overtakes
+// the request before it. A Latency model holds each response back like the ESP32's WebServer
+// would: a fixed cost per request, a cost per response byte and random jitter. With one
+// worker, requests are also served strictly one after another, as on the device.
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <strings.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace Http {
+
+struct Request {
+  std::string method, path, query, version, body;
+  std::vector<std::pair<std::string, std::string>> headers;
+  bool keepAlive = true;
+
+  // Header value by case-insensitive name, "" if absent
+  std::string header(const char *name) const {
+    for (const auto &h : headers) if (!strcasecmp(h.first.c_str(), name)) return h.second;
+    return "";
+  }
+};
+
+struct Response {
+  int code = 200;
+  std::string type = "text/plain", body;
+  std::string headers; // extra header lines, each ending in \r\n
+};
+
+inline Response reply(int code, const std::string &type, std::string body, std::string headers = "") {
+  Response r;
+  r.code = code; r.type = type; r.body = std::move(body); r.headers = std::move(headers);
+  return r;
+}
+
+inline const char *reason(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 413: return "Payload Too Large";
+    case 501: return "Not Implemented";
+    case 503: return "Service Unavailable";
+    default:  return code < 400 ? "OK" : "Error";
+  }
+}
+
+inline std::string serialize(const Response &r, bool keepAlive) {
+  char line[96];
+  std::string out;
+  out.reserve(128 + r.headers.size() + r.body.size());
+  std::snprintf(line, sizeof(line), "HTTP/1.1 %d %s\r\n", r.code, reason(r.code));
+  out += line;
+  out += "Content-Type: "; out += r.type; out += "\r\n";
+  out += r.headers;
+  if (r.code != 304) { std::snprintf(line, sizeof(line), "Content-Length: %zu\r\n", r.body.size()); out += line; }
+  out += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+  if (r.code != 304) out += r.body;
+  return out;
+}
+
+enum ParseResult { NEED_MORE, PARSED, BAD, TOO_LARGE, UNSUPPORTED };
+static const size_t MAX_HEAD = 8192, MAX_BODY = 1 << 20;
+
+// One request from the front of buf; on PARSED `used` bytes belong to it and the rest is the
+// next (pipelined) request
+inline ParseResult parse(const char *buf, size_t len, Request &req, size_t &used) {
+  const char *end = nullptr;
+  for (size_t i = 3; i < len && i < MAX_HEAD; ++i)
+    if (buf[i] == '\n' && buf[i - 1] == '\r' && buf[i - 2] == '\n' && buf[i - 3] == '\r') { end = buf + i + 1; break; }
+  if (!end) return len >= MAX_HEAD ? TOO_LARGE : NEED_MORE;
+  req = Request();
+  // Request line: METHOD SP target SP HTTP/1.x
+  const char *p = buf, *eol = (const char *)memchr(p, '\r', end - p);
+  const char *sp1 = (const char *)memchr(p, ' ', eol - p);
+  const char *sp2 = sp1 ? (const char *)memchr(sp1 + 1, ' ', eol - sp1 - 1) : nullptr;
+  if (!sp1 || !sp2 || sp1 == p || sp2 == sp1 + 1 || eol - sp2 - 1 != 8 || strncmp(sp2 + 1, "HTTP/1.", 7)) return BAD;
+  req.method.assign(p, sp1);
+  std::string target(sp1 + 1, sp2);
+  size_t q = target.find('?');
+  req.path = target.substr(0, q);
+  if (q != std::string::npos) req.query = target.substr(q + 1);
+  req.version.assign(sp2 + 1, eol);
+  // Headers
+  size_t clen = 0;
+  bool haveLen = false;
+  for (p = eol + 2; p < end - 2; p = eol + 2) {
+    eol = (const char *)memchr(p, '\r', end - p);
+    const char *colon = (const char *)memchr(p, ':', eol - p);
+    if (!colon || colon == p) return BAD;
+    const char *v = colon + 1, *ve = eol;
+    while (v < ve && (*v == ' ' || *v == '\t')) v++;
+    while (ve > v && (ve[-1] == ' ' || ve[-1] == '\t')) ve--;
+    req.headers.emplace_back(std::string(p, colon), std::string(v, ve));
+    const std::string &name = req.headers.back().first, &value = req.headers.back().second;
+    if (!strcasecmp(name.c_str(), "Content-Length")) {
+      if (value.empty() || value.size() > 9 || value.find_first_not_of("0123456789") != std::string::npos) return BAD;
+      size_t n = (size_t)std::stoul(value);
+      if (haveLen && n != clen) return BAD;
+      clen = n; haveLen = true;
+    } else if (!strcasecmp(name.c_str(), "Transfer-Encoding")) {
+      return UNSUPPORTED; // nothing in the UI sends chunked bodies
+    }
+  }
+  if (clen > MAX_BODY) return TOO_LARGE;
+  size_t head = (size_t)(end - buf);
+  if (len - head < clen) return NEED_MORE;
+  req.body.assign(end, clen);
+  used = head + clen;
+  // HTTP/1.1 keeps the connection unless told to close, 1.0 only when asked to keep it
+  std::string conn = req.header("Connection");
+  for (char &c : conn) c = (char)tolower((unsigned char)c);
+  req.keepAlive = req.version == "HTTP/1.1" ? conn.find("close") == std::string::npos : conn.find("keep-alive") != std::string::npos;
+  return PARSED;
+}
+
+// Delay before a response leaves, modelled on the ESP32 WebServer over WiFi
+struct Latency {
+  uint32_t baseMs = 0;     // per request
+  uint32_t jitterMs = 0;   // uniform 0..jitterMs on top
+  uint32_t bytesPerMs = 0; // response transfer rate, 0 = free
+  uint32_t delayMs(size_t bytes, std::mt19937 &rng) const {
+    uint32_t d = baseMs + (bytesPerMs ? (uint32_t)(bytes / bytesPerMs) : 0);
+    if (jitterMs) d += std::uniform_int_distribution<uint32_t>(0, jitterMs)(rng);
+    return d;
+  }
+  // About what a phone sees from the leader: ~20 ms a request, ~250 kB/s, bursty
+  static Latency esp32() { Latency l; l.baseMs = 20; l.jitterMs = 15; l.bytesPerMs = 250; return l; }
+};
+
+class Server {
+public:
+  using Handler = std::function<Response(const Request &)>;
+  struct Options {
+    int port = 8080;         // 0 = any free port, see port()
+    unsigned workers = 4;    // handler threads; 1 serves requests one at a time like the device
+    Latency latency;
+    size_t maxConnections = 256;
+    uint32_t idleMs = 30000; // keep-alive connections idle this long are closed
+  };
+  struct Stats {
+    std::atomic<uint64_t> accepted{0}, refused{0}, requests{0}, reused{0}, badRequests{0}, closed{0};
+  };
+  Stats stats;
+
+  Server(const Options &o, Handler h) : opt_(o), handler_(std::move(h)) {}
+  ~Server() { stop(); }
+
+  // Binds and starts the loop and workers; false if the port cannot be bound
+  bool start() {
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd_ < 0) { perror("socket"); return false; }
+    int one = 1;
+    setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET; addr.sin_addr.s_addr = htonl(INADDR_ANY); addr.sin_port = htons((uint16_t)opt_.port);
+    if (bind(listenFd_, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(listenFd_, 128) < 0) { perror("bind"); ::close(listenFd_); listenFd_ = -1; return false; }
+    socklen_t alen = sizeof(addr);
+    getsockname(listenFd_, (sockaddr *)&addr, &alen);
+    port_ = ntohs(addr.sin_port);
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    watch(listenFd_, LISTEN_ID, EPOLLIN, EPOLL_CTL_ADD);
+    watch(wakeFd_, WAKE_ID, EPOLLIN, EPOLL_CTL_ADD);
+    running_ = true;
+    for (unsigned i = 0; i < std::max(1u, opt_.workers); ++i) workers_.emplace_back([this, i] { work(i); });
+    loop_ = std::thread([this] { run(); });
+    return true;
+  }
+  void stop() {
+    if (!running_.exchange(false)) return;
+    jobCv_.notify_all();
+    wake();
+    if (loop_.joinable()) loop_.join();
+    for (std::thread &t : workers_) t.join();
+    workers_.clear();
+    for (auto &c : conns_) ::close(c.second.fd);
+    conns_.clear();
+    ::close(listenFd_); ::close(wakeFd_); ::close(epollFd_);
+  }
+  int port() const { return port_; }
+
+private:
+  static const uint64_t LISTEN_ID = 0, WAKE_ID = 1;
+
+  struct Conn {
+    int fd = -1;
+    std::string in, out;
+    bool busy = false;    // a request is with a worker
+    bool closing = false; // close once out is sent
+    bool eof = false;     // peer finished sending
+    bool served = false;  // answered a request before (for stats.reused)
+    bool wantOut = false;
+    std::chrono::steady_clock::time_point last;
+  };
+  struct Job { uint64_t conn; Request req; };
+  struct Done { uint64_t conn; std::string bytes; bool keepAlive; };
+
+  void watch(int fd, uint64_t id, uint32_t events, int op) {
+    epoll_event ev{};
+    ev.events = events; ev.data.u64 = id;
+    epoll_ctl(epollFd_, op, fd, &ev);
+  }
+  void wake() { uint64_t one = 1; if (write(wakeFd_, &one, sizeof(one)) < 0) {} }
+
+  void run() {
+    epoll_event evs[64];
+    while (running_) {
+      int n = epoll_wait(epollFd_, evs, 64, 1000);
+      if (n < 0 && errno != EINTR) { perror("epoll_wait"); break; }
+      for (int i = 0; i < n; ++i) {
+        uint64_t id = evs[i].data.u64;
+        if (id == LISTEN_ID) accept();
+        else if (id == WAKE_ID) completions();
+        else {
+          auto it = conns_.find(id);
+          if (it == conns_.end()) continue;
+          if (evs[i].events & (EPOLLHUP | EPOLLERR)) { drop(id, it->second); continue; } // gone both ways
+          if (evs[i].events & EPOLLIN) readable(id, it->second);
+          it = conns_.find(id);
+          if (it != conns_.end() && (evs[i].events & EPOLLOUT)) flush(id, it->second);
+        }
+      }
+      sweep();
+    }
+  }
+
+  void accept() {
+    for (;;) {
+      int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (fd < 0) return;
+      if (conns_.size() >= opt_.maxConnections) { stats.refused++; ::close(fd); continue; }
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      uint64_t id = nextId_++;
+      Conn &c = conns_[id];
+      c.fd = fd; c.last = std::chrono::steady_clock::now();
+      watch(fd, id, EPOLLIN | EPOLLRDHUP, EPOLL_CTL_ADD);
+      stats.accepted++;
+    }
+  }
+
+  void readable(uint64_t id, Conn &c) {
+    char buf[16384];
+    for (;;) {
+      ssize_t n = recv(c.fd, buf, sizeof(buf), 0);
+      if (n > 0) { c.in.append(buf, (size_t)n); continue; }
+      if (n == 0) c.eof = true;
+      else if (errno != EAGAIN && errno != EWOULDBLOCK) { drop(id, c); return; }
+      break;
+    }
+    c.last = std::chrono::steady_clock::now();
+    if (c.eof) watch(c.fd, id, c.wantOut ? (uint32_t)EPOLLOUT : 0, EPOLL_CTL_MOD); // nothing more to read
+    pump(id, c);
+  }
+
+  // Next request to a worker, unless one is out already or the connection is closing
+  void pump(uint64_t id, Conn &c) {
+    if (!c.busy && !c.closing && !c.in.empty()) {
+      Request req;
+      size_t used = 0;
+      ParseResult pr = parse(c.in.data(), c.in.size(), req, used);
+      if (pr == PARSED) {
+        c.in.erase(0, used);
+        c.busy = true;
+        stats.requests++;
+        if (c.served) stats.reused++;
+        c.served = true;
+        {
+          std::lock_guard<std::mutex> lock(jobMu_);
+          jobs_.push_back(Job{ id, std::move(req) });
+        }
+        jobCv_.notify_one();
+        return;
+      }
+      if (pr != NEED_MORE) {
+        int code = pr == TOO_LARGE ? 413 : pr == UNSUPPORTED ? 501 : 400;
+        stats.badRequests++;
+        c.out += serialize(reply(code, "text/plain", reason(code)), false);
+        c.closing = true;
+        c.in.clear();
+      }
+    }
+    if (c.eof && !c.busy) c.closing = true; // half-closed: answer what arrived, then close
+    flush(id, c);
+  }
+
+  void flush(uint64_t id, Conn &c) {
+    while (!c.out.empty()) {
+      ssize_t n = send(c.fd, c.out.data(), c.out.size(), MSG_NOSIGNAL);
+      if (n > 0) { c.out.erase(0, (size_t)n); continue; }
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+      drop(id, c);
+      return;
+    }
+    if (c.out.empty() && c.closing && !c.busy) { drop(id, c); return; }
+    bool want = !c.out.empty();
+    if (want != c.wantOut) {
+      c.wantOut = want;
+      watch(c.fd, id, (c.eof ? 0 : (uint32_t)(EPOLLIN | EPOLLRDHUP)) | (want ? (uint32_t)EPOLLOUT : 0), EPOLL_CTL_MOD);
+    }
+  }
+
+  void drop(uint64_t id, Conn &c) {
+    ::close(c.fd);
+    stats.closed++;
+    conns_.erase(id); // a response still with a worker is discarded when it comes back
+  }
+
+  void completions() {
+    uint64_t v;
+    if (read(wakeFd_, &v, sizeof(v)) < 0) {}
+    std::vector<Done> done;
+    {
+      std::lock_guard<std::mutex> lock(doneMu_);
+      done.swap(done_);
+    }
+    for (Done &d : done) {
+      auto it = conns_.find(d.conn);
+      if (it == conns_.end()) continue;
+      Conn &c = it->second;
+      c.busy = false;
+      c.out += d.bytes;
+      if (!d.keepAlive) c.closing = true;
+      c.last = std::chrono::steady_clock::now();
+      pump(d.conn, c); // sends this one, queues the next pipelined request
+    }
+  }
+
+  void sweep() {
+    auto now = std::chrono::steady_clock::now();
+    std::vector<uint64_t> idle;
+    for (auto &kv : conns_)
+      if (!kv.second.busy && kv.second.out.empty() && now - kv.second.last > std::chrono::milliseconds(opt_.idleMs)) idle.push_back(kv.first);
+    for (uint64_t id : idle) drop(id, conns_[id]);
+  }
+
+  void work(unsigned index) {
+    std::mt19937 rng(0x9E3779B9u * (index + 1));
+    for (;;) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock(jobMu_);
+        jobCv_.wait(lock, [this] { return !jobs_.empty() || !running_; });
+        if (!running_) return;
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      auto t0 = std::chrono::steady_clock::now();
+      Response r = handler_(job.req);
+      bool keep = job.req.keepAlive;
+      std::string bytes = serialize(r, keep);
+      // The model's delay counts from when the worker took the request, handler time included
+      auto due = t0 + std::chrono::milliseconds(opt_.latency.delayMs(bytes.size(), rng));
+      std::this_thread::sleep_until(due);
+      {
+        std::lock_guard<std::mutex> lock(doneMu_);
+        done_.push_back(Done{ job.conn, std::move(bytes), keep });
+      }
+      wake();
+    }
+  }
+
+  Options opt_;
+  Handler handler_;
+  int listenFd_ = -1, epollFd_ = -1, wakeFd_ = -1, port_ = 0;
+  std::atomic<bool> running_{false};
+  std::thread loop_;
+  std::vector<std::thread> workers_;
+  std::unordered_map<uint64_t, Conn> conns_; // loop thread only
+  uint64_t nextId_ = 2;
+  std::mutex jobMu_, doneMu_;
+  std::condition_variable jobCv_;
+  std::deque<Job> jobs_;
+  std::vector<Done> done_;
+};
+
+} // namespace Http
@@ -0,0 +1,170 @@
+// Host recorder for the LED frame stream (led_stream.h). Connects to the push socket of a
+// leader or the test-ui server, subscribes at the requested rate and writes the frames as
+// they arrive (u16 LE length + frame each); --play prints a recording as brightness rows like
+// the Serial dump, with per-role frame counts and rate.
+//   led_record [--host 192.168.4.1] [--port 81] [--fps 15] [--roles 3] [--seconds 10] [--out leds.bin]
+//   led_record --play leds.bin
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../ws_push.h"
+#include "../led_stream.h"
+
+using Clock = std::chrono::steady_clock;
+
+static int dial(const char *host, int port) {
+  addrinfo hints{}, *res = nullptr;
+  hints.ai_family = AF_INET; hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(host, std::to_string(port).c_str(), &hints, &res) != 0 || !res) return -1;
+  int fd = socket(res->ai_family, res->ai_socktype, 0);
+  if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) { close(fd); fd = -1; }
+  freeaddrinfo(res);
+  return fd;
+}
+
+static bool sendAll(int fd, const void *data, size_t n) {
+  const char *p = (const char *)data;
+  while (n) { ssize_t r = send(fd, p, n, MSG_NOSIGNAL); if (r <= 0) return false; p += r; n -= (size_t)r; }
+  return true;
+}
+static bool recvAll(int fd, void *data, size_t n) {
+  char *p = (char *)data;
+  while (n) { ssize_t r = recv(fd, p, n, 0); if (r <= 0) return false; p += r; n -= (size_t)r; }
+  return true;
+}
+
+// Client frames are masked (RFC 6455 5.3)
+static bool sendMasked(int fd, uint8_t op, const std::string &payload, std::mt19937 &rng) {
+  uint8_t hdr[14];
+  size_t h = Ws::frameHeader(op, payload.size(), hdr);
+  hdr[1] |= 0x80;
+  uint32_t key = rng();
+  memcpy(hdr + h, &key, 4);
+  std::string out((const char *)hdr, h + 4);
+  for (size_t i = 0; i < payload.size(); ++i) out += (char)(payload[i] ^ hdr[h + (i & 3)]);
+  return sendAll(fd, out.data(), out.size());
+}
+
+// One server frame (unmasked); false when the socket closes
+static bool readFrame(int fd, uint8_t &op, std::vector<uint8_t> &payload) {
+  uint8_t h[2];
+  if (!recvAll(fd, h, 2)) return false;
+  op = h[0] & 0x0F;
+  uint64_t n = h[1] & 0x7F;
+  if (n == 126) { uint8_t e[2]; if (!recvAll(fd, e, 2)) return false; n = (uint64_t)e[0] << 8 | e[1]; }
+  else if (n == 127) { uint8_t e[8]; if (!recvAll(fd, e, 8)) return false; n = 0; for (int i = 0; i < 8; ++i) n = n << 8 | e[i]; }
+  if (n > (1u << 20)) return false;
+  payload.resize((size_t)n);
+  return n == 0 || recvAll(fd, payload.data(), (size_t)n);
+}
+
+static int record(const char *host, int port, int fps, int roles, double seconds, const char *path) {
+  int fd = dial(host, port);
+  if (fd < 0) { std::fprintf(stderr, "cannot connect to %s:%d\n", host, port); return 1; }
+  std::mt19937 rng((uint32_t)Clock::now().time_since_epoch().count());
+  // Handshake
+  static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  char key[25];
+  for (int i = 0; i < 22; ++i) key[i] = b64[rng() & 63];
+  key[22] = key[23] = '='; key[24] = 0;
+  std::string req = std::string("GET /ws HTTP/1.1\r\nHost: ") + host + "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Key: " + key + "\r\nSec-WebSocket-Version: 13\r\n\r\n";
+  std::string head;
+  char c;
+  if (!sendAll(fd, req.data(), req.size())) { close(fd); return 1; }
+  while (head.find("\r\n\r\n") == std::string::npos && head.size() < 2048 && recv(fd, &c, 1, 0) == 1) head += c;
+  char accept[29];
+  Ws::acceptKey(key, 24, accept);
+  if (head.compare(0, 12, "HTTP/1.1 101") != 0 || head.find(accept) == std::string::npos) { std::fprintf(stderr, "upgrade refused:\n%s\n", head.c_str()); close(fd); return 1; }
+
+  FILE *out = std::fopen(path, "wb");
+  if (!out) { std::fprintf(stderr, "cannot write %s\n", path); close(fd); return 1; }
+  sendMasked(fd, Ws::OP_TEXT, "{\"frames\":" + std::to_string(fps) + ",\"roles\":" + std::to_string(roles) + "}", rng);
+
+  timeval tv{ 0, 200000 };
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  uint32_t frames[2] = { 0, 0 }, gaps = 0, lastSeq = 0;
+  size_t bytes = 0;
+  auto t0 = Clock::now();
+  uint8_t op; std::vector<uint8_t> payload;
+  while (std::chrono::duration<double>(Clock::now() - t0).count() < seconds) {
+    if (!readFrame(fd, op, payload)) { if (errno == EAGAIN || errno == EWOULDBLOCK) continue; break; }
+    if (op == Ws::OP_TEXT) {
+      std::string text(payload.begin(), payload.end());
+      if (text.find("\"frames\"") != std::string::npos) std::fprintf(stderr, "granted %s\n", text.c_str());
+      continue;
+    }
+    LedStream::Header h; const uint8_t *v;
+    if (op != Ws::OP_BINARY || !LedStream::decode(payload.data(), payload.size(), h, v)) continue;
+    uint8_t len[2] = { (uint8_t)payload.size(), (uint8_t)(payload.size() >> 8) };
+    std::fwrite(len, 1, 2, out);
+    std::fwrite(payload.data(), 1, payload.size(), out);
+    bytes += payload.size() + 2;
+    if (h.role < 2) frames[h.role]++;
+    if (h.role == 0 && lastSeq && h.seq != lastSeq + 1) gaps++;
+    if (h.role == 0) lastSeq = h.seq;
+  }
+  double dt = std::chrono::duration<double>(Clock::now() - t0).count();
+  sendMasked(fd, Ws::OP_TEXT, "{\"frames\":0}", rng);
+  sendMasked(fd, Ws::OP_CLOSE, "", rng);
+  close(fd);
+  std::fclose(out);
+  std::printf("%s: %u leader + %u follower frames in %.1f s (%.1f fps), %zu bytes, %u render gaps\n", path, frames[0], frames[1], dt, frames[0] / dt, bytes, gaps);
+  return 0;
+}
+
+static int play(const char *path) {
+  FILE *in = std::fopen(path, "rb");
+  if (!in) { std::fprintf(stderr, "cannot read %s\n", path); return 1; }
+  const char levels[5] = { ' ', '.', ':', '*', '#' };
+  uint32_t frames[2] = { 0, 0 }, first[2] = { 0, 0 }, last[2] = { 0, 0 }, bad = 0;
+  uint8_t len[2];
+  std::vector<uint8_t> buf;
+  while (std::fread(len, 1, 2, in) == 2) {
+    buf.resize((size_t)(len[0] | len[1] << 8));
+    if (std::fread(buf.data(), 1, buf.size(), in) != buf.size()) { bad++; break; }
+    LedStream::Header h; const uint8_t *v;
+    if (!LedStream::decode(buf.data(), buf.size(), h, v) || h.role > 1) { bad++; continue; }
+    if (!frames[h.role]++) first[h.role] = h.tMs;
+    last[h.role] = h.tMs;
+    std::printf("%c %10u %8u |", h.role ? 'F' : 'L', h.seq, h.tMs);
+    for (uint16_t i = 0; i < h.count; ++i) std::putchar(levels[(v[i] * 4 + 127) / 255]);
+    std::printf("|\n");
+  }
+  std::fclose(in);
+  for (int r = 0; r < 2; ++r) {
+    if (!frames[r]) continue;
+    double span = (last[r] - first[r]) / 1000.0;
+    std::printf("%s: %u frames over %.1f s (%.1f fps)\n", r ? "follower" : "leader", frames[r], span, span > 0 ? (frames[r] - 1) / span : 0.0);
+  }
+  if (bad) std::printf("%u unreadable records\n", bad);
+  return bad ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  const char *host = "192.168.4.1", *out = "leds.bin", *playPath = nullptr;
+  int port = WS_PORT, fps = 15, roles = 3;
+  double seconds = 10.0;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    bool more = i + 1 < argc;
+    if (a == "--host" && more) host = argv[++i];
+    else if (a == "--port" && more) port = std::atoi(argv[++i]);
+    else if (a == "--fps" && more) fps = std::atoi(argv[++i]);
+    else if (a == "--roles" && more) roles = std::atoi(argv[++i]);
+    else if (a == "--seconds" && more) seconds = std::atof(argv[++i]);
+    else if (a == "--out" && more) out = argv[++i];
+    else if (a == "--play" && more) playPath = argv[++i];
+    else { std::fprintf(stderr, "usage: %s [--host H] [--port P] [--fps N] [--roles 1|2|3] [--seconds S] [--out FILE] | --play FILE\n", argv[0]); return 2; }
+  }
+  return playPath ? play(playPath) : record(host, port, fps, roles, seconds, out);
+}
@@ -0,0 +1,497 @@
+// Host load generator for the leader's HTTP API. Plays several operators using the web UI at
+// once, each on its own keep-alive connection: slider drags streaming POST /api/cfg2 (leader,
+// then follower 40 ms later, like Apply), the globals slider on POST /api/globals, favorites
+// add / list / delete, and auto mode with its /api/auto/config polling. Runs against test_ui
+// or a leader's IP and prints requests per second and p50/p95/p99/max latency per endpoint.
+// --record writes the generated requests to a scenario file and --replay runs one, so two
+// runs (two firmware builds, test_ui --workers 1 vs 4) send the same requests at the same
+// times; --save keeps the result table and --baseline compares a run against a saved one.
+// --seconds is when operators stop starting new actions, not the run length: an action under
+// way (a slider drag, auto mode's polling) runs to completion, so the script can run past it.
+// The first line printed gives the actual span.
+//   loadgen [--host 127.0.0.1] [--port 8080] [--operators 4] [--seconds 30] [--seed 1] [--slider-hz 10]
+//           [--record FILE | --replay FILE] [--save FILE] [--baseline FILE] [--timeout MS] [--hist]
+//
+// Scenario file: a "# loadgen scenario 1" line, then one request per line,
+//   <ms from start> <operator> <METHOD> <path> [body]
+// The body runs to the end of the line. "$fav" in it stands for the id the operator's last
+// POST /api/favorites/add returned.
+//
+// Each operator sends its requests in order and waits for the reply, like the page's awaited
+// fetch() calls. A request due while the previous one is still out goes when that returns;
+// latency is measured from the send, and how long requests waited on an earlier reply is
+// reported separately.
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../anim_schema.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct Step { uint32_t atMs; uint16_t op; std::string method, path, body; };
+using Script = std::vector<Step>;
+
+// --- scenario generation ---
+
+static std::string num(float v) { char b[24]; std::snprintf(b, sizeof(b), "%.4g", v); return b; }
+
+// {id,value} list of an animation's params at their defaults, pid at v
+static std::string animParams(const AnimSchema::AnimDef &a, int pid, float v) {
+  std::string s = "[";
+  for (uint8_t i = 0; i < a.paramCount; ++i) {
+    const AnimSchema::ParamDef *pd = AnimSchema::findParam(a.paramIds[i]);
+    if (!pd) continue;
+    if (s.size() > 1) s += ',';
+    s += "{\"id\":" + std::to_string(pd->id) + ",\"value\":" + num(pd->id == pid ? v : pd->defVal) + "}";
+  }
+  return s + "]";
+}
+static std::string globalParams(float gmin) {
+  return "[{\"id\":" + std::to_string(AnimSchema::PID_GLOBAL_SPEED) + ",\"value\":1},{\"id\":" + std::to_string(AnimSchema::PID_GLOBAL_MIN) +
+         ",\"value\":" + num(gmin) + "},{\"id\":" + std::to_string(AnimSchema::PID_GLOBAL_MAX) + ",\"value\":1}]";
+}
+
+struct Operator {
+  uint16_t op;
+  uint32_t t, endMs, tickMs;
+  unsigned favs = 0;
+  std::mt19937 rng;
+  Script &out;
+
+  uint32_t uni(uint32_t lo, uint32_t hi) { return std::uniform_int_distribution<uint32_t>(lo, hi)(rng); }
+  const AnimSchema::AnimDef &anim() { return AnimSchema::ANIM_ITEMS[uni(0, AnimSchema::ANIM_COUNT - 1)]; }
+  void at(uint32_t dt, const char *method, const char *path, const std::string &body = "") { t += dt; out.push_back({ t, op, method, path, body }); }
+
+  void pageLoad() {
+    at(0, "GET", "/"); at(30, "GET", "/api/state"); at(10, "GET", "/api/favorites"); at(10, "GET", "/api/auto/config");
+  }
+  // Drags one range param of a random animation across its range and back
+  void slider() {
+    const AnimSchema::AnimDef &a = anim();
+    const AnimSchema::ParamDef *pd = nullptr;
+    for (uint8_t i = 0, n = a.paramCount; i < n && !pd; ++i) {
+      const AnimSchema::ParamDef *c = AnimSchema::findParam(a.paramIds[uni(0, n - 1)]);
+      if (c && c->type == AnimSchema::PT_RANGE) pd = c;
+    }
+    uint32_t ticks = uni(1000, 4000) / tickMs;
+    for (uint32_t k = 0; k < ticks; ++k) {
+      float f = (float)(k % 20) / 10.0f, v = pd ? pd->minVal + (pd->maxVal - pd->minVal) * (f <= 1.0f ? f : 2.0f - f) : 0;
+      std::string tail = ",\"animIndex\":" + std::to_string(a.index) + ",\"params\":" + animParams(a, pd ? pd->id : -1, v) + ",\"globals\":" + globalParams(0) + "}";
+      at(k ? tickMs - 40 : 0, "POST", "/api/cfg2", "{\"role\":0" + tail);
+      at(40, "POST", "/api/cfg2", "{\"role\":1" + tail);
+    }
+  }
+  void globals() {
+    uint32_t ticks = uni(1000, 3000) / tickMs;
+    for (uint32_t k = 0; k < ticks; ++k) at(k ? tickMs : 0, "POST", "/api/globals", globalParams(0.05f * (float)(k % 10)));
+  }
+  void addFavorite() {
+    const AnimSchema::AnimDef &l = anim(), &f = anim();
+    std::string body = "{\"name\":\"op" + std::to_string(op) + " #" + std::to_string(++favs) + "\",\"globals\":{\"globalSpeed\":1}" +
+                       ",\"leader\":{\"animIndex\":" + std::to_string(l.index) + ",\"params\":" + animParams(l, -1, 0) + "}" +
+                       ",\"follower\":{\"animIndex\":" + std::to_string(f.index) + ",\"params\":" + animParams(f, -1, 0) + "}}";
+    at(0, "POST", "/api/favorites/add", body);
+    at(20, "GET", "/api/favorites");
+  }
+  void deleteFavorite(uint32_t afterMs) {
+    at(afterMs, "POST", "/api/favorites/delete", "{\"id\":$fav}");
+    at(20, "GET", "/api/favorites");
+  }
+  // Add, look at the list, delete again: the store stays the size it started at
+  void favorites() { addFavorite(); deleteFavorite(uni(1000, 3000)); }
+  // Auto mode on the operator's own favorite, polling the banner every second, then off
+  void autoMode() {
+    addFavorite();
+    at(500, "POST", "/api/auto/settings", "{\"interval\":1,\"random\":false,\"selections\":[$fav]}");
+    at(20, "POST", "/api/auto/start");
+    for (uint32_t k = 0, n = uni(5, 15); k < n; ++k) at(1000, "GET", "/api/auto/config");
+    at(200, "POST", "/api/auto/stop");
+    deleteFavorite(500);
+  }
+
+  void run() {
+    pageLoad();
+    while ((t += uni(1000, 4000)) < endMs) {
+      uint32_t pick = uni(0, 9);
+      if (pick < 5) slider();
+      else if (pick < 7) globals();
+      else if (pick < 9) favorites();
+      else autoMode();
+    }
+  }
+};
+
+static Script generate(unsigned operators, uint32_t seconds, uint32_t seed, unsigned sliderHz) {
+  Script s;
+  for (uint16_t op = 0; op < operators; ++op) {
+    Operator o{ op, 0, seconds * 1000, 1000 / std::max(1u, std::min(sliderHz, 20u)), 0, std::mt19937(seed * 7919u + op), s };
+    o.t = op * 300 + o.uni(0, 200); // pages opened a little apart
+    o.run();
+  }
+  std::stable_sort(s.begin(), s.end(), [](const Step &a, const Step &b) { return a.atMs < b.atMs; });
+  return s;
+}
+
+static bool writeScript(const char *path, const Script &s) {
+  FILE *f = std::fopen(path, "w");
+  if (!f) return false;
+  std::fprintf(f, "# loadgen scenario 1\n");
+  for (const Step &st : s) std::fprintf(f, "%u %u %s %s%s%s\n", st.atMs, st.op, st.method.c_str(), st.path.c_str(), st.body.empty() ? "" : " ", st.body.c_str());
+  return std::fclose(f) == 0;
+}
+
+static bool readScript(const char *path, Script &s) {
+  FILE *f = std::fopen(path, "r");
+  if (!f) { std::fprintf(stderr, "cannot open %s\n", path); return false; }
+  char line[16384];
+  unsigned n = 0;
+  bool ok = true;
+  while (ok && std::fgets(line, sizeof(line), f)) {
+    n++;
+    size_t len = strcspn(line, "\r\n");
+    line[len] = 0;
+    if (!len || line[0] == '#') continue;
+    unsigned at, op;
+    char method[16], target[1024];
+    int used = 0;
+    if (std::sscanf(line, "%u %u %15s %1023s%n", &at, &op, method, target, &used) != 4 || op > 0xFFFF || target[0] != '/') {
+      std::fprintf(stderr, "%s:%u: expected <ms> <operator> <METHOD> <path> [body]\n", path, n);
+      ok = false;
+      break;
+    }
+    const char *body = line + used;
+    if (*body == ' ') body++;
+    s.push_back({ at, (uint16_t)op, method, target, body });
+  }
+  std::fclose(f);
+  return ok && !s.empty();
+}
+
+// --- client ---
+
+static int dial(const char *host, int port, uint32_t timeoutMs) {
+  addrinfo hints{}, *res = nullptr;
+  hints.ai_family = AF_INET; hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(host, std::to_string(port).c_str(), &hints, &res) != 0 || !res) return -1;
+  int fd = socket(res->ai_family, res->ai_socktype, 0);
+  if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) { close(fd); fd = -1; }
+  freeaddrinfo(res);
+  if (fd < 0) return -1;
+  timeval tv{ (time_t)(timeoutMs / 1000), (suseconds_t)(timeoutMs % 1000 * 1000) };
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  return fd;
+}
+
+static bool sendAll(int fd, const std::string &s) {
+  const char *p = s.data();
+  size_t n = s.size();
+  while (n) { ssize_t r = send(fd, p, n, MSG_NOSIGNAL); if (r <= 0) return false; p += r; n -= (size_t)r; }
+  return true;
+}
+// Appends what arrived: bytes read, 0 when the peer closed, -1 on a timeout or error
+static int fill(int fd, std::string &buf) {
+  char tmp[8192];
+  ssize_t r = recv(fd, tmp, sizeof(tmp), 0);
+  if (r <= 0) return r == 0 ? 0 : -1;
+  buf.append(tmp, (size_t)r);
+  return (int)r;
+}
+
+struct Reply { int status = 0; std::string body; bool close = false; };
+
+// One response: Content-Length, chunked (the firmware streams its JSON) or up to the close.
+// False if the socket closed or timed out first.
+static bool readReply(int fd, std::string &buf, Reply &r) {
+  size_t he;
+  while ((he = buf.find("\r\n\r\n")) == std::string::npos) if (buf.size() > 65536 || fill(fd, buf) <= 0) return false;
+  r = Reply();
+  if (buf.compare(0, 7, "HTTP/1.") || he < 12) return false;
+  r.status = std::atoi(buf.c_str() + 9);
+  bool chunked = false, haveLen = false, keep = buf[7] == '1';
+  size_t len = 0;
+  for (size_t p = buf.find("\r\n") + 2; p < he;) {
+    size_t e = buf.find("\r\n", p);
+    std::string h = buf.substr(p, e - p);
+    for (char &c : h) c = (char)tolower((unsigned char)c);
+    if (!h.compare(0, 15, "content-length:")) { len = std::strtoul(h.c_str() + 15, nullptr, 10); haveLen = true; }
+    else if (!h.compare(0, 18, "transfer-encoding:")) chunked = h.find("chunked") != std::string::npos;
+    else if (!h.compare(0, 11, "connection:")) keep = h.find("close") == std::string::npos && (keep || h.find("keep-alive") != std::string::npos);
+    p = e + 2;
+  }
+  r.close = !keep;
+  buf.erase(0, he + 4);
+  if (r.status / 100 == 1 || r.status == 204 || r.status == 304) return true;
+  if (chunked) {
+    for (;;) {
+      size_t e;
+      while ((e = buf.find("\r\n")) == std::string::npos) if (fill(fd, buf) <= 0) return false;
+      size_t n = std::strtoul(buf.c_str(), nullptr, 16);
+      if (!n) { // last chunk and trailers
+        while ((e = buf.find("\r\n\r\n")) == std::string::npos) if (fill(fd, buf) <= 0) return false;
+        buf.erase(0, e + 4);
+        return true;
+      }
+      while (buf.size() < e + 2 + n + 2) if (fill(fd, buf) <= 0) return false;
+      r.body.append(buf, e + 2, n);
+      buf.erase(0, e + 2 + n + 2);
+    }
+  }
+  if (haveLen) {
+    while (buf.size() < len) if (fill(fd, buf) <= 0) return false;
+    r.body = buf.substr(0, len);
+    buf.erase(0, len);
+    return true;
+  }
+  while (fill(fd, buf) > 0) {}
+  r.body.swap(buf);
+  buf.clear();
+  r.close = true;
+  return true;
+}
+
+struct Sample { uint16_t ep; bool replied, ok; uint32_t us, lateUs, bytes; };
+
+struct Client {
+  Client(const char *host, int port, uint32_t timeoutMs) : host(host), port(port), timeoutMs(timeoutMs) {}
+
+  const char *host;
+  int port;
+  uint32_t timeoutMs;
+  std::vector<const Step *> steps;
+  std::vector<Sample> samples;
+  unsigned connects = 0, failedConnects = 0;
+  int fd = -1;
+  bool reused = false;
+  std::string buf;
+
+  // A keep-alive connection the server already dropped fails at once: the send fails, or the
+  // first read is an EOF with no bytes. Only then, and only for a GET, is the request sent
+  // once more on a new connection. A timeout or a half-read reply is an error: the server may
+  // still be working on it, and a repeated POST could be applied twice.
+  bool exchange(const std::string &req, bool idempotent, Reply &r) {
+    for (int attempt = 0; attempt < 2; ++attempt) {
+      if (fd < 0) {
+        fd = dial(host, port, timeoutMs);
+        if (fd < 0) { failedConnects++; return false; }
+        connects++;
+        reused = false;
+        buf.clear();
+      }
+      bool sent = sendAll(fd, req);
+      int got = sent && buf.empty() ? fill(fd, buf) : 1;
+      bool ok = sent && got > 0 && readReply(fd, buf, r);
+      bool retry = !ok && reused && idempotent && (!sent || got == 0);
+      if (!ok || r.close) { close(fd); fd = -1; }
+      if (ok) { reused = true; return true; }
+      if (!retry) return false;
+    }
+    return false;
+  }
+
+  void run(Clock::time_point t0, const std::map<std::string, uint16_t> &endpoints) {
+    std::string fav = "-1";
+    Clock::time_point prevDone = t0;
+    for (const Step *st : steps) {
+      Clock::time_point due = t0 + std::chrono::milliseconds(st->atMs);
+      std::this_thread::sleep_until(due);
+      std::string body = st->body;
+      for (size_t p; (p = body.find("$fav")) != std::string::npos;) body.replace(p, 4, fav);
+      std::string req = st->method + " " + st->path + " HTTP/1.1\r\nHost: " + host + "\r\n";
+      if (st->path == "/") req += "Accept-Encoding: gzip\r\n";
+      if (st->method == "POST") req += "Content-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) + "\r\n";
+      req += "\r\n" + body;
+      Clock::time_point start = Clock::now();
+      Reply r;
+      bool ok = exchange(req, st->method == "GET", r);
+      Clock::time_point done = Clock::now();
+      if (ok && r.status == 200 && st->path == "/api/favorites/add") {
+        size_t p = r.body.find("\"id\":");
+        if (p != std::string::npos) fav = std::to_string(std::atol(r.body.c_str() + p + 5));
+      }
+      Sample s;
+      s.ep = endpoints.at(st->method + " " + st->path);
+      s.replied = ok;
+      s.ok = ok && r.status >= 200 && r.status < 400;
+      s.us = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(done - start).count();
+      s.lateUs = prevDone > due ? (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(prevDone - due).count() : 0;
+      s.bytes = ok ? (uint32_t)r.body.size() : 0;
+      samples.push_back(s);
+      prevDone = done;
+    }
+    if (fd >= 0) close(fd);
+  }
+};
+
+// --- report ---
+
+struct Row { std::string name; size_t n = 0, err = 0; double rps = 0, p50 = 0, p95 = 0, p99 = 0, max = 0, kb = 0; std::vector<uint32_t> us; };
+
+// Nearest-rank percentile of sorted samples in us, as ms
+static double pct(const std::vector<uint32_t> &v, double p) {
+  if (v.empty()) return 0;
+  size_t k = (size_t)std::ceil(p / 100.0 * (double)v.size());
+  return v[std::min(v.size(), std::max<size_t>(k, 1)) - 1] / 1000.0;
+}
+static void finish(Row &r, double seconds) {
+  std::sort(r.us.begin(), r.us.end());
+  r.rps = (double)r.n / seconds;
+  r.p50 = pct(r.us, 50); r.p95 = pct(r.us, 95); r.p99 = pct(r.us, 99); r.max = pct(r.us, 100);
+}
+
+static void histogram(const Row &r) {
+  static const double edges[] = { 0.25, 0.5, 1, 2.5, 5, 10, 25, 50, 100, 250, 500, 1000, 2500 };
+  const size_t nb = sizeof(edges) / sizeof(edges[0]) + 1;
+  size_t count[nb] = {}, most = 1;
+  for (uint32_t us : r.us) count[std::upper_bound(edges, edges + nb - 1, us / 1000.0) - edges]++;
+  for (size_t c : count) most = std::max(most, c);
+  std::printf("%s\n", r.name.c_str());
+  for (size_t b = 0; b < nb; ++b) {
+    if (!count[b]) continue;
+    char range[32];
+    if (b + 1 < nb) std::snprintf(range, sizeof(range), "< %g ms", edges[b]); else std::snprintf(range, sizeof(range), ">= %g ms", edges[nb - 2]);
+    std::printf("  %12s %7zu %s\n", range, count[b], std::string((size_t)(40.0 * count[b] / most + 0.999), '#').c_str());
+  }
+}
+
+static bool save(const char *path, const std::vector<Row> &rows) {
+  FILE *f = std::fopen(path, "w");
+  if (!f) return false;
+  std::fprintf(f, "# loadgen result 1: endpoint\tn\terr\treq/s\tp50\tp95\tp99\tmax (ms)\n");
+  for (const Row &r : rows) std::fprintf(f, "%s\t%zu\t%zu\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\n", r.name.c_str(), r.n, r.err, r.rps, r.p50, r.p95, r.p99, r.max);
+  return std::fclose(f) == 0;
+}
+
+static void compare(const char *path, const std::vector<Row> &rows) {
+  FILE *f = std::fopen(path, "r");
+  if (!f) { std::fprintf(stderr, "cannot open baseline %s\n", path); return; }
+  std::map<std::string, Row> base;
+  char line[512];
+  while (std::fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') continue;
+    char *tab = strchr(line, '\t');
+    if (!tab) continue;
+    Row r;
+    r.name.assign(line, tab);
+    if (std::sscanf(tab + 1, "%zu %zu %lf %lf %lf %lf %lf", &r.n, &r.err, &r.rps, &r.p50, &r.p95, &r.p99, &r.max) == 7) base[r.name] = r;
+  }
+  std::fclose(f);
+  auto delta = [](double now, double was) {
+    char b[16];
+    if (was <= 0) std::snprintf(b, sizeof(b), "-");
+    else if (now >= 10 * was) std::snprintf(b, sizeof(b), "x%.0f", now / was);
+    else std::snprintf(b, sizeof(b), "%+.0f%%", 100.0 * (now - was) / was);
+    return std::string(b);
+  };
+  std::printf("\nagainst %s (ms, baseline -> this run)\n%-26s | %20s | %20s | %20s | %6s\n", path, "endpoint", "p50", "p95", "p99", "errors");
+  for (const Row &r : rows) {
+    auto it = base.find(r.name);
+    if (it == base.end()) { std::printf("%-26s | not in baseline\n", r.name.c_str()); continue; }
+    const Row &b = it->second;
+    std::printf("%-26s | %6.1f %6.1f %6s | %6.1f %6.1f %6s | %6.1f %6.1f %6s | %2zu->%zu\n", r.name.c_str(),
+                b.p50, r.p50, delta(r.p50, b.p50).c_str(), b.p95, r.p95, delta(r.p95, b.p95).c_str(), b.p99, r.p99, delta(r.p99, b.p99).c_str(), b.err, r.err);
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *host = "127.0.0.1", *recordPath = nullptr, *replayPath = nullptr, *savePath = nullptr, *basePath = nullptr;
+  int port = 8080;
+  unsigned operators = 4, seconds = 30, seed = 1, sliderHz = 10, timeoutMs = 5000;
+  bool hist = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    bool more = i + 1 < argc;
+    if (a == "--host" && more) host = argv[++i];
+    else if (a == "--port" && more) port = std::atoi(argv[++i]);
+    else if (a == "--operators" && more) operators = (unsigned)std::max(1, std::atoi(argv[++i]));
+    else if (a == "--seconds" && more) seconds = (unsigned)std::max(1, std::atoi(argv[++i]));
+    else if (a == "--seed" && more) seed = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+    else if (a == "--slider-hz" && more) sliderHz = (unsigned)std::max(1, std::atoi(argv[++i]));
+    else if (a == "--record" && more) recordPath = argv[++i];
+    else if (a == "--replay" && more) replayPath = argv[++i];
+    else if (a == "--save" && more) savePath = argv[++i];
+    else if (a == "--baseline" && more) basePath = argv[++i];
+    else if (a == "--timeout" && more) timeoutMs = (unsigned)std::max(1, std::atoi(argv[++i]));
+    else if (a == "--hist") hist = true;
+    else {
+      std::fprintf(stderr, "usage: %s [--host H] [--port P] [--operators N] [--seconds S] [--seed N] [--slider-hz N]\n"
+                           "       [--record FILE | --replay FILE] [--save FILE] [--baseline FILE] [--timeout MS] [--hist]\n"
+                           "--seconds: no new actions start after S; the ones under way finish, so runs last a little longer\n", argv[0]);
+      return 2;
+    }
+  }
+
+  Script script;
+  if (replayPath) { if (!readScript(replayPath, script)) return 2; }
+  else script = generate(operators, seconds, seed, sliderHz);
+  if (recordPath && !writeScript(recordPath, script)) { std::fprintf(stderr, "cannot write %s\n", recordPath); return 2; }
+
+  // Endpoints in the order they first appear; one client per operator
+  std::map<std::string, uint16_t> endpoints;
+  std::vector<std::string> names;
+  std::map<uint16_t, Client> clients;
+  for (const Step &st : script) {
+    std::string name = st.method + " " + st.path;
+    if (endpoints.emplace(name, (uint16_t)names.size()).second) names.push_back(name);
+    Client &c = clients.emplace(st.op, Client(host, port, timeoutMs)).first->second;
+    c.steps.push_back(&st);
+  }
+  std::printf("%zu requests from %zu operators over %.1f s against %s:%d%s%s\n", script.size(), clients.size(), script.back().atMs / 1000.0, host, port,
+              replayPath ? ", replaying " : "", replayPath ? replayPath : "");
+
+  Clock::time_point t0 = Clock::now() + std::chrono::milliseconds(50);
+  std::vector<std::thread> threads;
+  for (auto &kv : clients) threads.emplace_back([&kv, t0, &endpoints] { kv.second.run(t0, endpoints); });
+  for (std::thread &t : threads) t.join();
+  double wall = std::chrono::duration<double>(Clock::now() - t0).count();
+
+  std::vector<Row> rows(names.size());
+  Row all;
+  all.name = "all";
+  std::vector<uint32_t> late;
+  unsigned connects = 0, failedConnects = 0;
+  for (size_t i = 0; i < names.size(); ++i) rows[i].name = names[i];
+  for (auto &kv : clients) {
+    connects += kv.second.connects;
+    failedConnects += kv.second.failedConnects;
+    for (const Sample &s : kv.second.samples) {
+      for (Row *r : { &rows[s.ep], &all }) {
+        r->n++;
+        if (!s.ok) r->err++;
+        if (s.replied) r->us.push_back(s.us); // latency of requests that got an answer
+        r->kb += s.bytes / 1024.0;
+      }
+      late.push_back(s.lateUs);
+    }
+  }
+  for (Row &r : rows) finish(r, wall);
+  finish(all, wall);
+  std::sort(late.begin(), late.end());
+
+  std::printf("%-26s | %6s %5s | %7s | %7s %7s %7s %7s | %8s\n", "endpoint", "n", "err", "req/s", "p50", "p95", "p99", "max ms", "KB");
+  auto print = [](const Row &r) {
+    std::printf("%-26s | %6zu %5zu | %7.1f | %7.1f %7.1f %7.1f %7.1f | %8.0f\n", r.name.c_str(), r.n, r.err, r.rps, r.p50, r.p95, r.p99, r.max, r.kb);
+  };
+  for (const Row &r : rows) print(r);
+  print(all);
+  std::printf("%.1f s, %u connections (%u refused); waited on an earlier reply: p99 %.1f ms, max %.1f ms\n", wall, connects, failedConnects, pct(late, 99), pct(late, 100));
+  if (hist) { std::printf("\n"); for (const Row &r : rows) histogram(r); }
+  if (basePath) compare(basePath, rows);
+  if (savePath && !save(savePath, rows)) { std::fprintf(stderr, "cannot write %s\n", savePath); return 2; }
+  return all.err ? 1 : 0;
+}
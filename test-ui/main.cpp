@@ -8,12 +8,16 @@
 #include <chrono>
 #include <unordered_map>
 #include <functional>
+#include <algorithm>
 #include <cctype>
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <poll.h>
+#include <cerrno>
 #include <unistd.h>
 #include <cstdlib>
 #include <ctime>
+#include <mutex>
 
 // Minimal Arduino compatibility shims
 using String = std::string;
@@ -22,6 +26,15 @@ using String = std::string;
 
 // Pull in the embedded UI pieces
 #include "../web_ui.h"
+#include "../web_ui_gz.h"
+#include "../follower_registry.h"
+#include "../json_reader.h"
+#include "../ws_push.h"
+#include "../led_stream.h"
+#include "../animations.h"
+#include "../fav_store.h"
+#include "mock_preferences.h"
+#include "http_server.h"
 
 static std::string buildIndexHtml(){
     std::string html;
@@ -40,8 +53,17 @@ static const char *STATE_JSON = R"({
   "follower": {"animIndex": 1, "speed": 3.0, "phase": 0.0, "width": 2, "branchMode": true, "invert": false}
 })";
 
-// In-memory favorites store for test server
-static std::vector<std::string> gFavorites;
+// Everything simulated below is shared by the HTTP workers and the push thread
+static std::mutex gSimMu;
+
+// Favorites in the firmware's store (fav_store.h), on an in-memory Preferences
+static MockPreferences gPrefs;
+static FavStore::Store<MockPreferences> gFavs(gPrefs);
+static FavStore::Cache<MockPreferences> gFavCache(gFavs);
+static std::string favoriteName(int id){
+    const FavStore::Entry *e = id >= 0 ? gFavCache.get((uint16_t)id) : nullptr;
+    return e ? std::string(e->name, e->nameLen) : std::string();
+}
 
 // --- Simulated dynamic animation state (mirrors firmware surface) ---
 static int gLeaderAnimIndex = 1;
@@ -66,57 +88,51 @@ static void initDefaultParams(){
 static bool gAutoOn = false;
 static int gAutoIntervalMin = 1; // minutes
 static bool gAutoRandom = false;
-static std::vector<int> gAutoSel; // indices into gFavorites
+static std::vector<int> gAutoSel; // favorite ids
 static int gAutoIdx = -1; // index into gAutoSel
 static std::chrono::steady_clock::time_point gAutoLastSwitch;
 
+// --- Simulated follower registry (a few synthetic nodes, one of them stale) ---
+static Fleet::Registry gFollowers;
+static std::chrono::steady_clock::time_point gStart = std::chrono::steady_clock::now();
+static uint32_t simNowMs(){ return 1u + (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gStart).count(); }
+static void initFollowersSim(){
+    if (gFollowers.count) return;
+    uint32_t now = simNowMs();
+    gFollowers.beginRound(now / 33);
+    for (uint8_t id = 1; id <= 5; ++id){
+        if (id == 4) { gFollowers.onReq(id, now, -112, -6); continue; }
+        gFollowers.onAck(id, gFollowers.roundFrame, (int16_t)(id * 3 - 7), now, (int16_t)(-60 - id * 8), (int8_t)(9 - id));
+    }
+    gFollowers.onAck(Tdma::kSlots + 1, gFollowers.roundFrame, 4, now, -95, 2); // shares node 1's slot
+}
+
 static void seedRandOnce(){ static bool s=false; if(!s){ std::srand((unsigned)std::time(nullptr)); s=true; } }
 
 static void applyFavoriteSim(int favId){
-    // Parse favorite JSON and apply to simulated dynamic state like firmware
-    if (favId < 0 || favId >= (int)gFavorites.size()) return;
+    // Decoded favorite from the firmware's cache, applied to simulated dynamic state like firmware
+    const FavStore::Entry *fav = favId >= 0 ? gFavCache.get((uint16_t)favId) : nullptr;
+    if (!fav) return;
     initDefaultParams();
-    const std::string &cfg = gFavorites[favId];
-    auto findNum=[&](const std::string &s, size_t start, size_t end, const char *key, double defv){
-        size_t k = s.find(key, start); if (k==std::string::npos || k>=end) return defv; k = s.find(':', k); if (k==std::string::npos || k>=end) return defv; k++; while (k<end && s[k]==' ') k++; size_t e=k; while (e<end && (std::isdigit((unsigned char)s[e])||s[e]=='-'||s[e]=='+'||s[e]=='.'||s[e]=='e'||s[e]=='E')) e++; try{ return std::stod(s.substr(k, e-k)); }catch(...){ return defv; } };
-    auto parseBlock=[&](const char* blockName, int &animIndex, std::unordered_map<int,float> &pmap){
-        size_t b = cfg.find(blockName); if (b==std::string::npos) return; size_t bl = cfg.find('{', b); if (bl==std::string::npos) return; size_t br = cfg.find('}', bl); if (br==std::string::npos) br = cfg.size();
-        // animIndex
-        double a = findNum(cfg, bl, br, "\"animIndex\"", animIndex);
-        animIndex = (int)a;
-        // scan id/value pairs in this block
-        size_t pos = bl; int safety=0;
-        while (pos < br && safety < 256){
-            size_t idk = cfg.find("\"id\"", pos); if (idk==std::string::npos || idk>=br) break; size_t col = cfg.find(':', idk); if (col==std::string::npos) break; size_t is = col+1; while (is<br && cfg[is]==' ') is++; size_t ie=is; while (ie<br && std::isdigit((unsigned char)cfg[ie])) ie++; int pid = 0; try{ pid = std::stoi(cfg.substr(is, ie-is)); }catch(...){ pid = 0; }
-            size_t vk = cfg.find("\"value\"", ie); if (vk==std::string::npos || vk>=br){ pos = ie; safety++; continue; }
-            col = cfg.find(':', vk); if (col==std::string::npos) break; size_t vs = col+1; while (vs<br && cfg[vs]==' ') vs++; size_t ve=vs; while (ve<br && (std::isdigit((unsigned char)cfg[ve])||cfg[ve]=='-'||cfg[ve]=='+'||cfg[ve]=='.'||cfg[ve]=='e'||cfg[ve]=='E')) ve++; double v=0.0; try{ v = std::stod(cfg.substr(vs, ve-vs)); }catch(...){ v=0.0; }
-            pmap[pid] = (float)v; pos = ve; safety++;
-        }
+    auto applyRole=[&](uint8_t role, int &animIndex, std::unordered_map<int,float> &pmap){
+        if (fav->anim[role] != FavStore::NO_ANIM) animIndex = fav->anim[role];
+        for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row)
+            if (fav->has(role, row)) pmap[AnimSchema::PARAM_IDS[row]] = Anim::getParamField(fav->ps[role], AnimSchema::PARAM_IDS[row]);
     };
-    parseBlock("\"leader\"", gLeaderAnimIndex, gLeaderParams);
-    parseBlock("\"follower\"", gFollowerAnimIndex, gFollowerParams);
-    // Optional globals: only override keys that are explicitly present
-    size_t gpos = cfg.find("\"globals\"");
-    if (gpos != std::string::npos) {
-        size_t gl = cfg.find('{', gpos);
-        size_t gr = cfg.find('}', gl==std::string::npos?0:gl);
-        if (gl!=std::string::npos && gr!=std::string::npos && gr>gl){
-            auto hasKeyIn = [&](const char* key){ size_t k = cfg.find(key, gl); return (k!=std::string::npos && k<gr); };
-            if (hasKeyIn("\"globalSpeed\"")){
-                double gs = findNum(cfg, gl, gr, "\"globalSpeed\"", 1.0);
-                gLeaderParams[(int)AnimSchema::PID_GLOBAL_SPEED]=(float)gs;
-                gFollowerParams[(int)AnimSchema::PID_GLOBAL_SPEED]=(float)gs;
-            }
-            // Intentionally ignore globalMin/globalMax from favorites to match firmware
-            // Enforce max >= min using existing values
-            float lmin = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MIN];
-            float lmax = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX];
-            if (lmax < lmin) gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX] = lmin;
-            float fmin = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MIN];
-            float fmax = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX];
-            if (fmax < fmin) gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX] = fmin;
-        }
+    applyRole(0, gLeaderAnimIndex, gLeaderParams);
+    applyRole(1, gFollowerAnimIndex, gFollowerParams);
+    // Optional globals: only globalSpeed, min/max intentionally ignored to match firmware
+    if (fav->hasSpeed){
+        gLeaderParams[(int)AnimSchema::PID_GLOBAL_SPEED] = fav->globalSpeed;
+        gFollowerParams[(int)AnimSchema::PID_GLOBAL_SPEED] = fav->globalSpeed;
     }
+    // Enforce max >= min using existing values
+    float lmin = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MIN];
+    float lmax = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX];
+    if (lmax < lmin) gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX] = lmin;
+    float fmin = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MIN];
+    float fmax = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX];
+    if (fmax < fmin) gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX] = fmin;
 }
 
 static void advanceAutoIfNeeded(){
@@ -163,364 +179,434 @@ static int remainingSeconds(){
     if (rem < 0) rem = 0; return rem;
 }
 
-static std::string extractNameFromJson(const std::string &js){
-    auto pos = js.find("\"name\"");
-    if (pos == std::string::npos) return "favorite";
-    pos = js.find(':', pos);
-    if (pos == std::string::npos) return "favorite";
-    ++pos;
-    while (pos < js.size() && js[pos] == ' ') ++pos;
-    if (pos < js.size() && js[pos] == '"'){
-        auto end = js.find('"', pos+1);
-        if (end != std::string::npos && end > pos+1) return js.substr(pos+1, end - (pos+1));
-    }
-    // fallback until comma/brace
-    size_t end = pos; while (end < js.size() && js[end] != ',' && js[end] != '}' && js[end] != '\n' && js[end] != '\r') ++end;
-    return js.substr(pos, end-pos);
-}
+static void appendJson(void *user, const char *data, size_t len){ static_cast<std::string *>(user)->append(data, len); }
 
 static std::string buildFavoritesJson(){
-    std::ostringstream oss; oss << "{\"items\":[";
-    for(size_t i=0;i<gFavorites.size();++i){
-        if (i) oss << ",";
-        const std::string &cfg = gFavorites[i];
-        std::string name = extractNameFromJson(cfg);
-        oss << "{\"id\":"<< i << ",\"name\":\"" << name << "\",\"cfg\":" << cfg << "}";
-    }
-    oss << "]}";
-    return oss.str();
-}
-
-// Helpers to parse JSON-ish posts (very naive, matching firmware)
-static int extractNum(const std::string &body, const char *key, int defv){
-    auto idx = body.find(key); if (idx==std::string::npos) return defv;
-    idx = body.find(':', idx); if (idx==std::string::npos) return defv; idx++;
-    while (idx < body.size() && body[idx]==' ') idx++;
-    size_t end=idx; while (end<body.size() && std::isdigit((unsigned char)body[end])) end++;
-    if (end>idx) return std::stoi(body.substr(idx, end-idx));
-    return defv;
-}
-static bool extractBool(const std::string &body, const char *key, bool defv){
-    auto idx = body.find(key); if (idx==std::string::npos) return defv;
-    idx = body.find(':', idx); if (idx==std::string::npos) return defv; idx++;
-    while (idx < body.size() && body[idx]==' ') idx++;
-    if (body.compare(idx, 4, "true") == 0) return true;
-    if (body.compare(idx, 5, "false") == 0) return false;
-    return defv;
-}
-static std::vector<int> extractSelections(const std::string &body){
-    std::vector<int> out;
-    auto sidx = body.find("\"selections\"");
-    if (sidx==std::string::npos) return out;
-    auto lb = body.find('[', sidx); auto rb = body.find(']', lb);
-    if (lb==std::string::npos || rb==std::string::npos || rb<=lb) return out;
-    size_t pos = lb+1;
-    while (pos < rb){
-        while (pos < rb && (body[pos]==' ' || body[pos]==',')) ++pos;
-        size_t st = pos; while (pos < rb && std::isdigit((unsigned char)body[pos])) ++pos;
-        if (pos > st) out.push_back(std::stoi(body.substr(st, pos-st)));
-        while (pos < rb && body[pos] != ',') ++pos;
+    std::string out;
+    Json::Writer<> w(&appendJson, &out);
+    const uint16_t *ids = gFavCache.ids();
+    uint16_t count = gFavCache.count();
+    w.beginObject().key("items").beginArray();
+    for (uint16_t i = 0; i < count; ++i){
+        FavStore::Favorite f;
+        if (!gFavs.load(ids[i], f)) continue;
+        w.beginObject().key("id").num((unsigned)ids[i]).key("name").rawStr(f.name, f.nameLen).key("cfg");
+        FavStore::writeJson(w, f);
+        w.endObject();
     }
+    w.endArray().endObject();
+    w.flush();
     return out;
 }
 
-// Parse an array of objects with numeric id/value pairs under a key name
-static std::vector<std::pair<int,float>> extractIdValueArray(const std::string &body, const char *key){
+// Request bodies go through the firmware's tokenizer (json_reader.h)
+static std::vector<std::pair<int,float>> extractIdValueArray(const Json::Doc<> &doc, int arr){
     std::vector<std::pair<int,float>> out;
-    auto sidx = body.find(key);
-    if (sidx==std::string::npos) return out;
-    auto lb = body.find('[', sidx);
-    auto rb = body.find(']', lb==std::string::npos?0:lb);
-    if (lb==std::string::npos || rb==std::string::npos || rb<=lb) return out;
-    size_t pos = lb+1; int safety=0;
-    while (pos < rb && safety < 1024){
-        auto idk = body.find("\"id\"", pos); if (idk==std::string::npos || idk>=rb) break;
-        auto col = body.find(':', idk); if (col==std::string::npos || col>=rb) break; size_t is = col+1; while (is<rb && body[is]==' ') is++;
-        size_t ie=is; while (ie<rb && std::isdigit((unsigned char)body[ie])) ie++;
-        int pid = 0; try{ pid = std::stoi(body.substr(is, ie-is)); }catch(...){ pid=0; }
-        auto vk = body.find("\"value\"", ie); if (vk==std::string::npos || vk>=rb){ pos = ie; safety++; continue; }
-        col = body.find(':', vk); if (col==std::string::npos || col>=rb) break; size_t vs = col+1; while (vs<rb && body[vs]==' ') vs++;
-        size_t ve=vs; while (ve<rb && (std::isdigit((unsigned char)body[ve])||body[ve]=='-'||body[ve]=='+'||body[ve]=='.'||body[ve]=='e'||body[ve]=='E')) ve++;
-        float val = 0.0f; try{ val = std::stof(body.substr(vs, ve-vs)); }catch(...){ val=0.0f; }
-        out.emplace_back(pid, val);
-        pos = ve; safety++;
-    }
+    doc.forEachParam(arr, [&](uint8_t pid, float v){ out.emplace_back(pid, v); });
     return out;
 }
 
 static void applyCfg2FromBody(const std::string &body){
     initDefaultParams();
+    Json::Doc<> doc(body.data(), body.size());
     // role and animIndex
-    int role = extractNum(body, "\"role\"", -1);
-    int animIndex = extractNum(body, "\"animIndex\"", -1);
-    auto params = extractIdValueArray(body, "\"params\"");
-    auto globals = extractIdValueArray(body, "\"globals\"");
+    int role = (int)doc.integer(doc.get(0, "role"), -1);
+    int animIndex = (int)doc.integer(doc.get(0, "animIndex"), -1);
+    auto params = extractIdValueArray(doc, doc.get(0, "params"));
+    auto globals = extractIdValueArray(doc, doc.get(0, "globals"));
     if (role==0){ if (animIndex>=0) gLeaderAnimIndex = animIndex; for (auto &pr : params) gLeaderParams[pr.first]=pr.second; }
     else if (role==1){ if (animIndex>=0) gFollowerAnimIndex = animIndex; for (auto &pr : params) gFollowerParams[pr.first]=pr.second; }
     // Apply globals to both
     for (auto &pr : globals){ gLeaderParams[pr.first]=pr.second; gFollowerParams[pr.first]=pr.second; }
 }
 
-class SimpleHttpServer {
+// What the push channel compares, built from the simulated state like the firmware's wsSnapshot
+static Ws::Snapshot simSnapshot(){
+    initDefaultParams();
+    Ws::Snapshot s;
+    s.autoOn = gAutoOn && !gAutoSel.empty() && gAutoIdx >= 0 && gAutoIdx < (int)gAutoSel.size();
+    s.autoId = s.autoOn ? (int16_t)gAutoSel[gAutoIdx] : -1;
+    s.autoMark = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(gAutoLastSwitch.time_since_epoch()).count();
+    s.remaining = (uint32_t)remainingSeconds();
+    s.intervalSec = (uint32_t)gAutoIntervalMin * 60u;
+    if (s.autoOn){ std::string nm = favoriteName(s.autoId); s.setName(nm.data(), nm.size()); }
+    s.anim[Ws::LEADER] = (uint8_t)gLeaderAnimIndex; s.anim[Ws::FOLLOWER] = (uint8_t)gFollowerAnimIndex;
+    for (auto &kv : gLeaderParams) Anim::setParamField(s.params[Ws::LEADER], (uint8_t)kv.first, kv.second);
+    for (auto &kv : gFollowerParams) Anim::setParamField(s.params[Ws::FOLLOWER], (uint8_t)kv.first, kv.second);
+    return s;
+}
+
+// Page and web API on the HTTP workers (http_server.h); the simulated state is shared with
+// the push loop, so every request holds gSimMu
+static Http::Response route(const Http::Request &req){
+    static const std::string indexHtml = buildIndexHtml();
+    std::lock_guard<std::mutex> lock(gSimMu);
+    const std::string &method = req.method, &path = req.path, &body = req.body;
+    if(path=="/" || path=="/index.html"){
+        // Same artefact as the firmware: web_ui_gz.h with its ETag, plain page without gzip
+        static const std::string gz((const char *)INDEX_HTML_GZ, INDEX_HTML_GZ_LEN);
+        const std::string cache = std::string("ETag: ") + INDEX_HTML_ETAG + "\r\nCache-Control: no-cache\r\n";
+        if (req.header("If-None-Match") == INDEX_HTML_ETAG) return Http::reply(304, "text/html; charset=utf-8", "", cache);
+        else if (req.header("Accept-Encoding").find("gzip") != std::string::npos) return Http::reply(200, "text/html; charset=utf-8", gz, cache + "Content-Encoding: gzip\r\n");
+        else return Http::reply(200, "text/html; charset=utf-8", indexHtml, cache);
+    } else if(path=="/api/state"){
+        // Build dynamic state including auto flags and current params
+        advanceAutoIfNeeded();
+        auto serializeParams=[&](const std::unordered_map<int,float> &m){
+            std::ostringstream ps;
+            ps << "[";
+            bool first=true;
+            for (const auto &kv : m){
+                if (!first) ps << ",";
+                first=false;
+                ps << "{\"id\":"<< kv.first <<",\"value\":"<< kv.second <<"}";
+            }
+            // Ensure globals exist with defaults if missing
+            auto ensure=[&](int pid, float defv){
+                if (m.find(pid)==m.end()){
+                    if (!first) ps << ",";
+                    first=false;
+                    ps << "{\"id\":"<< pid <<",\"value\":"<< defv <<"}";
+                }
+            };
+            ensure((int)AnimSchema::PID_GLOBAL_SPEED, 1.0f);
+            ensure((int)AnimSchema::PID_GLOBAL_MIN,   0.0f);
+            ensure((int)AnimSchema::PID_GLOBAL_MAX,   1.0f);
+            ps << "]";
+            return ps.str();
+        };
+        std::ostringstream s;
+        s << "{";
+        s << "\"autoOn\":" << (gAutoOn?"true":"false") << ",";
+        s << "\"autoRemaining\":" << remainingSeconds() << ",";
+        s << "\"leader\":{\"animIndex\":"<< gLeaderAnimIndex << ",\"params\":"<< serializeParams(gLeaderParams) << "},";
+        s << "\"follower\":{\"animIndex\":"<< gFollowerAnimIndex << ",\"params\":"<< serializeParams(gFollowerParams) << "}";
+        s << "}";
+        return Http::reply(200, "application/json", s.str());
+    } else if(path=="/api/cfg2"){
+        // Stop Auto when manual config is applied and apply body
+        if (gAutoOn) {
+            gAutoOn = false;
+            std::cout << "[sim] Auto stopped due to cfg2" << std::endl;
+        }
+        applyCfg2FromBody(body);
+        return Http::reply(200, "application/json", "{\"ok\":true}");
+    } else if(path=="/api/globals" && method=="POST"){
+        // Apply only global params to both roles; do not stop Auto
+        initDefaultParams();
+        Json::Doc<> doc(body.data(), body.size());
+        doc.forEachParam(doc.is(0, Json::T_ARRAY) ? 0 : doc.get(0, "globals"), [&](uint8_t pid, float val){
+            if (pid== (int)AnimSchema::PID_GLOBAL_SPEED || pid==(int)AnimSchema::PID_GLOBAL_MIN || pid==(int)AnimSchema::PID_GLOBAL_MAX){
+                gLeaderParams[pid]=val;
+                gFollowerParams[pid]=val;
+            }
+        });
+        // Enforce max >= min on both
+        float lmin = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MIN];
+        float lmax = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX];
+        if (lmax < lmin) gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX] = lmin;
+        float fmin = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MIN];
+        float fmax = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX];
+        if (fmax < fmin) gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX] = fmin;
+        return Http::reply(200, "application/json", "{\"ok\":true}");
+    } else if(path=="/api/followers" && method=="GET"){
+        initFollowersSim();
+        uint32_t now = simNowMs();
+        std::ostringstream j;
+        j << "{\"frame\":" << gFollowers.roundFrame << ",\"pending\":" << (int)gFollowers.pendingCount()
+          << ",\"slotClashes\":" << (int)gFollowers.slotClashCount() << ",\"items\":[";
+        for (uint8_t i=0;i<gFollowers.count;i++){
+            const Fleet::Follower &f = gFollowers.nodes[i];
+            if (i) j << ",";
+            j << "{\"id\":" << (int)f.id << ",\"slot\":" << (int)Tdma::slotFor(f.id) << ",\"slotPeer\":" << (int)gFollowers.slotPeer(f)
+              << ",\"acked\":" << (gFollowers.isStale(f)?"false":"true")
+              << ",\"lastAckAgoMs\":" << (f.lastAckMs ? (long)(int32_t)(now - f.lastAckMs) : -1L)
+              << ",\"lastSeenAgoMs\":" << (long)(int32_t)(now - f.lastSeenMs)
+              << ",\"offsetErrMs\":" << f.offsetErrMs << ",\"rssi\":" << f.rssi << ",\"snr\":" << (int)f.snr
+              << ",\"retries\":" << (int)f.retries << "}";
+        }
+        j << "]}";
+        return Http::reply(200, "application/json", j.str());
+    } else if(path=="/api/favorites" && method=="GET"){
+        std::string json = buildFavoritesJson();
+        return Http::reply(200, "application/json", json);
+    } else if(path=="/api/favorites/add" && method=="POST"){
+        FavStore::Favorite f;
+        int32_t id = FavStore::fromJson(body.data(), body.size(), f) ? gFavCache.add(f) : -2;
+        if (id < 0){
+            return Http::reply(400, "application/json", id == -2 ? "{\"ok\":false,\"error\":\"bad json\"}" : "{\"ok\":false,\"error\":\"favorites full\"}");
+        } else {
+            std::ostringstream oss; oss << "{\"ok\":true,\"id\":" << id << "}";
+            return Http::reply(200, "application/json", oss.str());
+        }
+    } else if(path=="/api/favorites/delete" && method=="POST"){
+        // Parse {\"id\":n} from body
+        Json::Doc<8> doc(body.data(), body.size());
+        int id = (int)doc.integer(doc.get(0, "id"), -1);
+        if (id < 0 || id > FavStore::MAX_ID || !gFavCache.remove((uint16_t)id)){
+            return Http::reply(400, "application/json", "{\"ok\":false,\"error\":\"bad id\"}");
+        } else {
+            // Ids are stable: only the deleted one leaves the selections
+            if (!gAutoSel.empty()){
+                gAutoSel.erase(std::remove(gAutoSel.begin(), gAutoSel.end(), id), gAutoSel.end());
+                if (gAutoSel.empty()) { gAutoOn=false; gAutoIdx=-1; }
+                else if (gAutoIdx >= (int)gAutoSel.size()) gAutoIdx = (int)gAutoSel.size()-1;
+            }
+            return Http::reply(200, "application/json", "{\"ok\":true}");
+        }
+    } else if(path=="/api/auto/config" && method=="GET"){
+        advanceAutoIfNeeded();
+        // selections array reflects saved selection, not all favorites
+        std::ostringstream sel; sel<<"["; for(size_t i=0;i<gAutoSel.size();++i){ if(i) sel<<","; sel<<gAutoSel[i]; } sel<<"]";
+        int curId = -1; std::string curName="";
+        if (gAutoOn && gAutoIdx >= 0 && gAutoIdx < (int)gAutoSel.size()){
+            curId = gAutoSel[gAutoIdx];
+            curName = favoriteName(curId);
+        }
+        std::ostringstream j; j << "{\"on\":"<<(gAutoOn?"true":"false")
+                                 << ",\"interval\":"<< gAutoIntervalMin
+                                 << ",\"random\":"<<(gAutoRandom?"true":"false")
+                                 << ",\"selections\":"<<sel.str()
+                                 << ",\"current\":{\"name\":\""<<curName<<"\",\"id\":"<<curId<<",\"remaining\":"<< remainingSeconds() <<"}}";
+        return Http::reply(200, "application/json", j.str());
+    } else if(path=="/api/auto/settings" && method=="POST"){
+        Json::Doc<> doc(body.data(), body.size());
+        int ivMin = (int)doc.integer(doc.get(0, "interval"), gAutoIntervalMin);
+        if (ivMin < 1) ivMin = 1;
+        bool rnd = doc.boolean(doc.get(0, "random"), gAutoRandom);
+        std::vector<int> sels;
+        int sel = doc.get(0, "selections");
+        for (int i = doc.first(sel); i >= 0; i = doc.next(sel, i)) sels.push_back((int)doc.integer(i, 0));
+        gAutoIntervalMin = ivMin;
+        gAutoRandom = rnd;
+        gAutoSel = std::move(sels);
+        if (gAutoIdx >= (int)gAutoSel.size()) gAutoIdx = (int)gAutoSel.size()-1; // clamp
+        return Http::reply(200, "application/json", "{\"ok\":true}");
+    } else if(path=="/api/auto/start" && method=="POST"){
+        if (gAutoSel.empty()){
+            return Http::reply(400, "application/json", "{\"ok\":false,\"error\":\"no selections\"}");
+        } else {
+            gAutoOn = true;
+            if (gAutoRandom) {
+                seedRandOnce();
+                int count = (int)gAutoSel.size();
+                if (count <= 1) {
+                    gAutoIdx = 0;
+                } else {
+                    int prev = gAutoIdx;
+                    int newi = std::rand() % count;
+                    if (prev >= 0 && newi == prev) newi = (newi + 1) % count; // avoid immediate repeat
+                    gAutoIdx = newi;
+                }
+            } else {
+                if (gAutoIdx < 0 || gAutoIdx >= (int)gAutoSel.size()) gAutoIdx = 0;
+            }
+            gAutoLastSwitch = std::chrono::steady_clock::now();
+            applyFavoriteSim(gAutoSel[gAutoIdx]);
+            return Http::reply(200, "application/json", "{\"ok\":true}");
+        }
+    } else if(path=="/api/auto/stop" && method=="POST"){
+        gAutoOn = false;
+        return Http::reply(200, "application/json", "{\"ok\":true}");
+    } else {
+        return Http::reply(404, "text/plain", "Not found");
+    }
+}
+
+// Push sockets (ws_push.h, led_stream.h) on their own thread like the leader's loop
+class PushServer {
 public:
-    explicit SimpleHttpServer(int port):port_(port){}
+    explicit PushServer(int port):port_(port){}
     void start(){running_=true; thread_=std::thread([this]{run();});}
     void join(){ if(thread_.joinable()) thread_.join(); }
 private:
     int port_; std::thread thread_; std::atomic<bool> running_{false};
 
+    struct WsClient { int fd; std::vector<uint8_t> buf; LedStream::Subscription stream; LedStream::Outbox out; };
+    std::vector<WsClient> ws_;
+    uint32_t renderSeq_ = 0;
+    Ws::Snapshot wsLast_;
+    Ws::Message wsMsg_;
+
+    static int listenOn(int port){
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if(fd < 0){ perror("socket"); return -1; }
+        int opt=1; setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        sockaddr_in addr{}; addr.sin_family=AF_INET; addr.sin_addr.s_addr=htonl(INADDR_ANY); addr.sin_port=htons(port);
+        if(bind(fd, (sockaddr*)&addr, sizeof(addr))<0){ perror("bind"); close(fd); return -1; }
+        if(listen(fd, 8)<0){ perror("listen"); close(fd); return -1; }
+        return fd;
+    }
+
+    // Accept and read push sockets, stream LED frames, and compare state every WS_PUSH_MS
     void run(){
-        int server_fd = ::socket(AF_INET, SOCK_STREAM, 0);
-        if(server_fd < 0){ perror("socket"); return; }
-        int opt=1; setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
-        sockaddr_in addr{}; addr.sin_family=AF_INET; addr.sin_addr.s_addr=htonl(INADDR_ANY); addr.sin_port=htons(port_);
-        if(bind(server_fd, (sockaddr*)&addr, sizeof(addr))<0){ perror("bind"); close(server_fd); return; }
-        if(listen(server_fd, 8)<0){ perror("listen"); close(server_fd); return; }
-        std::cout << "Serving on http://localhost:"<<port_<<"\n";
-        const std::string indexHtml = buildIndexHtml();
+        int ws_fd = listenOn(port_);
+        if(ws_fd < 0) return;
+        wsLast_ = lockedSnapshot();
+        auto nextPush = std::chrono::steady_clock::now();
         while(running_){
-            sockaddr_in caddr; socklen_t clen=sizeof(caddr);
-            int cfd=accept(server_fd,(sockaddr*)&caddr,&clen);
-            if(cfd<0){ if(errno==EINTR) continue; perror("accept"); break; }
-            handleClient(cfd, indexHtml);
-            close(cfd);
+            std::vector<pollfd> fds = { { ws_fd, POLLIN, 0 } };
+            for (const WsClient &c : ws_) fds.push_back({ c.fd, POLLIN, 0 });
+            int timeout = WS_PUSH_MS;
+            for (const WsClient &c : ws_) if (c.stream.fps) { int32_t due = (int32_t)(c.stream.nextMs - simNowMs()); timeout = std::max(0, std::min(timeout, (int)due)); }
+            if(::poll(fds.data(), fds.size(), timeout) < 0){ if(errno==EINTR) continue; perror("poll"); break; }
+            if(fds[0].revents & POLLIN){ int cfd = accept(ws_fd, nullptr, nullptr); if(cfd>=0) wsAccept(cfd); }
+            for(size_t i = 1; i < fds.size(); ++i){
+                if(!fds[i].revents) continue;
+                WsClient &c = ws_[i - 1];
+                if(!wsRead(c)){ close(c.fd); c.fd = -1; }
+            }
+            wsDrop();
+            streamFrames();
+            wsDrop();
+            auto now = std::chrono::steady_clock::now();
+            if(now >= nextPush){
+                nextPush = now + std::chrono::milliseconds(WS_PUSH_MS);
+                Ws::Snapshot cur;
+                {
+                    std::lock_guard<std::mutex> lock(gSimMu);
+                    advanceAutoIfNeeded();
+                    cur = simSnapshot();
+                }
+                if(!ws_.empty() && Ws::buildPush(wsMsg_, &wsLast_, cur)){
+                    size_t n; const uint8_t *f = wsMsg_.frame(n);
+                    for(WsClient &c : ws_) if(!wsSend(c, f, n)){ close(c.fd); c.fd = -1; }
+                    wsDrop();
+                }
+                wsLast_ = cur;
+            }
         }
-        close(server_fd);
+        for(WsClient &c : ws_) close(c.fd);
+        close(ws_fd);
     }
 
-    static size_t findHeaderEnd(const std::string &req){
-        auto pos = req.find("\r\n\r\n");
-        if (pos == std::string::npos) return std::string::npos;
-        return pos + 4;
-    }
+    static Ws::Snapshot lockedSnapshot(){ std::lock_guard<std::mutex> lock(gSimMu); return simSnapshot(); }
 
-    static size_t parseContentLength(const std::string &req){
-        size_t pos = 0; size_t clen = 0;
-        while (true){
-            auto p = req.find("\r\n", pos);
-            if (p == std::string::npos) break;
-            auto line = req.substr(pos, p - pos);
-            if (line.empty()) break;
-            const std::string key = "Content-Length:";
-            if (line.size() >= key.size() && strncasecmp(line.c_str(), key.c_str(), key.size()) == 0){
-                std::istringstream iss(line.substr(key.size()));
-                iss >> clen; break;
-            }
-            pos = p + 2; // skip CRLF
+    void wsDrop(){ ws_.erase(std::remove_if(ws_.begin(), ws_.end(), [](const WsClient &c){ return c.fd < 0; }), ws_.end()); }
+
+    // Upgrade handshake, then the full state as the first message
+    void wsAccept(int fd){
+        std::string head; char buf[1024];
+        while(head.size() < 4096 && head.find("\r\n\r\n") == std::string::npos){
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if(n <= 0){ close(fd); return; }
+            head.append(buf, (size_t)n);
+        }
+        char resp[160];
+        size_t n = Ws::handshake(head.data(), head.size(), resp, sizeof(resp));
+        if(!n || ws_.size() >= WS_MAX_CLIENTS){
+            const char *no = n ? "HTTP/1.1 503 Service Unavailable\r\n\r\n" : "HTTP/1.1 400 Bad Request\r\n\r\n";
+            send(fd, no, strlen(no), MSG_NOSIGNAL); close(fd); return;
         }
-        return clen;
+        send(fd, resp, n, MSG_NOSIGNAL);
+        Ws::buildPush(wsMsg_, nullptr, lockedSnapshot());
+        size_t fl; const uint8_t *f = wsMsg_.frame(fl);
+        send(fd, f, fl, MSG_NOSIGNAL);
+        ws_.push_back({ fd, {}, LedStream::Subscription(), LedStream::Outbox() });
     }
 
-    static void handleClient(int fd, const std::string &indexHtml){
-        char buf[4096]; ssize_t n = recv(fd, buf, sizeof(buf)-1, 0); if(n<=0) return; buf[n]='\0';
-        std::string req(buf);
-        std::string method="GET"; std::string path="/";
-        {
-            std::istringstream iss(req); iss >> method >> path; // naive parse
+    // Blocking write for pushes, after whatever is left of a streamed frame
+    static bool wsSend(WsClient &c, const uint8_t *data, size_t n){
+        if(c.out.busy()){
+            size_t rest = c.out.len - c.out.off;
+            if(send(c.fd, c.out.buf + c.out.off, rest, MSG_NOSIGNAL) != (ssize_t)rest) return false;
+            c.out = LedStream::Outbox();
         }
+        return send(c.fd, data, n, MSG_NOSIGNAL) == (ssize_t)n;
+    }
+    static int trySend(void *u, const uint8_t *d, size_t n){
+        ssize_t r = send(static_cast<WsClient *>(u)->fd, d, n, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if(r < 0) return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+        return (int)r;
+    }
 
-        // If POST, read full body by Content-Length
-        std::string body;
-        if (method == "POST"){
-            size_t headerEnd = findHeaderEnd(req);
-            size_t clen = parseContentLength(req);
-            if (headerEnd != std::string::npos){
-                body = req.substr(headerEnd);
-                while (body.size() < clen){
-                    ssize_t m = recv(fd, buf, sizeof(buf), 0);
-                    if (m <= 0) break;
-                    body.append(buf, buf + m);
+    // LED frames for subscribed sockets, rendered from the simulated config like the leader's
+    // streamFrames (led_stream.h)
+    void streamFrames(){
+        uint32_t now = simNowMs();
+        bool any = false;
+        for(WsClient &c : ws_) any |= c.fd >= 0 && c.stream.fps && (int32_t)(now - c.stream.nextMs) >= 0;
+        if(!any) return;
+        Ws::Snapshot cfg = lockedSnapshot();
+        uint64_t tUs = (uint64_t)now * 1000u;
+        float frame[2][Anim::TOTAL_LEDS];
+        for(uint8_t role = 0; role < 2; ++role) Anim::applyAnim(cfg.anim[role], tUs, Anim::TOTAL_LEDS, cfg.params[role], frame[role]);
+        renderSeq_++;
+        for(WsClient &c : ws_){
+            if(c.fd < 0 || !c.stream.due(now)) continue;
+            for(uint8_t role = 0; role < 2 && c.fd >= 0; ++role){
+                if(!(c.stream.roles & (1u << role))) continue;
+                uint8_t msg[10 + LedStream::MAX_FRAME];
+                size_t h = Ws::frameHeader(Ws::OP_BINARY, LedStream::HEADER + Anim::TOTAL_LEDS, msg);
+                size_t n = LedStream::encode(msg + h, sizeof(msg) - h, role, renderSeq_, now, frame[role], Anim::TOTAL_LEDS);
+                switch(c.out.offer(msg, h + n, &trySend, &c)){
+                    case LedStream::Outbox::SENT: c.stream.sent++; break;
+                    case LedStream::Outbox::SKIPPED: c.stream.skipped++; break;
+                    case LedStream::Outbox::FAILED: close(c.fd); c.fd = -1; break;
                 }
-                if (body.size() > clen) body.resize(clen);
             }
         }
+    }
 
-        if(path=="/" || path=="/index.html"){
-            sendResponse(fd, 200, "text/html; charset=utf-8", indexHtml);
-        } else if(path=="/api/state"){
-            // Build dynamic state including auto flags and current params
-            advanceAutoIfNeeded();
-            auto serializeParams=[&](const std::unordered_map<int,float> &m){
-                std::ostringstream ps;
-                ps << "[";
-                bool first=true;
-                for (const auto &kv : m){
-                    if (!first) ps << ",";
-                    first=false;
-                    ps << "{\"id\":"<< kv.first <<",\"value\":"<< kv.second <<"}";
-                }
-                // Ensure globals exist with defaults if missing
-                auto ensure=[&](int pid, float defv){
-                    if (m.find(pid)==m.end()){
-                        if (!first) ps << ",";
-                        first=false;
-                        ps << "{\"id\":"<< pid <<",\"value\":"<< defv <<"}";
-                    }
-                };
-                ensure((int)AnimSchema::PID_GLOBAL_SPEED, 1.0f);
-                ensure((int)AnimSchema::PID_GLOBAL_MIN,   0.0f);
-                ensure((int)AnimSchema::PID_GLOBAL_MAX,   1.0f);
-                ps << "]";
-                return ps.str();
-            };
-            std::ostringstream s;
-            s << "{";
-            s << "\"autoOn\":" << (gAutoOn?"true":"false") << ",";
-            s << "\"autoRemaining\":" << remainingSeconds() << ",";
-            s << "\"leader\":{\"animIndex\":"<< gLeaderAnimIndex << ",\"params\":"<< serializeParams(gLeaderParams) << "},";
-            s << "\"follower\":{\"animIndex\":"<< gFollowerAnimIndex << ",\"params\":"<< serializeParams(gFollowerParams) << "}";
-            s << "}";
-            sendResponse(fd, 200, "application/json", s.str());
-        } else if(path=="/api/cfg2"){
-            // Stop Auto when manual config is applied and apply body
-            if (gAutoOn) {
-                gAutoOn = false;
-                std::cout << "[sim] Auto stopped due to cfg2" << std::endl;
-            }
-            applyCfg2FromBody(body);
-            sendResponse(fd, 200, "application/json", "{\"ok\":true}");
-        } else if(path=="/api/globals" && method=="POST"){
-            // Apply only global params to both roles; do not stop Auto
-            initDefaultParams();
-            auto lb = body.find('[');
-            auto rb = body.rfind(']');
-            if (lb != std::string::npos && rb != std::string::npos && rb > lb){
-                size_t pos = lb + 1; int safety = 0;
-                while (pos < rb && safety < 1024){
-                    auto idk = body.find("\"id\"", pos); if (idk==std::string::npos || idk>=rb) break;
-                    auto col = body.find(':', idk); if (col==std::string::npos || col>=rb) break; size_t is = col+1; while (is<rb && body[is]==' ') is++;
-                    size_t ie=is; while (ie<rb && std::isdigit((unsigned char)body[ie])) ie++;
-                    int pid = 0; try{ pid = std::stoi(body.substr(is, ie-is)); }catch(...){ pid=0; }
-                    auto vk = body.find("\"value\"", ie); if (vk==std::string::npos || vk>=rb){ pos = ie; safety++; continue; }
-                    col = body.find(':', vk); if (col==std::string::npos || col>=rb) break; size_t vs = col+1; while (vs<rb && body[vs]==' ') vs++;
-                    size_t ve=vs; while (ve<rb && (std::isdigit((unsigned char)body[ve])||body[ve]=='-'||body[ve]=='+'||body[ve]=='.'||body[ve]=='e'||body[ve]=='E')) ve++;
-                    float val = 0.0f; try{ val = std::stof(body.substr(vs, ve-vs)); }catch(...){ val=0.0f; }
-                    if (pid== (int)AnimSchema::PID_GLOBAL_SPEED || pid==(int)AnimSchema::PID_GLOBAL_MIN || pid==(int)AnimSchema::PID_GLOBAL_MAX){
-                        gLeaderParams[pid]=val;
-                        gFollowerParams[pid]=val;
-                    }
-                    pos = ve; safety++;
-                }
-                // Enforce max >= min on both
-                float lmin = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MIN];
-                float lmax = gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX];
-                if (lmax < lmin) gLeaderParams[(int)AnimSchema::PID_GLOBAL_MAX] = lmin;
-                float fmin = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MIN];
-                float fmax = gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX];
-                if (fmax < fmin) gFollowerParams[(int)AnimSchema::PID_GLOBAL_MAX] = fmin;
-            }
-            sendResponse(fd, 200, "application/json", "{\"ok\":true}");
-        } else if(path=="/api/favorites" && method=="GET"){
-            std::this_thread::sleep_for(std::chrono::seconds(1)); // simulate delay
-            std::string json = buildFavoritesJson();
-            sendResponse(fd, 200, "application/json", json);
-        } else if(path=="/api/favorites/add" && method=="POST"){
-            if (!body.empty()) gFavorites.push_back(body);
-            std::ostringstream oss; oss << "{\"ok\":true,\"id\":" << (gFavorites.size()? gFavorites.size()-1 : 0) << "}";
-            sendResponse(fd, 200, "application/json", oss.str());
-        } else if(path=="/api/favorites/delete" && method=="POST"){
-            // Parse {\"id\":n} from body
-            int id = -1;
-            if (!body.empty()){
-                auto pos = body.find("\"id\"");
-                if (pos != std::string::npos){
-                    pos = body.find(':', pos);
-                    if (pos != std::string::npos){
-                        ++pos;
-                        while (pos < body.size() && body[pos] == ' ') ++pos;
-                        size_t end = pos;
-                        while (end < body.size() && isdigit((unsigned char)body[end])) ++end;
-                        if (end > pos) {
-                            id = std::stoi(body.substr(pos, end - pos));
-                        }
-                    }
-                }
-            }
-            if (id < 0 || id >= (int)gFavorites.size()){
-                sendResponse(fd, 400, "application/json", "{\"ok\":false,\"error\":\"bad id\"}");
-            } else {
-                gFavorites.erase(gFavorites.begin() + id);
-                // Adjust selections: drop 'id' and shift higher indices down
-                if (!gAutoSel.empty()){
-                    std::vector<int> out; out.reserve(gAutoSel.size());
-                    for (int v : gAutoSel){ if (v == id) continue; out.push_back(v > id ? v-1 : v); }
-                    gAutoSel.swap(out);
-                    if (gAutoSel.empty()) { gAutoOn=false; gAutoIdx=-1; }
-                    else if (gAutoIdx >= (int)gAutoSel.size()) gAutoIdx = (int)gAutoSel.size()-1;
-                }
-                sendResponse(fd, 200, "application/json", "{\"ok\":true}");
-            }
-        } else if(path=="/api/auto/config" && method=="GET"){
-            advanceAutoIfNeeded();
-            // selections array reflects saved selection, not all favorites
-            std::ostringstream sel; sel<<"["; for(size_t i=0;i<gAutoSel.size();++i){ if(i) sel<<","; sel<<gAutoSel[i]; } sel<<"]";
-            int curId = -1; std::string curName="";
-            if (gAutoOn && gAutoIdx >= 0 && gAutoIdx < (int)gAutoSel.size()){
-                curId = gAutoSel[gAutoIdx];
-                if (curId >= 0 && curId < (int)gFavorites.size()) curName = extractNameFromJson(gFavorites[curId]);
+    // Client frames: pong to ping, stream subscriptions, false on close or a broken frame
+    static bool wsRead(WsClient &c){
+        uint8_t buf[512];
+        ssize_t n = recv(c.fd, buf, sizeof(buf), 0);
+        if(n <= 0) return false;
+        c.buf.insert(c.buf.end(), buf, buf + n);
+        Ws::Frame fr; size_t used;
+        while((used = Ws::parseFrame(c.buf.data(), c.buf.size(), fr)) != 0){
+            if(used == Ws::BAD_FRAME || fr.op == Ws::OP_CLOSE) return false;
+            if(fr.op == Ws::OP_PING){
+                uint8_t h[10]; size_t hl = Ws::frameHeader(Ws::OP_PONG, fr.len, h);
+                std::string pong((const char *)h, hl); pong.append((const char *)fr.payload, fr.len);
+                if(!wsSend(c, (const uint8_t *)pong.data(), pong.size())) return false;
             }
-            std::ostringstream j; j << "{\"on\":"<<(gAutoOn?"true":"false")
-                                     << ",\"interval\":"<< gAutoIntervalMin
-                                     << ",\"random\":"<<(gAutoRandom?"true":"false")
-                                     << ",\"selections\":"<<sel.str()
-                                     << ",\"current\":{\"name\":\""<<curName<<"\",\"id\":"<<curId<<",\"remaining\":"<< remainingSeconds() <<"}}";
-            sendResponse(fd, 200, "application/json", j.str());
-        } else if(path=="/api/auto/settings" && method=="POST"){
-            int ivMin = extractNum(body, "\"interval\"", gAutoIntervalMin);
-            if (ivMin < 1) ivMin = 1;
-            bool rnd = extractBool(body, "\"random\"", gAutoRandom);
-            auto sels = extractSelections(body);
-            gAutoIntervalMin = ivMin;
-            gAutoRandom = rnd;
-            gAutoSel = std::move(sels);
-            if (gAutoIdx >= (int)gAutoSel.size()) gAutoIdx = (int)gAutoSel.size()-1; // clamp
-            sendResponse(fd, 200, "application/json", "{\"ok\":true}");
-        } else if(path=="/api/auto/start" && method=="POST"){
-            if (gAutoSel.empty()){
-                sendResponse(fd, 400, "application/json", "{\"ok\":false,\"error\":\"no selections\"}");
-            } else {
-                gAutoOn = true;
-                if (gAutoRandom) {
-                    seedRandOnce();
-                    int count = (int)gAutoSel.size();
-                    if (count <= 1) {
-                        gAutoIdx = 0;
-                    } else {
-                        int prev = gAutoIdx;
-                        int newi = std::rand() % count;
-                        if (prev >= 0 && newi == prev) newi = (newi + 1) % count; // avoid immediate repeat
-                        gAutoIdx = newi;
-                    }
-                } else {
-                    if (gAutoIdx < 0 || gAutoIdx >= (int)gAutoSel.size()) gAutoIdx = 0;
+            if(fr.op == Ws::OP_TEXT && fr.fin){
+                Json::Doc<8> doc((const char *)fr.payload, fr.len);
+                if(doc.ok() && doc.get(0, "frames") >= 0){
+                    uint8_t fps = c.stream.subscribe(doc.integer(doc.get(0, "frames"), 0), doc.integer(doc.get(0, "roles"), LedStream::WANT_LEADER), simNowMs());
+                    char reply[64]; uint8_t hdr[10];
+                    int len = std::snprintf(reply, sizeof(reply), "{\"frames\":%u,\"roles\":%u,\"leds\":%u}", fps, c.stream.roles, (unsigned)Anim::TOTAL_LEDS);
+                    size_t hl = Ws::frameHeader(Ws::OP_TEXT, (size_t)len, hdr);
+                    if(!wsSend(c, hdr, hl) || !wsSend(c, (const uint8_t *)reply, (size_t)len)) return false;
                 }
-                gAutoLastSwitch = std::chrono::steady_clock::now();
-                applyFavoriteSim(gAutoSel[gAutoIdx]);
-                sendResponse(fd, 200, "application/json", "{\"ok\":true}");
             }
-        } else if(path=="/api/auto/stop" && method=="POST"){
-            gAutoOn = false;
-            sendResponse(fd, 200, "application/json", "{\"ok\":true}");
-        } else {
-            sendResponse(fd, 404, "text/plain", "Not found");
+            c.buf.erase(c.buf.begin(), c.buf.begin() + used);
         }
+        return c.buf.size() < 4096;
     }
 
-    static void sendResponse(int fd, int code, const std::string &ctype, const std::string &body){
-        std::ostringstream oss;
-        oss << "HTTP/1.1 "<<code<<" OK\r\n";
-        oss << "Content-Type: "<<ctype<<"\r\n";
-        oss << "Content-Length: "<< body.size() <<"\r\n";
-        oss << "Connection: close\r\n\r\n";
-        oss << body;
-        auto s=oss.str(); send(fd, s.data(), s.size(), 0);
-    }
 };
 
-int main(){
-    SimpleHttpServer srv(8080);
-    srv.start();
+static void usage(){
+    std::cout << "usage: test_ui [--port N] [--workers N] [--latency MS] [--jitter MS] [--rate BYTES_PER_MS] [--esp32]\n"
+                 "  --esp32  one worker and the leader's latency model (Http::Latency::esp32)\n";
+}
+
+int main(int argc, char **argv){
+    Http::Server::Options opt;
+    for (int i = 1; i < argc; ++i){
+        std::string a = argv[i];
+        const char *v = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (a == "--esp32") { opt.workers = 1; opt.latency = Http::Latency::esp32(); continue; }
+        if (!v) { usage(); return 2; }
+        if (a == "--port") opt.port = std::atoi(v);
+        else if (a == "--workers") opt.workers = (unsigned)std::max(1, std::atoi(v));
+        else if (a == "--latency") opt.latency.baseMs = (uint32_t)std::atoi(v);
+        else if (a == "--jitter") opt.latency.jitterMs = (uint32_t)std::atoi(v);
+        else if (a == "--rate") opt.latency.bytesPerMs = (uint32_t)std::atoi(v);
+        else { usage(); return 2; }
+        ++i;
+    }
+    Http::Server http(opt, route);
+    if (!http.start()) return 1;
+    PushServer push(opt.port + 1);
+    push.start();
+    std::cout << "Serving on http://localhost:" << http.port() << " (push on ws://localhost:" << opt.port + 1 << "/ws), "
+              << opt.workers << " worker(s), latency " << opt.latency.baseMs << "+" << opt.latency.jitterMs << " ms"
+              << (opt.latency.bytesPerMs ? ", " + std::to_string(opt.latency.bytesPerMs) + " B/ms" : std::string()) << std::endl;
     // Run until Ctrl+C
-    while(true) std::this_thread::sleep_for(std::chrono::seconds(10));
+    push.join();
     return 0;
 }
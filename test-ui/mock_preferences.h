@@ -0,0 +1,81 @@
+#pragma once
+// Host stand-in for the ESP32 Preferences (NVS) API, the subset the firmware uses, backed by
+// a map. Mirrors the device where it matters: keys longer than 15 characters are refused,
+// getBytes / getString return 0 when the value does not fit the buffer, and getString
+// counts the terminating NUL like nvs_get_str. Counts writes, erases and bytes moved so
+// tests can compare storage layouts by flash traffic.
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+
+class MockPreferences {
+public:
+  struct Stats { size_t writes = 0, erases = 0, reads = 0, bytesWritten = 0, bytesRead = 0; };
+  Stats stats;
+
+  bool begin(const char *, bool = false) { return true; }
+  void end() {}
+  bool isKey(const char *key) const { return _kv.count(key) != 0; }
+  bool remove(const char *key) { stats.erases++; return _kv.erase(key) != 0; }
+  bool clear() { _kv.clear(); return true; }
+
+  size_t putBytes(const char *key, const void *value, size_t len) { return put(key, std::string((const char *)value, len)) ? len : 0; }
+  size_t getBytesLength(const char *key) const { auto it = _kv.find(key); return it == _kv.end() ? 0 : it->second.size(); }
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    auto it = _kv.find(key);
+    if (it == _kv.end() || it->second.size() > maxLen) return 0;
+    read(it->second.size());
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+  size_t putString(const char *key, const char *value) { size_t n = strlen(value); return put(key, std::string(value, n + 1)) ? n : 0; }
+  size_t getString(const char *key, char *value, size_t maxLen) { return getBytes(key, value, maxLen); }
+  std::string getString(const char *key, const std::string &def = "") {
+    auto it = _kv.find(key);
+    if (it == _kv.end()) return def;
+    read(it->second.size());
+    return std::string(it->second.c_str());
+  }
+  size_t putUChar(const char *key, uint8_t v) { return putValue(key, v); }
+  uint8_t getUChar(const char *key, uint8_t def = 0) { return getValue(key, def); }
+  size_t putChar(const char *key, int8_t v) { return putValue(key, v); }
+  int8_t getChar(const char *key, int8_t def = 0) { return getValue(key, def); }
+  size_t putBool(const char *key, bool v) { return putValue(key, (uint8_t)v); }
+  bool getBool(const char *key, bool def = false) { return getValue(key, (uint8_t)def) != 0; }
+  size_t putUShort(const char *key, uint16_t v) { return putValue(key, v); }
+  uint16_t getUShort(const char *key, uint16_t def = 0) { return getValue(key, def); }
+  size_t putULong(const char *key, uint32_t v) { return putValue(key, v); }
+  uint32_t getULong(const char *key, uint32_t def = 0) { return getValue(key, def); }
+  size_t putFloat(const char *key, float v) { return putValue(key, v); }
+  float getFloat(const char *key, float def = 0.0f) { return getValue(key, def); }
+
+  size_t keys() const { return _kv.size(); }
+  // Bytes stored under keys starting with prefix
+  size_t bytesUnder(const char *prefix) const {
+    size_t n = 0, pl = strlen(prefix);
+    for (auto &kv : _kv) if (kv.first.compare(0, pl, prefix) == 0) n += kv.second.size();
+    return n;
+  }
+
+private:
+  bool put(const char *key, const std::string &v) {
+    if (strlen(key) > 15) return false;
+    _kv[key] = v;
+    stats.writes++; stats.bytesWritten += v.size();
+    return true;
+  }
+  void read(size_t n) { stats.reads++; stats.bytesRead += n; }
+  // Scalars stored as their bytes; a value of another size reads as missing
+  template<typename T> size_t putValue(const char *key, T v) { return put(key, std::string((const char *)&v, sizeof(v))) ? sizeof(v) : 0; }
+  template<typename T> T getValue(const char *key, T def) {
+    auto it = _kv.find(key);
+    if (it == _kv.end() || it->second.size() != sizeof(T)) return def;
+    read(sizeof(T));
+    T v;
+    memcpy(&v, it->second.data(), sizeof(T));
+    return v;
+  }
+
+  std::map<std::string, std::string> _kv;
+};
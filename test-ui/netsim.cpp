@@ -0,0 +1,889 @@
+// Host LoRa network simulator: one leader + N followers on a single shared channel.
+// Nodes mirror the leader/follower logic in LeaderFollower.ino and use the real packet
+// layouts (protocol.h), follower registry and TDMA slot math, so protocol changes can be
+// measured without hardware.
+//
+// Channel model: 1 ms steps, time-on-air from lora_airtime.h, any overlap destroys every
+// frame involved (no capture effect), half-duplex radios, optional i.i.d. packet loss.
+// Each node runs its loop() every kLoopMs with a random phase, like the firmware.
+// With batching on, a node's queued packets share one MSG_BATCH frame as in HeltecLoRa.
+// Every frame is sent on a LinkRate rung: only receivers tuned to it can decode it, only
+// frames on the same rung collide, and the leader<->follower link must clear the SX126x
+// SNR floor for that SF/BW (per-follower mean SNR plus per-packet fading).
+// CFG2 can go out as fec.h fragments (one frame each, never batched) or repeated copies.
+// With hops > 0 the fleet spreads over that many radio hops instead of a star: nodes hear
+// only the adjacent rings, collisions are judged at each receiver, and relay.h relays
+// carry the leader's broadcasts outwards.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../protocol.h"
+#include "../dyn_config.h"
+#include "../follower_registry.h"
+#include "../tdma.h"
+#include "../lora_airtime.h"
+#include "../link_rate.h"
+#include "../fec.h"
+#include "../relay.h"
+
+namespace {
+
+static constexpr uint32_t kLoopMs = 12; // loop(): render + setLEDs + delay(10)
+
+struct Rng {
+  uint64_t s;
+  explicit Rng(uint64_t seed) : s(seed * 0x9E3779B97F4A7C15ull + 1) {}
+  uint32_t next() { s ^= s << 13; s ^= s >> 7; s ^= s << 17; return (uint32_t)(s >> 16); }
+  double uniform() { return (next() & 0xFFFFFF) / 16777216.0; }
+  uint32_t range(uint32_t lo, uint32_t hi) { return lo + next() % (hi - lo + 1); }
+};
+
+struct SimConfig {
+  int followers{50};
+  bool tdma{true};
+  bool lbt{false};
+  double loss{0.0};
+  bool join{true};          // REQ carries config hash, leader answers with JOIN; false = bare REQ/SYNC
+  bool syncHash{true};      // SYNC carries the follower-config hash (self-heal after a missed CFG2)
+  int32_t cfgChangeAtMs{-1};// leader changes the follower config once (single CFG2), -1 = no
+  uint32_t cfgEveryMs{0};   // leader CFG2 broadcast period (auto mode), 0 = never
+  uint8_t cfgCopies{1};     // plain retransmission: each CFG2 is sent this many times
+  bool cfgBurst{false};     // each CFG2 goes out behind a broadcast SYNC and a BRIGHTNESS (UI push)
+  uint8_t fecK{0}, fecM{0}; // CFG_FEC_K / CFG_FEC_M: CFG2 as k data + m parity fragments, 0 = off
+  int hops{0};              // 0 = star; N = followers on rings 1..N, ring k hears only k-1..k+1
+  int relaysPerHop{2};      // LORA_RELAY followers on each ring but the outermost (hops > 0)
+  bool relayCorrect{true};  // relays advance the SYNC clock by their hold time + inbound airtime
+  int32_t rejoinAtMs{-1};   // power-cycle follower 1 at this time, -1 = no
+  bool softReset{false};    // that reboot is a software/watchdog reset (Node::soloRestart)
+  uint32_t batchMs{0};      // LORA_BATCH_MS: pack packets queued this long / while busy into one frame
+  bool adr{false};          // LORA_ADR: leader adapts the fleet rate from follower SNR
+  double snrLoDb{10}, snrHiDb{10}; // follower link SNR at 125 kHz, uniform in [lo, hi]
+  double fadeDb{0};         // per-packet SNR jitter (std dev)
+  int32_t dropAtMs{-1};     // follower 1's link loses dropDb at this time, -1 = no
+  double dropDb{0};
+  bool fullRun{false};      // run for durationMs even after everyone is confirmed
+  uint32_t durationMs{120000};
+  uint64_t seed{1};
+};
+
+struct SimResult {
+  uint32_t frames{0}, collided{0}, lost{0};
+  uint32_t airtimeMs{0};
+  uint32_t syncTx{0}, ackTx{0}, reqTx{0}, joinTx{0}, cfgTx{0};
+  uint32_t packets{0}, batches{0}; // packets handed to the radio, MSG_BATCH frames sent
+  uint32_t weak{0};                // frames lost below the SNR floor
+  uint32_t rounds{0}, roundMs{0};  // closed leader rounds and their summed SYNC -> closed time
+  uint32_t rateUps{0}, rateDowns{0};
+  uint8_t finalRate{LinkRate::kDefault};
+  int reachedEnd{0};               // followers that ACKed in the last 2 sync intervals
+  int32_t allSyncedMs{-1};    // every follower has received a SYNC
+  int32_t allConfirmedMs{-1}; // leader registry holds an ACK from every follower
+  int32_t allCorrectMs{-1};   // every follower synced and rendering the leader's config
+  int32_t rejoinMs{-1};       // power-cycled follower: reboot -> synced with correct config
+  int32_t healMs{-1};         // config change -> every follower rendering the new config
+  uint32_t cfgAirMs{0};       // airtime of config traffic: CFG2, FEC fragments, REQ, JOIN
+  uint32_t healAirMs{0}, healCfgAirMs{0}; // airtime (all / config traffic) from change to healMs
+  int pushOk{0};              // followers on the new config 2 s after the change
+  static constexpr int kRings = 4;
+  int ringCount[kRings + 1]{}, ringSynced[kRings + 1]{}, ringCorrect[kRings + 1]{};
+  double ringErrSum[kRings + 1]{}; int ringErrN[kRings + 1]{}, ringErrMax[kRings + 1]{}; // |clock error| samples, ms
+  uint32_t relayed{0}, dupes{0}, relayAnswers{0};
+};
+
+struct Airframe {
+  int src;
+  uint8_t rate;
+  uint32_t startMs, endMs;
+  std::vector<uint8_t> bytes;
+  bool collided{false};
+  std::vector<int> overlap; // sources of frames that overlapped this one
+};
+
+class Channel;
+
+struct SimNode {
+  int index{0};
+  uint32_t bootMs{0};
+  uint32_t phase{0};
+  uint32_t txUntil{0};
+  uint8_t rate{LinkRate::kDefault}; // rung the radio is tuned to
+  double snrDb{10};                 // follower: link SNR to the leader at 125 kHz
+  int ring{0};                      // hops > 0: distance from the leader in radio hops
+  struct RxFrame { std::vector<uint8_t> bytes; int8_t snr; uint32_t airMs; };
+  std::vector<RxFrame> rxQueue;     // delivered frames waiting for the next poll()
+  virtual ~SimNode() {}
+  virtual void loop(uint32_t now, Channel &ch) = 0;
+  bool transmitting(uint32_t now) const { return (int32_t)(txUntil - now) > 0; }
+};
+
+class Channel {
+ public:
+  Channel(SimResult &res, Rng &rng, double loss, double fadeDb, int hops)
+    : res_(res), rng_(rng), loss_(loss), fadeDb_(fadeDb), hops_(hops) {}
+
+  // Star: followers only listen to the leader and vice versa. Rings: neighbours only.
+  bool hears(const SimNode &a, const SimNode &b) const {
+    if (!hops_) return a.index == 0 || b.index == 0;
+    return std::abs(a.ring - b.ring) <= 1;
+  }
+
+  bool busy(uint32_t now, uint8_t rate) const {
+    for (const Airframe &f : air_) if (f.rate == rate && f.startMs < now && now < f.endMs) return true;
+    return false;
+  }
+
+  void send(SimNode &src, const uint8_t *data, uint8_t len, uint32_t now) {
+    Airframe f; f.src = src.index; f.rate = src.rate; f.startMs = now; f.endMs = now + LoraPhy::airtimeMs(len, LinkRate::modem(src.rate));
+    f.bytes.assign(data, data + len);
+    for (Airframe &o : air_) if (o.rate == f.rate && o.endMs > f.startMs) {
+      o.collided = true; f.collided = true; o.overlap.push_back(f.src); f.overlap.push_back(o.src);
+    }
+    src.txUntil = f.endMs;
+    res_.frames++; res_.airtimeMs += f.endMs - f.startMs;
+    uint8_t t = data[0];
+    if (t == Proto::MSG_CFG2 || t == Proto::MSG_FEC || t == Proto::MSG_REQ || t == Proto::MSG_JOIN) res_.cfgAirMs += f.endMs - f.startMs;
+    air_.push_back(f);
+  }
+
+  void deliver(uint32_t now, std::vector<SimNode*> &nodes) {
+    for (size_t i = 0; i < air_.size();) {
+      Airframe &f = air_[i];
+      if (f.endMs > now) { ++i; continue; }
+      if (f.collided) res_.collided++;
+      uint32_t airMs = f.endMs - f.startMs;
+      for (SimNode *n : nodes) {
+        if (n->index == f.src || now < n->bootMs || !hears(*n, *nodes[f.src])) continue;
+        // Half-duplex: a node that keyed up during the frame missed it; other rungs are noise
+        if ((int32_t)(n->txUntil - f.startMs) > 0 || n->rate != f.rate) continue;
+        // Star: any overlap destroys the frame. Rings: only overlaps this receiver can hear.
+        if (f.collided && (!hops_ || std::any_of(f.overlap.begin(), f.overlap.end(), [&](int o){ return o == n->index || hears(*n, *nodes[o]); }))) continue;
+        const LoraPhy::Modem &m = LinkRate::modem(f.rate);
+        double snr = (f.src ? nodes[f.src]->snrDb : n->snrDb) - LinkRate::bwPenaltyQ4(m.bwHz) / 4.0 + fade();
+        if (snr * 4.0 < LinkRate::floorQ4(m.sf)) { res_.weak++; continue; }
+        if (loss_ > 0.0 && rng_.uniform() < loss_) { res_.lost++; continue; }
+        int8_t q = (int8_t)std::max(-32.0, std::min(12.0, snr)); // SX126x reports whole dB, saturating
+        if (f.bytes[0] != Proto::MSG_BATCH) { n->rxQueue.push_back({f.bytes, q, airMs}); continue; }
+        // HeltecLoRa::poll() yields the records one by one
+        for (size_t p = 1; p < f.bytes.size() && f.bytes[p] && p + 1 + f.bytes[p] <= f.bytes.size(); p += 1 + f.bytes[p])
+          n->rxQueue.push_back({std::vector<uint8_t>(f.bytes.begin() + p + 1, f.bytes.begin() + p + 1 + f.bytes[p]), q, airMs});
+      }
+      air_.erase(air_.begin() + i);
+    }
+  }
+
+ private:
+  std::vector<Airframe> air_;
+  SimResult &res_;
+  Rng &rng_;
+  double loss_, fadeDb_;
+  int hops_;
+  // Irwin-Hall approximation of a normal deviate
+  double fade() { return fadeDb_ > 0 ? (rng_.uniform() + rng_.uniform() + rng_.uniform() + rng_.uniform() - 2.0) * 1.732 * fadeDb_ : 0.0; }
+};
+
+// Transmit path shared by both roles: optional CAD listen-before-talk and MSG_BATCH
+// aggregation, as in HeltecLoRa
+struct Radio {
+  struct Pending { std::vector<uint8_t> bytes; uint32_t at; uint8_t rate; };
+  std::vector<Pending> queue;
+  uint32_t cadAt{0};
+  uint8_t cadTries{0};
+  uint8_t queueRate{LinkRate::kDefault}; // setRate(): rung for packets queued from now on
+  bool sequence{false};                  // leader with LORA_RELAY: relay header on broadcasts
+  uint16_t seq{0};
+
+  void send(const void *p, uint8_t len, uint32_t now) {
+    Pending q; q.bytes.assign((const uint8_t*)p, (const uint8_t*)p + len); q.at = now; q.rate = queueRate;
+    if (sequence && Relay::forwardable((const uint8_t*)p, len)) { // HeltecLoRa::sequence
+      uint8_t buf[Proto::BATCH_MAX_BYTES];
+      if (++seq == 0) seq = 1;
+      q.bytes.assign(buf, buf + Relay::wrap((const uint8_t*)p, len, 0, seq, buf, sizeof(buf)));
+    }
+    if (queue.empty()) { cadAt = now; cadTries = 0; }
+    queue.push_back(q);
+  }
+  void service(SimNode &self, Channel &ch, const SimConfig &cfg, Rng &rng, SimResult &res, uint32_t now) {
+    if (self.transmitting(now)) return;
+    self.rate = queue.empty() ? queueRate : queue.front().rate; // retune between frames
+    if (queue.empty() || (int32_t)(now - cadAt) < 0) return;
+    bool urgent = std::any_of(queue.begin(), queue.end(), [](const Pending &q){ return q.bytes[0] == Proto::MSG_ACK; });
+    if (cfg.batchMs && !urgent && now - queue.front().at < cfg.batchMs) return;
+    if (cfg.lbt && ch.busy(now, self.rate) && ++cadTries < 4) { cadAt = now + rng.range(10, 60); return; }
+    size_t n = 1;
+    std::vector<uint8_t> frame(1, Proto::MSG_BATCH);
+    if (cfg.batchMs) {
+      for (n = 0; n < queue.size() && n < Proto::BATCH_MAX_RECORDS; ++n) {
+        std::vector<uint8_t> &b = queue[n].bytes;
+        if (frame.size() + 1 + b.size() > Proto::BATCH_MAX_BYTES || queue[n].rate != self.rate) break;
+        if (b[0] == Proto::MSG_FEC || (b[0] == Proto::MSG_RELAY && b[Relay::kHeaderBytes] == Proto::MSG_FEC)) break; // lost independently
+        Relay::addTime(b.data(), (uint8_t)b.size(), now - queue[n].at); // flushBatch() restamps the leader clock
+        frame.push_back((uint8_t)b.size()); frame.insert(frame.end(), b.begin(), b.end());
+      }
+      if (n == 0) n = 1; // oversized packet goes out alone
+    }
+    if (n == 1) ch.send(self, queue.front().bytes.data(), (uint8_t)queue.front().bytes.size(), now);
+    else { ch.send(self, frame.data(), (uint8_t)frame.size(), now); res.batches++; }
+    res.packets += (uint32_t)n;
+    queue.erase(queue.begin(), queue.begin() + n);
+    cadTries = 0; cadAt = now;
+  }
+};
+
+// Follower config the leader distributes (non-default so a fresh node is visibly wrong)
+struct FleetConfig {
+  uint8_t animIndex{3};
+  Anim::ParamSet ps;
+  uint16_t h;
+  FleetConfig() { ps.speed = 5.0f; ps.width = 2; ps.globalMax = 0.6f; h = DynCfg::configHash(animIndex, ps); }
+  uint16_t hash() const { return h; }
+  void change() { animIndex = 5; ps.speed = 2.0f; ps.minSparkles = 4; h = DynCfg::configHash(animIndex, ps); }
+};
+
+static uint8_t encodeFleetCfg(const FleetConfig &fc, DynCfg::ParamValue *pv) {
+  for (uint8_t i = 0; i < AnimSchema::PARAM_COUNT; ++i) pv[i] = { AnimSchema::PARAM_IDS[i], Anim::getParamField(fc.ps, AnimSchema::PARAM_IDS[i]) };
+  return AnimSchema::PARAM_COUNT;
+}
+
+struct SimLeader : SimNode {
+  const SimConfig &cfg; Rng &rng; SimResult &res;
+  Radio radio;
+  Fleet::Registry followers;
+  FleetConfig fleetCfg;
+  uint32_t lastSyncSent{0};
+  bool lastSyncTargeted{false};
+  uint32_t slotWindowEndMs{0};
+  uint32_t ackTimeout;
+  uint32_t syncInterval{60000};
+  uint32_t lastCfgMs{0};
+  uint8_t fecMsgId{0};
+  LinkRate::Controller rateCtl;
+  uint32_t rateRoundFrame{0}, rateResyncAtMs{0}, roundStartMs{0};
+
+  SimLeader(const SimConfig &c, Rng &r, SimResult &s)
+    : cfg(c), rng(r), res(s), ackTimeout(c.tdma ? Tdma::kResponseWindowMs : 2000) { radio.sequence = c.hops > 0; }
+
+  void sendSync(uint32_t now, uint32_t frame, uint8_t target) {
+    Proto::SyncPacket p; p.time_ms = now; p.frame = frame; p.target = target; p.cfgHash = cfg.syncHash ? fleetCfg.hash() : 0;
+    radio.send(&p, sizeof(p), now); res.syncTx++;
+  }
+
+  void sendJoin(uint32_t now, uint32_t frame, uint8_t target) {
+    DynCfg::ParamValue pv[AnimSchema::PARAM_COUNT]; uint8_t buf[64];
+    uint8_t len = DynCfg::encodeJoin(now, frame, target, fleetCfg.animIndex, pv, encodeFleetCfg(fleetCfg, pv), buf, sizeof(buf));
+    radio.send(buf, len, now); res.syncTx++; res.joinTx++;
+  }
+
+  // Node::answerFollower
+  void answerFollower(const Fleet::Follower *f, uint32_t now) {
+    uint8_t target = f ? f->id : Proto::NODE_BROADCAST;
+    if (cfg.join && f && f->cfgHash && f->cfgHash != fleetCfg.hash()) {
+      sendJoin(now, followers.roundFrame, target);
+    } else {
+      sendSync(now, followers.roundFrame, target);
+    }
+    lastSyncSent = now; lastSyncTargeted = (f != nullptr);
+  }
+
+  // Node::adaptRate
+  void adaptRate(uint32_t now) {
+    uint8_t r = rateCtl.onRoundDone(followers, now);
+    if (r == rateCtl.rate) return;
+    if (r > rateCtl.rate) res.rateUps++; else res.rateDowns++;
+    Proto::RatePacket p; p.rate = r;
+    radio.send(&p, sizeof(p), now);
+    rateResyncAtMs = now + LoraPhy::airtimeMs(sizeof(p), LinkRate::modem(rateCtl.rate)) + LinkRate::kSettleMs;
+    rateCtl.apply(r);
+    radio.queueRate = r;
+    if (cfg.tdma) ackTimeout = Tdma::responseWindowMs(LinkRate::modem(r));
+  }
+
+  void loop(uint32_t now, Channel &ch) override {
+    for (auto &rx : rxQueue) {
+      const std::vector<uint8_t> &b = rx.bytes;
+      int16_t snrQ4 = LinkRate::refSnrQ4(rx.snr, rate);
+      if (b[0] == Proto::MSG_ACK && b.size() >= sizeof(Proto::AckPacket)) {
+        Proto::AckPacket a; memcpy(&a, b.data(), sizeof(a));
+        followers.onAck(a.node, a.frame, a.offsetErrMs, now, -80, rx.snr);
+        followers.noteSnr(a.node, snrQ4);
+      } else if (b[0] == Proto::MSG_REQ && b.size() >= Proto::REQ_LEGACY_SIZE) {
+        Proto::ReqPacket q; memcpy(&q, b.data(), std::min(b.size(), sizeof(q)));
+        if (lastSyncSent == 0) followers.beginRound(now / 33);
+        Fleet::Follower *f = followers.onReq(q.node, now, -80, rx.snr);
+        if (f) { f->cfgHash = (b.size() >= sizeof(q)) ? q.cfgHash : 0; followers.noteSnr(f->id, snrQ4); }
+        if (!cfg.tdma || (int32_t)(now - slotWindowEndMs) >= 0) answerFollower(f, now);
+      }
+    }
+    rxQueue.clear();
+    // Config changes (auto mode steps / UI edits) are broadcast as CFG2, fire-and-forget
+    bool changed = cfg.cfgChangeAtMs >= 0 && (int32_t)now >= cfg.cfgChangeAtMs && (int32_t)lastCfgMs < cfg.cfgChangeAtMs;
+    if (changed) fleetCfg.change();
+    if (changed || (cfg.cfgEveryMs && now - lastCfgMs >= cfg.cfgEveryMs)) {
+      DynCfg::ParamValue pv[AnimSchema::PARAM_COUNT]; uint8_t buf[64];
+      uint8_t len = DynCfg::encodeCfg2(1, fleetCfg.animIndex, pv, encodeFleetCfg(fleetCfg, pv), nullptr, 0, buf, sizeof(buf));
+      if (cfg.cfgBurst) {
+        sendSync(now, followers.roundFrame, Proto::NODE_BROADCAST);
+        Proto::BrightnessPacket b; b.percent = 50;
+        radio.send(&b, sizeof(b), now);
+      }
+      if (cfg.fecK) { // HeltecLoRa::sendFec
+        uint8_t frag[Proto::BATCH_MAX_BYTES];
+        for (uint8_t i = 0; i < cfg.fecK + cfg.fecM; ++i)
+          radio.send(frag, Fec::encodeFragment(buf, len, cfg.fecK, cfg.fecM, fecMsgId, i, frag, sizeof(frag)), now);
+        fecMsgId++;
+      } else {
+        for (uint8_t i = 0; i < cfg.cfgCopies; ++i) radio.send(buf, len, now);
+      }
+      res.cfgTx++;
+      lastCfgMs = now;
+    }
+    if (!followers.roundOpen) {
+      if (lastSyncSent != 0 && followers.roundFrame != rateRoundFrame) {
+        rateRoundFrame = followers.roundFrame;
+        res.rounds++; res.roundMs += now - roundStartMs;
+        if (cfg.adr) adaptRate(now);
+      }
+      bool discover = followers.grewThisRound() && (int32_t)(now - slotWindowEndMs) >= 0;
+      bool resync = rateResyncAtMs && (int32_t)(now - rateResyncAtMs) >= 0;
+      if (lastSyncSent == 0 || now - lastSyncSent > syncInterval || discover || resync) {
+        // Node::broadcastRound: boot and discovery rounds carry the config
+        uint32_t frame = now / 33;
+        if (cfg.join && (lastSyncSent == 0 || discover)) sendJoin(now, frame, Proto::NODE_BROADCAST);
+        else sendSync(now, frame, Proto::NODE_BROADCAST);
+        lastSyncSent = now; lastSyncTargeted = false; rateResyncAtMs = 0; roundStartMs = now;
+        slotWindowEndMs = now + Tdma::responseWindowMs(LinkRate::modem(rateCtl.rate));
+        followers.beginRound(frame);
+      }
+    } else if (now - lastSyncSent > (lastSyncTargeted && cfg.tdma ? Tdma::targetedWindowMs(LinkRate::modem(rateCtl.rate)) : ackTimeout)) {
+      // Node::tick: several stale nodes get one broadcast resend, answered in their slots
+      uint8_t stale = followers.retryableCount();
+      if (cfg.tdma && stale > 1 && stale * Tdma::targetedWindowMs(LinkRate::modem(rateCtl.rate)) > ackTimeout &&
+          !followers.anyNeedsConfig(fleetCfg.hash()) && followers.retryAll()) {
+        answerFollower(nullptr, now); slotWindowEndMs = now + ackTimeout;
+      } else if (Fleet::Follower *f = followers.nextRetryTarget()) answerFollower(f, now);
+      else { lastSyncSent = now; lastSyncTargeted = false; }
+    }
+    radio.service(*this, ch, cfg, rng, res, now);
+  }
+};
+
+struct SimFollower : SimNode {
+  const SimConfig &cfg; Rng &rng; SimResult &res;
+  Radio radio;
+  uint8_t nodeId;
+  int32_t timeOffsetMs{0};
+  uint32_t lastSyncRecvMs{0};
+  uint32_t lastReqSentMs{0};
+  uint32_t reqDueMs{0};
+  uint8_t reqAttempt{0};
+  bool soloRestart{false};
+  bool cfgKnown{false};
+  bool ackQueued{false};
+  uint32_t ackDueMs{0}, ackFrame{0};
+  int16_t ackErrMs{0};
+  uint8_t animIndex{1};
+  Anim::ParamSet ps;
+  uint16_t hash{DynCfg::configHash(1, Anim::ParamSet())};
+  uint32_t lastLeaderMs{0}, rateSinceMs{0};
+  Fec::Assembler fec;
+  bool relay{false};
+  uint32_t syncFrame{0};
+  Relay::Seen seen;
+  Relay::Queue fwd;
+  uint8_t relayReqNode{0};
+  uint16_t relayReqHash{0};
+  uint32_t relayReqDueMs{0};
+
+  SimFollower(const SimConfig &c, Rng &r, SimResult &s, uint8_t id)
+    : cfg(c), rng(r), res(s), nodeId(id) {}
+
+  // Firmware: once synced a REQ retry waits for this node's slot on the leader's grid
+  uint32_t reqSlot(uint32_t t) const {
+    return cfg.tdma && lastSyncRecvMs ? Tdma::nextSlotStart(t, timeOffsetMs, nodeId, LinkRate::modem(radio.queueRate)) : t;
+  }
+
+  // Power cycle (soft: software/watchdog reset): everything but the id is lost
+  void reboot(uint32_t now, bool soft) {
+    soloRestart = soft;
+    radio = Radio(); rxQueue.clear(); txUntil = 0; bootMs = now; rate = LinkRate::kDefault; lastLeaderMs = rateSinceMs = 0;
+    timeOffsetMs = 0; lastSyncRecvMs = 0; lastReqSentMs = 0; reqDueMs = 0; reqAttempt = 0; cfgKnown = false;
+    ackQueued = false; animIndex = 1; ps = Anim::ParamSet(); hash = DynCfg::configHash(animIndex, ps); fec = Fec::Assembler();
+    seen = Relay::Seen(); fwd = Relay::Queue(); relayReqNode = 0;
+  }
+
+  // local millis() counts from this node's boot
+  uint32_t millisLocal(uint32_t now) const { return (uint32_t)((int32_t)(now - bootMs) + 1); }
+
+  void applyCfg(uint8_t anim, const DynCfg::ParamValue *pv, uint8_t n) {
+    animIndex = anim; cfgKnown = true;
+    for (uint8_t i = 0; i < n; ++i) Anim::setParamField(ps, pv[i].id, pv[i].value);
+    hash = DynCfg::configHash(animIndex, ps);
+  }
+
+  void applySync(uint32_t local, uint32_t time_ms, uint32_t frame, uint8_t target, bool plainSync, uint16_t leaderHash, uint8_t hops) {
+    bool firstSync = (lastSyncRecvMs == 0);
+    if (firstSync) reqDueMs = 0;
+    lastSyncRecvMs = local; syncFrame = frame;
+    if (plainSync && leaderHash) {
+      bool match = (leaderHash == hash);
+      if (cfgKnown && !match) { reqAttempt = 0; reqDueMs = 0; }
+      cfgKnown = match;
+    } else if (plainSync && target == nodeId) {
+      cfgKnown = true;
+    }
+    int32_t newOffset = (int32_t)time_ms - (int32_t)local;
+    int32_t diff = newOffset - timeOffsetMs;
+    if (hops == 0 && (target == Proto::NODE_BROADCAST || target == nodeId || firstSync)) {
+      ackQueued = true; ackFrame = frame;
+      ackErrMs = (int16_t)std::max(-32768, std::min(32767, diff));
+      ackDueMs = local + (cfg.tdma ? Tdma::ackDelayMs(nodeId, target == nodeId, LinkRate::modem(radio.queueRate)) : 0);
+    }
+    int32_t adiff = diff < 0 ? -diff : diff;
+    if (adiff > 100) timeOffsetMs = (adiff < 200) ? timeOffsetMs + diff / 2 : newOffset;
+  }
+
+  void loop(uint32_t now, Channel &ch) override {
+    uint32_t local = millisLocal(now);
+    for (auto &rx : rxQueue) {
+      const uint8_t *b = rx.bytes.data(); uint8_t len = (uint8_t)rx.bytes.size(), hops = 0;
+      DynCfg::ParamValue pv[16], gv[8]; uint8_t role, anim, pc, gc;
+      if (b[0] == Proto::MSG_RELAY) { // HeltecLoRa::parse
+        Proto::RelayHeader h; const uint8_t *in; uint8_t inLen;
+        if (!Relay::unwrap(b, len, h, in, inLen)) continue;
+        if (!seen.fresh(h.seq)) { res.dupes++; fwd.cancel(h.seq, h.hops); continue; }
+        if (relay && h.hops + 2 <= Relay::kMaxHops && Relay::forwardable(in, inLen))
+          fwd.push(b, len, local, Relay::forwardDelayMs(in, h.hops, LinkRate::modem(rate), rng.next()), rx.airMs);
+        b = in; len = inLen; hops = h.hops;
+      }
+      if (b[0] == Proto::MSG_ACK || b[0] == Proto::MSG_REQ) { // another follower (rings only)
+        if (relay && b[0] == Proto::MSG_REQ && len >= sizeof(Proto::ReqPacket) && !relayReqNode) { // Node::onRelayReq
+          Proto::ReqPacket q; memcpy(&q, b, sizeof(q));
+          relayReqNode = q.node; relayReqHash = q.cfgHash;
+          relayReqDueMs = local + Relay::answerDelayMs(LinkRate::modem(rate), rng.next());
+        }
+        continue;
+      }
+      lastLeaderMs = local;
+      if (b[0] == Proto::MSG_RATE && len >= sizeof(Proto::RatePacket)) {
+        radio.queueRate = b[1] < LinkRate::kCount ? b[1] : LinkRate::kDefault; rateSinceMs = local;
+      } else if (b[0] == Proto::MSG_SYNC && len >= sizeof(Proto::SyncPacket)) {
+        Proto::SyncPacket p; memcpy(&p, b, sizeof(p));
+        if (relayReqNode && p.target == relayReqNode) relayReqNode = 0;
+        applySync(local, p.time_ms, p.frame, p.target, true, p.cfgHash, hops);
+      } else if (b[0] == Proto::MSG_JOIN) {
+        Proto::JoinHeader h;
+        if (!DynCfg::decodeJoin(b, len, h, role, anim, pv, pc, gv, gc)) continue;
+        if (relayReqNode && h.target == relayReqNode) relayReqNode = 0;
+        applyCfg(anim, pv, pc);
+        applySync(local, h.time_ms, h.frame, h.target, false, 0, hops);
+      } else if (b[0] == Proto::MSG_CFG2) {
+        if (DynCfg::decodeCfg2(b, len, role, anim, pv, pc, gv, gc)) applyCfg(anim, pv, pc);
+      } else if (b[0] == Proto::MSG_FEC) {
+        uint8_t buf[Fec::kMaxMsgBytes];
+        uint8_t n = fec.add(b, len, buf);
+        if (n && buf[0] == Proto::MSG_CFG2 && DynCfg::decodeCfg2(buf, n, role, anim, pv, pc, gv, gc)) applyCfg(anim, pv, pc);
+      }
+    }
+    rxQueue.clear();
+    uint8_t out[Proto::BATCH_MAX_BYTES];
+    while (uint8_t n = fwd.pop(local, out, cfg.relayCorrect)) { radio.send(out, n, now); res.relayed++; }
+    if (relayReqNode && (int32_t)(local - relayReqDueMs) >= 0) { // Node::tickRelay
+      uint8_t target = relayReqNode; relayReqNode = 0;
+      if (lastSyncRecvMs != 0 && cfgKnown) {
+        uint32_t leaderNow = (uint32_t)((int32_t)local + timeOffsetMs);
+        if (relayReqHash && relayReqHash != hash) {
+          DynCfg::ParamValue pv[AnimSchema::PARAM_COUNT]; uint8_t buf[64];
+          for (uint8_t i = 0; i < AnimSchema::PARAM_COUNT; ++i) pv[i] = { AnimSchema::PARAM_IDS[i], Anim::getParamField(ps, AnimSchema::PARAM_IDS[i]) };
+          radio.send(buf, DynCfg::encodeJoin(leaderNow, syncFrame, target, animIndex, pv, AnimSchema::PARAM_COUNT, buf, sizeof(buf)), now);
+        } else {
+          Proto::SyncPacket p; p.time_ms = leaderNow; p.frame = syncFrame; p.target = target; p.cfgHash = hash;
+          radio.send(&p, sizeof(p), now);
+        }
+        res.relayAnswers++;
+      }
+    }
+    if (ackQueued && (int32_t)(local - ackDueMs) >= 0) {
+      Proto::AckPacket a; a.frame = ackFrame; a.node = nodeId; a.offsetErrMs = ackErrMs;
+      radio.send(&a, sizeof(a), now); res.ackTx++;
+      ackQueued = false;
+    }
+    if (cfg.join) {
+      // Firmware: REQ with config hash until synced + configured, on this node's slot once
+      // synced. Before that the first one is spread over a frame after the leader's boot
+      // round (short jitter after a soft reset), retries back off exponentially with jitter.
+      bool linkLost = lastLeaderMs && local - lastLeaderMs > LinkRate::kLinkLostMs;
+      if (lastSyncRecvMs == 0 || !cfgKnown || linkLost) {
+        if (reqDueMs == 0) {
+          if (cfg.tdma && lastSyncRecvMs) reqDueMs = reqSlot(local);
+          else if (cfg.tdma && !soloRestart) reqDueMs = local + Tdma::firstReqDelayMs(rng.next(), LinkRate::modem(radio.queueRate));
+          else reqDueMs = local + Proto::reqBackoffMs(0, rng.next());
+        } else if ((int32_t)(local - reqDueMs) >= 0) {
+          Proto::ReqPacket q; q.node = nodeId; q.cfgHash = DynCfg::configHash(animIndex, ps);
+          radio.send(&q, sizeof(q), now); res.reqTx++;
+          lastReqSentMs = local; soloRestart = false;
+          reqDueMs = reqSlot(local + Proto::reqBackoffMs(++reqAttempt, rng.next()));
+        }
+      }
+      if (cfg.adr && (lastLeaderMs == 0 || linkLost) && local - rateSinceMs > LinkRate::scanDwellMs(radio.queueRate)) {
+        radio.queueRate = LinkRate::scanNext(radio.queueRate); rateSinceMs = local;
+        reqAttempt = 0; reqDueMs = local + Proto::reqBackoffMs(0, rng.next());
+      }
+    } else if (lastSyncRecvMs == 0 && (lastReqSentMs == 0 || local - lastReqSentMs > 2000)) {
+      // Previous firmware: bare REQ every 2s until the first SYNC
+      Proto::ReqPacket q; q.node = nodeId;
+      radio.send(&q, Proto::REQ_LEGACY_SIZE, now); res.reqTx++;
+      lastReqSentMs = local;
+    }
+    radio.service(*this, ch, cfg, rng, res, now);
+  }
+
+  bool correct(uint16_t fleetHash) const { return lastSyncRecvMs != 0 && hash == fleetHash; }
+  // Follower's idea of the leader clock minus the real one (the leader stamps global time)
+  int32_t clockErrMs(uint32_t now) const { return (int32_t)(millisLocal(now) + timeOffsetMs) - (int32_t)now; }
+};
+
+static void printRate(char *out, size_t n, uint8_t rate) {
+  const LoraPhy::Modem &m = LinkRate::modem(rate);
+  snprintf(out, n, "SF%u/%lu", m.sf, (unsigned long)(m.bwHz / 1000));
+}
+
+SimResult runSync(const SimConfig &cfg) {
+  SimResult res;
+  Rng rng(cfg.seed);
+  Channel ch(res, rng, cfg.loss, cfg.fadeDb, cfg.hops);
+  SimLeader leader(cfg, rng, res);
+  std::vector<SimFollower*> fs;
+  std::vector<SimNode*> nodes;
+  leader.index = 0; leader.bootMs = rng.range(0, 300); leader.phase = rng.range(0, kLoopMs - 1);
+  nodes.push_back(&leader);
+  for (int i = 0; i < cfg.followers; ++i) {
+    SimFollower *f = new SimFollower(cfg, rng, res, (uint8_t)(i + 1));
+    f->index = i + 1; f->bootMs = rng.range(0, 300); f->phase = rng.range(0, kLoopMs - 1);
+    f->snrDb = cfg.snrLoDb + (cfg.snrHiDb > cfg.snrLoDb ? (cfg.snrHiDb - cfg.snrLoDb) * rng.uniform() : 0.0);
+    if (cfg.hops > 0) { // round-robin over the rings; the first few on each inner ring relay
+      f->ring = 1 + i % cfg.hops;
+      f->relay = i / cfg.hops < cfg.relaysPerHop && f->ring < cfg.hops;
+    }
+    fs.push_back(f); nodes.push_back(f);
+  }
+  uint32_t air0 = 0, cfgAir0 = 0;
+  for (uint32_t now = 0; now < cfg.durationMs; ++now) {
+    const uint16_t fleetHash = leader.fleetCfg.hash();
+    if ((int32_t)now == cfg.cfgChangeAtMs) { air0 = res.airtimeMs; cfgAir0 = res.cfgAirMs; }
+    if ((int32_t)now == cfg.cfgChangeAtMs + 2000)
+      res.pushOk = (int)std::count_if(fs.begin(), fs.end(), [&](SimFollower *f){ return f->correct(fleetHash); });
+    if ((int32_t)now == cfg.rejoinAtMs) fs[0]->reboot(now, cfg.softReset);
+    if ((int32_t)now == cfg.dropAtMs) fs[0]->snrDb -= cfg.dropDb;
+    ch.deliver(now, nodes);
+    for (SimNode *n : nodes) {
+      if (now < n->bootMs || (now - n->bootMs) % kLoopMs != n->phase) continue;
+      n->loop(now, ch);
+    }
+    if (res.allSyncedMs < 0 && std::all_of(fs.begin(), fs.end(), [](SimFollower *f){ return f->lastSyncRecvMs != 0; }))
+      res.allSyncedMs = (int32_t)now;
+    if (res.allConfirmedMs < 0 && leader.followers.count == cfg.followers) {
+      bool all = true;
+      for (uint8_t i = 0; i < leader.followers.count; ++i) if (leader.followers.nodes[i].lastAckMs == 0) { all = false; break; }
+      if (all) res.allConfirmedMs = (int32_t)now;
+    }
+    if (res.allCorrectMs < 0 && std::all_of(fs.begin(), fs.end(), [&](SimFollower *f){ return f->correct(fleetHash); }))
+      res.allCorrectMs = (int32_t)now;
+    if (cfg.rejoinAtMs >= 0 && (int32_t)now > cfg.rejoinAtMs && res.rejoinMs < 0 && fs[0]->correct(fleetHash))
+      res.rejoinMs = (int32_t)now - cfg.rejoinAtMs;
+    if (cfg.cfgChangeAtMs >= 0 && (int32_t)now > cfg.cfgChangeAtMs && res.healMs < 0 && fleetHash != FleetConfig().hash() &&
+        std::all_of(fs.begin(), fs.end(), [&](SimFollower *f){ return f->correct(fleetHash); })) {
+      res.healMs = (int32_t)now - cfg.cfgChangeAtMs;
+      res.healAirMs = res.airtimeMs - air0; res.healCfgAirMs = res.cfgAirMs - cfgAir0;
+      if (res.healMs < 2000) res.pushOk = cfg.followers;
+    }
+    if (cfg.hops > 0 && now >= 60000 && now % 5000 == 0) {
+      for (SimFollower *f : fs) {
+        if (!f->lastSyncRecvMs || f->ring > SimResult::kRings) continue;
+        int e = std::abs(f->clockErrMs(now));
+        res.ringErrSum[f->ring] += e; res.ringErrN[f->ring]++; res.ringErrMax[f->ring] = std::max(res.ringErrMax[f->ring], e);
+      }
+    }
+    bool rejoinDone = cfg.rejoinAtMs < 0 || res.rejoinMs >= 0;
+    bool healDone = cfg.cfgChangeAtMs < 0 || res.healMs >= 0;
+    if (res.allSyncedMs >= 0 && res.allConfirmedMs >= 0 && rejoinDone && healDone && now > 10000 && !cfg.fullRun) break;
+  }
+  res.finalRate = leader.rateCtl.rate;
+  for (SimFollower *f : fs) {
+    if (f->ring > SimResult::kRings) continue;
+    res.ringCount[f->ring]++;
+    if (f->lastSyncRecvMs) res.ringSynced[f->ring]++;
+    if (f->correct(leader.fleetCfg.hash())) res.ringCorrect[f->ring]++;
+  }
+  for (uint8_t i = 0; i < leader.followers.count; ++i) {
+    const Fleet::Follower &f = leader.followers.nodes[i];
+    if (f.lastAckMs && (int32_t)(leader.lastSyncSent - f.lastAckMs) < 2 * (int32_t)leader.syncInterval) res.reachedEnd++;
+  }
+  for (SimFollower *f : fs) delete f;
+  return res;
+}
+
+void printRow(const char *name, const std::vector<SimResult> &runs) {
+  double coll = 0, tSync = 0, tConf = 0; int nSync = 0, nConf = 0; uint32_t frames = 0, syncTx = 0, air = 0;
+  for (const SimResult &r : runs) {
+    coll += r.frames ? (double)r.collided / r.frames : 0.0; frames += r.frames; syncTx += r.syncTx; air += r.airtimeMs;
+    if (r.allSyncedMs >= 0) { tSync += r.allSyncedMs; nSync++; }
+    if (r.allConfirmedMs >= 0) { tConf += r.allConfirmedMs; nConf++; }
+  }
+  double n = (double)runs.size();
+  char a[32], b[32];
+  if (nSync) snprintf(a, sizeof(a), "%8.0f ms", tSync / nSync); else snprintf(a, sizeof(a), "%11s", "never");
+  if (nConf) snprintf(b, sizeof(b), "%8.0f ms", tConf / nConf); else snprintf(b, sizeof(b), "%11s", "never");
+  printf("%-16s %8.1f%% %11s (%d/%d) %11s (%d/%d) %8.0f %8.0f %9.0f\n", name, 100.0 * coll / n, a, nSync, (int)runs.size(), b, nConf,
+         (int)runs.size(), frames / n, syncTx / n, air / n);
+}
+
+void scenarioSync(SimConfig base, int seeds) {
+  printf("\n== follower responses: %d followers, %d seeds, loss %.0f%% ==\n", base.followers, seeds, base.loss * 100);
+  printf("%-16s %9s %19s %19s %8s %8s %9s\n", "mode", "collide", "all synced", "all confirmed", "frames", "SYNCs", "airtime");
+  struct Mode { const char *name; bool tdma, lbt; } modes[] = {
+    {"immediate", false, false}, {"immediate+cad", false, true}, {"tdma", true, false}, {"tdma+cad", true, true} };
+  for (const Mode &m : modes) {
+    std::vector<SimResult> runs;
+    for (int s = 0; s < seeds; ++s) { SimConfig c = base; c.tdma = m.tdma; c.lbt = m.lbt; c.seed = base.seed + s; runs.push_back(runSync(c)); }
+    printRow(m.name, runs);
+  }
+}
+
+// A follower power-cycles inside a running fleet: how long until it renders the leader's
+// animation again. Bare REQ/SYNC leaves it on defaults until the next CFG2 broadcast. A
+// power-up waits out the boot spread of its first REQ, a software reset skips it.
+void scenarioJoin(SimConfig base, int seeds) {
+  base.rejoinAtMs = 30000; base.cfgEveryMs = 60000; base.durationMs = std::max<uint32_t>(base.durationMs, 150000);
+  printf("\n== follower join: %d followers, %d seeds, loss %.0f%%, CFG2 every %us, follower 1 reboots at %ds ==\n",
+         base.followers, seeds, base.loss * 100, (unsigned)(base.cfgEveryMs / 1000), (int)(base.rejoinAtMs / 1000));
+  printf("%-16s %19s %19s %10s %8s %9s\n", "mode", "boot: all correct", "rejoin: correct", "rejoin max", "JOINs", "airtime");
+  struct Mode { const char *name; bool join, soft; } modes[] = { {"req+sync", false, false}, {"join", true, false}, {"join, soft reset", true, true} };
+  for (const Mode &m : modes) {
+    double tAll = 0, tRe = 0; int nAll = 0, nRe = 0; int32_t reMax = -1; uint32_t joins = 0, air = 0;
+    for (int s = 0; s < seeds; ++s) {
+      SimConfig c = base; c.join = m.join; c.softReset = m.soft; c.seed = base.seed + s;
+      SimResult r = runSync(c);
+      if (r.allCorrectMs >= 0) { tAll += r.allCorrectMs; nAll++; }
+      if (r.rejoinMs >= 0) { tRe += r.rejoinMs; nRe++; reMax = std::max(reMax, r.rejoinMs); }
+      joins += r.joinTx; air += r.airtimeMs;
+    }
+    char a[32], b[32], c[32];
+    if (nAll) snprintf(a, sizeof(a), "%8.0f ms", tAll / nAll); else snprintf(a, sizeof(a), "%11s", "never");
+    if (nRe) snprintf(b, sizeof(b), "%8.0f ms", tRe / nRe); else snprintf(b, sizeof(b), "%11s", "never");
+    if (nRe) snprintf(c, sizeof(c), "%7d ms", (int)reMax); else snprintf(c, sizeof(c), "%10s", "-");
+    printf("%-16s %11s (%d/%d) %11s (%d/%d) %10s %8.0f %9.0f\n", m.name, a, nAll, seeds, b, nRe, seeds, c,
+           joins / (double)seeds, air / (double)seeds);
+  }
+}
+
+// The leader changes the follower config once (one CFG2) on a lossy channel. Without
+// reconciliation the followers that missed it stay wrong until the next change; the
+// alternative is flooding CFG2 periodically, or carrying a 2-byte hash in every SYNC.
+void scenarioHeal(SimConfig base, int seeds) {
+  base.loss = std::max(base.loss, 0.1); base.cfgChangeAtMs = 20000; base.durationMs = std::max<uint32_t>(base.durationMs, 150000);
+  printf("\n== missed CFG2: %d followers, %d seeds, loss %.0f%%, config change at %ds ==\n",
+         base.followers, seeds, base.loss * 100, (int)(base.cfgChangeAtMs / 1000));
+  printf("%-16s %19s %10s %8s %8s %9s\n", "mode", "change -> all ok", "worst", "CFG2s", "JOINs", "airtime");
+  struct Mode { const char *name; bool hash; uint32_t flood; } modes[] = {
+    {"cfg2 only", false, 0}, {"cfg2 flood/10s", false, 10000}, {"hash in SYNC", true, 0} };
+  for (const Mode &m : modes) {
+    double t = 0; int n = 0; int32_t worst = -1; uint32_t cfgs = 0, joins = 0, air = 0;
+    for (int s = 0; s < seeds; ++s) {
+      SimConfig c = base; c.syncHash = m.hash; c.cfgEveryMs = m.flood; c.seed = base.seed + s;
+      SimResult r = runSync(c);
+      if (r.healMs >= 0) { t += r.healMs; n++; worst = std::max(worst, r.healMs); }
+      cfgs += r.cfgTx; joins += r.joinTx; air += r.airtimeMs;
+    }
+    char a[32], b[32];
+    if (n) snprintf(a, sizeof(a), "%8.0f ms", t / n); else snprintf(a, sizeof(a), "%11s", "never");
+    if (n) snprintf(b, sizeof(b), "%7d ms", (int)worst); else snprintf(b, sizeof(b), "%10s", "-");
+    printf("%-16s %11s (%d/%d) %10s %8.0f %8.0f %9.0f\n", m.name, a, n, seeds, b, cfgs / (double)seeds, joins / (double)seeds, air / (double)seeds);
+  }
+}
+
+// One config change on channels losing 5-20% of frames. Followers that miss the push
+// heal through the hash in the next SYNC (REQ -> JOIN); repeating the CFG2 or adding fec.h
+// parity spends airtime up front to get more of them right the first time. The change
+// lands at a different point of the SYNC interval in each seed (a push overlapping the
+// ACK slots collides).
+void scenarioFec(SimConfig base, int seeds) {
+  base.durationMs = std::max<uint32_t>(base.durationMs, 300000);
+  printf("\n== CFG2 erasure coding: %d followers, %d seeds, config change at 90-150s ==\n", base.followers, seeds);
+  printf("%-6s %-14s %9s %11s %10s %11s %11s\n", "loss", "mode", "push ok", "converge", "worst", "cfg air", "total air");
+  struct Mode { const char *name; uint8_t copies, k, m; } modes[] = {
+    {"cfg2 x1", 1, 0, 0}, {"cfg2 x2", 2, 0, 0}, {"cfg2 x3", 3, 0, 0},
+    {"fec 2+1", 1, 2, 1}, {"fec 3+2", 1, 3, 2}, {"fec 4+2", 1, 4, 2} };
+  for (double loss : {0.05, 0.10, 0.20}) {
+    for (const Mode &m : modes) {
+      double t = 0, ok = 0, cfgAir = 0, air = 0; int n = 0; int32_t worst = -1;
+      for (int s = 0; s < seeds; ++s) {
+        SimConfig c = base; c.loss = loss; c.cfgCopies = m.copies; c.fecK = m.k; c.fecM = m.m; c.seed = base.seed + s;
+        c.cfgChangeAtMs = 90000 + (int32_t)(s * 60000 / seeds);
+        SimResult r = runSync(c);
+        ok += r.pushOk;
+        if (r.healMs >= 0) { t += r.healMs; n++; worst = std::max(worst, r.healMs); cfgAir += r.healCfgAirMs; air += r.healAirMs; }
+      }
+      char l[16], a[32], b[32];
+      snprintf(l, sizeof(l), "%.0f%%", loss * 100);
+      if (n) snprintf(a, sizeof(a), "%8.1f s", t / n / 1000.0); else snprintf(a, sizeof(a), "%10s", "never");
+      if (n) snprintf(b, sizeof(b), "%7.1f s", worst / 1000.0); else snprintf(b, sizeof(b), "%9s", "-");
+      printf("%-6s %-14s %5.1f/%-3d %11s %10s %8.0f ms %8.0f ms\n", l, m.name, ok / seeds, base.followers, a, b,
+             n ? cfgAir / n : 0.0, n ? air / n : 0.0);
+    }
+  }
+}
+
+// Followers spread over 2-3 radio hops; only ring 1 hears the leader. Relays forward the
+// leader's broadcasts outwards. Clock error is sampled every 5 s from 60 s on; the config
+// changes once at 100 s.
+void scenarioRelay(SimConfig base, int seeds) {
+  base.cfgChangeAtMs = 100000; base.durationMs = std::max<uint32_t>(base.durationMs, 200000); base.fullRun = true;
+  printf("\n== multi-hop relay: %d followers, %d seeds, loss %.0f%%, config change at %ds ==\n",
+         base.followers, seeds, base.loss * 100, (int)(base.cfgChangeAtMs / 1000));
+  printf("%-5s %-20s %9s %17s %17s %17s %8s %8s %9s\n", "hops", "mode", "correct", "ring 1 |err|", "ring 2 |err|", "ring 3 |err|",
+         "relayed", "dupes", "airtime");
+  struct Mode { const char *name; int relays; bool correct; } modes[] = {
+    {"no relays", 0, true}, {"relays, raw stamp", 2, false}, {"relays", 2, true}, {"1 relay per ring", 1, true} };
+  for (int hops : {2, 3}) {
+    for (const Mode &m : modes) {
+      SimResult sum; int correct = 0; uint32_t air = 0;
+      for (int s = 0; s < seeds; ++s) {
+        SimConfig c = base; c.hops = hops; c.relaysPerHop = m.relays; c.relayCorrect = m.correct; c.seed = base.seed + s;
+        SimResult r = runSync(c);
+        for (int k = 1; k <= SimResult::kRings; ++k) {
+          correct += r.ringCorrect[k];
+          sum.ringErrSum[k] += r.ringErrSum[k]; sum.ringErrN[k] += r.ringErrN[k]; sum.ringErrMax[k] = std::max(sum.ringErrMax[k], r.ringErrMax[k]);
+        }
+        sum.relayed += r.relayed; sum.dupes += r.dupes; air += r.airtimeMs;
+      }
+      char ring[3][32];
+      for (int k = 1; k <= 3; ++k) {
+        if (k > hops) snprintf(ring[k - 1], sizeof(ring[0]), "%17s", "-");
+        else if (!sum.ringErrN[k]) snprintf(ring[k - 1], sizeof(ring[0]), "%17s", "never synced");
+        else snprintf(ring[k - 1], sizeof(ring[0]), "%6.0f / %5d ms", sum.ringErrSum[k] / sum.ringErrN[k], sum.ringErrMax[k]);
+      }
+      double k = seeds;
+      printf("%-5d %-20s %5.1f/%-3d %17s %17s %17s %8.0f %8.0f %9.0f\n", hops, m.name, correct / k, base.followers,
+             ring[0], ring[1], ring[2], sum.relayed / k, sum.dupes / k, air / k);
+    }
+  }
+}
+
+// Airtime of packets that tend to leave together, one frame each vs. one MSG_BATCH frame
+static void bundleRow(const char *name, std::initializer_list<uint8_t> lens) {
+  uint32_t sep = 0, batch = 1;
+  for (uint8_t l : lens) { sep += LoraPhy::airtimeMs(l); batch += 1u + l; }
+  uint32_t one = LoraPhy::airtimeMs((uint8_t)batch);
+  printf("%-24s %8u ms %8u ms %7.0f%%\n", name, (unsigned)sep, (unsigned)one, 100.0 * (1.0 - (double)one / sep));
+}
+
+// Mixed traffic from one fleet: boot, a UI edit (CFG2) every few seconds, a follower
+// reboot and 10% loss, so JOINs, targeted SYNCs, ACKs and REQs overlap in the TX queues.
+// The burst rows queue a SYNC and a BRIGHTNESS with every CFG2, the bundle batching is for.
+void scenarioBatch(SimConfig base, int seeds) {
+  DynCfg::ParamValue pv[AnimSchema::PARAM_COUNT]; uint8_t buf[64];
+  uint8_t cfgLen = DynCfg::encodeCfg2(1, FleetConfig().animIndex, pv, encodeFleetCfg(FleetConfig(), pv), nullptr, 0, buf, sizeof(buf));
+  const uint8_t sync = sizeof(Proto::SyncPacket), bri = sizeof(Proto::BrightnessPacket);
+  printf("\n== batched frames: per-bundle airtime ==\n");
+  printf("%-24s %11s %11s %8s\n", "packets", "separate", "batched", "saved");
+  bundleRow("SYNC+BRIGHTNESS", {sync, bri});
+  bundleRow("SYNC+CFG2", {sync, cfgLen});
+  bundleRow("SYNC+BRIGHTNESS+CFG2", {sync, bri, cfgLen});
+  bundleRow("ACK+REQ", {sizeof(Proto::AckPacket), sizeof(Proto::ReqPacket)});
+  bundleRow("3x targeted SYNC", {sync, sync, sync});
+
+  base.loss = std::max(base.loss, 0.1); base.cfgEveryMs = 3000; base.rejoinAtMs = 30000; base.fullRun = true;
+  base.durationMs = std::max<uint32_t>(base.durationMs, 120000);
+  printf("\n== batched frames: %d followers, %d seeds, loss %.0f%%, CFG2 every %us, %us run ==\n",
+         base.followers, seeds, base.loss * 100, (unsigned)(base.cfgEveryMs / 1000), (unsigned)(base.durationMs / 1000));
+  printf("%-16s %8s %8s %8s %9s %9s %19s\n", "mode", "packets", "frames", "batches", "collide", "airtime", "boot: all correct");
+  struct Mode { const char *name; uint32_t batchMs; bool burst; } modes[] = {
+    {"one per frame", 0, false}, {"batch 10ms", 10, false}, {"batch 25ms", 25, false},
+    {"burst, separate", 0, true}, {"burst, batch 10ms", 10, true} };
+  for (const Mode &m : modes) {
+    double t = 0, coll = 0; int n = 0; uint32_t packets = 0, frames = 0, batches = 0, air = 0;
+    for (int s = 0; s < seeds; ++s) {
+      SimConfig c = base; c.batchMs = m.batchMs; c.cfgBurst = m.burst; c.seed = base.seed + s;
+      SimResult r = runSync(c);
+      if (r.allCorrectMs >= 0) { t += r.allCorrectMs; n++; }
+      packets += r.packets; frames += r.frames; batches += r.batches; air += r.airtimeMs;
+      coll += r.frames ? (double)r.collided / r.frames : 0.0;
+    }
+    char a[32];
+    if (n) snprintf(a, sizeof(a), "%8.0f ms", t / n); else snprintf(a, sizeof(a), "%11s", "never");
+    double k = seeds;
+    printf("%-16s %8.0f %8.0f %8.0f %8.1f%% %9.0f %11s (%d/%d)\n", m.name, packets / k, frames / k, batches / k, 100.0 * coll / k, air / k, a, n, seeds);
+  }
+}
+
+// Adaptive data rate. Every follower boots on the default SF7/125 rung; the leader moves the
+// whole fleet to the fastest rung the weakest link supports with LORA_ADR_MARGIN_DB to spare.
+// "fixed" keeps SF7/125 like before; "fixed SF10" is the robust alternative without ADR.
+void scenarioRate(SimConfig base, int seeds) {
+  base.fadeDb = 2; base.fullRun = true; base.durationMs = std::max<uint32_t>(base.durationMs, 600000);
+  printf("\n== adaptive rate: %d followers, %d seeds, %us run, margin %d dB, fading %.0f dB ==\n",
+         base.followers, seeds, (unsigned)(base.durationMs / 1000), LORA_ADR_MARGIN_DB, base.fadeDb);
+  printf("%-28s %-10s %7s %9s %10s %9s %8s %8s %10s\n", "links / mode", "final", "reached", "confirmed", "round", "airtime", "ups", "downs", "rejoin");
+  struct Links { const char *name; double lo, hi; int32_t dropAt; double drop; int32_t rejoinAt; } links[] = {
+    {"strong (+8..+12 dB)", 8, 12, -1, 0, 400000},
+    {"mixed (-12..+10 dB)", -12, 10, -1, 0, -1},
+    {"strong, node 1 fades -18 dB", 8, 12, 300000, 18, -1},
+  };
+  struct Mode { const char *name; bool adr; uint8_t rate; } modes[] = { {"fixed", false, LinkRate::kDefault}, {"adaptive", true, LinkRate::kDefault} };
+  for (const Links &l : links) {
+    for (const Mode &m : modes) {
+      double conf = 0, rms = 0, air = 0, ups = 0, downs = 0, reached = 0, re = 0; int nConf = 0, nRe = 0; int rateHist[LinkRate::kCount] = {};
+      for (int s = 0; s < seeds; ++s) {
+        SimConfig c = base; c.adr = m.adr; c.snrLoDb = l.lo; c.snrHiDb = l.hi; c.dropAtMs = l.dropAt; c.dropDb = l.drop;
+        c.rejoinAtMs = l.rejoinAt; c.seed = base.seed + s;
+        SimResult r = runSync(c);
+        if (r.allConfirmedMs >= 0) { conf += r.allConfirmedMs; nConf++; }
+        if (r.rejoinMs >= 0) { re += r.rejoinMs; nRe++; }
+        rms += r.rounds ? (double)r.roundMs / r.rounds : 0; air += r.airtimeMs; ups += r.rateUps; downs += r.rateDowns;
+        reached += r.reachedEnd; rateHist[r.finalRate]++;
+      }
+      uint8_t common = 0;
+      for (uint8_t i = 1; i < LinkRate::kCount; ++i) if (rateHist[i] > rateHist[common]) common = i;
+      char name[64], fr[16], a[32], b[32];
+      snprintf(name, sizeof(name), "%s %s", l.name, m.name);
+      printRate(fr, sizeof(fr), common);
+      if (nConf) snprintf(a, sizeof(a), "%6.1f s", conf / nConf / 1000.0); else snprintf(a, sizeof(a), "%8s", "never");
+      if (l.rejoinAt < 0) snprintf(b, sizeof(b), "%10s", "-");
+      else if (nRe) snprintf(b, sizeof(b), "%8.1f s", re / nRe / 1000.0); else snprintf(b, sizeof(b), "%10s", "never");
+      double k = seeds;
+      printf("%-38s %-10s %3.0f/%-3d %9s %7.0f ms %9.0f %8.1f %8.1f %10s\n", name, fr, reached / k, base.followers, a, rms / k, air / k, ups / k, downs / k, b);
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  SimConfig cfg;
+  int seeds = 5;
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    auto next = [&](){ return (i + 1 < argc) ? argv[++i] : "0"; };
+    if (a == "--followers") cfg.followers = std::max(1, std::min(250, atoi(next())));
+    else if (a == "--seeds") seeds = std::max(1, atoi(next()));
+    else if (a == "--loss") cfg.loss = atof(next());
+    else if (a == "--duration") cfg.durationMs = (uint32_t)atol(next());
+    else if (a == "--seed") cfg.seed = (uint64_t)atoll(next());
+    else { printf("usage: netsim [--followers N] [--seeds K] [--loss p] [--duration ms] [--seed s]\n"); return 1; }
+  }
+  printf("modem SF%u/BW%lu/CR4/%u: SYNC %u ms, ACK %u ms, slot %u ms x %u\n", LoraPhy::DEFAULT_MODEM.sf,
+         (unsigned long)(LoraPhy::DEFAULT_MODEM.bwHz / 1000), LoraPhy::DEFAULT_MODEM.cr + 4,
+         (unsigned)LoraPhy::airtimeMs(sizeof(Proto::SyncPacket)), (unsigned)LoraPhy::airtimeMs(sizeof(Proto::AckPacket)),
+         (unsigned)Tdma::kSlotMs, (unsigned)Tdma::kSlots);
+  scenarioSync(cfg, seeds);
+  scenarioJoin(cfg, seeds);
+  scenarioHeal(cfg, seeds);
+  scenarioFec(cfg, seeds);
+  scenarioRelay(cfg, seeds);
+  scenarioBatch(cfg, seeds);
+  scenarioRate(cfg, seeds);
+  return 0;
+}
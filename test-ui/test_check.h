@@ -0,0 +1,12 @@
+#pragma once
+// Shared by the host tests: CHECK prints the message of a failed condition and counts it in
+// g_bad; main() ends with checksResult(), which reports the count and gives the exit code.
+#include <cstdio>
+
+static int g_bad = 0;
+#define CHECK(cond, ...) do { if (!(cond)) { std::printf(__VA_ARGS__); std::printf("\n"); g_bad++; } } while (0)
+
+static inline int checksResult() {
+  if (g_bad) { std::printf("FAILED: %d\n", g_bad); return 1; }
+  return 0;
+}
@@ -0,0 +1,299 @@
+// Favorites store (fav_store.h) on the host Preferences mock: record round trips for every
+// animation, name escaping and truncation, stable ids, the one-time migration from the
+// fav_N JSON strings, and flash traffic against that legacy layout (bytes stored, bytes
+// read to serve the list, writes to delete the first favorite). Then the decoded cache in
+// front of it: auto mode stepping through selections with the next one prefetched, timed
+// against loading the record at the switch. Exits non-zero on any mismatch, if a delete
+// costs more than the index write and one erase, or if an auto switch reads flash.
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../fav_store.h"
+#include "mock_preferences.h"
+#include "test_check.h"
+
+static void sinkAppend(void *user, const char *data, size_t len) { static_cast<std::string *>(user)->append(data, len); }
+
+static std::string toJson(const FavStore::Favorite &f) {
+  std::string s;
+  Json::Writer<> w(&sinkAppend, &s);
+  FavStore::writeJson(w, f);
+  w.flush();
+  return s;
+}
+
+// A favorite as the web UI posts it ({name, ...buildExportConfig()}), params spread over each range
+static std::string uiFavorite(int n) {
+  char b[96];
+  std::string js = "{\"name\":\"Favorite " + std::to_string(n) + "\",\"v\":1,\"globals\":{\"globalSpeed\":";
+  std::snprintf(b, sizeof(b), "%g", 0.5 + 0.25 * (n % 7));
+  js += b; js += "}";
+  for (int side = 0; side < 2; ++side) {
+    AnimSchema::AnimDef ad;
+    memcpy(&ad, &AnimSchema::ANIM_ITEMS[(n + side * 3) % AnimSchema::ANIM_COUNT], sizeof(ad));
+    js += side ? ",\"follower\":{" : ",\"leader\":{";
+    js += "\"animIndex\":" + std::to_string(ad.index) + ",\"params\":[";
+    for (uint8_t i = 0; i < ad.paramCount; ++i) {
+      const AnimSchema::ParamDef *pd = AnimSchema::findParam(ad.paramIds[i]);
+      float t = (float)((n * 7 + i * 3 + side) % 11) / 10.0f, v = pd->minVal + t * (pd->maxVal - pd->minVal);
+      if (pd->type != AnimSchema::PT_RANGE) v = roundf(v);
+      std::snprintf(b, sizeof(b), "%s{\"id\":%u,\"value\":%.4g}", i ? "," : "", pd->id, v);
+      js += b;
+    }
+    js += "]}";
+  }
+  return js + "}";
+}
+
+// Same favorite: names, animations and every param within one quantization step
+static bool same(const std::string &a, const std::string &b) {
+  Json::Doc<> x(a.data(), a.size()), y(b.data(), b.size());
+  if (!x.ok() || !y.ok()) return false;
+  int nx = x.get(0, "name"), ny = y.get(0, "name");
+  if (std::string(a, x.tok[nx].start, x.tok[nx].end - x.tok[nx].start) != std::string(b, y.tok[ny].start, y.tok[ny].end - y.tok[ny].start)) return false;
+  if (std::fabs(x.num(x.get(x.get(0, "globals"), "globalSpeed"), -1) - y.num(y.get(y.get(0, "globals"), "globalSpeed"), -2)) > 0.01f) return false;
+  for (const char *side : { "leader", "follower" }) {
+    int sx = x.get(0, side), sy = y.get(0, side);
+    if (x.integer(x.get(sx, "animIndex"), -1) != y.integer(y.get(sy, "animIndex"), -2)) return false;
+    std::vector<std::pair<int, float>> px, py;
+    x.forEachParam(x.get(sx, "params"), [&](uint8_t id, float v) { px.emplace_back(id, v); });
+    y.forEachParam(y.get(sy, "params"), [&](uint8_t id, float v) { py.emplace_back(id, v); });
+    if (px.size() != py.size()) return false;
+    for (size_t i = 0; i < px.size(); ++i) {
+      const AnimSchema::ParamDef *pd = AnimSchema::findParam((uint8_t)px[i].first);
+      float step = (pd->maxVal - pd->minVal) / (float)((1u << pd->bits) - 1u);
+      if (px[i].first != py[i].first || std::fabs(px[i].second - py[i].second) > step * 0.51f) return false;
+    }
+  }
+  return true;
+}
+
+static void records() {
+  for (int n = 0; n < 40; ++n) {
+    std::string js = uiFavorite(n);
+    FavStore::Favorite f, g;
+    CHECK(FavStore::fromJson(js.data(), js.size(), f), "favorite %d not parsed: %s", n, js.c_str());
+    uint8_t buf[FavStore::MAX_RECORD];
+    size_t len = FavStore::encode(f, buf, sizeof(buf));
+    CHECK(len && FavStore::decode(buf, len, g), "favorite %d: record of %zu bytes not read back", n, len);
+    std::string back = toJson(g);
+    CHECK(same(js, back), "favorite %d changed:\n  %s\n  %s", n, js.c_str(), back.c_str());
+    CHECK(!FavStore::decode(buf, len - 1, g), "favorite %d: truncated record accepted", n);
+  }
+  // Round values come back as written, not as their quantized neighbours
+  const char *round = "{\"name\":\"r\",\"globals\":{\"globalSpeed\":1},\"leader\":{\"animIndex\":1,\"params\":[{\"id\":1,\"value\":3},{\"id\":2,\"value\":0.5},{\"id\":4,\"value\":1}]}}";
+  FavStore::Favorite f;
+  FavStore::fromJson(round, strlen(round), f);
+  std::string out = toJson(f);
+  CHECK(out == "{\"v\":1,\"name\":\"r\",\"globals\":{\"globalSpeed\":1},\"leader\":{\"animIndex\":1,\"params\":[{\"id\":1,\"value\":3},{\"id\":2,\"value\":0.5},{\"id\":4,\"value\":1}]}}", "round values: %s", out.c_str());
+  Anim::ParamSet ps;
+  CHECK(f.part[FavStore::LEADER].apply(ps) == 3 && ps.speed == 3.0f && ps.phase == 0.5f && ps.branch, "apply: speed %g phase %g", ps.speed, ps.phase);
+
+  // Names stay JSON-escaped and are cut on whole characters
+  const char *esc = "{\"name\":\"Sunset \\\"warm\\\" \\u00e9t\\u00e9 \xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\"}";
+  FavStore::fromJson(esc, strlen(esc), f);
+  CHECK(!strcmp(f.name, "Sunset \\\"warm\\\" \\u00e9t\\u00e9 \xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9"), "escaped name cut: [%s] (%u)", f.name, f.nameLen);
+  FavStore::fromJson("{}", 2, f);
+  CHECK(!strcmp(f.name, "favorite"), "unnamed: %s", f.name);
+  CHECK(!FavStore::fromJson("[1]", 3, f) && !FavStore::fromJson("{\"name\":", 8, f), "bad body accepted");
+}
+
+static void ids() {
+  MockPreferences p;
+  FavStore::Store<MockPreferences> s(p);
+  FavStore::Favorite f;
+  for (int n = 0; n < 5; ++n) { std::string js = uiFavorite(n); FavStore::fromJson(js.data(), js.size(), f); CHECK(s.add(f) == n, "add %d", n); }
+  CHECK(s.remove(1) && !s.remove(1) && !s.remove(77), "remove");
+  CHECK(s.add(f) == 5, "deleted id handed out again");
+  uint16_t list[FAV_MAX];
+  uint16_t n = s.list(list, FAV_MAX);
+  CHECK(n == 5 && list[0] == 0 && list[1] == 2 && list[4] == 5, "list order after delete");
+  CHECK(s.load(2, f) && !strcmp(f.name, "Favorite 2") && !s.load(1, f), "load by id");
+  while (s.add(f) >= 0) {}
+  CHECK(s.list(list, FAV_MAX) == FAV_MAX, "full store holds %u", s.list(list, FAV_MAX));
+}
+
+// --- the fav_N layout it replaces (LeaderFollower.ino before fav_store.h) ---
+
+static void legacyAdd(MockPreferences &p, const std::string &js) {
+  uint8_t count = p.getUChar("fav_count", 0);
+  p.putString(("fav_" + std::to_string(count)).c_str(), js.c_str());
+  p.putUChar("fav_count", (uint8_t)(count + 1));
+}
+static void legacyDelete(MockPreferences &p, int id) {
+  uint8_t count = p.getUChar("fav_count", 0);
+  for (int i = id; i < (int)count - 1; ++i) p.putString(("fav_" + std::to_string(i)).c_str(), p.getString(("fav_" + std::to_string(i + 1)).c_str(), "{}").c_str());
+  p.remove(("fav_" + std::to_string(count - 1)).c_str());
+  p.putUChar("fav_count", (uint8_t)(count - 1));
+}
+static size_t legacyList(MockPreferences &p) {
+  size_t out = 0;
+  uint8_t count = p.getUChar("fav_count", 0);
+  for (uint8_t i = 0; i < count; ++i) out += p.getString(("fav_" + std::to_string(i)).c_str(), "{}").size();
+  return out;
+}
+static size_t storeList(MockPreferences &p) {
+  FavStore::Store<MockPreferences> s(p);
+  uint16_t ids[FAV_MAX];
+  uint16_t n = s.list(ids, FAV_MAX);
+  size_t out = 0;
+  FavStore::Favorite f;
+  for (uint16_t i = 0; i < n; ++i) if (s.load(ids[i], f)) out += toJson(f).size();
+  return out;
+}
+
+static void migration() {
+  MockPreferences p;
+  const int n = 30;
+  for (int i = 0; i < n; ++i) legacyAdd(p, i == 7 ? std::string("{\"name\":\"broken\",\"leader\":{") : uiFavorite(i));
+  FavStore::Store<MockPreferences> s(p);
+  CHECK(s.migrate() == n - 1, "migrated count");
+  CHECK(!p.isKey("fav_count") && !p.isKey("fav_0") && !p.isKey("fav_29"), "legacy keys left behind");
+  CHECK(s.migrate() == 0, "migrated twice");
+  uint16_t ids[FAV_MAX];
+  CHECK(s.list(ids, FAV_MAX) == n - 1 && ids[7] == 8, "ids after migration");
+  FavStore::Favorite f;
+  for (int i = 0; i < n; ++i) {
+    if (i == 7) { CHECK(!s.load(7, f), "broken favorite migrated"); continue; }
+    CHECK(s.load((uint16_t)i, f) && same(uiFavorite(i), toJson(f)), "favorite %d differs after migration", i);
+  }
+  // Auto selections keep pointing at the same favorites, new ones continue after them
+  CHECK(s.load(12, f) && !strcmp(f.name, "Favorite 12"), "selection 12 moved");
+  CHECK(s.add(f) == n, "first id after migration");
+
+  // Reset after the index write: the next boot only clears the leftovers
+  MockPreferences q;
+  for (int i = 0; i < 3; ++i) legacyAdd(q, uiFavorite(i));
+  FavStore::Store<MockPreferences> t(q);
+  t.migrate();
+  legacyAdd(q, uiFavorite(0)); // stands in for keys a reset left behind
+  CHECK(t.migrate() == 0 && !q.isKey("fav_count") && t.list(ids, FAV_MAX) == 3, "leftover cleanup");
+}
+
+static void traffic() {
+  std::printf("%6s | %10s %10s | %12s %12s | %14s %14s\n", "favs", "JSON B", "binary B", "list read B", "binary read", "delete first", "binary delete");
+  for (int n : { 10, 50, 100, 200 }) {
+    MockPreferences lp, bp;
+    FavStore::Store<MockPreferences> s(bp);
+    FavStore::Favorite f;
+    for (int i = 0; i < n; ++i) {
+      std::string js = uiFavorite(i);
+      legacyAdd(lp, js);
+      FavStore::fromJson(js.data(), js.size(), f);
+      s.add(f);
+    }
+    size_t lStored = lp.bytesUnder("fav_"), bStored = bp.bytesUnder("f");
+    lp.stats = MockPreferences::Stats(); bp.stats = MockPreferences::Stats();
+    size_t lJson = legacyList(lp), bJson = storeList(bp);
+    size_t lRead = lp.stats.bytesRead, bRead = bp.stats.bytesRead;
+    CHECK(lJson >= bJson, "%d favorites: served JSON grew from %zu to %zu", n, lJson, bJson);
+    lp.stats = MockPreferences::Stats(); bp.stats = MockPreferences::Stats();
+    legacyDelete(lp, 0);
+    s.remove(0);
+    std::printf("%6d | %10zu %10zu | %12zu %12zu | %5zu w %6zu B %6zu w %6zu B\n", n, lStored, bStored, lRead, bRead,
+                lp.stats.writes + lp.stats.erases, lp.stats.bytesWritten, bp.stats.writes + bp.stats.erases, bp.stats.bytesWritten);
+    CHECK(bp.stats.writes == 1 && bp.stats.erases == 1, "%d favorites: delete took %zu writes and %zu erases", n, bp.stats.writes, bp.stats.erases);
+    CHECK(bRead * 3 < lRead, "%d favorites: list read %zu bytes, JSON layout %zu", n, bRead, lRead);
+  }
+}
+
+// --- decoded cache ---
+
+// applyFavoriteToBoth before the cache: record load, decode and snapping at the switch
+static void applyLoaded(FavStore::Store<MockPreferences> &s, uint16_t id, Anim::ParamSet ps[2], uint8_t anim[2]) {
+  FavStore::Favorite f;
+  if (!s.load(id, f)) return;
+  for (uint8_t r = 0; r < 2; ++r) {
+    const FavStore::Part &p = f.part[FavStore::LEADER + r];
+    if (p.anim != FavStore::NO_ANIM) anim[r] = p.anim;
+    p.apply(ps[r]);
+  }
+  float vs;
+  if (f.part[FavStore::GLOBALS].get(AnimSchema::PID_GLOBAL_SPEED, vs)) ps[0].globalSpeed = ps[1].globalSpeed = vs;
+}
+
+static bool sameParams(const Anim::ParamSet &a, const Anim::ParamSet &b) {
+  for (uint8_t row = 0; row < AnimSchema::PARAM_COUNT; ++row)
+    if (Anim::getParamField(a, AnimSchema::PARAM_IDS[row]) != Anim::getParamField(b, AnimSchema::PARAM_IDS[row])) return false;
+  return true;
+}
+
+static void cache() {
+  MockPreferences p;
+  FavStore::Store<MockPreferences> s(p);
+  FavStore::Cache<MockPreferences> c(s);
+  const int n = 24;
+  FavStore::Favorite f;
+  for (int i = 0; i < n; ++i) { std::string js = uiFavorite(i); FavStore::fromJson(js.data(), js.size(), f); c.add(f); }
+  CHECK(c.count() == n, "cache lists %u of %d", c.count(), n);
+
+  // A cached entry applies exactly like the record it came from
+  for (uint16_t id = 0; id < n; ++id) {
+    Anim::ParamSet a[2], b[2];
+    a[1].speed = b[1].speed = 7.0f; a[0].width = b[0].width = 9;
+    uint8_t aa[2] = { 3, 4 }, ba[2] = { 3, 4 };
+    applyLoaded(s, id, a, aa);
+    const FavStore::Entry *e = c.get(id);
+    CHECK(e, "favorite %u not cached", id);
+    if (!e) continue;
+    e->apply(0, b[0], ba[0]); e->apply(1, b[1], ba[1]);
+    CHECK(sameParams(a[0], b[0]) && sameParams(a[1], b[1]) && aa[0] == ba[0] && aa[1] == ba[1], "favorite %u applies differently from cache", id);
+    CHECK(e->nameLen == strlen(e->name) && !strcmp(e->name, ("Favorite " + std::to_string(id)).c_str()), "favorite %u name %s", id, e->name);
+  }
+
+  // Auto mode as tickAutoMode runs it: the next selection is decoded ahead, the switch is a hit,
+  // and names for the UI come from RAM while more favorites are touched than the cache holds
+  uint16_t sel[12];
+  for (int i = 0; i < 12; ++i) sel[i] = (uint16_t)(i * 2);
+  Anim::ParamSet ps[2];
+  uint8_t anim[2] = { 0, 0 };
+  size_t switchReads = 0;
+  for (int step = 0; step < 60; ++step) {
+    uint16_t next = sel[(step + 1) % 12];
+    c.prefetch(next);
+    for (int k = 0; k < FAV_CACHE_ENTRIES + 2; ++k) c.get((uint16_t)((step * 5 + k) % n)); // list views, names
+    size_t before = p.stats.reads;
+    const FavStore::Entry *e = c.get(next);
+    CHECK(e && e->id == next, "step %d: prefetched favorite %u gone", step, next);
+    if (e) { e->apply(0, ps[0], anim[0]); e->apply(1, ps[1], anim[1]); }
+    switchReads += p.stats.reads - before;
+  }
+  CHECK(switchReads == 0, "auto switches read flash %zu times", switchReads);
+
+  // add / remove keep it in step with the store
+  CHECK(c.remove(4) && !c.get(4) && !c.contains(4) && c.count() == n - 1, "removed favorite still cached");
+  size_t before = p.stats.reads;
+  CHECK(!c.get(4) && !c.get(999) && p.stats.reads == before, "unlisted id read from flash");
+  std::string js = uiFavorite(100);
+  FavStore::fromJson(js.data(), js.size(), f);
+  int32_t id = c.add(f);
+  const FavStore::Entry *e = c.get((uint16_t)id);
+  CHECK(id == n && e && !strcmp(e->name, "Favorite 100") && c.ids()[c.count() - 1] == id, "added favorite not listed");
+  FavStore::Cache<MockPreferences> fresh(s);
+  CHECK(fresh.count() == c.count() && !memcmp(fresh.ids(), c.ids(), c.count() * sizeof(uint16_t)), "cached list differs from the store");
+
+  // Switch cost: the load path against a cache hit
+  const int reps = 20000;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < reps; ++i) applyLoaded(s, sel[i % 12], ps, anim);
+  auto t1 = std::chrono::steady_clock::now();
+  c.prefetch(sel[0]);
+  for (int i = 0; i < reps; ++i) { const FavStore::Entry *x = c.get(sel[0]); x->apply(0, ps[0], anim[0]); x->apply(1, ps[1], anim[1]); }
+  auto t2 = std::chrono::steady_clock::now();
+  double load = std::chrono::duration<double, std::nano>(t1 - t0).count() / reps, hit = std::chrono::duration<double, std::nano>(t2 - t1).count() / reps;
+  std::printf("auto switch: load+decode %.0f ns (plus a flash read on the device), cached %.0f ns; entry %zu B, cache %zu B\n",
+              load, hit, sizeof(FavStore::Entry), sizeof(FavStore::Cache<MockPreferences>));
+}
+
+int main() {
+  records();
+  ids();
+  migration();
+  traffic();
+  cache();
+  return checksResult();
+}
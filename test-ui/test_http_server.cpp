@@ -0,0 +1,174 @@
+// test-ui HTTP server (http_server.h): the incremental parser on pipelined input split at
+// every byte, keep-alive rules and malformed or oversized requests, then the server on a
+// loopback port. Checks that pipelined requests come back in order and run in order, that
+// keep-alive connections are reused and "Connection: close" is honoured, and that the worker
+// pool overlaps the latency model while a single worker serialises it like the ESP32. Prints
+// wall time for 8 clients against 1, 2 and 8 workers. Exits non-zero on any mismatch.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+
+#include "http_server.h"
+#include "test_check.h"
+
+static Http::ParseResult parseAll(const std::string &in, Http::Request &r, size_t &used) { return Http::parse(in.data(), in.size(), r, used); }
+
+static void parser() {
+  const std::string a = "GET /api/state?x=1 HTTP/1.1\r\nHost: leader\r\naccept-encoding:  gzip, br \r\n\r\n";
+  const std::string b = "POST /api/cfg2 HTTP/1.1\r\nContent-Length: 11\r\nConnection: close\r\n\r\n{\"anim\":1}\n";
+  const std::string c = "GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n";
+  const std::string all = a + b + c;
+  Http::Request r;
+  size_t used = 0, off = 0;
+  const std::string *want[] = { &a, &b, &c };
+  for (const std::string *w : want) {
+    CHECK(Http::parse(all.data() + off, all.size() - off, r, used) == Http::PARSED && used == w->size(), "pipelined request at %zu: used %zu of %zu", off, used, w->size());
+    off += used;
+  }
+  parseAll(a, r, used);
+  CHECK(r.method == "GET" && r.path == "/api/state" && r.query == "x=1" && r.header("Accept-Encoding") == "gzip, br" && r.keepAlive, "request line / headers");
+  parseAll(b, r, used);
+  CHECK(r.body == "{\"anim\":1}\n" && !r.keepAlive, "body / close");
+  parseAll(c, r, used);
+  CHECK(r.version == "HTTP/1.0" && r.keepAlive, "1.0 keep-alive");
+  parseAll("GET / HTTP/1.0\r\n\r\n", r, used);
+  CHECK(!r.keepAlive, "1.0 closes by default");
+
+  // Every prefix of a request is incomplete, whatever the split
+  for (size_t k = 0; k < b.size(); ++k) CHECK(Http::parse(b.data(), k, r, used) == Http::NEED_MORE, "prefix of %zu bytes not NEED_MORE", k);
+
+  struct { const char *in; Http::ParseResult want; } bad[] = {
+    { "GET /\r\n\r\n", Http::BAD },
+    { "GET / HTTP/2.0\r\n\r\n", Http::BAD },
+    { "GET / HTTP/1.1\r\nno colon\r\n\r\n", Http::BAD },
+    { "POST / HTTP/1.1\r\nContent-Length: -1\r\n\r\n", Http::BAD },
+    { "POST / HTTP/1.1\r\nContent-Length: 2\r\nContent-Length: 3\r\n\r\nabc", Http::BAD },
+    { "POST / HTTP/1.1\r\nContent-Length: 99999999\r\n\r\n", Http::TOO_LARGE },
+    { "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n", Http::UNSUPPORTED },
+  };
+  for (auto &t : bad) CHECK(parseAll(t.in, r, used) == t.want, "accepted: %s", t.in);
+  std::string huge = "GET / HTTP/1.1\r\nX: " + std::string(Http::MAX_HEAD, 'a');
+  CHECK(parseAll(huge, r, used) == Http::TOO_LARGE, "endless header not refused");
+}
+
+// --- loopback client ---
+
+static int connectTo(int port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in a{};
+  a.sin_family = AF_INET; a.sin_port = htons((uint16_t)port); a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (sockaddr *)&a, sizeof(a)) < 0) { close(fd); return -1; }
+  timeval tv{ 5, 0 };
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  return fd;
+}
+static void sendAll(int fd, const std::string &s) { if (send(fd, s.data(), s.size(), MSG_NOSIGNAL) < 0) {} }
+
+// Next response on fd (buf keeps what arrived beyond it); status 0 when the connection ended
+struct Reply { int status = 0; std::string body; bool close = false; };
+static Reply readReply(int fd, std::string &buf) {
+  Reply r;
+  for (;;) {
+    size_t he = buf.find("\r\n\r\n");
+    if (he != std::string::npos) {
+      size_t cl = buf.find("Content-Length: ");
+      size_t len = cl != std::string::npos && cl < he ? (size_t)std::stoul(buf.substr(cl + 16)) : 0;
+      if (buf.size() >= he + 4 + len) {
+        r.status = std::atoi(buf.c_str() + 9);
+        r.close = buf.find("Connection: close") < he;
+        r.body = buf.substr(he + 4, len);
+        buf.erase(0, he + 4 + len);
+        return r;
+      }
+    }
+    char tmp[4096];
+    ssize_t n = recv(fd, tmp, sizeof(tmp), 0);
+    if (n <= 0) return r;
+    buf.append(tmp, (size_t)n);
+  }
+}
+
+static void loopback() {
+  std::mutex mu;
+  std::vector<std::string> order;
+  Http::Server::Options o;
+  o.port = 0; o.workers = 4;
+  Http::Server srv(o, [&](const Http::Request &q) {
+    std::lock_guard<std::mutex> lock(mu);
+    order.push_back(q.path);
+    return Http::reply(q.path == "/missing" ? 404 : 200, "text/plain", q.method + " " + q.path + " " + q.body);
+  });
+  CHECK(srv.start() && srv.port() > 0, "server did not start");
+
+  // Pipelined: answered in order and run in order, the POST between two GETs included
+  int fd = connectTo(srv.port());
+  sendAll(fd, "GET /a HTTP/1.1\r\n\r\nPOST /b HTTP/1.1\r\nContent-Length: 3\r\n\r\nxyzGET /c HTTP/1.1\r\n\r\n");
+  std::string buf;
+  Reply ra = readReply(fd, buf), rb = readReply(fd, buf), rc = readReply(fd, buf);
+  CHECK(ra.body == "GET /a " && rb.body == "POST /b xyz" && rc.body == "GET /c ", "pipelined replies: [%s] [%s] [%s]", ra.body.c_str(), rb.body.c_str(), rc.body.c_str());
+  CHECK(order.size() == 3 && order[0] == "/a" && order[1] == "/b" && order[2] == "/c", "pipelined requests ran out of order");
+  // A request split over several writes, then a 404, all on the same connection
+  sendAll(fd, "GET /sp"); std::this_thread::sleep_for(std::chrono::milliseconds(20)); sendAll(fd, "lit HTTP/1.1\r\n"); sendAll(fd, "\r\n");
+  CHECK(readReply(fd, buf).body == "GET /split ", "split request");
+  sendAll(fd, "GET /missing HTTP/1.1\r\nConnection: close\r\n\r\n");
+  Reply rm = readReply(fd, buf);
+  CHECK(rm.status == 404 && rm.close && readReply(fd, buf).status == 0, "close not honoured");
+  close(fd);
+  CHECK(srv.stats.requests == 5 && srv.stats.reused == 4, "keep-alive: %llu requests, %llu on a reused connection", (unsigned long long)srv.stats.requests.load(), (unsigned long long)srv.stats.reused.load());
+
+  fd = connectTo(srv.port());
+  buf.clear();
+  sendAll(fd, "GARBAGE\r\n\r\n");
+  Reply rbad = readReply(fd, buf);
+  CHECK(rbad.status == 400 && rbad.close && readReply(fd, buf).status == 0, "bad request: %d", rbad.status);
+  close(fd);
+}
+
+// 8 clients, one request each, against a latency model of 50 ms
+static double wall(unsigned workers, int clients) {
+  Http::Server::Options o;
+  o.port = 0; o.workers = workers; o.latency.baseMs = 50;
+  Http::Server srv(o, [](const Http::Request &) { return Http::reply(200, "application/json", "{\"ok\":true}"); });
+  srv.start();
+  auto t0 = std::chrono::steady_clock::now();
+  std::vector<std::thread> ts;
+  std::vector<int> status(clients, 0);
+  for (int i = 0; i < clients; ++i) ts.emplace_back([&, i] {
+    int fd = connectTo(srv.port());
+    std::string buf;
+    sendAll(fd, "GET /api/state HTTP/1.1\r\n\r\n");
+    status[i] = readReply(fd, buf).status;
+    close(fd);
+  });
+  for (std::thread &t : ts) t.join();
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  for (int i = 0; i < clients; ++i) CHECK(status[i] == 200, "%u workers: client %d got %d", workers, i, status[i]);
+  return ms;
+}
+
+static void concurrency() {
+  const int clients = 8;
+  std::printf("%d clients, one request each, 50 ms per request\n%8s | %8s\n", clients, "workers", "wall ms");
+  double w1 = 0, w8 = 0;
+  for (unsigned w : { 1u, 2u, 8u }) {
+    double ms = wall(w, clients);
+    std::printf("%8u | %8.0f\n", w, ms);
+    if (w == 1) w1 = ms;
+    if (w == 8) w8 = ms;
+  }
+  CHECK(w1 >= clients * 50 * 0.95, "one worker did not serialise: %.0f ms", w1);
+  CHECK(w8 < w1 / 3, "8 workers did not overlap: %.0f ms vs %.0f", w8, w1);
+}
+
+int main() {
+  parser();
+  loopback();
+  concurrency();
+  return checksResult();
+}
@@ -0,0 +1,162 @@
+// LED frame stream (led_stream.h): frame codec and quantisation, rate negotiation and pacing
+// against a 60 fps render loop, and a phone on a slow link: a fake non-blocking socket that
+// takes a fixed number of bytes per millisecond. The render loop only ever offers frames, so
+// it cannot stall; the test checks that frames are skipped instead, that what arrives is a
+// sequence of whole frames with increasing seq, and that a recording of it plays back.
+// Exits non-zero on any mismatch.
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../ws_push.h"
+#include "../led_stream.h"
+#include "test_check.h"
+
+static void codec() {
+  float v[28];
+  for (int i = 0; i < 28; ++i) v[i] = i / 27.0f;
+  v[0] = -0.5f; v[1] = NAN; v[27] = 1.5f;
+  uint8_t f[LedStream::MAX_FRAME];
+  size_t n = LedStream::encode(f, sizeof(f), LedStream::ROLE_FOLLOWER, 0x01020304u, 0xA0B0C0D0u, v, 28);
+  CHECK(n == LedStream::HEADER + 28u, "frame size %zu", n);
+  LedStream::Header h; const uint8_t *q = nullptr;
+  CHECK(LedStream::decode(f, n, h, q), "own frame rejected");
+  CHECK(h.role == LedStream::ROLE_FOLLOWER && h.seq == 0x01020304u && h.tMs == 0xA0B0C0D0u && h.count == 28, "header %u %08x %08x %u", h.role, h.seq, h.tMs, h.count);
+  CHECK(f[4] == 0x04 && f[8] == 0xD0 && f[12] == 28, "not little endian");
+  CHECK(q[0] == 0 && q[1] == 0 && q[27] == 255, "clamping: %u %u %u", q[0], q[1], q[27]);
+  float worst = 0.0f;
+  for (int i = 2; i < 27; ++i) worst = std::fmax(worst, std::fabs(q[i] / 255.0f - v[i]));
+  CHECK(worst <= 0.5f / 255.0f + 1e-6f, "quantisation error %g", worst);
+
+  CHECK(!LedStream::decode(f, n - 1, h, q), "truncated frame accepted");
+  uint8_t g[LedStream::MAX_FRAME]; memcpy(g, f, n); g[1] = 2;
+  CHECK(!LedStream::decode(g, n, h, q), "unknown version accepted");
+  CHECK(LedStream::encode(f, 20, 0, 0, 0, v, 28) == 0, "frame larger than the buffer encoded");
+}
+
+// Frames offered by a 60 fps loop (16/17 ms steps) over `ms`
+static uint32_t paced(LedStream::Subscription &s, uint32_t start, uint32_t ms) {
+  uint32_t due = 0;
+  for (uint32_t t = start, i = 0; t < start + ms; t += (i++ % 3 == 2) ? 16 : 17) due += s.due(t);
+  return due;
+}
+
+static void pacing() {
+  LedStream::Subscription s;
+  CHECK(s.subscribe(100, 3, 0) == LED_STREAM_MAX_FPS, "rate not clamped");
+  CHECK(s.subscribe(15, 0, 0) == 15 && s.roles == LedStream::WANT_LEADER, "empty role mask not leader");
+  for (int fps : { 5, 10, 15, 20, 30 }) {
+    s.subscribe(fps, 1, 1000);
+    uint32_t got = paced(s, 1000, 10000);
+    // Frames land on render ticks, so each one is up to a tick late and the rate dips slightly
+    CHECK(got <= (uint32_t)fps * 10 + 1 && got >= (uint32_t)fps * 10 * 9 / 10, "%d fps: %u frames in 10 s", fps, got);
+  }
+  // A stalled loop gets one frame back, not the backlog
+  s.subscribe(15, 1, 0);
+  s.due(0);
+  uint32_t burst = 0;
+  for (uint32_t t = 2000; t < 2010; ++t) burst += s.due(t);
+  CHECK(burst == 1, "%u frames after a 2 s stall", burst);
+  s.subscribe(0, 1, 0);
+  CHECK(paced(s, 0, 1000) == 0, "unsubscribed socket still due");
+}
+
+// Fake non-blocking socket: takes up to `rate` bytes per millisecond
+struct Link {
+  double rate = 0, budget = 0;
+  std::string wire;
+  size_t calls = 0;
+  static int send(void *user, const uint8_t *data, size_t len) {
+    Link &l = *(Link *)user;
+    l.calls++;
+    size_t n = (size_t)l.budget < len ? (size_t)l.budget : len;
+    l.budget -= (double)n;
+    l.wire.append((const char *)data, n);
+    return (int)n;
+  }
+};
+
+struct Received { uint32_t frames = 0, bad = 0, outOfOrder = 0; std::string recording; };
+
+// Splits the bytes a phone received into WebSocket messages and decodes them
+static Received receive(const std::string &wire) {
+  Received r;
+  size_t p = 0; uint32_t last = 0;
+  while (p + 2 <= wire.size()) {
+    const uint8_t *b = (const uint8_t *)wire.data() + p;
+    size_t n = b[1] & 0x7F, h = 2;
+    if (n == 126) { if (p + 4 > wire.size()) break; n = (size_t)b[2] << 8 | b[3]; h = 4; }
+    if (p + h + n > wire.size()) break; // last frame still in flight
+    LedStream::Header fh; const uint8_t *v;
+    if ((b[0] & 0x0F) != Ws::OP_BINARY || !LedStream::decode(b + h, n, fh, v)) r.bad++;
+    else {
+      if (r.frames && fh.seq <= last) r.outOfOrder++;
+      last = fh.seq; r.frames++;
+      r.recording += (char)(uint8_t)n; r.recording += (char)(uint8_t)(n >> 8);
+      r.recording.append((const char *)b + h, n);
+    }
+    p += h + n;
+  }
+  return r;
+}
+
+static void backpressure() {
+  const int leds = 28, fps = 30;
+  const uint32_t ms = 10000;
+  std::printf("%d LEDs at %d fps for %u s, 60 fps render loop\n", leds, fps, ms / 1000);
+  std::printf("%10s | %8s %8s %8s | %12s\n", "link B/s", "sent", "skipped", "received", "calls/frame");
+  for (double bps : { 100000.0, 2000.0, 1000.0, 400.0, 100.0 }) {
+    Link link;
+    link.rate = bps / 1000.0;
+    LedStream::Subscription sub;
+    LedStream::Outbox out;
+    sub.subscribe(fps, 1, 0);
+    float v[leds];
+    uint8_t msg[10 + LedStream::MAX_FRAME];
+    uint32_t due = 0, seq = 0, failed = 0;
+    for (uint32_t t = 0; t < ms; ++t) {
+      link.budget += link.rate;
+      if (t % 16) continue; // render tick
+      seq++;
+      if (!sub.due(t)) { out.drain(Link::send, &link); continue; }
+      due++;
+      for (int i = 0; i < leds; ++i) v[i] = 0.5f + 0.5f * std::sin(t * 0.003f + i * 0.4f);
+      uint8_t *f = msg + 4;
+      size_t n = LedStream::encode(f, LedStream::MAX_FRAME, LedStream::ROLE_LEADER, seq, t, v, leds);
+      uint8_t hdr[10];
+      size_t h = Ws::frameHeader(Ws::OP_BINARY, n, hdr);
+      memcpy(f - h, hdr, h);
+      LedStream::Outbox::Result res = out.offer(f - h, h + n, Link::send, &link);
+      if (res == LedStream::Outbox::SENT) sub.sent++;
+      else if (res == LedStream::Outbox::SKIPPED) sub.skipped++;
+      else failed++;
+    }
+    Received r = receive(link.wire);
+    std::printf("%10.0f | %8u %8u %8u | %12.2f\n", bps, sub.sent, sub.skipped, r.frames, (double)link.calls / (sub.sent ? sub.sent : 1));
+    CHECK(!failed && sub.sent + sub.skipped == due, "%.0f B/s: %u sent + %u skipped of %u due", bps, sub.sent, sub.skipped, due);
+    CHECK(!r.bad && !r.outOfOrder, "%.0f B/s: %u torn and %u reordered frames", bps, r.bad, r.outOfOrder);
+    CHECK(r.frames + 1 >= sub.sent && r.frames <= sub.sent, "%.0f B/s: %u frames received of %u sent", bps, r.frames, sub.sent);
+    double need = (double)fps * (LedStream::HEADER + leds + 2);
+    if (bps >= 2 * need) CHECK(!sub.skipped, "%.0f B/s: %u frames skipped on a fast link", bps, sub.skipped);
+    if (bps < need) CHECK(sub.skipped && sub.sent * (LedStream::HEADER + leds + 2) <= bps * ms / 1000 + 64, "%.0f B/s: more sent than the link carries", bps);
+
+    // What the recorder writes plays back as the same frames
+    size_t p = 0; uint32_t back = 0;
+    while (p + 2 <= r.recording.size()) {
+      size_t n = (uint8_t)r.recording[p] | (uint8_t)r.recording[p + 1] << 8;
+      LedStream::Header fh; const uint8_t *fv;
+      if (p + 2 + n > r.recording.size() || !LedStream::decode((const uint8_t *)r.recording.data() + p + 2, n, fh, fv) || fh.count != leds) break;
+      back++; p += 2 + n;
+    }
+    CHECK(back == r.frames && p == r.recording.size(), "%.0f B/s: recording plays %u of %u frames", bps, back, r.frames);
+  }
+}
+
+int main() {
+  codec();
+  pacing();
+  backpressure();
+  return checksResult();
+}
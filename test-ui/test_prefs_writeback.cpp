@@ -0,0 +1,126 @@
+// NVS write-back (prefs_writeback.h) on the host Preferences mock. Replays 20 minutes of
+// the firmware's puts in a 100 Hz loop: auto mode advancing every minute, a globals slider
+// dragged for a few seconds and once for 45 s without a pause, auto settings saved, then
+// compares with writing each put straight to flash like before. Checks that flash ends up
+// equal to the direct writes after flush(), never takes more than one write per loop pass,
+// and never lags a put by more than the debounce / max-delay bounds. Then the edge cases:
+// puts of the stored value, a full table, long strings, a key changing type. Exits non-zero
+// on any mismatch.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "../prefs_writeback.h"
+#include "mock_preferences.h"
+#include "test_check.h"
+
+static const char *const KEYS[] = { "gmin", "gmax", "auto_idx", "auto_last", "auto_on", "auto_iv", "auto_rand", "auto_sel" };
+
+static std::string raw(MockPreferences &p, const char *key) {
+  size_t n = p.getBytesLength(key);
+  std::string v(n, '\0');
+  if (n) p.getBytes(key, &v[0], n);
+  return v;
+}
+static bool sameFlash(MockPreferences &a, MockPreferences &b) {
+  for (const char *k : KEYS) if (a.isKey(k) != b.isKey(k) || raw(a, k) != raw(b, k)) return false;
+  return true;
+}
+
+// The firmware's puts at time t (ms), on either a WriteBack or Preferences itself
+template<typename P>
+static void firmwarePuts(P &p, uint32_t t, float &gmin, float &lastSaved) {
+  // Auto mode advances every minute (tickAutoMode)
+  if (t % 60000 == 0) { p.putChar("auto_idx", (int8_t)(t / 60000 % 5)); p.putULong("auto_last", t); }
+  // Globals slider: a UI post every 50 ms while dragging, persisted when it moved (handleGlobals)
+  bool drag = (t >= 120000 && t < 124000) || (t >= 600000 && t < 645000);
+  if (drag && t % 50 == 0) gmin = 0.1f + 0.3f * (float)((t / 50) % 40) / 40.0f;
+  if (drag && t % 50 == 0 && (gmin - lastSaved > 0.001f || lastSaved - gmin > 0.001f)) {
+    p.putFloat("gmin", gmin); p.putFloat("gmax", 1.0f); lastSaved = gmin;
+  }
+  // Auto settings saved, then started twice (handleAutoSettings, handleAutoStart)
+  if (t == 300000 || t == 300500) {
+    p.putUShort("auto_iv", 60); p.putBool("auto_rand", false); p.putString("auto_sel", "0,3,4,7,12");
+  }
+  if (t == 301000 || t == 302000) { p.putBool("auto_on", true); p.putChar("auto_idx", 0); p.putULong("auto_last", t); }
+}
+
+static void session() {
+  MockPreferences direct, cached;
+  PrefsWb::WriteBack<MockPreferences> wb(cached);
+  float g1 = 0, s1 = -1, g2 = 0, s2 = -1;
+  const uint32_t end = 20 * 60000, step = 10;
+  uint32_t worstPass = 0, lagSince = 0, worstLag = 0;
+  bool lagging = false;
+  for (uint32_t t = step; t <= end; t += step) {
+    firmwarePuts(direct, t, g1, s1);
+    firmwarePuts(wb, t, g2, s2);
+    size_t before = cached.stats.writes;
+    wb.tick(t);
+    worstPass = std::max<uint32_t>(worstPass, (uint32_t)(cached.stats.writes - before));
+    // How long flash has trailed what was put
+    bool behind = !sameFlash(direct, cached);
+    if (behind && !lagging) lagSince = t;
+    lagging = behind;
+    if (behind) worstLag = std::max(worstLag, t - lagSince);
+  }
+  uint8_t flushed = wb.flush();
+  const PrefsWb::Stats &s = wb.stats;
+  std::printf("20 min session, 100 Hz loop: %u puts, %u keys left for flush()\n", s.puts, flushed);
+  std::printf("%10s | %8s %8s %8s %8s | %10s %12s\n", "", "writes", "merged", "dropped", "direct", "max/pass", "worst lag ms");
+  std::printf("%10s | %8zu %8s %8s %8s | %10s %12s\n", "direct", direct.stats.writes, "-", "-", "-", "-", "0");
+  std::printf("%10s | %8zu %8u %8u %8u | %10u %12u\n", "writeback", cached.stats.writes, s.merged, s.unchanged, s.direct, worstPass, worstLag);
+  std::printf("write time: last %u us, max %u us, total %u us (host map; flash is milliseconds)\n", s.lastWriteUs, s.maxWriteUs, s.totalWriteUs);
+
+  CHECK(sameFlash(direct, cached), "flash differs from direct writes after flush");
+  CHECK(direct.stats.writes == s.puts, "direct path wrote %zu for %u puts", direct.stats.writes, s.puts);
+  CHECK(s.puts == s.writes + s.merged + s.unchanged + s.direct, "%u puts: %u written, %u merged, %u dropped, %u direct", s.puts, s.writes, s.merged, s.unchanged, s.direct);
+  CHECK(cached.stats.writes * 10 < direct.stats.writes, "write-back made %zu writes, direct %zu", cached.stats.writes, direct.stats.writes);
+  CHECK(worstPass <= 1, "%u flash writes in one loop pass", worstPass);
+  CHECK(worstLag <= PREFS_WB_MAX_DELAY_MS + 8 * step, "flash trailed puts by %u ms", worstLag);
+  CHECK(!s.direct && !s.failed, "%u direct and %u failed writes", s.direct, s.failed);
+}
+
+static void edges() {
+  MockPreferences p;
+  PrefsWb::WriteBack<MockPreferences> wb(p);
+  uint32_t t = 1000;
+  wb.tick(t);
+  // Debounce: nothing before the quiet period, then one key per pass, oldest first
+  wb.putULong("auto_last", 5); wb.putChar("auto_idx", 2);
+  wb.tick(t += PREFS_WB_DEBOUNCE_MS - 10);
+  CHECK(!p.stats.writes && wb.pending() == 2, "written before the debounce");
+  CHECK(wb.tick(t += 10) && p.isKey("auto_last") && !p.isKey("auto_idx"), "first write not the oldest key");
+  CHECK(wb.tick(t += 10) && p.getChar("auto_idx", 0) == 2 && !wb.pending(), "second key not written");
+  // The value already written is dropped; a changed one is written again
+  wb.putULong("auto_last", 5);
+  CHECK(!wb.pending() && wb.stats.unchanged == 1, "put of the stored value kept");
+  wb.putULong("auto_last", 6); wb.putULong("auto_last", 5);
+  CHECK(wb.pending() == 1 && wb.stats.merged == 1, "merge after a write");
+  wb.flush();
+  CHECK(p.getULong("auto_last", 0) == 5, "last put lost");
+
+  // No free slot or a string too long for one: written at put time
+  for (int i = 0; i < PREFS_WB_SLOTS + 2; ++i) wb.putUShort(("k" + std::to_string(i)).c_str(), (uint16_t)i);
+  CHECK(wb.stats.direct == 4 && p.getUShort("k11", 0) == 11, "full table: %u direct", wb.stats.direct);
+  std::string longSel(PREFS_WB_STR_MAX + 1, '1');
+  wb.putString("auto_sel", longSel.c_str());
+  CHECK(wb.stats.direct == 5 && p.getString("auto_sel") == longSel, "long string not written through");
+
+  // A key changing type: the pending old value lands first, the new one last
+  MockPreferences q;
+  PrefsWb::WriteBack<MockPreferences> w2(q);
+  w2.putUChar("mode", 3);
+  w2.putFloat("mode", 2.5f);
+  w2.flush();
+  CHECK(q.getFloat("mode", 0) == 2.5f && q.stats.writes == 2, "type change: %g after %zu writes", q.getFloat("mode", 0), q.stats.writes);
+  w2.putString("name", "");
+  CHECK(w2.flush() == 1 && q.isKey("name") && q.getString("name", "x").empty(), "empty string");
+}
+
+int main() {
+  session();
+  edges();
+  return checksResult();
+}
@@ -0,0 +1,134 @@
+// Host test for the render time base (time_base.h): fast-forwards the synced clock to long
+// uptimes and checks that Wave/Pulse/Chase/Sparkle/Perlin advance like they do in minute
+// one, across the 49.7-day millis() wrap, and identically on nodes whose clocks differ by
+// whole wraps. Also prints how the old float-seconds time base degrades.
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "../animations.h"
+#include "test_check.h"
+
+static const uint64_t kMinuteUs = 60ull * 1000000ull;
+static const uint64_t kDayUs = 24ull * 3600ull * 1000000ull;
+static const uint64_t kFrameUs = 33333;
+static const int kFrames = 600; // 20 s of frames
+
+struct Uptime { const char *name; uint64_t us; };
+static const Uptime kUptimes[] = {
+  { "1 min", kMinuteUs },
+  { "6 h", 6 * 3600ull * 1000000ull },
+  { "10 days", 10 * kDayUs },
+  { "49.7 day wrap", TimeBase::kMsWrapUs - 5 * 1000000ull }, // millis() wraps 5 s into the run
+  { "60 days", 60 * kDayUs },
+  { "1 year", 365 * kDayUs },
+};
+
+// Largest per-frame change of any LED and the number of frames that did not change at all
+struct Motion { float maxStep; int frozen; };
+
+static Motion motion(uint8_t anim, const Anim::ParamSet &ps, uint64_t startUs) {
+  float prev[Anim::TOTAL_LEDS], cur[Anim::TOTAL_LEDS];
+  Motion m{0.0f, 0};
+  Anim::applyAnim(anim, startUs, Anim::TOTAL_LEDS, ps, prev);
+  for (int f = 1; f <= kFrames; ++f) {
+    Anim::applyAnim(anim, startUs + (uint64_t)f * kFrameUs, Anim::TOTAL_LEDS, ps, cur);
+    float step = 0.0f;
+    for (uint16_t i = 0; i < Anim::TOTAL_LEDS; ++i) step = std::fmax(step, std::fabs(cur[i] - prev[i]));
+    m.maxStep = std::fmax(m.maxStep, step);
+    if (step == 0.0f) m.frozen++;
+    std::memcpy(prev, cur, sizeof(prev));
+  }
+  return m;
+}
+
+static void checkClock64() {
+  TimeBase::Clock64 c;
+  uint32_t us32 = 0xFFFFF000u;
+  uint64_t base = c.extend(us32);
+  for (int i = 0; i < 3; ++i) { us32 += 0x80000000u; c.extend(us32); } // three half-wraps
+  CHECK(c.us - base == 3ull * 0x80000000ull, "Clock64 lost time across micros() wraps");
+
+  // A follower 2 s after boot, leader 30 days up: the offset is negative as int32 once the
+  // leader passed 24.8 days, the low 32 ms bits must still match the leader's millis()
+  uint64_t leaderUs = 30 * kDayUs + 123456;
+  uint64_t followerUs = 2000000 + 123456;
+  int32_t offsetMs = (int32_t)((uint32_t)(leaderUs / 1000) - (uint32_t)(followerUs / 1000));
+  uint64_t s = TimeBase::synced(followerUs, offsetMs);
+  CHECK((uint32_t)(s / 1000) == (uint32_t)(leaderUs / 1000), "synced clock ms %u != leader %u", (unsigned)(s / 1000), (unsigned)(leaderUs / 1000));
+  CHECK(s % 1000 == leaderUs % 1000, "synced clock lost sub-ms part");
+}
+
+static void checkTurns() {
+  const float speeds[] = { 0.05f, 0.477f, 3.0f, 12.0f * 4.0f };
+  for (float cps : speeds) {
+    uint32_t d0 = TimeBase::turnsQ32(kMinuteUs + kFrameUs, cps) - TimeBase::turnsQ32(kMinuteUs, cps);
+    for (const Uptime &u : kUptimes) {
+      for (int f = 0; f < kFrames; ++f) {
+        uint64_t t = u.us + (uint64_t)f * kFrameUs;
+        uint32_t d = TimeBase::turnsQ32(t + kFrameUs, cps) - TimeBase::turnsQ32(t, cps);
+        int32_t diff = (int32_t)(d - d0);
+        // Only the sub-ms rounding may differ between frames: below one Q32 rate step
+        if (diff > (int32_t)TimeBase::rateQ32(cps) || -diff > (int32_t)TimeBase::rateQ32(cps)) {
+          CHECK(false, "turns step at %s, %.3f cycles/s: %d Q32 off minute one", u.name, cps, diff);
+          break;
+        }
+      }
+    }
+  }
+}
+
+int main() {
+  checkClock64();
+  checkTurns();
+
+  // periodic: exact across the millis() wrap. Sparkle and Perlin are not periodic and start a
+  // new pattern there (same on every node). stepCheck: the largest frame step is not random.
+  struct Case { const char *name; uint8_t anim; float speed; bool branch, periodic, stepCheck; };
+  const Case cases[] = {
+    { "Wave", 1, 3.0f, false, true, true }, { "Wave branch", 1, 0.5f, true, true, true },
+    { "Pulse", 2, 3.0f, false, true, true }, { "Chase", 3, 3.0f, false, true, true },
+    { "Chase branch", 3, 3.0f, true, true, true }, { "Sparkle", 5, 3.0f, false, false, false },
+    { "Perlin", 6, 3.0f, false, false, true },
+  };
+
+  std::printf("%-13s %-14s %9s %7s %10s\n", "animation", "uptime", "max step", "frozen", "old float");
+  for (const Case &c : cases) {
+    Anim::ParamSet ps;
+    ps.speed = c.speed; ps.branch = c.branch; ps.randomMode = true;
+    Motion ref = motion(c.anim, ps, kMinuteUs);
+    for (const Uptime &u : kUptimes) {
+      Motion m = motion(c.anim, ps, u.us);
+      // Old time base: float seconds from the 32-bit ms clock
+      float prev[Anim::TOTAL_LEDS], cur[Anim::TOTAL_LEDS];
+      int oldFrozen = 0;
+      uint32_t ms0 = (uint32_t)(u.us / 1000);
+      Anim::applyAnim(c.anim, TimeBase::fromSeconds(ms0 / 1000.0f), Anim::TOTAL_LEDS, ps, prev);
+      for (int f = 1; f <= kFrames; ++f) {
+        uint32_t ms = (uint32_t)((u.us + (uint64_t)f * kFrameUs) / 1000);
+        Anim::applyAnim(c.anim, TimeBase::fromSeconds(ms / 1000.0f), Anim::TOTAL_LEDS, ps, cur);
+        if (std::memcmp(prev, cur, sizeof(cur)) == 0) oldFrozen++;
+        std::memcpy(prev, cur, sizeof(prev));
+      }
+      std::printf("%-13s %-14s %9.4f %7d %10d\n", c.name, u.name, m.maxStep, m.frozen, oldFrozen);
+      // Sparkle/Chase legitimately hold still between steps; they must not stall more than in minute one
+      CHECK(m.frozen <= ref.frozen + kFrames / 50, "%s at %s: %d frozen frames (minute one %d)", c.name, u.name, m.frozen, ref.frozen);
+      bool wrap = u.us < TimeBase::kMsWrapUs && u.us + (uint64_t)kFrames * kFrameUs >= TimeBase::kMsWrapUs;
+      if (c.stepCheck && (c.periodic || !wrap))
+        CHECK(m.maxStep <= ref.maxStep + 0.02f, "%s at %s: step %.4f (minute one %.4f)", c.name, u.name, m.maxStep, ref.maxStep);
+    }
+
+    // Leader up 60 days, follower clock one millis() wrap behind (joined after the wrap):
+    // same synced ms low bits, so the same frame
+    float a[Anim::TOTAL_LEDS], b[Anim::TOTAL_LEDS];
+    for (int f = 0; f < 50; ++f) {
+      uint64_t t = 60 * kDayUs + (uint64_t)f * 777777;
+      Anim::applyAnim(c.anim, t, Anim::TOTAL_LEDS, ps, a);
+      Anim::applyAnim(c.anim, t - TimeBase::kMsWrapUs, Anim::TOTAL_LEDS, ps, b);
+      if (std::memcmp(a, b, sizeof(a)) != 0) { CHECK(false, "%s differs between nodes one millis() wrap apart", c.name); break; }
+    }
+  }
+
+  if (!g_bad) std::printf("time base OK\n");
+  return checksResult();
+}
@@ -0,0 +1,198 @@
+// Push channel (ws_push.h): RFC 6455 handshake and framing vectors, the state deltas, and a
+// 10-minute simulation of phones keeping the UI open. Polling phones follow web_ui.h's
+// timers (auto banner countdown, /api/auto/config on rollover and every 5 s while Auto is
+// off, /api/state after a switch); pushing phones open one socket and get frames instead.
+// Phones beyond WS_MAX_CLIENTS are refused and keep polling. Exits non-zero on any mismatch
+// or if pushing does not cut the leader's HTTP requests.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "../ws_push.h"
+#include "test_check.h"
+
+static std::string delta(const Ws::Snapshot *prev, const Ws::Snapshot &cur, bool *sent = nullptr) {
+  Ws::Message m;
+  bool any = Ws::buildPush(m, prev, cur);
+  if (sent) *sent = any;
+  if (!any) return "";
+  size_t n; const uint8_t *f = m.frame(n);
+  size_t h = n - m.len;
+  return std::string((const char *)f + h, m.len);
+}
+
+static void protocol() {
+  {
+    Ws::Sha1 s; s.update("abc", 3); uint8_t d[20]; s.final(d);
+    char hex[41]; for (int i = 0; i < 20; ++i) std::snprintf(hex + i * 2, 3, "%02x", d[i]);
+    CHECK(!strcmp(hex, "a9993e364706816aba3e25717850c26c9cd0d89d"), "sha1(abc) = %s", hex);
+  }
+  {
+    // RFC 6455 1.3
+    const char *req = "GET /ws HTTP/1.1\r\nHost: server.example.com\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nsec-websocket-key:   dGhlIHNhbXBsZSBub25jZQ==\r\n\r\n";
+    char out[160];
+    size_t n = Ws::handshake(req, strlen(req), out, sizeof(out));
+    CHECK(n && strstr(out, "Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n"), "handshake: %s", out);
+    const char *plain = "GET / HTTP/1.1\r\nHost: x\r\n\r\n";
+    CHECK(Ws::handshake(plain, strlen(plain), out, sizeof(out)) == 0, "handshake without key accepted");
+  }
+  {
+    uint8_t h[10];
+    CHECK(Ws::frameHeader(Ws::OP_TEXT, 5, h) == 2 && h[0] == 0x81 && h[1] == 5, "short header");
+    CHECK(Ws::frameHeader(Ws::OP_TEXT, 300, h) == 4 && h[1] == 126 && h[2] == 1 && h[3] == 44, "16-bit header");
+    CHECK(Ws::frameHeader(Ws::OP_TEXT, 70000, h) == 10 && h[1] == 127 && h[7] == 1 && h[8] == 0x11 && h[9] == 0x70, "64-bit header");
+    // RFC 6455 5.7: masked "Hello"
+    uint8_t hello[] = { 0x81, 0x85, 0x37, 0xfa, 0x21, 0x3d, 0x7f, 0x9f, 0x4d, 0x51, 0x58, 0x89 };
+    Ws::Frame f;
+    CHECK(Ws::parseFrame(hello, 10, f) == 0, "incomplete frame parsed");
+    CHECK(Ws::parseFrame(hello, sizeof(hello), f) == 11 && f.op == Ws::OP_TEXT && f.fin && f.len == 5 && !memcmp(f.payload, "Hello", 5), "masked Hello");
+    uint8_t unmasked[] = { 0x81, 0x05, 'H', 'e', 'l', 'l', 'o' };
+    CHECK(Ws::parseFrame(unmasked, sizeof(unmasked), f) == Ws::BAD_FRAME, "unmasked client frame accepted");
+  }
+}
+
+static void deltas() {
+  Ws::Snapshot a;
+  a.anim[0] = 1; a.anim[1] = 6;
+  bool sent;
+  std::string full = delta(nullptr, a);
+  CHECK(full.find("\"auto\"") != std::string::npos && full.find("\"animIndex\":1") != std::string::npos && full.find("\"animIndex\":6") != std::string::npos, "full: %s", full.c_str());
+  delta(&a, a, &sent);
+  CHECK(!sent, "unchanged state pushed");
+
+  Ws::Snapshot b = a;
+  b.params[Ws::FOLLOWER].speed = 4.5f;
+  std::string d = delta(&a, b);
+  CHECK(d == "{\"follower\":{\"params\":[{\"id\":1,\"value\":4.50000}]}}", "one param: %s", d.c_str());
+
+  Ws::Snapshot c = b;
+  c.anim[Ws::LEADER] = 3;
+  d = delta(&b, c);
+  size_t params = 0;
+  for (size_t p = d.find("\"id\":"); p != std::string::npos; p = d.find("\"id\":", p + 1)) params++;
+  CHECK(d.find("\"leader\":{\"animIndex\":3") == 1 && params == AnimSchema::PARAM_COUNT && d.find("follower") == std::string::npos, "anim change: %s", d.c_str());
+
+  Ws::Snapshot e = c;
+  e.autoOn = true; e.autoId = 2; e.autoMark = 1000; e.remaining = 60; e.intervalSec = 60;
+  e.setName("Sunset \\\"warm\\\"", 15);
+  d = delta(&c, e);
+  CHECK(d == "{\"auto\":{\"on\":true,\"id\":2,\"name\":\"Sunset \\\"warm\\\"\",\"remaining\":60,\"interval\":1}}", "auto: %s", d.c_str());
+  // Countdown alone is not news; a restart is
+  Ws::Snapshot g = e; g.remaining = 59;
+  delta(&e, g, &sent);
+  CHECK(!sent, "countdown tick pushed");
+  g.autoMark = 61000; g.remaining = 60;
+  delta(&e, g, &sent);
+  CHECK(sent, "restart not pushed");
+
+  Ws::Snapshot n;
+  n.setName("abc\\", 4);
+  CHECK(!strcmp(n.name, "abc"), "dangling escape kept: %s", n.name);
+  // Cut to 39 bytes on a code point: never inside \uXXXX, a surrogate pair or UTF-8
+  struct { size_t pad; const char *tail; size_t want; } cuts[] = {
+    { 36, "\\u00e9", 36 }, { 38, "\xc3\xa9", 38 }, { 37, "\xe2\x82\xac", 37 }, { 38, "\\n", 38 },
+    { 30, "\\ud83d\\ude00", 30 }, { 27, "\\ud83d\\ude00", 39 },
+  };
+  for (auto &c : cuts) {
+    std::string in = std::string(c.pad, 'a') + c.tail;
+    n.setName(in.data(), in.size());
+    CHECK(strlen(n.name) == c.want && !memcmp(n.name, in.data(), c.want), "name of %zu bytes cut to %zu, want %zu", in.size(), strlen(n.name), c.want);
+  }
+
+  // Larger than a frame: clients are told to reload
+  Ws::Message m;
+  m.len = 0; m.overflow = false;
+  char big[600]; memset(big, 'x', sizeof(big));
+  for (int i = 0; i < 4; ++i) Ws::Message::sink(&m, big, sizeof(big));
+  size_t fl; const uint8_t *f = m.frame(fl);
+  CHECK(std::string((const char *)f + 2, fl - 2) == "{\"reload\":true}", "overflow not turned into reload");
+}
+
+// --- load ---
+
+struct Leader {
+  uint32_t interval = 60;
+  bool on = false;
+  uint32_t mark = 0; // second the countdown restarted
+  uint32_t fav = 0;
+  uint32_t remaining(uint32_t t) const { uint32_t el = t - mark; return on && el < interval ? interval - el : 0; }
+};
+
+struct Phone {
+  bool push = false;
+  bool on = false;
+  uint32_t remain = 0, offTicks = 0;
+  uint32_t startedAt = 0;
+};
+
+struct Load { uint32_t requests = 0, frames = 0, bytes = 0; };
+
+// One run: phones open the page at staggered seconds, Auto runs from t=60 s on with a
+// 1-minute interval, and another phone changes a parameter every 45 s
+static Load simulate(int phones, bool usePush, uint32_t seconds) {
+  Leader L;
+  Phone ph[16];
+  int sockets = 0;
+  Load load;
+  Ws::Snapshot last, cur;
+  for (int p = 0; p < phones; ++p) ph[p].startedAt = (uint32_t)p * 3;
+  for (uint32_t t = 0; t < seconds; ++t) {
+    // Leader side: tickAutoMode and an outside CFG2
+    if (t == 60) { L.on = true; L.mark = t; L.fav = 0; }
+    if (L.on && t - L.mark >= L.interval) { L.mark = t; L.fav = (L.fav + 1) % 5; }
+    cur.autoOn = L.on; cur.autoId = L.on ? (int16_t)L.fav : -1; cur.autoMark = L.mark * 1000u; cur.remaining = L.remaining(t); cur.intervalSec = L.interval;
+    cur.params[Ws::LEADER].speed = 1.0f + (float)L.fav; // favorites differ in a couple of params
+    cur.params[Ws::FOLLOWER].width = (uint8_t)(2 + L.fav);
+    if (t && t % 45 == 0) cur.params[Ws::LEADER].phase += 0.25f;
+    bool changed = false;
+    std::string d = t ? delta(&last, cur, &changed) : "";
+    last = cur;
+
+    for (int p = 0; p < phones; ++p) {
+      Phone &f = ph[p];
+      if (t < f.startedAt) continue;
+      if (t == f.startedAt) {
+        load.requests += 3; // page load: /api/state, /api/favorites, /api/auto/config
+        f.on = L.on; f.remain = L.remaining(t);
+        if (usePush && sockets < WS_MAX_CLIENTS) { f.push = true; sockets++; load.requests++; load.frames++; load.bytes += (uint32_t)delta(nullptr, cur).size(); }
+        continue;
+      }
+      if (f.push) {
+        if (changed) { load.frames++; load.bytes += (uint32_t)d.size(); if (d.find("\"auto\"") != std::string::npos) { f.on = L.on; f.remain = L.remaining(t); } }
+        else if (f.on && f.remain) f.remain--;
+        continue;
+      }
+      // web_ui.h banner timer, once a second
+      if (f.on) {
+        if (f.remain > 0) { f.remain--; continue; }
+        load.requests++; // /api/auto/config
+        uint32_t r = L.remaining(t);
+        if (r > 0) load.requests++; // rollover: loadState()
+        f.on = L.on; f.remain = r;
+      } else {
+        f.offTicks = (f.offTicks + 1) % 5;
+        if (f.offTicks == 0) { load.requests++; f.on = L.on; f.remain = L.remaining(t); }
+      }
+    }
+  }
+  return load;
+}
+
+int main() {
+  protocol();
+  deltas();
+
+  const uint32_t seconds = 600;
+  std::printf("%u s, Auto on from 60 s at 1 min, one outside change every 45 s, WS_MAX_CLIENTS %d\n", seconds, WS_MAX_CLIENTS);
+  std::printf("%6s | %12s | %12s %8s %10s\n", "phones", "poll req/min", "push req/min", "frames", "push B/min");
+  for (int phones : { 1, 2, 4, 6, 8 }) {
+    Load poll = simulate(phones, false, seconds), push = simulate(phones, true, seconds);
+    double minutes = seconds / 60.0;
+    std::printf("%6d | %12.1f | %12.1f %8u %10.0f\n", phones, poll.requests / minutes, push.requests / minutes, push.frames, push.bytes / minutes);
+    CHECK(push.requests < poll.requests, "%d phones: push %u requests, polling %u", phones, push.requests, poll.requests);
+    // Up to the socket limit, nothing but the page loads and upgrades reaches the HTTP server
+    if (phones <= WS_MAX_CLIENTS) CHECK(push.requests == 4u * phones, "%d phones: %u requests with every phone on a socket", phones, push.requests);
+  }
+  return checksResult();
+}
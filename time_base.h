@@ -0,0 +1,65 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+
+// Render time base. Renderers get the synced clock as 64-bit microseconds and turn it into
+// animation phase with integer math, instead of float seconds that lose millisecond
+// resolution after a few hours of uptime.
+//
+// Phase is kept in fixed-point turns (Q0.32, one full cycle = 2^32). Only the low 32 bits
+// of the millisecond count are multiplied by a per-ms Q0.32 rate. 2^32 ms is a whole number
+// of rate steps, so the result is exact at any uptime. Nodes whose 64-bit clocks differ by
+// whole 32-bit millis() wraps (e.g. a follower that joined after the leader wrapped) still
+// get the same phase.
+namespace TimeBase {
+
+static constexpr uint64_t kMsWrapUs = 4294967296ull * 1000ull; // one 32-bit ms wrap in µs
+
+// Extends a wrapping 32-bit µs counter (micros()) to 64 bits. Call at least once per wrap
+// (~71 min); the render loop does.
+struct Clock64 {
+  uint64_t us{0};
+  uint32_t last{0};
+  uint64_t extend(uint32_t now) { us += (uint32_t)(now - last); last = now; return us; }
+};
+
+// Synced clock from a local 64-bit clock and the follower's ms offset to the leader. A
+// negative result is moved up by whole ms wraps so the low 32 ms bits still match the
+// leader's millis().
+inline uint64_t synced(uint64_t localUs, int32_t offsetMs) {
+  int64_t off = (int64_t)offsetMs * 1000;
+  if (off < 0 && (uint64_t)(-off) > localUs) off += (int64_t)kMsWrapUs;
+  return localUs + (uint64_t)off;
+}
+
+// Q0.32 turns per millisecond at cyclesPerSec (|cyclesPerSec| below 500)
+inline uint32_t rateQ32(float cyclesPerSec) {
+  return (uint32_t)(int64_t)llround((double)cyclesPerSec * 4294967.296);
+}
+
+// Position after tUs as Q32.32 cycles: whole cycles in the high word, turn fraction in the
+// low word. The whole count restarts with the 32-bit ms clock, so non-periodic patterns
+// keyed on it (Sparkle slots, the Perlin time axis) start over once every 49.7 days, at the
+// same moment on every node.
+inline uint64_t cyclesQ32(uint64_t tUs, float cyclesPerSec) {
+  uint32_t ms = (uint32_t)(tUs / 1000), sub = (uint32_t)(tUs % 1000);
+  int64_t rate = llround((double)cyclesPerSec * 4294967.296);
+  return (uint64_t)ms * (uint64_t)rate + (uint64_t)((int64_t)sub * rate / 1000);
+}
+
+// Fraction of a turn, Q0.32
+inline uint32_t turnsQ32(uint64_t tUs, float cyclesPerSec) {
+  uint32_t ms = (uint32_t)(tUs / 1000), sub = (uint32_t)(tUs % 1000);
+  uint32_t rate = rateQ32(cyclesPerSec);
+  return ms * rate + (uint32_t)((int64_t)sub * (int32_t)rate / 1000);
+}
+
+// Fraction of a turn in [0, 1)
+inline float turns(uint64_t tUs, float cyclesPerSec) {
+  return (float)(turnsQ32(tUs, cyclesPerSec) >> 8) * (1.0f / 16777216.0f);
+}
+
+// Seconds as float, for host tools that still hand out float time
+inline uint64_t fromSeconds(float t) { return t > 0.0f ? (uint64_t)((double)t * 1e6) : 0; }
+
+} // namespace TimeBase
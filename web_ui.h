@@ -11,6 +11,9 @@
 // Endpoints:
 //   GET /api/state -> legacy state for convenience (leader/follower subset + globals)
 //   POST /api/cfg2  -> JSON { role:0|1, animIndex, params:[{id,value}], globals:[{id,value}] }
+//   GET /api/followers -> { frame, pending, slotClashes, items:[{id,slot,slotPeer,acked,lastAckAgoMs,lastSeenAgoMs,offsetErrMs,rssi,snr,retries}] }
+//   ws://<host>:<http port + 1>/ws -> pushed deltas { auto:{on,id,name,remaining,interval}, leader|follower:{animIndex?,params} } (ws_push.h)
+//     send {frames:fps, roles:1|2|3} -> { frames, roles, leds }, then binary LED frames at that rate (led_stream.h)
 
 // Generate the complete HTML with embedded schema
 static const char INDEX_HTML_PREFIX[] PROGMEM = R"HTML(
@@ -143,6 +146,11 @@ static const char INDEX_HTML_PREFIX[] PROGMEM = R"HTML(
        <div class="actions" id="autoGlobalsActions" style="display:none;margin-top:8px">
          <button class="btn" id="applyGlobals">Write Settings</button>
        </div>
+     </div>
+     <div class="card" id="previewCard">
+       <div class="pill">Live preview</div>
+       <div class="row"><label>Stream</label><div class="switch"><input id="previewOn" type="checkbox"/><span>leader / follower</span></div><span id="previewInfo" class="pill">&nbsp;</span></div>
+       <canvas id="previewCanvas" width="560" height="72" style="width:100%;height:auto;display:none"></canvas>
      </div>
       <div class="tabs">
        <button class="tab active" data-target="leaderCard">Leader</button>
@@ -514,7 +522,7 @@ async function stopAuto(){ try{ await http('/api/auto/stop',{method:'POST'}); AU
 function updateAutoStatus(){ const pill=$('autoStatus'); if(!pill) return; const startBtn=$('autoStart'); if(startBtn){ const totalFavs = Array.isArray(FAVS)?FAVS.length:0; startBtn.disabled = (totalFavs===0 || AUTO_CFG.selections.length===0); }
   if(!AUTO_CFG.on){ pill.textContent='stopped'; pill.style.borderColor='var(--outline)'; pill.style.color='var(--muted)'; return; } const nm=AUTO_CFG.current&&AUTO_CFG.current.name?AUTO_CFG.current.name:''; const rem=(typeof AUTO_LOCAL_REMAIN==='number')?Math.max(0,Math.floor(AUTO_LOCAL_REMAIN)):0; pill.textContent = (nm? nm+' • ' : '') + rem + 's left'; pill.style.borderColor='var(--accent2)'; pill.style.color='var(--accent2)'; }
 
-async function localAutoTick(){ if(!AUTO_CFG.on){ updateAutoStatus(); return; } if (AUTO_LOCAL_REMAIN>0){ AUTO_LOCAL_REMAIN -= 1; updateAutoStatus(); return; } if (AUTO_STATUS_FETCHING) { return; } try{ AUTO_STATUS_FETCHING=true; await loadAutoConfig(); updateAutoStatus(); } catch(_){} finally { AUTO_STATUS_FETCHING=false; } }
+async function localAutoTick(){ if(!AUTO_CFG.on){ updateAutoStatus(); return; } if (AUTO_LOCAL_REMAIN>0){ AUTO_LOCAL_REMAIN -= 1; updateAutoStatus(); return; } if (AUTO_STATUS_FETCHING || PUSH_LIVE) { return; } try{ AUTO_STATUS_FETCHING=true; await loadAutoConfig(); updateAutoStatus(); } catch(_){} finally { AUTO_STATUS_FETCHING=false; } }
 
 function startAutoStatusPolling(){ stopAutoStatusPolling(); // seed remaining from current if present
   if (typeof AUTO_LOCAL_REMAIN !== 'number' || AUTO_LOCAL_REMAIN<=0){ AUTO_LOCAL_REMAIN = Math.max(0, parseInt(AUTO_CFG.current&&AUTO_CFG.current.remaining||0,10)); }
@@ -531,10 +539,37 @@ async function refreshAutoBannerState(){ if (AUTO_BANNER_FETCHING) return; try{
  updateAutoBanner(); const rollover = prevOn && AUTO_BANNER_ON && (prevRemain<=0) && (AUTO_BANNER_LOCAL_REMAIN>0) && (AUTO_BANNER_NAME!==prevName || AUTO_BANNER_LOCAL_REMAIN>prevRemain); if (rollover){ const mode=document.querySelector('.navlink[data-mode].active')?.dataset.mode; if (mode!=='auto'){ try{ await loadState(); }catch(_){} } } } catch(_) { /* ignore */ } finally { AUTO_BANNER_FETCHING=false; } }
 
 function startAutoBannerPolling(){ stopAutoBannerPolling(); // seed once
- refreshAutoBannerState(); AUTO_BANNER_TIMER = setInterval(async ()=>{ if (AUTO_BANNER_ON){ if (AUTO_BANNER_LOCAL_REMAIN>0){ AUTO_BANNER_LOCAL_REMAIN -= 1; updateAutoBanner(); } else { await refreshAutoBannerState(); } } else { // occasionally check if Auto turned on (every 5s)
- AUTO_BANNER_OFF_TICKS = (AUTO_BANNER_OFF_TICKS+1)%5; if (AUTO_BANNER_OFF_TICKS===0){ await refreshAutoBannerState(); } }
+ refreshAutoBannerState(); AUTO_BANNER_TIMER = setInterval(async ()=>{ if (AUTO_BANNER_ON){ if (AUTO_BANNER_LOCAL_REMAIN>0){ AUTO_BANNER_LOCAL_REMAIN -= 1; updateAutoBanner(); } else if (!PUSH_LIVE) { await refreshAutoBannerState(); } } else { // occasionally check if Auto turned on (every 5s)
+ AUTO_BANNER_OFF_TICKS = (AUTO_BANNER_OFF_TICKS+1)%5; if (AUTO_BANNER_OFF_TICKS===0 && !PUSH_LIVE){ await refreshAutoBannerState(); } }
  }, 1000); }
 
+// ----- Push channel (ws_push.h): while the socket is open the leader sends changes and the timers above only count down -----
+let PUSH_LIVE=false; let PUSH_RETRY=null; let PUSH_SOCKET=null;
+function pushUrl(){ const port = location.port ? Number(location.port)+1 : 81; return 'ws://'+location.hostname+':'+port+'/ws'; }
+function applyPushRole(prefix, d){ if (d.animIndex!==undefined){ $(prefix+'_anim').value=String(d.animIndex); buildControlsFor(prefix); }
+ (Array.isArray(d.params)?d.params:[]).forEach(p=>{ if (!p || typeof p.id!=='number' || typeof p.value!=='number') return; setParamValueByPid(prefix+'_paramContainer', p.id, p.value); if (prefix==='L' && p.id>=20 && p.id<=22) setParamValueByPid('G_paramContainer', p.id, p.value); }); }
+function onPush(m){ if (m.reload){ loadState().catch(()=>{}); return; }
+ if (m.frames!==undefined){ const i=$('previewInfo'); if(i) i.textContent = m.frames? (m.frames+' fps') : '\u00a0'; return; }
+ if (m.auto){ const a=m.auto; AUTO_BANNER_ON=!!a.on; AUTO_BANNER_NAME=(a.on && a.name)? String(a.name) : ''; AUTO_BANNER_LOCAL_REMAIN=Math.max(0, parseInt(a.remaining||0,10));
+  AUTO_CFG.on=!!a.on; AUTO_CFG.current={ name:AUTO_BANNER_NAME, id:a.id, remaining:AUTO_BANNER_LOCAL_REMAIN }; AUTO_LOCAL_REMAIN=AUTO_BANNER_LOCAL_REMAIN;
+  if (AUTO_BANNER_TIMER) updateAutoBanner(); if (AUTO_STATUS_TIMER) updateAutoStatus(); }
+ if (m.leader) applyPushRole('L', m.leader); if (m.follower) applyPushRole('F', m.follower); }
+function connectPush(){ if (!('WebSocket' in window)) return; let ws; try{ ws=new WebSocket(pushUrl()); }catch(_){ return; }
+ ws.binaryType='arraybuffer'; PUSH_SOCKET=ws;
+ ws.onopen=()=>{ PUSH_LIVE=true; previewSubscribe(); };
+ ws.onmessage=(ev)=>{ if (typeof ev.data!=='string'){ drawPreviewFrame(ev.data); return; } try{ onPush(JSON.parse(ev.data)); }catch(e){ console.warn('push message', e); } };
+ ws.onclose=()=>{ PUSH_LIVE=false; PUSH_SOCKET=null; clearTimeout(PUSH_RETRY); PUSH_RETRY=setTimeout(connectPush, 5000); }; } // polling resumes meanwhile
+
+// ----- Live LED preview (led_stream.h): binary frames on the push socket while the switch is on -----
+const PREVIEW_FPS=15;
+function previewSubscribe(){ const on=!!($('previewOn') && $('previewOn').checked); const c=$('previewCanvas'); if(c) c.style.display=on?'':'none';
+ if (PUSH_SOCKET && PUSH_SOCKET.readyState===1) PUSH_SOCKET.send(JSON.stringify({ frames:on?PREVIEW_FPS:0, roles:3 })); else if(on){ const i=$('previewInfo'); if(i) i.textContent='no push socket'; } }
+// Header: 'L', version 1, role, flags, seq u32, tMs u32, count u16 (little endian), then count bytes 0..255; one row per role
+function drawPreviewFrame(buf){ const d=new DataView(buf); if (buf.byteLength<14 || d.getUint8(0)!==76 || d.getUint8(1)!==1) return; const role=d.getUint8(2), n=d.getUint16(12,true); if (role>1 || buf.byteLength!==14+n) return;
+ const c=$('previewCanvas'); if(!c || c.style.display==='none') return; const g=c.getContext('2d'); const rowH=c.height/2, cell=c.width/Math.max(1,n);
+ g.clearRect(0,role*rowH,c.width,rowH);
+ for(let i=0;i<n;i++){ const v=d.getUint8(14+i); g.fillStyle='rgb('+v+','+Math.round(v*0.85)+','+Math.round(v*0.6)+')'; g.fillRect(i*cell+1, role*rowH+4, Math.max(1,cell-2), rowH-8); } }
+
 function stopAutoBannerPolling(){ if (AUTO_BANNER_TIMER){ clearInterval(AUTO_BANNER_TIMER); AUTO_BANNER_TIMER=null; } AUTO_BANNER_FETCHING=false; AUTO_BANNER_OFF_TICKS=0; const pill=$('autoBanner'); if(pill){ pill.style.display='none'; pill.textContent='\u00a0'; pill.style.borderColor='var(--outline)'; pill.style.color='var(--muted)'; } }
 
 
@@ -751,7 +786,8 @@ async function init(){
   await buildSchema();
   buildAnimSelect($('L_anim')); buildAnimSelect($('F_anim'));
   buildControlsFor('L'); buildControlsFor('F'); buildGlobals();
-  initTabs(); buildGrids(); setMode('normal'); startAutoBannerPolling();
+  initTabs(); buildGrids(); setMode('normal'); startAutoBannerPolling(); connectPush();
+  const pv=$('previewOn'); if(pv){ pv.addEventListener('change', previewSubscribe); }
   // Wire Import / Export action buttons
   const btnImport=$('btnImport'); if(btnImport){ btnImport.addEventListener('click', (e)=>{ e.preventDefault(); doImport(); }); }
   const btnExport=$('btnExport'); if(btnExport){ btnExport.addEventListener('click', (e)=>{ e.preventDefault(); doExport(); }); }
@@ -763,7 +799,7 @@ async function init(){
     const btn=$('apply'); if(btn) btn.disabled=true; setStatus('saving…','saving');
     try {
       // If Auto is running, confirm with the user
-      let autoOn=false; try{ const r=await http('/api/state', undefined, {silent:true}); if(r.ok){ const s=await r.json(); autoOn = !!s.autoOn; } }catch{}
+      let autoOn=PUSH_LIVE && AUTO_BANNER_ON; if (!PUSH_LIVE){ try{ const r=await http('/api/state', undefined, {silent:true}); if(r.ok){ const s=await r.json(); autoOn = !!s.autoOn; } }catch{} }
       if (autoOn){ const ok = window.confirm('Auto mode is running. Applying settings will stop Auto. Continue?'); if(!ok){ setStatus('', ''); return; } }
       const g=gatherGlobals(); const L=gather('L'); const F=gather('F');
       console.log('Applying CFG2', {globals:g, leader:L, follower:F});
@@ -0,0 +1,1023 @@
+// Generated by test-ui/gen_index_gz from web_ui.h and anim_schema.h; do not edit.
+// The index page gzipped for serving with Content-Encoding: gzip, and an ETag over the
+// uncompressed page. Rebuild test-ui (or its index_gz target) after changing either input.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define INDEX_HTML_ETAG "\"7ea1395b07f001ee\""
+static const size_t INDEX_HTML_LEN = 61104; // uncompressed
+static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xed,0x7d,0xdb,0x76,0xdb,0x48,
+  0x92,0xe0,0xbb,0xbf,0x22,0x2d,0x57,0x9b,0x40,0x89,0x84,0x48,0xea,0x6a,0xd2,0x90,
+  0xd6,0xe5,0xb2,0xca,0xda,0x96,0x2f,0xc7,0x72,0x55,0xed,0x1c,0x97,0xd7,0x07,0x24,
+  0x40,0x11,0x65,0x10,0x60,0x03,0xa0,0x2e,0x45,0xeb,0x9c,0xf9,0x8c,0x7d,0xde,0x87,
+  0x7d,0xde,0x6f,0xea,0x2f,0xd9,0x88,0xc8,0x0b,0x32,0x71,0x21,0x29,0xb7,0xbb,0xa7,
+  0x67,0xb6,0xa7,0xa6,0x2d,0x22,0x2f,0x91,0x91,0x91,0x91,0x11,0x91,0x91,0x91,0x99,
+  0x0f,0x9e,0x3e,0xf4,0x93,0x71,0x7e,0x3b,0x0f,0xd8,0x34,0x9f,0x45,0xc7,0x0f,0x9e,
+  0xe2,0x1f,0x16,0x79,0xf1,0xa5,0xbb,0x15,0xc4,0x5b,0x98,0x10,0x78,0xfe,0xf1,0x03,
+  0xc6,0x9e,0xce,0x82,0xdc,0x63,0xe3,0xa9,0x97,0x66,0x41,0xee,0x6e,0x2d,0xf2,0x49,
+  0xe7,0x68,0x8b,0xed,0x14,0x59,0xb1,0x37,0x0b,0xdc,0xad,0xab,0x30,0xb8,0x9e,0x27,
+  0x69,0xbe,0xc5,0xc6,0x49,0x9c,0x07,0x31,0x14,0xbd,0x0e,0xfd,0x7c,0xea,0xfa,0xc1,
+  0x55,0x38,0x0e,0x3a,0xf4,0xd1,0x0e,0xe3,0x30,0x0f,0xbd,0xa8,0x93,0x8d,0xbd,0x28,
+  0x70,0x7b,0xed,0x99,0x77,0x13,0xce,0x16,0x33,0xf9,0x2d,0xe1,0xe6,0x61,0x1e,0x05,
+  0xc7,0xe7,0x80,0x41,0x90,0xb2,0xe7,0x00,0x2f,0x4d,0xa2,0xec,0xe9,0x0e,0x4f,0xc6,
+  0x02,0x59,0x7e,0xcb,0x7f,0x31,0x36,0x48,0x93,0x24,0x5f,0x76,0x3a,0xa3,0xcb,0xc1,
+  0xa3,0xee,0xa4,0xd7,0xeb,0x1d,0x0c,0x3b,0x9d,0xb9,0x17,0x07,0xd1,0xe0,0x51,0x6f,
+  0xbf,0x77,0xd4,0xc7,0xef,0x3c,0xb8,0xc9,0x07,0x8f,0x82,0x03,0xf8,0x6f,0x02,0x9f,
+  0xb3,0x45,0x1e,0xf8,0x83,0x47,0x4f,0x3c,0x6f,0x6f,0xd4,0x87,0x6f,0x6f,0x3c,0x06,
+  0x8c,0x7b,0x83,0x47,0x87,0xe3,0x5d,0x2f,0xf0,0x8b,0x94,0xce,0x74,0xf0,0xe8,0x68,
+  0xb4,0x3f,0x9e,0x1c,0xa8,0xb4,0x3e,0x34,0x73,0x30,0x3a,0xf0,0xf7,0x20,0x25,0x59,
+  0xe4,0x51,0x18,0x07,0x83,0x47,0xfd,0xdd,0xfe,0xd1,0xee,0x08,0x52,0x26,0xc9,0x78,
+  0x91,0x69,0x25,0x7c,0xa0,0x68,0x90,0x42,0xd3,0x93,0x3d,0xf8,0xbf,0x3b,0xc2,0xf8,
+  0xfb,0xe5,0x28,0xb9,0xe9,0x64,0xe1,0x1f,0x61,0x7c,0x39,0x18,0x25,0x29,0x74,0xb2,
+  0x03,0x29,0xc3,0xce,0x75,0x30,0xfa,0x1c,0xe6,0x9d,0xdc,0x9b,0x77,0xa6,0xe1,0xe5,
+  0x34,0x82,0xff,0xe5,0x9d,0x71,0x12,0x25,0xe9,0x20,0x4f,0xbd,0x38,0x9b,0x7b,0x29,
+  0x20,0xc0,0x81,0x8c,0x12,0xff,0x76,0x39,0xf3,0xd2,0xcb,0x30,0x1e,0x74,0x87,0x13,
+  0xa0,0xd1,0xa0,0xb7,0x37,0xbf,0xd9,0xe9,0x39,0x7b,0x2c,0xbb,0xcd,0xf2,0x60,0xd6,
+  0x59,0x84,0xed,0x8b,0xe0,0x32,0x09,0xd8,0xcf,0x67,0xed,0x77,0xc9,0x28,0xc9,0x93,
+  0xf6,0xcb,0x20,0xba,0x0a,0xf2,0x70,0xec,0xb5,0x9f,0xa5,0x30,0x0e,0xc3,0x91,0x37,
+  0xfe,0x7c,0x99,0x26,0x8b,0xd8,0x1f,0x5c,0x79,0xa9,0x85,0x54,0xb4,0x87,0xbc,0x45,
+  0xfe,0x8d,0x84,0xb3,0x15,0x66,0xd8,0x4c,0x27,0x9b,0x01,0xc1,0xa7,0x88,0xbb,0x17,
+  0xe3,0x60,0x86,0x5e,0x16,0xf8,0x1c,0xa9,0x29,0x8d,0xd8,0x72,0xee,0xf9,0x3e,0xe6,
+  0x23,0x42,0xac,0x77,0x34,0xbf,0x19,0xaa,0x5e,0xe6,0x79,0x32,0x1b,0xf4,0x20,0x39,
+  0x4b,0xa2,0xd0,0x67,0xbc,0x11,0x41,0x46,0x7b,0xe8,0x87,0xd9,0x3c,0xf2,0x6e,0x07,
+  0x93,0x28,0xb8,0x19,0x02,0xe4,0xcb,0xb8,0x13,0x42,0x4f,0xb2,0x01,0x12,0x3e,0x48,
+  0x87,0x97,0xde,0x7c,0xd0,0xeb,0x23,0xbc,0x02,0x6f,0xac,0xe9,0xa5,0x9d,0xcb,0xd4,
+  0xf3,0x43,0x28,0x65,0xf5,0x8e,0xba,0x7e,0x70,0xd9,0x7e,0xd4,0xeb,0xf7,0xf6,0xfb,
+  0xfb,0x6d,0xc1,0x13,0xb6,0x40,0xb0,0x67,0xd2,0x0c,0x47,0x21,0x18,0xf4,0x0e,0x01,
+  0x24,0x7d,0x5e,0x07,0x48,0xf3,0xc1,0x41,0xb7,0x3b,0x8c,0x82,0x1c,0x9a,0xec,0x00,
+  0xd1,0xc7,0xd8,0x17,0x67,0x7f,0x7e,0xc3,0x61,0x38,0xc8,0xe0,0x1e,0xb4,0x9a,0x02,
+  0xac,0x1b,0xce,0xd8,0x83,0x27,0x07,0x5d,0x80,0x21,0x61,0x33,0x6f,0x91,0x27,0x43,
+  0x45,0x06,0xa4,0x80,0xec,0xda,0x65,0x1a,0xfa,0xbc,0x1f,0x47,0x05,0x40,0x2f,0xf5,
+  0x97,0x95,0xa1,0x20,0x1e,0xb6,0x05,0xe9,0x9a,0x69,0x26,0x48,0x8b,0xdd,0x07,0xce,
+  0x43,0x92,0x17,0x0d,0x1f,0x10,0xe9,0x81,0xd7,0xa6,0x9e,0x9f,0x5c,0x03,0x5e,0xd0,
+  0x26,0xeb,0xe3,0xa8,0xa4,0x97,0x23,0xcf,0xea,0xb6,0xf1,0x3f,0xa7,0x7f,0x64,0x0f,
+  0xe7,0x49,0x06,0x33,0x33,0x89,0x07,0x69,0x10,0x79,0x79,0x78,0x15,0x08,0xd4,0xd2,
+  0xe4,0x7a,0x69,0xa2,0x0e,0xff,0x00,0x57,0xcc,0x20,0x25,0x0f,0x90,0x39,0x17,0xb3,
+  0x18,0x9b,0xed,0xe2,0x50,0x4f,0x52,0x76,0x84,0xc3,0x43,0xfd,0x43,0x82,0xd4,0x8c,
+  0xa1,0xa0,0x11,0x66,0xb3,0x6e,0xd1,0x0a,0xc8,0x9e,0x51,0x10,0x2d,0x75,0xde,0xa3,
+  0x59,0x6a,0xeb,0xe3,0x84,0xb0,0x6b,0xc6,0x65,0x88,0x5c,0xda,0xa1,0x29,0x32,0x49,
+  0xd2,0xd9,0x60,0x31,0x9f,0x07,0xe9,0x18,0xd8,0x92,0x83,0x0f,0xe3,0xf9,0x22,0xff,
+  0x80,0xc2,0xce,0x4d,0x71,0x3a,0x7e,0x5c,0xf2,0x31,0xeb,0x75,0xbb,0x7f,0x52,0x43,
+  0x36,0x9c,0xf2,0xa1,0xef,0x1f,0x99,0xec,0x55,0x99,0x78,0x1a,0xb4,0x78,0x31,0x1b,
+  0x05,0xe9,0xc7,0x76,0x16,0x44,0xc1,0x38,0xd7,0xa1,0x6a,0x00,0x1e,0x75,0xc7,0xc0,
+  0x82,0x47,0xf7,0x1c,0xc7,0x27,0x80,0x45,0x75,0x1e,0xca,0x81,0xc5,0x61,0x7c,0x22,
+  0x78,0x76,0xd0,0xdb,0x45,0x90,0x72,0xca,0x37,0x21,0x39,0x20,0xc9,0x24,0x50,0xe5,
+  0x1f,0x4b,0x29,0xbe,0xfa,0x25,0x9c,0x28,0xd7,0x1e,0x8a,0xec,0x4e,0x32,0x99,0x80,
+  0xe8,0x1f,0x88,0xc1,0x12,0x9d,0xf5,0x80,0xc6,0x1e,0xd0,0x66,0x1c,0x0c,0xe2,0x24,
+  0x0e,0xb4,0x1e,0x77,0xc2,0x99,0x77,0x19,0x54,0xe6,0xe5,0xde,0x3e,0x4e,0x4b,0x8d,
+  0x9c,0x6c,0xef,0xc9,0x9f,0xda,0xfa,0x48,0xb3,0xfd,0xee,0x9f,0xec,0x76,0x65,0x3e,
+  0xef,0x52,0x45,0xa3,0x20,0xd6,0xd4,0x21,0x61,0x45,0x1d,0x03,0xc5,0xcd,0xa0,0x56,
+  0xc6,0x16,0x8e,0x08,0xeb,0x30,0x9c,0x1a,0xd0,0xc6,0xde,0x9f,0xda,0x7a,0xea,0x13,
+  0x91,0xa8,0x57,0x27,0x66,0x83,0xb9,0xc3,0x70,0xfe,0x30,0x2d,0x23,0x0d,0xa0,0xd3,
+  0x39,0x74,0x58,0xfc,0x92,0x03,0xd2,0x49,0x89,0x77,0x76,0xbb,0x6a,0x4a,0xe7,0xd7,
+  0x09,0x0c,0xdf,0x46,0x53,0x07,0x26,0x0d,0xfc,0xaf,0x2c,0x13,0x72,0x6f,0x94,0xa9,
+  0xea,0x48,0xe1,0x22,0x7d,0x89,0xe2,0x71,0xd0,0x1b,0x36,0x0f,0x01,0x68,0xbe,0x51,
+  0xbf,0xbb,0xdb,0x5d,0xcb,0x74,0x35,0xd3,0x4d,0x09,0x8f,0xae,0x20,0x00,0x31,0x19,
+  0x48,0x44,0x66,0x32,0x5a,0x59,0xf0,0xe0,0x74,0x1f,0x2f,0xd2,0x0c,0xe0,0xcd,0x93,
+  0x90,0xa6,0x3a,0x0d,0x11,0x1f,0x08,0xa7,0x77,0x94,0x69,0x94,0x6c,0x53,0xc3,0x45,
+  0x97,0x1c,0x6f,0x8c,0x42,0xa7,0x2a,0x04,0x85,0x1e,0x96,0x98,0x3e,0x9a,0x4c,0x26,
+  0xb2,0x61,0x1d,0x77,0x59,0x4c,0x40,0x1c,0xe5,0x71,0x95,0x41,0xeb,0x49,0xa1,0x1a,
+  0xd8,0xa8,0xe9,0x82,0x16,0x7b,0x06,0x2d,0x14,0xd1,0x7a,0x25,0x8d,0x27,0xa9,0xd3,
+  0xaf,0x52,0xa7,0x4e,0x90,0xcd,0xc2,0x58,0x28,0x94,0xde,0x7e,0xb7,0x2c,0xbc,0x49,
+  0x9b,0xe2,0x3f,0x1d,0x9c,0xb0,0x8f,0xba,0xdd,0x2e,0xd8,0x53,0x30,0x33,0x59,0x57,
+  0xfc,0x67,0xe0,0xdd,0x99,0xda,0xc6,0x00,0xf4,0xfb,0xc6,0x00,0x30,0x4a,0x50,0x32,
+  0x53,0x7c,0x17,0xed,0x15,0x94,0x1c,0x4c,0x93,0x2b,0xd0,0x75,0x4d,0xf4,0x81,0x76,
+  0xb4,0xb2,0x62,0x1c,0x0b,0x59,0x4c,0xbf,0x90,0xe1,0xff,0xcd,0x02,0xda,0xd8,0x66,
+  0x8f,0xb0,0x1f,0x47,0x7a,0x87,0x04,0xa4,0x79,0x18,0x45,0xca,0x8a,0xd8,0x13,0xc2,
+  0xae,0x24,0x20,0x9f,0x48,0x01,0x28,0x74,0x43,0x4f,0x15,0xb9,0x17,0xbb,0xcb,0x29,
+  0x16,0xc6,0x24,0xeb,0x46,0x51,0x32,0xfe,0x2c,0x94,0x82,0x34,0x57,0xf6,0x56,0x68,
+  0x98,0xca,0x28,0x1e,0xaa,0x19,0x9c,0x5d,0x87,0xf9,0x78,0xba,0x34,0x6c,0x1a,0x65,
+  0xc0,0x54,0x15,0xa3,0x51,0x8b,0x0b,0x70,0x8d,0x8c,0x64,0x20,0x5b,0x3d,0x47,0xb2,
+  0xf8,0xa3,0x2c,0xf7,0x72,0x10,0xe1,0x05,0xc3,0x1c,0x76,0x25,0x9a,0x04,0xdb,0x84,
+  0x8a,0xc3,0x92,0xc4,0x59,0x0d,0x32,0x7b,0xf5,0x5a,0x1a,0x0b,0x74,0xae,0x53,0x28,
+  0x81,0xff,0x70,0x28,0x3b,0xdf,0xb3,0xd7,0xde,0xd5,0xc8,0x4b,0xd9,0xf7,0x3b,0x1c,
+  0x6c,0xec,0x5d,0x2d,0x37,0xb2,0xd9,0xb0,0x95,0x42,0x3d,0xde,0xa9,0xda,0x40,0xf3,
+  0xcf,0x99,0x30,0xc9,0x3a,0x51,0x30,0xc9,0x07,0x64,0x39,0x55,0xd0,0x2c,0xe4,0xa2,
+  0xa8,0x54,0x67,0x28,0x50,0xe7,0xfd,0x60,0x9c,0xa4,0x1e,0xb1,0x3c,0x4d,0x7b,0x5d,
+  0x65,0xf6,0xba,0x15,0x36,0x3a,0xda,0x80,0x6b,0x6a,0xe4,0x6a,0x83,0x4c,0x34,0x71,
+  0x5c,0x2f,0xd4,0x56,0x48,0x32,0x4d,0xea,0x94,0xa0,0x02,0x71,0xbc,0x51,0x14,0xf8,
+  0xcb,0x04,0x79,0x2e,0xbf,0x05,0xc9,0x31,0x14,0x32,0xa5,0x13,0x5c,0x41,0xe5,0x4c,
+  0xd7,0x17,0x53,0x6f,0x36,0x5a,0xa4,0xb0,0x06,0x31,0x94,0xc9,0xdf,0xaa,0x2b,0xb8,
+  0x39,0x52,0x25,0x65,0x85,0xda,0xda,0x04,0x3d,0x28,0x74,0x5b,0x92,0x44,0xc0,0x46,
+  0xcb,0xba,0x61,0x1e,0xea,0xcc,0xa0,0x86,0xfd,0xbf,0xcd,0x02,0x3f,0xf4,0x98,0x55,
+  0x18,0xdc,0x87,0x5d,0x00,0x6f,0x2f,0x29,0xb7,0xb6,0x9b,0xc6,0x4c,0x26,0x68,0x42,
+  0xba,0x68,0x08,0x94,0x19,0x4f,0x15,0x50,0xac,0xa9,0x2c,0x09,0x50,0xc7,0xa0,0xb0,
+  0xf3,0x60,0x98,0x27,0xf3,0xc1,0x3e,0xf2,0x33,0xd7,0xf9,0x34,0x9b,0x69,0xb6,0xf8,
+  0x61,0x1a,0x8c,0xb9,0xd5,0x41,0xaa,0xbd,0xb0,0x82,0xbf,0x91,0x69,0xdf,0xd7,0x4d,
+  0xfb,0xae,0xb6,0xa6,0xa0,0x11,0xfd,0xa3,0x13,0xc6,0x3e,0xd8,0x05,0x20,0x18,0x9f,
+  0x54,0xfa,0xe1,0x24,0xf3,0x20,0x36,0xe8,0xcd,0x8b,0xa8,0x89,0x7d,0xfe,0xe2,0x47,
+  0x86,0xf6,0x89,0x9a,0xda,0xc0,0x60,0x1d,0x4c,0xd8,0xc4,0x84,0xe1,0xc6,0x90,0x75,
+  0xd8,0xde,0xeb,0xa3,0x88,0x57,0xfd,0xfe,0x7d,0x91,0xe5,0xe1,0xe4,0xb6,0x23,0x3c,
+  0x02,0x52,0x22,0xe8,0x7d,0x10,0x1c,0xe1,0x27,0xd2,0x7c,0x46,0x10,0xd2,0x16,0xa7,
+  0xdf,0x26,0x11,0xf6,0xd1,0xb8,0xbe,0xcf,0x7c,0xf5,0x7a,0x93,0x7e,0x50,0x27,0xf8,
+  0x4b,0xda,0xb8,0x98,0xd1,0xfd,0x9a,0x19,0x0d,0xf8,0x39,0x49,0xdc,0x34,0x93,0xfb,
+  0x6a,0xb6,0x76,0xbb,0xbd,0xae,0xb2,0xf5,0x6b,0xe6,0x75,0xdf,0x6e,0xe2,0xe7,0xa3,
+  0x03,0x83,0x9f,0x71,0xdd,0xd5,0x60,0x2f,0xf6,0xe5,0x52,0xeb,0x50,0xd1,0x6f,0xc3,
+  0x49,0x52,0x32,0x4a,0x69,0x86,0x14,0x73,0x42,0x37,0x38,0x0b,0xfd,0x50,0x2c,0x6b,
+  0x3b,0xc8,0xf9,0x9d,0x3d,0xd9,0xa6,0x82,0x27,0xd6,0xaf,0x06,0x33,0x6a,0x35,0x7a,
+  0x4d,0x35,0xa4,0x78,0x34,0x27,0xac,0x17,0xc3,0xf2,0x81,0x66,0xd1,0xc4,0xf3,0x03,
+  0xb0,0x4a,0xf6,0x33,0x59,0xbb,0xec,0x5d,0xe8,0x0b,0x7b,0x48,0x41,0x2f,0x16,0xe6,
+  0xba,0x07,0x42,0x55,0xef,0x2d,0xeb,0xa4,0x91,0xa0,0xdd,0xe7,0xe0,0x76,0x92,0x7a,
+  0xb3,0x20,0x63,0xd8,0xee,0x72,0x92,0x26,0x33,0x25,0x60,0xbb,0xc3,0x5a,0x7b,0x06,
+  0x40,0xd8,0x77,0x79,0xa2,0x8a,0xf5,0xea,0x8b,0x75,0xed,0x3b,0x35,0xcd,0xde,0xe1,
+  0xfa,0x93,0xa1,0xf7,0x0a,0xb0,0x93,0x73,0xad,0xba,0x3e,0x95,0xfe,0x96,0x92,0x0d,
+  0xdb,0xb0,0x9c,0x1d,0x0c,0x64,0xf9,0x0c,0x66,0x03,0xce,0x95,0x45,0x1c,0xa3,0x8a,
+  0x40,0x83,0x65,0xfc,0x79,0x29,0x66,0xd3,0x81,0x29,0x89,0x1e,0xf5,0xfb,0x7d,0x6f,
+  0xd7,0x2f,0xcd,0xaf,0xbd,0x3a,0x7d,0xf8,0xa8,0xff,0x64,0xb7,0xb7,0x77,0xb0,0x69,
+  0xf3,0xf9,0x14,0x96,0x9c,0x4d,0x7d,0x30,0x98,0xe9,0xa0,0x98,0xeb,0x64,0x34,0x0b,
+  0x13,0xe1,0xa8,0x7e,0xda,0x37,0x4e,0x3e,0x81,0x70,0xb1,0x8c,0x95,0x8e,0x40,0xc3,
+  0xd8,0xc4,0xff,0x76,0xc9,0xce,0xa4,0xcc,0x36,0x4f,0x41,0xeb,0xb2,0x3c,0x97,0x9b,
+  0x57,0x31,0x86,0x89,0xdc,0x76,0x0c,0x93,0xba,0x89,0x3c,0xdc,0x25,0x58,0x4f,0xa4,
+  0x55,0xa6,0xc1,0xbd,0x51,0x97,0xb6,0x61,0xdd,0x08,0xcd,0x92,0x3f,0x3a,0xf4,0xf1,
+  0x0f,0xe3,0x09,0xad,0x45,0xea,0xea,0x7f,0xba,0x71,0x2e,0xd6,0x4a,0x4e,0xcd,0xca,
+  0xa8,0x79,0x9c,0xcb,0x1d,0xff,0xbb,0x8c,0x31,0xc8,0x92,0x53,0xef,0x2a,0x49,0xc1,
+  0xd4,0xce,0xd8,0x2c,0xf1,0xbd,0x48,0x69,0x6e,0xfa,0x2a,0x0c,0x97,0x49,0x78,0x13,
+  0xf8,0x43,0x5a,0x28,0x82,0x20,0x5b,0x67,0xad,0x37,0xa8,0x6c,0xad,0x0f,0xba,0xe7,
+  0x70,0x6f,0xdf,0x56,0x76,0x07,0x18,0xf6,0x6a,0xfd,0x46,0x28,0x7c,0x98,0x86,0xbe,
+  0x1f,0xc4,0x1f,0xeb,0xbc,0x18,0x54,0x80,0x9b,0x41,0xcb,0x6f,0x68,0x1d,0x15,0xab,
+  0xa1,0xfe,0x11,0x57,0x5c,0x52,0x13,0xee,0x93,0x7f,0x56,0xf8,0x6a,0xfb,0x7f,0xa2,
+  0x1c,0xc1,0x91,0x87,0xdd,0xab,0xe9,0x10,0x97,0xb8,0x93,0x08,0x06,0x82,0xd6,0x1f,
+  0xc6,0xc0,0x90,0x23,0x04,0xdd,0x82,0x86,0xd3,0x74,0x5f,0xf3,0x94,0x28,0x25,0x23,
+  0xfa,0x25,0x14,0xd5,0x7d,0x69,0x8d,0x6b,0x48,0x58,0x81,0x06,0xf9,0x75,0x10,0xc4,
+  0xa5,0x35,0xa8,0x66,0x2b,0x4d,0xbc,0xab,0x4e,0x14,0x66,0xb9,0x09,0xbf,0xd9,0x04,
+  0x3d,0x32,0x6a,0xea,0x0e,0xdd,0xaf,0x43,0xec,0x2b,0x96,0x4b,0x35,0xae,0xa2,0x1a,
+  0x23,0x10,0xd1,0xc3,0xcd,0xa4,0x65,0x93,0xc7,0xa9,0xb2,0x02,0xd1,0x2a,0xfa,0x01,
+  0xa8,0xfe,0x28,0x5b,0x6a,0xd8,0xf9,0x5e,0x36,0x0d,0xd6,0xb1,0x4d,0x19,0x17,0xe9,
+  0x10,0x46,0xf7,0x1f,0x37,0x06,0xcd,0x0e,0xf5,0x7b,0x87,0x7d,0x4f,0x6b,0xb7,0x71,
+  0x65,0x7d,0x64,0x1a,0x4e,0x6a,0x14,0xd0,0xd8,0x4e,0x3c,0x6c,0x8f,0x21,0xd3,0x41,
+  0x1d,0x39,0x73,0x1f,0x45,0x3c,0xfd,0x0d,0x4f,0xfe,0xc7,0x4f,0xe1,0x7e,0x31,0x85,
+  0x4b,0xb8,0x30,0x07,0xa6,0xc4,0x26,0x0c,0xd7,0xe4,0x00,0x28,0x46,0x39,0x9b,0x87,
+  0x31,0x9a,0x68,0xc2,0xdc,0xef,0x6a,0xe6,0x7e,0x77,0x95,0xb9,0xbf,0xab,0xa9,0x1e,
+  0x0f,0x54,0xcf,0xa1,0x2c,0x0a,0xd4,0xad,0xb5,0xb4,0x35,0x53,0x12,0xdb,0x64,0xbd,
+  0x8c,0x71,0xdf,0x32,0xc8,0xee,0x09,0x6e,0x44,0x4a,0x61,0x24,0xba,0x4a,0x2c,0x55,
+  0xe3,0x57,0xa8,0x18,0x88,0x08,0x6d,0x09,0x76,0x5f,0x61,0xed,0xa5,0x49,0x0e,0xa6,
+  0x9e,0xb5,0x7b,0x80,0x5b,0x4f,0xdc,0xdc,0x7b,0xba,0x23,0xf6,0x28,0x9f,0xee,0xf0,
+  0x9d,0xd4,0xa7,0xb8,0x63,0x47,0x9b,0x97,0x5c,0x3c,0xf0,0xdd,0xcb,0xa7,0x7e,0x78,
+  0xc5,0x42,0xdf,0xdd,0x32,0xe9,0xbd,0x75,0x4c,0x19,0xe3,0xc8,0xcb,0x32,0x77,0x0b,
+  0x68,0x6f,0x26,0x08,0x1a,0x42,0xe2,0x0e,0xa4,0x1a,0x59,0x7a,0x67,0xb6,0x8e,0x05,
+  0xa7,0xfd,0xf5,0xdf,0xff,0x8f,0x28,0xa9,0xfd,0x5b,0xb4,0x2f,0xaa,0xc2,0x62,0x71,
+  0xeb,0x58,0x18,0xcb,0x4f,0xa7,0xbd,0xe3,0x5f,0xc2,0x2b,0xa0,0x76,0xb1,0xfd,0x0a,
+  0x49,0x22,0x97,0x3d,0x85,0xb2,0x5a,0x35,0x5a,0x63,0xaa,0xba,0x98,0xef,0xb1,0x69,
+  0x1a,0x4c,0xdc,0xad,0x47,0x5b,0x30,0x0d,0x73,0x0f,0x94,0xa2,0x1f,0x40,0x51,0x20,
+  0x96,0x17,0x6d,0x95,0x6a,0x32,0xbe,0x10,0xd8,0x3a,0x7e,0x4d,0xd9,0x4f,0x77,0xbc,
+  0xf5,0x90,0xb2,0xe0,0x2f,0x8b,0x80,0xb6,0x1f,0xcb,0xd0,0xb6,0x8e,0x2f,0x54,0x9e,
+  0x09,0xaa,0x09,0x16,0x8a,0xfc,0x2a,0x94,0x67,0x90,0xaa,0xd7,0x7f,0xba,0x03,0x59,
+  0xf4,0xa5,0xd3,0x4c,0x78,0x12,0x8c,0xbe,0x8f,0x16,0x20,0xb2,0x63,0x1a,0xd5,0x51,
+  0x1e,0x9f,0xcd,0xf8,0xb6,0x38,0x6d,0x5e,0xbb,0x5b,0xfc,0x13,0x37,0xc9,0x27,0xe1,
+  0x65,0xa5,0x55,0xe6,0xa5,0xa1,0xd7,0xa1,0xad,0x30,0x59,0x54,0x07,0x8d,0x3b,0xdf,
+  0x57,0x97,0xec,0x66,0x16,0xc5,0x50,0x69,0x9a,0xe7,0xf3,0xc1,0xce,0xce,0xf5,0xf5,
+  0xb5,0x73,0xbd,0xeb,0x24,0xe9,0xe5,0x0e,0x4e,0xe0,0x1d,0x28,0xb1,0xc5,0xf8,0xde,
+  0xfb,0x56,0xbf,0xbb,0xc5,0xf8,0xec,0xe2,0xbf,0x71,0x97,0xfe,0x87,0xe4,0xc6,0xdd,
+  0x42,0xdb,0xa2,0xbf,0x07,0xff,0xbf,0xc5,0x26,0x61,0x14,0xe1,0xd0,0xc4,0xc1,0x16,
+  0xac,0x4c,0xd2,0xe4,0x33,0x60,0x09,0xa6,0x11,0x6e,0xac,0x3c,0xc7,0xc9,0x20,0x53,
+  0x3b,0x12,0xa6,0x4a,0xc0,0xe9,0x34,0xf6,0xe6,0xee,0x16,0x89,0x15,0x23,0xf9,0x77,
+  0x30,0xaa,0x54,0xba,0x64,0xcd,0xc5,0x18,0x4c,0x5f,0xc6,0xff,0x74,0x42,0xea,0x5d,
+  0x27,0x04,0x4a,0x98,0x49,0xc0,0xd5,0x73,0x2f,0x9f,0x32,0x20,0xdf,0xab,0x5e,0x9f,
+  0xed,0x5e,0xf5,0xfa,0x5b,0x3b,0x45,0xda,0xec,0x88,0xf5,0x7a,0x6c,0x0f,0xff,0xeb,
+  0xec,0xe9,0x19,0xaf,0x8e,0xd8,0xfe,0xcb,0x3d,0xaf,0xcf,0xfa,0xdc,0x1d,0xde,0x81,
+  0x5f,0x57,0xbd,0x6e,0x91,0x00,0x7f,0xfb,0xd3,0xde,0x81,0x9e,0xd0,0xe9,0xff,0x72,
+  0xa8,0xd7,0xe8,0xf4,0xa7,0x1c,0x28,0x52,0x51,0x1f,0xd3,0x1d,0x3e,0xa8,0xcd,0xc3,
+  0xfc,0xe2,0xc6,0x18,0x66,0xfe,0xb9,0xd1,0x30,0x8b,0x9a,0xff,0x45,0x87,0x79,0x1c,
+  0x85,0xf3,0x51,0x02,0xcb,0x7d,0x90,0xd1,0xf3,0x5b,0x63,0xb8,0xcd,0x2c,0x18,0x76,
+  0xd4,0x25,0xb2,0x4b,0x47,0x45,0x8f,0x00,0xf9,0x1b,0x4a,0xb8,0x25,0xac,0x52,0xf8,
+  0xe8,0xc1,0x9f,0x5b,0xfc,0x63,0x8e,0xff,0xde,0xcb,0x83,0xf2,0xf8,0xef,0x95,0xc7,
+  0xbf,0x6f,0x8e,0xff,0x55,0xc7,0xe0,0xae,0x57,0xbd,0x03,0xb6,0x37,0x2d,0xca,0xf4,
+  0xb0,0xd2,0x95,0xc9,0x67,0xfd,0x1e,0xeb,0xed,0xbd,0xec,0x19,0x8d,0xcf,0x7a,0xfb,
+  0x60,0x28,0x76,0xf6,0x38,0x63,0x7e,0x15,0x07,0x81,0x3d,0xff,0xcc,0xf7,0x15,0x07,
+  0xc1,0x6f,0x36,0x11,0x26,0xfe,0x6a,0x06,0x32,0x4b,0x4a,0xf7,0xf0,0x7f,0x51,0x7e,
+  0xca,0x72,0x2f,0x35,0xb8,0x08,0x13,0x0c,0x91,0xd1,0x73,0xf6,0xfb,0xfb,0xac,0xef,
+  0xf4,0x9f,0xec,0x7b,0xce,0xfe,0x2e,0xfc,0xbf,0x18,0x49,0xe7,0xc9,0x3e,0xeb,0x46,
+  0x7d,0x67,0x17,0xc4,0x87,0x73,0x70,0xf8,0xc4,0xeb,0x3b,0xbd,0xfe,0x2e,0xe3,0xff,
+  0x72,0x86,0x80,0xba,0x50,0xa8,0xe7,0xf4,0x0e,0xa2,0x7d,0xf8,0xe7,0xc0,0x39,0xdc,
+  0x3f,0x28,0x01,0xe9,0x3f,0xd9,0x73,0x9e,0x74,0xf7,0xa2,0xce,0xae,0x73,0xb8,0x7b,
+  0xc0,0x76,0x9d,0x83,0xdd,0xa3,0x2a,0xa4,0x8e,0x73,0x00,0x52,0xaa,0xe7,0x1c,0x1d,
+  0x1e,0x45,0xce,0xd1,0x51,0x9f,0x01,0xb8,0x3d,0x03,0x52,0xc7,0x39,0x3c,0x84,0xe6,
+  0x0e,0xa2,0x0e,0x20,0xd3,0x3b,0xea,0xf4,0x9d,0xbd,0x3e,0x07,0xd4,0x67,0xfc,0x5f,
+  0x0e,0xa8,0xe7,0x3c,0x39,0x84,0x2a,0xe7,0x07,0xce,0xee,0x93,0x03,0xd6,0xef,0x39,
+  0xdd,0x5e,0x05,0x4e,0x07,0xe1,0x40,0x33,0xbd,0x0e,0x34,0xb3,0xfb,0xa4,0x06,0x0a,
+  0xa2,0xd3,0x41,0x74,0x9e,0x9c,0x43,0xf2,0x01,0x7b,0xe2,0x1c,0x56,0xc8,0x03,0x3d,
+  0xeb,0x40,0xd7,0x78,0xd7,0xf7,0x01,0xee,0xfe,0x7e,0x15,0x12,0x91,0xe8,0xb0,0x83,
+  0x24,0xfa,0xe3,0x6b,0xd9,0xfc,0xcd,0x3c,0x88,0x15,0x9f,0xe3,0x87,0x62,0xdf,0x6c,
+  0x35,0xa7,0x97,0xcb,0xfe,0x17,0xe7,0xf5,0x45,0x86,0x3b,0x8b,0x65,0x86,0x57,0xa9,
+  0x06,0xd7,0x1f,0x38,0xdd,0x7d,0x60,0xb8,0x3e,0x0c,0xf4,0x81,0x07,0x3f,0xc4,0xa0,
+  0x02,0xf7,0x74,0x9f,0x38,0xdd,0xfe,0x5e,0x04,0xdc,0x7a,0x08,0x9f,0x7b,0xfb,0x7d,
+  0x95,0xdd,0x65,0x98,0x08,0x1c,0xb0,0x1f,0xf5,0x80,0x8d,0xf7,0x9c,0xfe,0xbe,0x5e,
+  0xd7,0xd9,0x3f,0x3a,0x42,0x16,0x06,0x8e,0xc0,0xf1,0x3e,0xec,0xd3,0xc4,0x38,0x2a,
+  0xaa,0x77,0x9c,0xfe,0x51,0xdf,0x39,0x3a,0x00,0xde,0xeb,0xef,0x3f,0x81,0xdc,0x83,
+  0xde,0x6e,0x51,0x1f,0xea,0xec,0xef,0x21,0x06,0xbd,0xdd,0x3d,0x04,0xb0,0xc7,0x79,
+  0x4a,0xaf,0xfe,0x04,0xf4,0x7b,0x57,0xe4,0xe9,0x59,0x54,0x77,0xf7,0x09,0xb6,0xba,
+  0xbb,0x8b,0xc0,0x8f,0x3a,0x26,0x70,0xde,0x74,0x87,0xda,0xc6,0x52,0xfb,0x07,0xf4,
+  0xef,0xae,0x81,0xfd,0x61,0x1f,0x39,0xbe,0xdf,0xa7,0xce,0xed,0x76,0x8c,0xde,0xf1,
+  0xae,0x77,0xb0,0xef,0x7f,0x94,0x94,0x48,0x6f,0xff,0xe5,0xa1,0x87,0x62,0x9c,0x37,
+  0x04,0xbf,0xae,0x48,0x45,0x8c,0xc3,0x74,0x1c,0x05,0x6c,0x8c,0xea,0x07,0xf8,0x64,
+  0x0c,0xfa,0xe7,0x10,0xd4,0x10,0xea,0xa7,0x0d,0xe6,0x81,0x66,0x73,0x17,0x53,0x42,
+  0x8c,0xba,0xda,0xbc,0x32,0xb9,0x7d,0x16,0xc4,0x0b,0x91,0x12,0xdc,0xcc,0x3d,0x58,
+  0xa2,0x01,0x82,0x13,0x2f,0xca,0xc0,0x54,0xfe,0xeb,0xff,0xfa,0xbf,0x66,0x13,0x0a,
+  0x3e,0x5f,0x6f,0x18,0xeb,0x0b,0xd1,0x8c,0x72,0x8f,0x4b,0x5b,0x43,0x2d,0x3e,0x60,
+  0x4a,0xbd,0x42,0xcf,0x85,0xe2,0xc3,0x19,0xff,0xe2,0x1e,0x9c,0xa2,0x0f,0x1a,0x30,
+  0xcd,0x83,0x63,0x18,0xbf,0x95,0x22,0x1c,0x1b,0x73,0xfd,0x82,0xfb,0xfb,0x5b,0xc7,
+  0xca,0x81,0x25,0x56,0x25,0x9a,0x9c,0x00,0x84,0x9e,0x47,0x49,0x56,0x55,0x7c,0xc7,
+  0x94,0xac,0xba,0x6e,0x50,0xb5,0xd4,0xa3,0xf3,0x30,0xcb,0x55,0x7d,0xe9,0x34,0xd9,
+  0x2a,0x55,0xd1,0xbf,0x8c,0xdf,0x3a,0xdd,0xc0,0x44,0xd9,0x22,0xa8,0x97,0x51,0x32,
+  0x02,0xfa,0x3f,0xc7,0x84,0x5a,0xaa,0xf0,0x8e,0xfd,0xc4,0x8b,0x95,0x5a,0x92,0xa8,
+  0xfd,0xf4,0x69,0xee,0xc1,0x42,0xf2,0x79,0x31,0x1a,0x35,0x05,0x05,0x3c,0xe1,0x5d,
+  0xe0,0xad,0xe3,0x3a,0x45,0x80,0x7e,0x26,0xd3,0x69,0x91,0xe9,0x6e,0x35,0x6d,0xbe,
+  0x1c,0xcd,0x6f,0xea,0x96,0x26,0x72,0x5d,0x99,0xc7,0x02,0xf2,0x7c,0x1e,0xdd,0x0a,
+  0xd0,0x5b,0xc7,0xbf,0xe2,0xa0,0xb0,0x8b,0x20,0xcf,0x61,0xe9,0x98,0xad,0xe4,0xe4,
+  0xf5,0x24,0x9b,0xa7,0x01,0x4a,0xd4,0x75,0x24,0x3b,0x87,0x05,0x20,0x13,0x65,0x9b,
+  0xc9,0x91,0x26,0xd7,0x40,0x2d,0x9a,0x1e,0xc7,0x17,0x79,0x1a,0x78,0xb3,0xa7,0x3b,
+  0xfc,0xcb,0x58,0x1d,0x53,0x08,0x05,0x14,0x24,0x1f,0xad,0x8e,0xc5,0x1b,0x54,0x3b,
+  0xe8,0xb2,0xdd,0x1a,0x4f,0x83,0xf1,0x67,0x5c,0x57,0xc3,0xd4,0xcd,0x80,0x8b,0x8f,
+  0x23,0x1e,0x6c,0xbc,0xc3,0x26,0x49,0x14,0x25,0xd7,0x41,0x0a,0x33,0x1a,0xd3,0x05,
+  0x6f,0xe2,0x6f,0x1d,0xd2,0x59,0x3c,0x29,0xd6,0x8c,0xbc,0x0b,0x8f,0xe3,0x51,0x36,
+  0x1f,0x1a,0xd5,0x54,0x1f,0xc6,0x5e,0x7c,0xe5,0x65,0x26,0x41,0x30,0x45,0x69,0xa1,
+  0xfd,0x03,0x4d,0x0d,0x1d,0xf6,0xd5,0xc0,0x6a,0x31,0x85,0xc2,0x4b,0x62,0x04,0x48,
+  0x90,0x4a,0x82,0xc6,0x38,0xfc,0x9a,0x41,0x31,0x17,0xab,0xde,0x48,0x5b,0xa5,0x97,
+  0x98,0x01,0x32,0xe5,0x42,0x9c,0x2f,0x8e,0x41,0xc3,0x5c,0x62,0xc4,0x37,0xa7,0x0c,
+  0x1f,0x40,0x1e,0x92,0x5d,0x65,0x89,0x0a,0xa8,0x12,0x0c,0x49,0x54,0x0e,0xe5,0x54,
+  0x91,0xd8,0x84,0xd3,0x3c,0xf0,0xc8,0x4f,0xe8,0xe6,0x0e,0x3a,0x7c,0xb1,0x2e,0xa7,
+  0x03,0xc1,0x13,0x62,0x4a,0x92,0x8c,0xb6,0x4d,0xb9,0x3b,0x6a,0xd0,0x83,0x01,0xed,
+  0xf4,0x9a,0x04,0x14,0x1f,0x37,0xbe,0xd0,0xaf,0x91,0x23,0x35,0x4c,0x77,0x86,0x1e,
+  0xad,0x2b,0x2f,0x62,0xd6,0x2c,0x8c,0x6d,0xc5,0x7c,0x05,0xa3,0x21,0x52,0xb2,0x90,
+  0xe4,0x35,0x1e,0x81,0xb9,0xc5,0x66,0xa8,0xef,0x7b,0x38,0xb4,0xc1,0x9c,0x7e,0x40,
+  0x99,0x45,0x20,0x56,0x31,0x82,0x6b,0x6a,0x98,0xa7,0x19,0x9b,0x77,0xa0,0x13,0x92,
+  0x59,0xf8,0x47,0xb0,0xe1,0x2c,0x40,0xe4,0x54,0x9d,0xc6,0x99,0x90,0x4d,0x17,0x93,
+  0x49,0x14,0x54,0xf9,0x7f,0x13,0xf4,0xb0,0x09,0x90,0xeb,0x17,0xdc,0x2b,0x58,0x91,
+  0x4f,0xeb,0x5d,0xd5,0x66,0x7c,0x70,0x69,0x55,0xbc,0x4e,0x85,0x18,0x85,0x89,0x24,
+  0xb5,0x08,0x34,0x38,0x29,0x4b,0xc2,0x92,0x80,0x98,0xc4,0xbb,0x08,0xa2,0x67,0x51,
+  0x54,0x43,0x39,0x90,0x96,0x18,0x15,0xcb,0x20,0xd7,0xc0,0x41,0x8c,0x4b,0xa5,0x13,
+  0x12,0xe0,0xe9,0x86,0x6a,0xaa,0x3c,0x37,0xea,0xb5,0x84,0xd9,0x4e,0x93,0xac,0xc7,
+  0x7e,0xc0,0xbc,0x84,0x36,0xe8,0x4f,0x8d,0xc5,0x5e,0xa9,0xac,0x8c,0xf1,0x02,0x40,
+  0x32,0xc7,0xfa,0xc9,0xbc,0xbe,0xba,0x12,0x97,0xa2,0xb5,0x7c,0x91,0xad,0x92,0x96,
+  0x4d,0xdd,0x6c,0x96,0x64,0x14,0x47,0xb0,0xd5,0x2c,0x2b,0xa4,0x24,0x23,0xd7,0xaa,
+  0x26,0xc0,0x56,0x09,0x02,0x29,0xdc,0x9a,0x09,0x4d,0x12,0x48,0x38,0x31,0x1b,0x39,
+  0x53,0x9f,0xa1,0xcf,0xa4,0x0b,0x5a,0xcd,0x50,0x1e,0x3e,0x4d,0x78,0x9d,0x7f,0x42,
+  0x0f,0x35,0x0e,0x35,0x4f,0x5c,0x3d,0xcb,0x34,0xce,0x39,0x5f,0x63,0x41,0xac,0xe6,
+  0x16,0xea,0x44,0x16,0xfc,0xa5,0x62,0xde,0x95,0x0b,0xca,0x10,0xa0,0x2d,0xd1,0x28,
+  0x7c,0xff,0x84,0x9f,0x6b,0x5a,0x5b,0x2d,0xc5,0x39,0x30,0x53,0x1f,0xac,0x1a,0x94,
+  0x42,0x57,0xfc,0xa3,0x86,0xe5,0xf4,0x6b,0x87,0xe5,0xf4,0x3f,0x62,0x58,0x4e,0xbf,
+  0x6a,0x58,0xd6,0x5b,0x9c,0xc7,0x2b,0x6d,0xc5,0x46,0x23,0xd1,0x9c,0xf9,0x3f,0x78,
+  0xb4,0x4d,0x61,0x8c,0x68,0x9d,0xc9,0x5a,0x36,0x9e,0x14,0x90,0x6c,0xad,0xe8,0xd0,
+  0xf7,0x32,0xd4,0xcf,0xa7,0xd9,0x38,0x0d,0xe7,0x39,0xfc,0xde,0xd9,0x61,0x17,0x20,
+  0xa7,0x67,0x1e,0xbb,0x0c,0x00,0x15,0x2f,0x0f,0x7c,0xe6,0xdf,0xc6,0xde,0x2c,0x1c,
+  0x7b,0x51,0x74,0xcb,0x30,0xce,0x87,0xe1,0x78,0x7f,0xca,0xa8,0x98,0x33,0x65,0x8b,
+  0x0c,0xf7,0xe6,0xfe,0x47,0x67,0xe6,0x8d,0xd3,0x24,0x7b,0x00,0xab,0xa6,0x2c,0x67,
+  0x17,0xcf,0x5f,0xbe,0x78,0xf5,0xec,0xd3,0x7f,0xbf,0x78,0xf3,0x9a,0xb9,0xac,0xb5,
+  0xdc,0xa2,0xa1,0xce,0xb6,0x06,0x1f,0x96,0x5b,0x40,0xfb,0x41,0xaf,0xbd,0x85,0x5b,
+  0x97,0x5b,0x83,0xad,0x6c,0x1e,0x04,0xfe,0x56,0x7b,0x0b,0x75,0x04,0x7c,0xbe,0x7d,
+  0xff,0xe9,0xdd,0xb3,0xd7,0x3f,0xbd,0x80,0x14,0xd0,0xff,0x90,0xd0,0x75,0xba,0x13,
+  0xfc,0xf0,0x6e,0xe0,0x03,0xd6,0xeb,0xf4,0xe5,0x07,0x13,0xf8,0xda,0xe5,0x1f,0xa3,
+  0x30,0x07,0xc0,0xbd,0xfe,0x5d,0x9b,0xc3,0xee,0x2b,0xd8,0xf3,0xa9,0x07,0x6b,0xa2,
+  0x66,0xd8,0x9d,0x03,0x58,0x16,0xef,0x16,0xe0,0xd5,0x27,0x87,0xdf,0xad,0x87,0xbf,
+  0xab,0xe0,0x93,0xb5,0x69,0xc0,0x3f,0x7b,0xfd,0x5e,0x41,0xef,0xe9,0x98,0x1f,0x35,
+  0x22,0xbe,0x27,0xe1,0xee,0x29,0xb8,0x23,0x8c,0xff,0x31,0x01,0xff,0xf0,0xe6,0xcd,
+  0x79,0x03,0x4d,0x74,0xc8,0x26,0xca,0x12,0xf2,0xbe,0x82,0x1c,0xc6,0x57,0x01,0xa8,
+  0xb2,0x6f,0x06,0xf9,0x40,0x41,0x8e,0x82,0x2b,0x58,0xda,0x6e,0x3a,0x8e,0x26,0xe4,
+  0xfd,0x02,0xf2,0x91,0x84,0x7c,0x58,0x70,0x08,0xf0,0x57,0x14,0x9c,0xe1,0x96,0x6b,
+  0x23,0xad,0x0d,0xe8,0x07,0xbb,0x8d,0x88,0x1f,0x48,0xf0,0x47,0x0a,0x7c,0x4a,0x16,
+  0xde,0xb7,0x23,0x49,0xbf,0xab,0x40,0xf3,0xf5,0xef,0xc5,0x7d,0x38,0x7c,0x4f,0x6f,
+  0xa0,0x67,0x34,0xd0,0x55,0x2d,0xf4,0x4a,0x2d,0xbc,0x02,0x38,0x5f,0x47,0xf9,0x6e,
+  0x0d,0xe5,0xfb,0xfd,0x32,0x78,0xef,0xe6,0xab,0xc0,0xf7,0xea,0xc1,0x17,0xf3,0x67,
+  0xfc,0xcd,0x51,0xdf,0x33,0x60,0x7f,0x25,0xde,0x5d,0xe7,0x68,0xaf,0x96,0xee,0xc5,
+  0x3c,0xf2,0x83,0x28,0xf7,0x36,0x05,0xbe,0xaf,0x03,0xef,0x37,0x8c,0xe9,0x81,0x26,
+  0x11,0xbd,0xf4,0x73,0x99,0x2e,0x1b,0x32,0xfb,0x51,0x2d,0xb3,0xf7,0x0f,0x4b,0xc0,
+  0xbd,0xaf,0x9a,0x49,0xbd,0x7e,0x3d,0xf4,0x62,0x2e,0x25,0xe3,0xdc,0xbb,0x0a,0xb2,
+  0xcd,0x44,0x62,0x33,0xab,0x83,0xa8,0x8d,0x17,0x51,0xf4,0xb1,0xbd,0xa5,0x62,0x12,
+  0x84,0xea,0x20,0x21,0x30,0x28,0x66,0x18,0xda,0xca,0xe1,0x18,0x2a,0x2a,0xfd,0x72,
+  0xf0,0x91,0xf0,0xe2,0x05,0x8b,0x89,0xf2,0x2b,0xe0,0xa5,0x17,0xeb,0xb5,0x59,0xbf,
+  0xcd,0xf6,0xda,0x6c,0x5f,0x2f,0x5f,0x70,0xfe,0xdb,0x45,0x94,0xd5,0x55,0xd0,0x4b,
+  0x17,0x8c,0xfc,0x5c,0x28,0x1a,0xbd,0xf4,0x6e,0xa9,0x74,0xc1,0x9a,0x17,0x24,0xd0,
+  0xf4,0xe2,0x87,0x7a,0xc1,0x82,0xcb,0x2e,0x70,0xb0,0xa2,0x32,0xe0,0x23,0xc0,0xe4,
+  0x00,0xfe,0x67,0x54,0x2a,0xd8,0xe7,0x6d,0x90,0x46,0xc4,0x3c,0x25,0x64,0xfa,0xf8,
+  0x3f,0xe8,0x30,0x70,0x31,0xeb,0x1f,0x7d,0x14,0x24,0xbe,0x6b,0x0d,0x1f,0x3c,0x78,
+  0x30,0x59,0xc4,0x64,0xc7,0xb0,0x39,0x1e,0x5b,0xe7,0x16,0xc0,0xb3,0xd8,0x3f,0x0d,
+  0x6f,0xac,0xdf,0xb3,0x24,0x7e,0x8f,0xc1,0x43,0x0c,0xe3,0xa2,0xb9,0x76,0x47,0x5f,
+  0x05,0xa8,0x75,0xd4,0xee,0x0e,0xd5,0x28,0x4a,0x01,0x34,0x86,0x56,0xc4,0x34,0x88,
+  0xe6,0x41,0xca,0xf2,0x04,0x5d,0xf8,0xe1,0x9c,0x79,0x78,0x76,0x2a,0xa4,0x30,0xde,
+  0xc9,0xce,0x29,0x98,0x10,0x3e,0xc2,0x42,0x65,0x84,0x65,0xf8,0x92,0x5f,0xc1,0x87,
+  0x85,0x5e,0x94,0x78,0x39,0x34,0x71,0xc5,0x5c,0x6e,0xac,0x58,0xc8,0x50,0xc9,0x04,
+  0x13,0x5c,0x30,0x28,0x10,0x68,0x7c,0xd9,0x62,0x8f,0x1f,0xb3,0x9d,0xff,0xd9,0x39,
+  0xf9,0xcd,0xdf,0xb6,0x4e,0x06,0xbf,0x39,0xf0,0xd7,0x3e,0x99,0x7c,0xb7,0x13,0x3a,
+  0xb0,0xc6,0xcd,0xad,0x2b,0xdb,0x16,0x36,0xdb,0x09,0xef,0x19,0x81,0x85,0x64,0x91,
+  0x3a,0x60,0x57,0x84,0x6f,0x38,0x61,0xd6,0xb3,0x34,0xf5,0x6e,0x9d,0x30,0xa3,0xbf,
+  0x16,0xf6,0xd0,0xe1,0x04,0xb4,0x79,0xcf,0x19,0xd3,0xd2,0x9c,0x49,0x92,0xbe,0xf0,
+  0xc6,0x53,0x6b,0x0e,0xf8,0x31,0x19,0x30,0x8e,0x60,0xe6,0xb6,0xfa,0x64,0x6c,0xee,
+  0x00,0xdb,0x43,0x2f,0x44,0x7f,0x2c,0xfa,0x06,0x12,0x69,0xf9,0xde,0x8d,0x99,0xef,
+  0xdd,0x18,0xf9,0x30,0x39,0x8c,0x7c,0xf8,0x56,0xf9,0x22,0x1e,0x9b,0xbe,0xf1,0x77,
+  0x1a,0xe4,0x8b,0x34,0x26,0x34,0x87,0x0f,0xee,0x1e,0x18,0x96,0x18,0x00,0xa9,0x0e,
+  0xad,0x66,0xa4,0x01,0x10,0x5e,0xfc,0x3b,0x28,0x69,0x85,0xbe,0xed,0x1e,0xfb,0xc9,
+  0x78,0x31,0x83,0xd5,0xbe,0x73,0x19,0xe4,0x2f,0xa2,0x00,0x7f,0xfe,0x70,0x7b,0xe6,
+  0x63,0x26,0x10,0x2d,0x0a,0x72,0xf6,0xe9,0x13,0xb7,0x37,0xdf,0x87,0xb3,0x20,0x75,
+  0x91,0x9d,0x86,0x05,0x27,0x65,0x41,0xce,0x17,0xb2,0x16,0x86,0xd6,0xb4,0xd9,0x67,
+  0x60,0x54,0xbb,0x60,0xa1,0x2c,0x77,0xbf,0xb3,0x5a,0xbc,0x7e,0xcb,0x1e,0x02,0xed,
+  0xac,0x87,0x19,0x30,0x19,0xef,0xc4,0x90,0x06,0xc5,0x32,0x1a,0xb0,0x97,0x60,0xd6,
+  0x06,0x5e,0x8a,0x1f,0xc9,0x22,0x2f,0x65,0x0e,0xeb,0xb0,0x21,0xb2,0x64,0xb9,0x83,
+  0x18,0x3c,0xe7,0xe1,0x5d,0x48,0x4d,0xf8,0x62,0x5f,0xbe,0xb0,0xd6,0x6f,0x8b,0x6e,
+  0xd7,0xeb,0xb6,0xb0,0x31,0xec,0x0e,0x8f,0x8f,0x72,0x5b,0x66,0x00,0x5c,0xab,0xcd,
+  0x28,0xc6,0x49,0xa6,0xf3,0x20,0x27,0xaa,0xc4,0x5d,0x46,0x96,0xea,0x19,0xf4,0x0d,
+  0xc4,0x00,0x30,0xa7,0x77,0x85,0xcc,0x39,0x28,0x41,0x94,0x11,0xa9,0xad,0xa1,0x09,
+  0x51,0x4b,0x1f,0xa5,0x81,0xf7,0x79,0x68,0x82,0x0a,0xfc,0xd6,0x40,0x4b,0xc1,0xf5,
+  0x44,0x58,0x4a,0xc3,0x20,0xa6,0x52,0x52,0x40,0x51,0x12,0xa5,0x44,0x1e,0x30,0x52,
+  0x4a,0x04,0x55,0x16,0x14,0x69,0xac,0x16,0xe9,0x7e,0x03,0xd2,0xfd,0x5a,0xa4,0x83,
+  0x34,0x4d,0xd2,0x4a,0xf7,0xf9,0xd5,0x0e,0x15,0x40,0x45,0xb2,0x06,0x07,0xd8,0xdc,
+  0x5b,0x44,0xf9,0xa0,0x48,0x13,0x23,0x49,0x8b,0x21,0x87,0x03,0xa6,0xad,0x44,0x97,
+  0xff,0x1e,0x16,0x99,0x1c,0x3a,0xfd,0xab,0xa5,0x16,0xe1,0x7c,0x6e,0x4b,0x3b,0x0a,
+  0xdd,0x12,0x9c,0xf6,0x41,0x50,0xba,0xad,0xe8,0xdb,0x96,0x54,0x6d,0x17,0xb4,0x6c,
+  0x17,0x14,0x6c,0x2b,0xba,0x7d,0x74,0xc2,0x78,0x1c,0x2d,0xfc,0x20,0xe3,0x9c,0x20,
+  0x58,0xc1,0x64,0x47,0x98,0x0d,0x92,0x6f,0x2d,0x98,0x5b,0xcb,0x12,0x57,0xba,0x8a,
+  0x17,0xeb,0x3b,0x59,0xe6,0xc9,0x4a,0x77,0x4b,0xcc,0x59,0x3f,0x19,0xda,0xac,0xb7,
+  0xd7,0xed,0x0a,0x79,0x01,0x02,0x02,0xc4,0xf4,0x73,0x68,0x3c,0xf5,0x22,0x36,0x09,
+  0xf0,0x14,0xa5,0x10,0xda,0xc0,0xd6,0x53,0x36,0x4f,0xe6,0x0b,0x10,0xdb,0x11,0x48,
+  0xe8,0x8c,0x25,0xb8,0x8d,0x1c,0x46,0x8b,0x34,0x78,0xe0,0x65,0xb7,0xf1,0x98,0xa9,
+  0x69,0x8e,0x3b,0xc6,0xd6,0x22,0x8d,0xda,0x2c,0x99,0x93,0x9e,0x6e,0xb3,0x65,0x16,
+  0x46,0xd8,0x27,0xda,0x7a,0xbb,0x73,0x97,0x77,0x44,0x91,0x3c,0xbd,0x15,0x73,0x84,
+  0xe6,0x7f,0x0a,0x13,0xd1,0xbb,0xf6,0xc2,0x9c,0x37,0x6d,0x80,0x10,0x12,0x0e,0x45,
+  0x42,0xea,0x24,0x9f,0x6d,0x96,0x4f,0xf1,0xc6,0x83,0x38,0xb8,0x66,0x2f,0x90,0xb5,
+  0xac,0xd6,0xcb,0xf7,0xef,0xdf,0xb2,0xd6,0x76,0xea,0xf0,0x5e,0x8a,0x0a,0x42,0x00,
+  0xa6,0xd4,0xc1,0xb1,0x87,0x60,0x03,0x31,0x1a,0x24,0x5e,0x08,0x2d,0x10,0x23,0xd4,
+  0x29,0xab,0xf5,0x0e,0xe3,0xde,0x00,0x15,0xec,0x59,0xe0,0x0f,0x7e,0x8b,0x5b,0xdb,
+  0x80,0xc5,0xf6,0xd6,0x6f,0xf1,0xd6,0xb6,0x15,0x3c,0x7e,0x1c,0x38,0xb3,0x20,0xcb,
+  0xbc,0xcb,0xe0,0x44,0xfd,0x1a,0xb4,0x7e,0x8e,0x3f,0xc7,0xc9,0x75,0xcc,0x38,0x8f,
+  0xdb,0xf6,0x50,0x88,0x61,0x8e,0x62,0xa0,0xd3,0x56,0x1c,0xfe,0x44,0x47,0x85,0x10,
+  0x15,0xa8,0xfd,0xac,0x24,0x86,0x75,0x34,0x45,0x00,0x72,0x42,0xab,0xc8,0x3a,0x74,
+  0xc2,0x31,0x2f,0x63,0xb8,0xed,0x60,0x0b,0x71,0x8c,0xe9,0xe7,0x58,0xd6,0xfd,0xe0,
+  0x38,0x8e,0x12,0xc9,0x80,0x78,0x7a,0xcb,0x7d,0xa8,0x49,0xfa,0x2c,0x8a,0xac,0x96,
+  0x3c,0xba,0xf6,0x41,0x81,0xfb,0xd8,0xb2,0x3f,0x4a,0xa9,0xae,0x76,0x4c,0xdd,0x7a,
+  0x10,0x50,0x5f,0x15,0x69,0x11,0x35,0x75,0x39,0xfe,0x0a,0xa0,0x59,0x08,0x92,0x88,
+  0xa9,0x50,0x52,0x4a,0xd0,0x73,0x8f,0x3d,0x87,0x5c,0x0e,0xe8,0x9c,0x75,0xf2,0xe4,
+  0x12,0xcc,0x1b,0xab,0xc5,0x7d,0x8a,0xad,0xb6,0xe7,0x20,0x4e,0x00,0xc7,0xa1,0xf8,
+  0x41,0xd7,0x25,0x50,0xd4,0xca,0xaa,0x0e,0x69,0x5e,0xaa,0x96,0xad,0xda,0x0a,0x22,
+  0xf7,0x38,0x88,0x1c,0xee,0xf3,0x71,0x09,0xab,0x87,0xae,0xdb,0x92,0xe5,0x36,0x83,
+  0x9a,0x05,0x7f,0x59,0x0f,0xb2,0x08,0x99,0x14,0x60,0x39,0x29,0xe5,0x36,0x8a,0xdb,
+  0xa4,0x1f,0x5b,0xb2,0x04,0x57,0x6b,0xcc,0x92,0xdf,0xb6,0xaa,0x2b,0xda,0x42,0x55,
+  0x2b,0x5b,0xc3,0x2c,0x4e,0x79,0xe0,0x9c,0x97,0xa1,0x1f,0xec,0x64,0x53,0xbc,0xe5,
+  0x83,0x7c,0xac,0x3b,0xd2,0xff,0xb7,0x83,0xbc,0xc1,0x46,0x78,0x83,0x0c,0xce,0x49,
+  0xac,0x5c,0x18,0x4d,0xd7,0x09,0x08,0x8b,0xe6,0x01,0xe6,0x3e,0x60,0xa1,0x6b,0x79,
+  0x61,0x5b,0x54,0x12,0xa2,0x44,0xb8,0x98,0x24,0x5a,0xae,0x42,0x0b,0xcc,0xa7,0x16,
+  0xfa,0x9d,0x5a,0x60,0x31,0xb5,0x5a,0x05,0x2d,0x10,0x9b,0x17,0xab,0x9a,0x84,0x7c,
+  0xd9,0x20,0x15,0xb5,0x45,0x95,0xfb,0x37,0x08,0x54,0x79,0xcf,0x63,0x47,0x07,0x8c,
+  0x07,0x7a,0xee,0xf0,0x40,0xc0,0x1d,0x0c,0xe7,0xba,0x0a,0xb3,0x70,0x14,0x05,0x8c,
+  0xe6,0x16,0x98,0x5c,0x9c,0x1d,0x86,0xda,0x99,0x0f,0xdc,0x25,0x50,0xc5,0xbc,0xe8,
+  0xda,0xbb,0xcd,0x54,0x37,0x60,0x34,0x02,0x04,0x0e,0x93,0xac,0xa5,0x22,0x50,0x41,
+  0xc2,0xab,0x30,0x45,0xfe,0x9b,0x07,0x9c,0x81,0xbc,0x9f,0x79,0x73,0xb0,0x82,0x56,
+  0x5a,0x48,0xc0,0x5d,0x61,0x94,0x07,0xa9,0xf5,0x03,0xc0,0x0d,0x3c,0x6e,0xf4,0xa9,
+  0x76,0x0c,0xd6,0x5b,0xb2,0x60,0x05,0x3d,0x24,0x63,0x23,0x45,0x88,0x1a,0x44,0x96,
+  0xa1,0x30,0xfb,0x38,0xfe,0x13,0x1e,0x22,0xd4,0xcc,0x91,0x45,0x18,0x91,0x18,0x0d,
+  0x51,0x03,0x64,0xa1,0xf8,0x65,0x22,0xe0,0xb6,0x5a,0x5c,0xae,0x09,0x5e,0x64,0xa6,
+  0xf7,0x92,0xc9,0xc8,0x83,0x98,0xe1,0x66,0xa0,0xc9,0x86,0xe4,0xef,0xfc,0x21,0x5f,
+  0x81,0x0d,0x95,0x10,0x88,0xc8,0xd2,0x28,0x95,0xc5,0xcf,0x7b,0xf2,0x06,0xe1,0x29,
+  0x9a,0xbe,0x5c,0x3d,0x29,0xcd,0x60,0x00,0x89,0xc1,0x25,0xb6,0x7d,0xb9,0x49,0xab,
+  0x06,0xfd,0x39,0x75,0x7e,0x9d,0xc2,0x34,0xa6,0x2d,0x31,0x94,0xed,0x9e,0xa4,0x46,
+  0x1b,0x74,0xd1,0x24,0x0d,0xb2,0xa9,0x88,0x68,0xdd,0xe1,0x7a,0x4a,0x2c,0x35,0x4a,
+  0x90,0xb9,0x86,0xca,0xf2,0x64,0xfe,0x4c,0xf9,0x80,0xdf,0xc2,0x84,0x07,0x88,0x96,
+  0xd0,0x6c,0x41,0x9c,0x81,0xee,0x55,0xdc,0x7c,0x4e,0x96,0x89,0x65,0x3b,0x39,0x34,
+  0x4f,0x06,0x05,0xda,0x2a,0x58,0xfb,0x39,0x35,0x67,0xd9,0x5a,0x16,0x86,0x3e,0xe5,
+  0xcf,0xd4,0xbe,0x92,0x82,0x6c,0x3b,0x5c,0x45,0x92,0x3d,0x22,0x56,0x11,0xc0,0x8a,
+  0x60,0xc0,0x99,0x08,0x95,0xaa,0x0d,0x45,0xa6,0x00,0x5a,0x8b,0x2e,0x10,0xe6,0x9d,
+  0xe8,0xbf,0x9c,0x72,0x3c,0x56,0x1d,0xa7,0x3f,0xae,0xf7,0x80,0x3a,0xb4,0x7f,0x20,
+  0x82,0xc2,0x18,0xbf,0xf4,0x0c,0xa1,0x02,0x9b,0x59,0x9c,0xa9,0x60,0x14,0xa6,0x60,
+  0x93,0xb1,0xc5,0xdc,0x27,0x37,0x74,0x98,0xf3,0x65,0x1b,0x76,0xf5,0x82,0xce,0x0f,
+  0xd4,0xf5,0x40,0x31,0x43,0xbc,0x42,0x2e,0xc9,0x10,0x7c,0x64,0x81,0x38,0xd2,0x54,
+  0x57,0x1a,0xcc,0x92,0x2b,0x50,0x5d,0x89,0x98,0x2a,0x4a,0x29,0x3a,0xa0,0xbe,0x9e,
+  0xe5,0xb0,0xe8,0x04,0xd6,0x47,0xd5,0xa6,0x07,0x19,0x81,0x74,0x20,0x53,0x87,0xc4,
+  0x37,0x20,0x50,0xab,0x20,0x1f,0xea,0x1a,0x52,0x44,0x16,0x65,0x56,0x4b,0x46,0xe4,
+  0xb5,0xec,0xc7,0x8f,0x3d,0xc7,0xf3,0xfd,0x17,0x78,0x23,0x01,0x16,0x42,0xf7,0xbb,
+  0xd5,0x1a,0x47,0xe1,0xf8,0x73,0xab,0x1d,0x40,0x07,0x03,0x07,0x43,0x21,0x20,0xf7,
+  0x47,0x6e,0x1c,0x03,0xb1,0xa5,0x6e,0x36,0x35,0xac,0x3d,0xbc,0x23,0x85,0x55,0x20,
+  0xdf,0x08,0x97,0x28,0x77,0x2f,0x7a,0xf1,0xc2,0x61,0x46,0x02,0xc7,0xa0,0x9d,0x54,
+  0xfb,0x82,0x76,0x1b,0x92,0xee,0x82,0x16,0xf2,0x16,0x07,0x68,0x23,0xea,0xe8,0x8f,
+  0x40,0x69,0x8f,0x9a,0x0e,0x08,0xc8,0x62,0x2f,0x45,0xd3,0x2a,0x1b,0xa7,0x01,0x4c,
+  0x83,0x62,0x81,0x89,0x47,0x52,0xb0,0x90,0x65,0x2f,0x0b,0x6d,0xb4,0xd6,0x4c,0x82,
+  0x42,0x68,0x17,0xf1,0x1a,0x5c,0xbb,0xe2,0x42,0xb4,0xd8,0xf3,0x6c,0xd9,0x6d,0x15,
+  0xd3,0x82,0x39,0xfa,0xd6,0x1b,0x74,0x0b,0x1b,0x51,0xe3,0x9a,0xbb,0xc7,0xf9,0x1a,
+  0xe2,0x1a,0xe5,0x6f,0xdc,0xe3,0x9b,0x1a,0x6e,0x13,0x86,0x12,0xf4,0x3e,0xd7,0x72,
+  0x01,0x6e,0x91,0x35,0xfc,0xc0,0x31,0x6c,0x4b,0x74,0x3e,0x2a,0xa0,0x63,0xf7,0x78,
+  0xbc,0x12,0xa8,0xa4,0x0e,0x85,0x96,0x7c,0x67,0xe5,0x8a,0x59,0x78,0x12,0xf6,0x09,
+  0xff,0x36,0x35,0x8d,0xcc,0x74,0xc7,0x17,0xfc,0x7c,0xcf,0x47,0x2c,0x27,0x38,0x58,
+  0xf2,0x87,0xbc,0xf2,0xe6,0x2e,0x5a,0xe7,0xf0,0x17,0x45,0x80,0x1a,0x22,0xae,0xbc,
+  0xc2,0x3f,0x82,0xd7,0xe4,0xdf,0xb1,0xae,0x40,0xd4,0x0a,0x23,0x5d,0xba,0x73,0x48,
+  0xc7,0x51,0x6e,0xeb,0x84,0x5d,0x81,0x80,0x35,0xfc,0x34,0x28,0x67,0x0b,0x70,0x58,
+  0xe7,0xcf,0xb0,0xc4,0xb2,0x72,0x32,0x44,0x51,0x94,0x0a,0x30,0xb9,0x06,0x46,0x58,
+  0xfc,0xc0,0x42,0x5d,0x58,0x1c,0x26,0x51,0xbb,0xe7,0x4e,0x10,0x5c,0xbb,0xef,0x86,
+  0x71,0xde,0xde,0x75,0x03,0x28,0xc8,0x2c,0xf2,0x3e,0xc5,0x08,0xd7,0xd6,0x17,0x0f,
+  0x16,0x82,0xea,0xda,0x27,0x2d,0xac,0xda,0x1a,0xd0,0x67,0xff,0xa4,0x05,0x35,0xc5,
+  0xc7,0xee,0x49,0x0b,0x01,0xb4,0x06,0x2d,0x82,0x2a,0x6c,0xc3,0xbb,0x1a,0x7c,0x84,
+  0x8f,0x4a,0xe0,0x23,0x9c,0x05,0xb9,0xba,0x5e,0x80,0xaf,0x95,0xc5,0x6e,0x03,0xac,
+  0x96,0x05,0x02,0xbc,0xe1,0x61,0xb9,0xd0,0xd9,0xeb,0xf7,0x5a,0x99,0x50,0xac,0x5c,
+  0x8d,0x22,0xa7,0xe7,0x6f,0x9e,0xe9,0x85,0x38,0x7e,0x95,0x62,0x2f,0x5e,0xff,0xfc,
+  0x4a,0x2b,0x45,0x9d,0x91,0x85,0xd4,0xba,0xbb,0x0e,0xc6,0x9d,0xe9,0x67,0x52,0x79,
+  0x30,0x44,0xa5,0x45,0xe1,0x68,0x11,0x46,0x3e,0x77,0x35,0x59,0x6a,0xa8,0x38,0xf3,
+  0x48,0x0f,0x8f,0xe0,0x25,0x72,0xa3,0xf0,0x0d,0x47,0x57,0xb8,0xaa,0x30,0x49,0x14,
+  0x16,0xde,0xb6,0x2f,0x5f,0x3e,0x7c,0x2c,0xcc,0xf5,0x39,0x9a,0x4c,0xb8,0x9e,0x9b,
+  0x2b,0x6f,0x11,0x9b,0x3b,0x60,0x8f,0x6d,0xe3,0xbf,0x43,0xee,0x74,0x73,0xcb,0xac,
+  0x27,0x5c,0x6f,0xdc,0xe5,0x56,0x97,0x8b,0x8e,0x37,0xee,0x70,0xab,0xc9,0x25,0xb7,
+  0x1b,0xe4,0x7e,0xc2,0x15,0xbe,0xab,0xf8,0x70,0xee,0xe0,0x4f,0x5b,0x5a,0x63,0x12,
+  0xeb,0xc2,0x69,0x6d,0x62,0xee,0x49,0xcc,0xbd,0x02,0x73,0xcf,0x21,0x07,0xae,0xbb,
+  0x2d,0x7e,0x60,0x0a,0xef,0xb5,0x6b,0x99,0xfd,0x47,0xab,0x13,0x04,0xc8,0xf6,0x4d,
+  0xa5,0xbd,0x55,0x54,0x02,0x22,0xc9,0x29,0x8a,0x82,0xd8,0x42,0x1a,0xb5,0xe7,0x0a,
+  0x44,0x69,0x30,0xf4,0xd9,0x86,0x12,0xff,0x0c,0xc3,0x79,0x32,0x8b,0x8e,0x67,0xbf,
+  0x80,0x05,0x3a,0xf0,0x0a,0x18,0xf1,0x72,0x44,0x1f,0x8a,0xf4,0x2f,0x5f,0x1e,0xf2,
+  0x0c,0xcd,0x7b,0x27,0xbc,0x7c,0xc0,0x16,0xae,0x95,0xa5,0xe3,0xb6,0x9f,0xe5,0xe4,
+  0xf7,0x80,0xbf,0x0e,0x8f,0xe3,0x82,0x54,0xfe,0x0b,0x70,0x21,0x54,0x38,0xb0,0x1a,
+  0x79,0x4a,0x41,0x45,0x5c,0x9e,0x22,0x40,0x85,0x0e,0x6f,0x94,0xfa,0x41,0x3f,0x37,
+  0xa8,0x4a,0xe5,0xda,0x02,0x00,0x56,0xd5,0x7b,0x0c,0x1a,0x06,0xcc,0x8a,0xb7,0x32,
+  0x28,0x21,0x4d,0x22,0x6b,0xee,0xb7,0x31,0xcc,0x72,0x12,0xde,0x68,0xbe,0x4b,0xbc,
+  0xe2,0xa9,0x50,0x96,0xbc,0x96,0x30,0x36,0x51,0xa3,0x5f,0xa1,0xe5,0x80,0x65,0xb8,
+  0x44,0x7d,0x8d,0xf7,0xbd,0xb6,0x50,0x85,0xd1,0x40,0xe0,0x89,0xe2,0x96,0xc8,0x97,
+  0x82,0x78,0x0e,0xdc,0x3b,0xf7,0x91,0x7b,0x55,0x1b,0x3c,0xa6,0xb9,0xa9,0x11,0xca,
+  0xc5,0x66,0xe8,0x87,0xe1,0x49,0x02,0x38,0xb8,0x11,0x20,0x5a,0xc0,0xdb,0x24,0x62,
+  0xff,0xf9,0x14,0xe6,0xa3,0x45,0x65,0xb5,0x65,0x03,0xf2,0x32,0xfa,0x85,0x7d,0xce,
+  0xd6,0xe8,0x12,0x2d,0x38,0xdb,0x17,0xac,0x2d,0x86,0x9a,0xf8,0x1e,0x64,0x1a,0x09,
+  0x27,0x5b,0x77,0xe4,0x8c,0x92,0x9b,0x5f,0x37,0xa0,0x87,0x28,0xa6,0x93,0x84,0x4b,
+  0x44,0x21,0x5c,0x84,0x5d,0x81,0xc3,0xd5,0x08,0x8a,0x0f,0x26,0x9a,0xed,0xf8,0x83,
+  0x10,0x74,0x5b,0x32,0xaa,0xac,0x25,0x93,0x29,0x21,0xf0,0xdd,0x87,0x0f,0xa1,0x13,
+  0x30,0x71,0x65,0x7a,0x95,0xd8,0xa5,0x0c,0x18,0xef,0x00,0x1d,0x69,0xc0,0x92,0x1d,
+  0xde,0x94,0x2c,0x81,0x35,0x88,0x09,0xb6,0x5b,0xf3,0xd6,0xb6,0x1a,0x29,0xc5,0xe5,
+  0x60,0xcc,0x34,0x22,0x8d,0x99,0x88,0x33,0xfe,0x35,0x5d,0x7e,0xdc,0x60,0x12,0xfd,
+  0x97,0xf4,0xd1,0x07,0x8c,0x1a,0xd7,0x68,0xa7,0xe7,0x21,0x38,0xbb,0x66,0x90,0x45,
+  0x59,0x5b,0xc7,0x6f,0xee,0xf9,0x6b,0xd1,0x83,0x32,0x26,0x76,0xad,0x1a,0xe0,0x50,
+  0x48,0x5f,0x27,0xe8,0x8c,0x41,0x6a,0xc4,0x60,0x8c,0x6c,0x05,0xff,0xf2,0x48,0x21,
+  0x22,0x0b,0xb0,0x6f,0xcd,0xc8,0xe8,0xc9,0x75,0xe3,0x82,0xf9,0x75,0xa3,0x52,0xc5,
+  0x39,0x13,0x3c,0xff,0xf7,0x26,0x86,0xe1,0xdc,0x44,0xf9,0xb2,0x9e,0x8d,0xa9,0x98,
+  0x60,0x63,0xfa,0xdd,0x92,0x69,0xa8,0xc1,0xa0,0x43,0xf0,0x47,0xa5,0x80,0xd6,0xc2,
+  0x14,0xef,0x46,0xa6,0x70,0x29,0x2a,0x79,0x9c,0xa7,0x51,0xa8,0xac,0x1a,0x13,0xb4,
+  0x12,0xc0,0x92,0xe9,0x81,0xe5,0x02,0xc5,0x70,0x6b,0xf5,0xf1,0x63,0xf1,0xe3,0xa9,
+  0x7b,0x74,0xd2,0xea,0x3a,0x5d,0xc8,0xc3,0x3f,0xf0,0x57,0xe1,0x53,0x33,0x1a,0x3c,
+  0x63,0xcd,0x2c,0x00,0x06,0x58,0xdf,0x65,0x28,0x24,0x3a,0x2c,0xac,0x35,0x9e,0xa4,
+  0xf7,0x97,0xbe,0xb5,0xde,0xe2,0xb7,0xd9,0x57,0x4c,0xa1,0x9e,0x16,0x9d,0xe6,0x89,
+  0x35,0xa8,0xeb,0xc9,0x75,0x8c,0x84,0xf9,0x7a,0xc7,0x62,0xa3,0x67,0x65,0x1d,0x88,
+  0x2a,0x47,0x70,0x53,0x85,0x1f,0xa8,0x40,0xdd,0x94,0x94,0x75,0x34,0xdb,0x09,0xcb,
+  0x98,0xba,0x87,0x4c,0x26,0x8c,0xb3,0xe3,0xcb,0x15,0x8b,0xcf,0x10,0xa1,0x6c,0xe5,
+  0x87,0x43,0xc7,0xd8,0x5f,0xbe,0x7f,0x75,0xee,0x72,0xaf,0xd8,0x86,0x16,0x07,0x33,
+  0x4c,0x0e,0x3e,0x5c,0x49,0xe3,0x60,0x71,0x2f,0x3c,0x8e,0x56,0x22,0x08,0x2f,0x16,
+  0x69,0xc2,0x44,0xa1,0x0c,0x7d,0x7a,0x78,0x42,0xe3,0x28,0x34,0xf5,0xde,0x27,0xc2,
+  0xd6,0xa8,0x74,0x56,0x1e,0x94,0x3f,0x85,0x25,0x66,0x45,0xc5,0xa2,0xf0,0xf8,0xce,
+  0x92,0xa3,0x42,0x11,0x86,0x88,0x10,0xcf,0x54,0x07,0x73,0xf4,0x22,0x66,0x2c,0x61,
+  0xc9,0x89,0x9d,0x06,0xd4,0xa4,0x55,0x08,0x28,0x5e,0xac,0x42,0x50,0xa5,0x88,0x7c,
+  0x60,0x40,0x5c,0x89,0x9c,0xc5,0x34,0x16,0x9c,0x10,0xed,0x5e,0xd7,0x90,0x25,0x88,
+  0x96,0xdb,0x38,0x06,0xa8,0x47,0xd1,0x35,0x8e,0x2b,0x7b,0x6e,0xe4,0xb9,0x2e,0xc0,
+  0x55,0xbb,0x1b,0x38,0x2a,0x50,0x47,0xb7,0x9a,0x60,0x44,0x31,0xa9,0xde,0xa2,0x43,
+  0x97,0xe3,0x52,0x4a,0x31,0xdf,0x55,0x66,0xdd,0x25,0x9a,0x75,0xb8,0x2b,0x4b,0xf6,
+  0x9e,0x6f,0x6b,0xdd,0xd3,0x07,0xa2,0xde,0xba,0x11,0x94,0x57,0x06,0xe1,0x1d,0x67,
+  0x37,0x27,0x89,0xc7,0x53,0x92,0x62,0x82,0x74,0xc3,0x82,0x86,0x35,0x63,0x29,0x3c,
+  0x6b,0x96,0x36,0x82,0x97,0x63,0x5c,0x3d,0xff,0x54,0x1d,0x17,0xb2,0x80,0x2f,0xc7,
+  0x05,0x3f,0x5e,0x8e,0xcd,0x61,0xe0,0x9b,0x35,0xc6,0x6a,0x41,0x78,0x80,0xdf,0xa0,
+  0x7b,0x37,0x9f,0x06,0x20,0x6e,0xf3,0x69,0x1a,0x04,0xcc,0x4b,0x03,0x26,0x0e,0x19,
+  0xb5,0xd1,0x1d,0x99,0x4f,0xc3,0x8c,0xd1,0xbe,0x99,0xc2,0x83,0xef,0x41,0x7e,0x90,
+  0x67,0x91,0x44,0x2c,0x16,0xff,0x9a,0x51,0x9c,0x84,0xf8,0xed,0xdd,0x6c,0x7d,0x2c,
+  0x8c,0xa3,0xd1,0x2d,0x19,0x29,0xda,0xaa,0xf6,0xfe,0xab,0x12,0x0e,0x83,0xcc,0x6e,
+  0x31,0x83,0xe6,0x34,0x53,0x6c,0x27,0x4f,0xce,0xb9,0x4f,0x21,0x0b,0x2c,0x1b,0x2c,
+  0x4c,0x45,0x7e,0xc2,0x56,0x01,0xfd,0x1c,0xdc,0x1a,0x43,0x2e,0x00,0xe2,0x80,0x43,
+  0x56,0x31,0xe0,0x40,0xc1,0xf5,0x23,0x0d,0x63,0xd1,0xb2,0x6b,0x26,0xe3,0xa5,0x07,
+  0x14,0xad,0x9f,0x82,0x34,0x9b,0xbf,0xc1,0x3c,0x2c,0x66,0x0b,0x45,0xf1,0xb9,0x12,
+  0xf4,0x89,0x3e,0xc5,0xb8,0xe8,0x50,0xf3,0x6c,0xd0,0x35,0x5c,0x0c,0x99,0xfb,0x41,
+  0x8e,0x8e,0xe0,0xed,0xaa,0x73,0x87,0xef,0x7d,0x91,0x94,0xdf,0xd2,0xa4,0xfc,0xd6,
+  0xc7,0xd2,0x66,0x8f,0xae,0xaa,0x49,0x55,0x48,0x2c,0x4c,0x5b,0x84,0x66,0x3b,0x45,
+  0x06,0x5c,0x15,0x53,0x16,0xad,0x6d,0xd4,0x5f,0xae,0x66,0x79,0xda,0xec,0xca,0x85,
+  0x74,0x61,0x78,0x9e,0xf4,0x10,0x75,0xb2,0x09,0xae,0x5c,0xcd,0x9b,0x21,0x85,0x88,
+  0x98,0xff,0x22,0x90,0x64,0xbe,0xc8,0xa6,0xd6,0x32,0xf4,0x07,0xd8,0x20,0xe5,0x0f,
+  0xae,0xc4,0x4c,0xd4,0x17,0x68,0x4b,0x45,0xbc,0xb6,0xa8,0x79,0x57,0x37,0x8a,0x35,
+  0xf3,0xb0,0xa0,0xde,0xaa,0x7d,0xb1,0x47,0xe5,0x89,0xca,0xfe,0x7e,0xc4,0x74,0xeb,
+  0x89,0x78,0x62,0x99,0x34,0xb4,0x07,0xb5,0xc4,0xa3,0x49,0xc6,0x17,0xe6,0x4e,0x08,
+  0x2b,0x89,0xd7,0x18,0xe5,0xb3,0x11,0x35,0x25,0x2d,0x79,0x59,0x72,0x2d,0x95,0xfc,
+  0x16,0x19,0x4c,0x21,0x0b,0xbb,0xdc,0x66,0x15,0x7a,0xb7,0xa5,0xa0,0xd1,0x68,0x8b,
+  0x57,0xd4,0xb8,0x14,0x05,0xc5,0x7d,0x3d,0xe1,0xe4,0xd6,0x5a,0x52,0xfd,0xa2,0xba,
+  0xa8,0x2d,0x2a,0x73,0x64,0xf8,0xc6,0x37,0x6d,0x9d,0xb7,0x76,0xbc,0x79,0xb8,0x33,
+  0x9e,0x5c,0xf6,0x5b,0xed,0xe5,0x2c,0xc8,0xa7,0x89,0x3f,0x68,0xbd,0x7d,0x73,0xf1,
+  0xbe,0xd5,0xe6,0x27,0x41,0xb3,0xc1,0xb2,0x25,0x14,0x6d,0xe7,0x3d,0x10,0x0d,0x0c,
+  0x36,0x0a,0x51,0x18,0x93,0xae,0xd9,0xc1,0xc0,0xab,0xd6,0x5d,0x1b,0x31,0x11,0x13,
+  0x1b,0xe4,0x64,0x07,0xff,0x4f,0xdb,0xfc,0xa2,0x6f,0xf2,0xe0,0x9d,0x3e,0xfb,0xe5,
+  0x82,0x78,0x41,0x7e,0x7c,0x3a,0x7f,0xf3,0xec,0xc7,0x17,0x3f,0xf2,0xcd,0x7a,0xcd,
+  0x75,0x07,0x32,0x06,0xad,0x11,0x94,0x37,0x16,0xd7,0xfa,0x52,0x0e,0x79,0xae,0x08,
+  0x1c,0xaa,0xd7,0x78,0xe8,0xe3,0x7c,0xfc,0xf8,0x46,0x69,0x3c,0xe1,0x43,0xe1,0x30,
+  0x8a,0x41,0xf0,0x4e,0x18,0x37,0x1b,0xd8,0x80,0x01,0xfb,0xb5,0xb6,0xa5,0x23,0x58,
+  0x96,0xbb,0x33,0x70,0x21,0x61,0x86,0xc8,0xd0,0x6e,0x0e,0x6a,0xbb,0x26,0x4d,0x28,
+  0x7d,0x36,0xb8,0x09,0x57,0x0c,0xb9,0x7f,0xc2,0xc4,0xc2,0x98,0xda,0x83,0x5c,0xa6,
+  0x9a,0x14,0x45,0xb5,0x06,0x27,0xb3,0xfc,0x17,0x2f,0x22,0x77,0x25,0x6e,0x5d,0x56,
+  0x5d,0x95,0xaa,0xf5,0xcc,0xbd,0x02,0x61,0x7e,0x8a,0x17,0x4e,0x59,0xbb,0x45,0x7b,
+  0x99,0x93,0x06,0xf3,0xc8,0x1b,0x07,0xd6,0xce,0x6f,0x4e,0x77,0xfb,0xbb,0x9d,0x76,
+  0x0b,0xa6,0x8d,0x4a,0xb3,0x7e,0x73,0x3e,0xf4,0x3a,0x4f,0x3e,0x7e,0x6f,0xf3,0xbc,
+  0xef,0xc8,0xfc,0xbe,0x93,0xb5,0x05,0x5e,0x57,0x26,0x52,0x29,0x30,0x67,0x90,0xc2,
+  0xa0,0xfe,0xc8,0xaf,0xee,0xb2,0x80,0x69,0x40,0xe9,0xe5,0xc1,0x0c,0x77,0x9b,0x3c,
+  0x1f,0x95,0xa3,0xc2,0xeb,0x6b,0x5c,0x14,0xda,0xb5,0x60,0xda,0x1e,0x6f,0x16,0x8c,
+  0x7f,0x5a,0x07,0x09,0xcb,0xe8,0x3a,0x7c,0xcd,0x11,0x5f,0x0d,0xfa,0x22,0x6a,0x06,
+  0xbe,0x20,0x0f,0x07,0x94,0x10,0x7b,0x73,0xfc,0xa4,0x9b,0xdb,0xc2,0xab,0xe5,0x30,
+  0x52,0xa6,0xc8,0x11,0x17,0x92,0x9d,0x07,0x13,0x58,0xab,0xe1,0x35,0x89,0x46,0x6e,
+  0x53,0xf8,0x16,0x0c,0x2d,0x90,0x10,0x43,0x08,0xe1,0x8f,0x23,0x26,0x28,0x7e,0x8a,
+  0x01,0xd7,0x52,0x1d,0x2d,0x92,0xbb,0x8e,0x0d,0xa2,0xb0,0xd9,0x55,0x13,0x92,0x9f,
+  0x26,0x34,0x17,0x94,0x1a,0xbc,0x01,0x70,0xa2,0x60,0xb8,0x86,0x16,0x05,0x15,0x0c,
+  0x5f,0x4e,0x28,0x22,0x4f,0x88,0xf4,0x7a,0x0e,0x94,0xb4,0x6b,0x97,0xc1,0xe3,0x9f,
+  0x74,0x5d,0xec,0xfb,0x17,0xa1,0x1f,0xb8,0xdc,0x29,0xd4,0x66,0x19,0x7c,0xd8,0x85,
+  0xad,0x01,0xa5,0x37,0x18,0xf3,0xd5,0x43,0xde,0xda,0x26,0xd8,0xdb,0x2d,0x39,0xe8,
+  0x02,0x36,0x3e,0x82,0xb4,0x0e,0x38,0x96,0x29,0x8d,0xfa,0x81,0x18,0x75,0x2d,0xab,
+  0x3e,0xf4,0x89,0x0a,0x18,0xc4,0x46,0x41,0x86,0x54,0xd6,0x65,0x1a,0x76,0xf8,0xf1,
+  0x63,0xfc,0xd7,0x51,0xb2,0xda,0xde,0x6e,0x31,0x2e,0x80,0xa0,0x70,0x53,0x09,0x0a,
+  0xbe,0x0a,0x4c,0x83,0x0b,0x9b,0x54,0x56,0xd1,0x22,0x5a,0xcb,0xd1,0xa5,0xae,0xed,
+  0xf1,0xbb,0xf3,0xba,0x82,0x6f,0x57,0x32,0xf5,0x1a,0x9e,0x2e,0x69,0x7d,0xde,0x07,
+  0x33,0xb4,0x95,0x7a,0x24,0x42,0x5b,0x4f,0x98,0xf6,0x05,0x92,0x11,0x35,0x43,0x39,
+  0xc2,0x55,0x3a,0x92,0x1f,0x3f,0x16,0xf3,0x82,0x9c,0xed,0xdf,0x60,0x12,0x54,0xc5,
+  0x3a,0x00,0x06,0x0a,0x6b,0x13,0x62,0xae,0xb4,0xfe,0x22,0xaa,0xf0,0xff,0x9d,0x30,
+  0x91,0x78,0x74,0x97,0x40,0x3b,0x0a,0xe2,0xcb,0x7c,0xfa,0xf5,0x13,0xd3,0x8a,0x13,
+  0x41,0x01,0xbb,0x55,0xdb,0x2a,0x93,0xcf,0xba,0x8c,0x4b,0xd3,0xae,0x61,0xd6,0xd9,
+  0xc2,0xbd,0x2d,0x66,0x9c,0xd5,0xe2,0xc7,0x26,0x31,0xac,0x74,0x72,0xf9,0xf8,0x31,
+  0x4e,0x79,0xbe,0xb5,0x77,0x52,0xfc,0x1c,0x88,0xdd,0x6c,0x55,0x47,0x9e,0xea,0xd3,
+  0x6b,0xc9,0x9d,0xc0,0x13,0xfd,0x43,0xd6,0xe4,0xee,0x79,0xa5,0x15,0xf4,0x35,0x2b,
+  0x8f,0x7e,0x58,0x37,0x03,0x45,0xb1,0xb2,0x7e,0x10,0xc9,0x06,0xaf,0x8d,0xf2,0x18,
+  0x03,0x12,0x1a,0x21,0xf2,0x68,0x11,0x72,0x02,0xf3,0x92,0xc2,0x03,0x24,0xd2,0x8b,
+  0x64,0xad,0x2d,0xb1,0xe3,0xac,0x65,0xea,0xb2,0x86,0xce,0xbb,0x95,0xce,0xc5,0x89,
+  0x07,0x29,0xd4,0x7d,0x92,0x07,0xb5,0x0f,0x35,0x6c,0x1d,0xdf,0xf7,0xba,0x9b,0x3d,
+  0xed,0xba,0x9b,0xbd,0x7f,0xaa,0xeb,0x6e,0x68,0x5f,0xbc,0xb3,0x98,0x77,0xf0,0x50,
+  0x1e,0xd5,0x31,0xee,0xbd,0xa9,0x66,0x6f,0xe9,0xf7,0x6f,0x1d,0xb1,0x27,0x9d,0x03,
+  0xfc,0x8f,0x1d,0x98,0x17,0x7a,0xd1,0x15,0x72,0xe6,0x0d,0x5e,0xfb,0xac,0xdf,0x9b,
+  0xf6,0x8a,0x7b,0x5b,0x70,0x40,0xc4,0x79,0x42,0xe9,0xbe,0x16,0xa3,0xd4,0xb8,0x19,
+  0xce,0xb8,0xa9,0xcd,0x83,0x5f,0x71,0xbe,0xe2,0xa8,0x7c,0xf9,0x22,0x44,0x0a,0x7e,
+  0xc0,0xe4,0x7f,0x88,0xa1,0xfd,0x52,0xac,0x94,0xfd,0x55,0x9f,0xdd,0x6b,0x90,0xcd,
+  0xc9,0xb5,0x43,0x21,0x35,0xe9,0x0c,0x66,0x12,0xb4,0xc8,0x97,0xfc,0xf2,0x8e,0xa3,
+  0x13,0xf6,0x1e,0x3f,0xaf,0x61,0x40,0xe8,0xb6,0xd0,0x6b,0x8a,0x5b,0x92,0x51,0x26,
+  0x99,0x88,0x5f,0x72,0xa4,0x17,0x02,0x63,0x4b,0x65,0x2b,0x18,0x9f,0xaa,0xba,0x21,
+  0xc3,0x32,0xdc,0x3c,0xc5,0xfd,0x29,0xc5,0xb7,0xba,0xa4,0x28,0xee,0x8a,0x04,0x2e,
+  0xe5,0x16,0x3d,0x86,0xa6,0x48,0xab,0xdb,0xc2,0x3e,0x91,0x55,0x07,0x66,0x31,0x9d,
+  0x9d,0xac,0x01,0xcf,0xad,0xee,0x7f,0xf1,0xf8,0x3f,0x3b,0x8f,0xb3,0x42,0xd7,0x48,
+  0xc1,0x68,0x6c,0xba,0xf0,0xf1,0xb3,0x4b,0x52,0xf1,0x47,0x8a,0x10,0xdf,0x4c,0x2e,
+  0xf2,0xb2,0x35,0x92,0x51,0x64,0x34,0xc9,0x46,0x91,0xdd,0x18,0x32,0xae,0x85,0xd7,
+  0x97,0x0a,0x8f,0xd7,0x15,0xfb,0x17,0x37,0x96,0xb9,0x31,0x4f,0xbd,0x6c,0xda,0x37,
+  0x38,0x90,0x92,0x3a,0x7d,0xe3,0x6e,0x31,0xb0,0xe5,0x7a,0x57,0x25,0x8e,0xdb,0xab,
+  0x49,0x7b,0xc2,0x0e,0xf4,0x0b,0x17,0x7b,0x78,0x03,0xe3,0xcb,0x43,0xfd,0xbb,0xd3,
+  0xff,0xc5,0xac,0xb3,0xcb,0x0e,0xa6,0xbd,0xa3,0xd2,0x0d,0x5c,0x07,0xbf,0xec,0xe9,
+  0x17,0x30,0x76,0xfa,0xd3,0xbd,0xd2,0x85,0x8c,0x7d,0xc5,0xd6,0x7c,0x6c,0x2b,0xc2,
+  0x5b,0x0c,0xf9,0x3f,0x54,0x7c,0xf3,0x36,0x4b,0x02,0x7c,0x95,0x68,0x16,0x48,0x56,
+  0x85,0xb3,0x9c,0x3c,0xba,0x78,0xa6,0xb4,0x92,0x7c,0xe6,0x47,0x36,0x0c,0x09,0xed,
+  0x90,0xe3,0xbc,0x24,0xa4,0xcb,0x0d,0x15,0x62,0xfa,0x5f,0x53,0xe3,0xff,0x9b,0xa9,
+  0xb1,0x5e,0xe6,0xf3,0x0a,0x4d,0xfb,0x81,0xa2,0x52,0xed,0xd6,0x5f,0xad,0x5f,0x07,
+  0x27,0x9d,0xa5,0xad,0x5c,0xf8,0x11,0x39,0x71,0x33,0x9b,0x9c,0x17,0x98,0x5c,0xcc,
+  0x0c,0xfc,0xaa,0xd9,0x3c,0x31,0x17,0x7c,0xe8,0xe6,0xb3,0xbf,0x7c,0xc1,0x3f,0x62,
+  0x79,0x44,0x21,0x6e,0xb2,0x21,0x7f,0xdd,0x52,0xc0,0x2f,0x2f,0x02,0x78,0x04,0x4b,
+  0xc9,0x1c,0x7a,0x9d,0x14,0x37,0x4d,0x32,0x3a,0x4c,0xc5,0x6e,0x03,0xdc,0x61,0x25,
+  0x1c,0x75,0xc2,0xf8,0xca,0x4f,0xc6,0x17,0x53,0x84,0x98,0x5c,0x6e,0x86,0x79,0xe1,
+  0x85,0x80,0x76,0xd6,0xe1,0x96,0xa2,0x40,0xa9,0xc1,0x4e,0x53,0xc4,0xf8,0x5a,0xd5,
+  0x3a,0x30,0x58,0xa6,0x1c,0x02,0x8f,0x93,0xb7,0x65,0x64,0x61,0xca,0x8f,0xf2,0x1e,
+  0x26,0xb7,0xc5,0x2f,0x62,0x32,0xda,0xe2,0x77,0x74,0xae,0x69,0x8c,0x0a,0x95,0xb1,
+  0x46,0xd7,0x64,0x4b,0xe6,0xe9,0x84,0x0d,0xf3,0xc7,0x8f,0xc3,0x9c,0x5c,0x97,0x27,
+  0xd2,0x47,0xca,0x3f,0xed,0x41,0x4b,0x52,0x5c,0xe2,0xa9,0x93,0x99,0x40,0x19,0x26,
+  0x49,0xb6,0x18,0x6d,0x84,0xa0,0x2c,0xb7,0xd2,0xcd,0x52,0x2a,0x84,0x6f,0x10,0x5c,
+  0x84,0x7f,0x40,0x6f,0xf0,0x0d,0x00,0x83,0x28,0xe8,0x64,0x73,0x41,0x47,0xa0,0x6b,
+  0x0d,0x50,0xc7,0xcf,0x13,0xf9,0x63,0xc0,0xf4,0x60,0x52,0xbe,0xfa,0x45,0xa2,0x40,
+  0x05,0xc8,0x3e,0x31,0xdc,0xd0,0xc5,0xfa,0x58,0x5f,0x36,0x6b,0xce,0x19,0x71,0x20,
+  0x40,0x1c,0x8a,0x10,0x2b,0xe2,0x55,0xd0,0x64,0x19,0x73,0x41,0x5d,0x81,0xc8,0x17,
+  0xfc,0xb2,0xbf,0xe6,0x61,0x52,0xb1,0x9c,0x47,0x9f,0x45,0x81,0xfd,0x76,0x8b,0xb1,
+  0xbf,0xfe,0xfb,0xff,0x06,0xd6,0x96,0xcb,0x72,0x74,0x69,0x68,0x08,0xd5,0x0c,0x97,
+  0x84,0x6f,0x6e,0x30,0xdf,0x6f,0xb1,0x5e,0xcf,0xc1,0x66,0x2e,0xa8,0x23,0x72,0xa1,
+  0xb6,0x2a,0xc6,0x2a,0x79,0x7e,0x37,0xb5,0x56,0xa9,0x70,0xad,0xb9,0xca,0x73,0x9a,
+  0xed,0x55,0x51,0xd3,0xd4,0xd5,0x85,0xd7,0x59,0x9d,0x31,0xe7,0x69,0x40,0xe2,0x3a,
+  0xc7,0xf7,0x97,0x2f,0xcb,0x3b,0x74,0x7e,0xb7,0x19,0xe9,0x66,0x94,0x52,0x02,0x70,
+  0x89,0x06,0xe2,0xb8,0x86,0x99,0xcb,0x1d,0x6f,0xef,0x13,0xa0,0x04,0xf7,0xba,0x15,
+  0x66,0x10,0x2f,0xb6,0x3a,0xa6,0x5b,0x9a,0x34,0x73,0x3a,0xc2,0x55,0xdf,0xb0,0xdb,
+  0xd0,0xb4,0xcc,0xc7,0xca,0x27,0x2d,0x7a,0xc3,0xab,0x35,0x90,0x45,0x1b,0xe8,0xc3,
+  0xcb,0xe2,0x41,0x1c,0x28,0xaa,0x68,0xb5,0x5e,0x3b,0x51,0x41,0x79,0x36,0x12,0x04,
+  0xa5,0xe1,0xca,0x02,0xfe,0x13,0xf2,0xb3,0x56,0x69,0x55,0xc5,0x36,0x14,0xad,0x4b,
+  0xf6,0xb5,0x66,0xee,0x78,0xc0,0xb6,0xda,0x81,0x52,0xa7,0x83,0x98,0xf5,0xf3,0xd9,
+  0xf6,0xb3,0xb7,0x67,0xb6,0xb6,0x15,0xf5,0xec,0xe7,0xf7,0x6f,0x3e,0x3d,0x3f,0xfd,
+  0xc9,0x5d,0x32,0x7a,0xbd,0x0c,0x86,0x11,0xf7,0xf0,0xf9,0x5d,0x80,0x83,0x5e,0xb7,
+  0xcd,0xf8,0xcd,0x2c,0x32,0x8b,0x6f,0x11,0x23,0x76,0x83,0x0f,0x1f,0xdb,0x72,0x51,
+  0x3f,0x58,0xa2,0x28,0x1c,0xb4,0x5a,0xed,0xd0,0x1f,0x74,0x7a,0xed,0x34,0x98,0x79,
+  0x61,0x8c,0xaf,0x93,0x74,0xef,0xee,0x86,0x45,0x43,0x17,0xef,0x9f,0xbd,0xff,0xf9,
+  0xe2,0xd3,0xfb,0xb3,0x57,0x2f,0xde,0x89,0xa3,0xea,0x2a,0xef,0xfc,0xcd,0xf3,0x67,
+  0xe7,0x9f,0xde,0xbd,0x78,0xf5,0xec,0xec,0xb5,0xdb,0xad,0x56,0x3a,0x7d,0xf1,0xfe,
+  0xf9,0xcb,0xb3,0xd7,0x3f,0xc9,0x4d,0xb2,0xb2,0xee,0x7e,0x56,0xdc,0x4c,0x57,0xd5,
+  0xdf,0xda,0xb5,0x75,0x9b,0xea,0x70,0xbe,0x37,0xf1,0x9f,0x59,0x8b,0x83,0x8a,0xb2,
+  0xff,0xa5,0xc7,0xff,0xa5,0xc7,0xff,0xa5,0xc7,0xc5,0x0c,0xa0,0x35,0xdb,0xba,0x39,
+  0x80,0x85,0x1a,0xb8,0x57,0xcf,0xa3,0x85,0xe4,0x19,0xae,0x23,0x81,0x77,0x69,0x21,
+  0x59,0x2a,0x40,0x2a,0x5e,0x53,0x6c,0x62,0xf8,0x46,0xeb,0xc3,0x33,0xc7,0xa3,0x6a,
+  0x54,0x35,0xa4,0x89,0xa8,0x0c,0x20,0x93,0x14,0xda,0x4e,0x21,0x8d,0x8b,0xeb,0x0f,
+  0xc2,0x9c,0x56,0xd3,0xbc,0xcd,0x51,0x9d,0x12,0xa5,0x90,0xb2,0x92,0x37,0x41,0x06,
+  0xdc,0xb9,0x54,0x7d,0xa8,0x05,0xe0,0xd5,0x37,0x06,0xe3,0xf9,0x66,0x62,0xc9,0x78,
+  0xb7,0x02,0x3b,0xbe,0x59,0x0f,0xf5,0x9e,0x76,0xed,0x5a,0x3c,0x29,0x38,0x44,0x2c,
+  0xf7,0x79,0xc8,0xae,0xa8,0x70,0xec,0x36,0xd4,0xc8,0x30,0xce,0x22,0xc0,0x22,0xed,
+  0x1e,0x55,0xe3,0x67,0x11,0x79,0xe4,0xcc,0xb3,0x28,0x42,0xe6,0x02,0xf2,0xcf,0xc2,
+  0x98,0x8e,0x23,0xf2,0xe3,0xde,0x0a,0x50,0x82,0xa7,0x5a,0x41,0x17,0xfa,0x09,0x8b,
+  0x93,0x9c,0xcd,0x83,0x34,0xc3,0x43,0xc8,0xb3,0xd0,0xc7,0x17,0x27,0x87,0x78,0x8a,
+  0x96,0x7d,0x0e,0x82,0x39,0xf4,0x78,0x11,0xe7,0x3e,0xde,0x2a,0x90,0x79,0x31,0x9e,
+  0xa4,0xe5,0xcd,0x14,0x87,0x2f,0x2d,0xd2,0xab,0x52,0xdf,0xf3,0xa1,0x36,0x02,0xbe,
+  0x46,0xf7,0xd3,0xf2,0x04,0xa1,0x38,0xab,0x89,0xfb,0x44,0x1d,0x3c,0x3a,0x3d,0x60,
+  0xc2,0x68,0xa0,0x9b,0x09,0x92,0x05,0xf7,0x68,0xef,0x70,0xb7,0xc9,0x57,0xd8,0x66,
+  0xe8,0xa0,0xf9,0x26,0xa6,0xd9,0x3f,0x97,0x95,0xaa,0x97,0xa8,0x60,0xcd,0x37,0x6a,
+  0xff,0xb3,0xda,0x92,0x9b,0x5a,0x7d,0xba,0x7d,0xb9,0xd6,0x26,0x54,0x1c,0xdd,0x38,
+  0x71,0x8c,0x50,0xb6,0xd5,0x65,0x55,0x18,0x52,0x14,0x49,0xf3,0x8a,0x5f,0x33,0x2c,
+  0xad,0x2b,0xc8,0x28,0x3b,0x1f,0xf3,0x24,0xf7,0x22,0xb7,0xc6,0x9e,0x3a,0xd1,0xcc,
+  0xa9,0x22,0xe0,0x10,0x83,0x8f,0xeb,0xc4,0x01,0x2f,0x37,0xc4,0xa6,0x49,0x0e,0x29,
+  0xac,0x60,0xe4,0xa0,0xd8,0x71,0x17,0x35,0x23,0xfc,0x78,0x4a,0xed,0xf1,0x72,0x85,
+  0xe8,0xa4,0x44,0x55,0x06,0x06,0x55,0x94,0x92,0xf7,0x21,0x79,0x69,0x8e,0xc7,0xe6,
+  0x65,0x9f,0xf0,0x5b,0x74,0x49,0xe6,0xd9,0x4b,0x55,0x4c,0xf9,0x26,0xf1,0xa4,0x3a,
+  0x07,0xd7,0x25,0x09,0x75,0x67,0x58,0xa7,0xfc,0x50,0xf8,0x69,0x92,0x82,0x1e,0xcc,
+  0x93,0xe7,0x93,0xcb,0x82,0x7e,0xe1,0x95,0x6c,0x4a,0xde,0xbf,0x5d,0x04,0x76,0xa2,
+  0xe1,0x2d,0x73,0xd5,0x05,0xd8,0x98,0xad,0xa8,0x22,0xed,0x74,0x68,0xfe,0x95,0x97,
+  0x4f,0x31,0x52,0xdf,0xea,0xb5,0x99,0x0a,0xfe,0x0b,0xaf,0xf8,0xce,0xfd,0x97,0x2f,
+  0xad,0x5e,0x0b,0x63,0xff,0xf4,0xca,0xdc,0xae,0x87,0xaa,0x0f,0xf1,0x04,0x99,0x2f,
+  0x69,0x54,0x17,0x91,0x57,0x3e,0xd7,0xbe,0xe4,0xce,0x60,0x81,0xa6,0x5b,0x09,0xa4,
+  0x43,0x8c,0x77,0xf8,0x99,0xfb,0xa2,0x3b,0x18,0x86,0x28,0x8a,0xa6,0x0e,0x06,0xcc,
+  0xf1,0x70,0x5e,0x4d,0x50,0xbb,0x0f,0x1f,0xd2,0xed,0x5e,0x49,0x7c,0x8f,0x3e,0x52,
+  0x0d,0x59,0x68,0x45,0x47,0x25,0x70,0xfe,0x35,0xac,0xd3,0x34,0xa8,0x59,0xab,0xf7,
+  0x8f,0x15,0xf9,0xf6,0x09,0x2b,0xa5,0x38,0x19,0xa9,0x26,0x7b,0x80,0x21,0x1b,0x0a,
+  0xa2,0xdc,0xe9,0x74,0x79,0x71,0xf9,0xf9,0xe5,0x0b,0x5b,0xb1,0x4c,0x52,0xb4,0xd0,
+  0xd7,0x41,0x7a,0xa7,0xbb,0x5a,0xa7,0xcb,0x4d,0x39,0x0a,0xd2,0x97,0x2f,0x5d,0xde,
+  0x7f,0x1e,0xab,0x2d,0x4e,0xa9,0xe3,0x69,0x7f,0x98,0x07,0xda,0xaa,0x02,0x74,0x24,
+  0x8a,0x28,0xb1,0x9e,0x03,0x0e,0xb6,0x84,0x82,0xcc,0xe8,0xb4,0x7f,0x9c,0x87,0x11,
+  0x23,0xee,0xb7,0xe5,0xcd,0x6c,0x8d,0x53,0x11,0xb9,0x1e,0xe7,0x53,0xcd,0xcc,0xc6,
+  0x64,0x6d,0x72,0x1f,0x77,0x45,0x10,0x44,0x3d,0xf1,0xa9,0x24,0x5d,0xeb,0x91,0xbb,
+  0xc7,0x85,0x19,0x83,0xeb,0x9a,0xca,0x24,0x31,0xcf,0x44,0x54,0xb8,0x05,0xc6,0xbf,
+  0x3a,0x73,0xd4,0xa1,0xb4,0x12,0x6b,0xf0,0x08,0xdf,0xca,0x1a,0x72,0x58,0x67,0x01,
+  0x3c,0x80,0xd9,0xad,0x2e,0x35,0x22,0xce,0x4e,0x40,0x07,0x5c,0x7b,0x69,0x6c,0xb5,
+  0xcc,0x69,0x22,0x6e,0x34,0x02,0x3b,0x2b,0xe0,0x86,0x43,0x35,0xd0,0x15,0x48,0x4d,
+  0xc0,0xc5,0x8e,0xb8,0x45,0x07,0xb3,0x6b,0xa4,0xc5,0x70,0x55,0xa4,0x6b,0xb1,0x5a,
+  0xaf,0x50,0x41,0x2d,0xde,0x4b,0x1d,0x36,0x96,0xf1,0x75,0x63,0xd1,0x10,0x20,0x4b,
+  0xf3,0x5a,0xee,0xdf,0x7f,0xab,0x48,0xd9,0x32,0x51,0xe4,0x9d,0x16,0x96,0x71,0x4f,
+  0xdd,0x06,0x72,0xb9,0x2a,0x96,0xf9,0xde,0x94,0x7e,0xed,0x15,0xde,0xac,0x8c,0x0c,
+  0x2e,0x3b,0xc1,0xef,0xaa,0x89,0x93,0xeb,0x21,0xaf,0x2d,0xee,0xae,0x99,0xf0,0x69,
+  0x90,0x2d,0xc6,0xe3,0x20,0xf0,0x33,0xee,0xe0,0x21,0x6a,0x54,0xc7,0x6c,0xa8,0xe5,
+  0x56,0x68,0x45,0x78,0x96,0x08,0x75,0x57,0xd8,0x7c,0xa7,0x74,0xe1,0x17,0xbf,0xa3,
+  0x23,0x83,0x21,0xc3,0x37,0x92,0x70,0x3b,0x87,0xcb,0x4e,0xba,0xb7,0x11,0xda,0x2f,
+  0x4c,0xd3,0x1d,0x31,0xdf,0xb5,0x26,0xcb,0xb2,0x79,0x68,0x4e,0x30,0x90,0xaa,0x7c,
+  0x83,0xae,0xe9,0x02,0x12,0x7e,0x78,0xae,0x89,0xa5,0x55,0x2d,0x93,0x9b,0x77,0xbe,
+  0xe7,0xd7,0x77,0x31,0xbc,0x1e,0x29,0x66,0xa3,0x5b,0xde,0x73,0x9b,0x7d,0xbf,0x43,
+  0xd3,0xb5,0xd8,0xc7,0x5b,0x3d,0x40,0xa8,0x37,0x57,0x0b,0x16,0x31,0x75,0x2a,0x4c,
+  0xc2,0x6f,0x45,0x51,0xaa,0xa8,0x89,0xfc,0xc9,0xbc,0x86,0xfa,0x06,0x75,0xc4,0xae,
+  0x62,0x9d,0xb1,0xdf,0x74,0xf7,0xca,0x4a,0x7a,0xf1,0x2a,0xa5,0xc9,0xcf,0xaa,0x96,
+  0x95,0xde,0x94,0x8a,0xa2,0x0e,0x35,0x73,0xca,0xb8,0x94,0x11,0x73,0xca,0xf6,0xd4,
+  0x86,0xc6,0x8a,0x66,0x7c,0x81,0x68,0xab,0x2a,0xb9,0x5a,0x13,0xac,0x76,0xa4,0x14,
+  0x0c,0x92,0xf8,0xa0,0xce,0x36,0x18,0x3a,0xe1,0x44,0x33,0x56,0x63,0xd8,0x19,0xd3,
+  0xa8,0x47,0xb2,0xcd,0x81,0x5c,0x43,0x9e,0xb7,0xc9,0xd5,0x7b,0x5a,0xc1,0x7a,0x97,
+  0x8a,0x72,0x8b,0xc9,0x93,0x91,0x33,0xb7,0xac,0x36,0x1f,0x3f,0xae,0x28,0x52,0xf2,
+  0x0c,0xd5,0xa6,0x0e,0x0a,0x6f,0x08,0x68,0x5b,0x57,0x06,0xa4,0x57,0x7d,0x97,0x5a,
+  0x50,0xe6,0x89,0xa6,0xbd,0xe9,0xe7,0x24,0x4a,0x92,0xd4,0xaa,0xd4,0xb1,0xe9,0xa0,
+  0x4d,0x99,0x2e,0x48,0xf3,0x78,0x76,0x02,0x98,0x6f,0xb7,0xc8,0x03,0xc2,0x2f,0x5b,
+  0xb2,0xd9,0x36,0x62,0x00,0xff,0xb6,0x32,0xf2,0x7c,0xac,0x25,0x9b,0x76,0x4d,0x64,
+  0x13,0xd9,0xb4,0x22,0x75,0xf6,0xdf,0xd8,0x8b,0x90,0x61,0xdf,0xc3,0x92,0xc9,0xe2,
+  0x4b,0xfc,0xd2,0x98,0xd6,0xcd,0x9f,0x62,0x04,0x94,0x01,0xa1,0x77,0x1a,0xad,0x81,
+  0x1a,0x93,0xa7,0xe3,0xb2,0xde,0x70,0x53,0x78,0x25,0xdf,0x30,0x32,0xe5,0xdb,0x9f,
+  0x2f,0x5e,0x7e,0x3a,0x3f,0xfb,0xe5,0x85,0xcd,0x96,0x5a,0x15,0x12,0x13,0xb5,0xfe,
+  0x64,0x2e,0x1f,0x1b,0xa4,0x69,0xbd,0x17,0x40,0xcc,0xff,0x4f,0xf6,0x52,0x8f,0x59,
+  0x58,0xe1,0xad,0x2e,0x89,0x80,0x26,0x61,0xbc,0x6c,0x96,0x39,0xa0,0x2d,0x48,0x17,
+  0x28,0x4b,0x8f,0xbf,0x02,0x20,0x8d,0x4b,0xa0,0xc8,0x1c,0xd4,0x08,0xd7,0x0d,0xda,
+  0x1d,0x28,0x55,0xfa,0xea,0xf1,0x21,0x6a,0x12,0xeb,0x25,0x9e,0xba,0xf5,0x03,0xb3,
+  0xa1,0x2d,0x5a,0x33,0xa9,0xaa,0xd6,0x29,0x49,0x86,0x3a,0xd2,0x56,0xb6,0x09,0x68,
+  0x55,0x97,0x4b,0xc3,0xcf,0x32,0x58,0xb1,0xcd,0x7a,0xdd,0x6e,0xd7,0x3c,0xa0,0xd1,
+  0x40,0xc0,0x65,0x85,0x67,0x08,0xba,0xbc,0xce,0x56,0xc1,0xaf,0x96,0x18,0x36,0x6d,
+  0x5d,0xc0,0x98,0xae,0x1c,0xf1,0xf2,0x16,0xcc,0x88,0x2e,0xe9,0x62,0x20,0xc3,0x48,
+  0xc7,0x17,0xdb,0x32,0xa5,0xdd,0x98,0x1f,0x9e,0xbd,0x7e,0xfd,0xe2,0x9d,0xd1,0x52,
+  0x39,0xaf,0xb4,0x57,0x52,0xc9,0x7f,0xf3,0x5a,0x62,0x51,0xce,0x79,0xfd,0xec,0xd5,
+  0x0b,0x8a,0x50,0x28,0x67,0x94,0xd1,0xaf,0x80,0x3c,0x3d,0x05,0x94,0x9e,0xff,0xf9,
+  0x02,0xf7,0x66,0xea,0x94,0x19,0xbf,0x83,0xac,0x5e,0x99,0xf1,0xbc,0x7a,0x65,0xa6,
+  0x64,0x89,0xc2,0x5d,0xaa,0x88,0x7a,0x4f,0x55,0x55,0x7b,0xa8,0x5b,0x5b,0xff,0x7e,
+  0xca,0x03,0x25,0xfe,0x0a,0x59,0x5e,0x33,0x2c,0xc0,0xea,0xc8,0xe7,0x75,0x1d,0x11,
+  0x71,0x49,0xdc,0x55,0xf4,0x6d,0x65,0xb7,0x50,0x75,0xe8,0x4b,0x2b,0x8f,0xfa,0x09,
+  0xb3,0xca,0x49,0x52,0xad,0x48,0x5f,0x7f,0x8d,0x02,0x6a,0xe1,0xd0,0xa2,0xc3,0x1d,
+  0x61,0x56,0xf5,0x0e,0x67,0x72,0x9c,0x65,0xdc,0x72,0x2e,0x2f,0xff,0x69,0xe1,0xe9,
+  0x5f,0x79,0xf1,0x38,0xd8,0xc6,0xa5,0x8d,0x92,0x57,0xe8,0x18,0x41,0x17,0xfe,0x15,
+  0xce,0x08,0xf8,0xff,0xf1,0xd8,0xcb,0x80,0x9f,0x60,0x9d,0x9f,0x4c,0x26,0x1d,0x5a,
+  0xa8,0x95,0xb5,0x90,0xb8,0xcc,0xaf,0xe0,0x35,0x71,0xff,0x9c,0x36,0xb5,0x4b,0xbc,
+  0x5c,0x0a,0x5e,0xab,0x65,0x77,0x2e,0xfd,0xc5,0x28,0x8f,0x57,0xfb,0x32,0xda,0xb0,
+  0x30,0xf6,0x03,0x10,0xf8,0x81,0xaf,0x2e,0xd8,0x1d,0x20,0x80,0x3b,0xb5,0x44,0xfb,
+  0x5d,0x82,0x48,0xc7,0xd2,0xc9,0x21,0xe7,0x43,0x1a,0x5c,0xbd,0x89,0x5d,0x93,0xd5,
+  0xf5,0xcc,0x77,0x24,0x25,0xdd,0x26,0x86,0xd2,0x8b,0xbe,0xae,0x1b,0xe0,0x61,0x49,
+  0x04,0x90,0x6b,0xc7,0xfa,0x7d,0x8c,0x8b,0xf0,0xdf,0xc7,0xa8,0xa6,0x87,0x8d,0x42,
+  0xa4,0x49,0xb8,0xab,0xda,0x72,0xdc,0x8c,0xaf,0x42,0xb0,0xa3,0x22,0xe9,0xa2,0x38,
+  0xb6,0x4b,0x8d,0x20,0x62,0x68,0xc7,0xac,0x01,0x44,0x3b,0x70,0xec,0x44,0x1e,0xba,
+  0xab,0xe4,0x70,0xfe,0xa4,0xf3,0x14,0x15,0x59,0x51,0x2b,0xde,0x40,0xbf,0x54,0x45,
+  0x93,0x1a,0x67,0xc9,0x79,0xae,0x18,0x15,0x72,0x5f,0x98,0xc4,0x83,0x14,0xab,0x18,
+  0x15,0xd4,0x89,0x94,0xd4,0x44,0xc0,0xe3,0x9a,0x7c,0x44,0x06,0xb4,0xad,0x1c,0x30,
+  0xa5,0x6c,0xeb,0xaa,0x17,0x4d,0x89,0x0d,0x0c,0x89,0xa3,0x92,0xa7,0x74,0x5f,0xe5,
+  0xba,0xcb,0x01,0xb5,0x8b,0x87,0x1d,0x79,0x75,0xdc,0x89,0x71,0x2f,0xe1,0x50,0x5d,
+  0x7e,0x59,0x5c,0x78,0x6b,0x2c,0xa2,0xb4,0x9b,0x1d,0x87,0xf2,0x02,0x67,0x32,0x74,
+  0xf8,0x7f,0x32,0x01,0xec,0x1d,0x58,0x05,0x86,0x97,0x71,0x92,0x06,0xb4,0xec,0x2b,
+  0x1b,0x42,0x0d,0x7a,0xa5,0xc1,0x10,0x2a,0xdd,0x60,0xb9,0x6c,0xbc,0x89,0x53,0x19,
+  0x42,0x09,0xc8,0x94,0x07,0x8d,0x42,0x61,0x58,0xd5,0xa5,0x25,0x4b,0xc2,0x8c,0xa5,
+  0x35,0x47,0x8e,0xf8,0xaa,0x9c,0x58,0x6f,0xbb,0xd6,0x4d,0xa6,0xb2,0x09,0x5b,0xf0,
+  0x9f,0x76,0x67,0xcf,0x43,0xc3,0x50,0x15,0x42,0xa3,0xb1,0x37,0x77,0xc5,0x76,0x19,
+  0x10,0xa0,0x10,0x97,0x40,0x6f,0x12,0x96,0x08,0x92,0x2c,0x0a,0x94,0x77,0xfc,0x5e,
+  0x62,0x2b,0x00,0xf6,0xb9,0x65,0xfb,0x99,0xfd,0xa0,0x5e,0x93,0xab,0xd5,0x77,0x39,
+  0x63,0xbb,0x67,0xff,0x69,0x7f,0x58,0xa5,0x8a,0x32,0x01,0x84,0xc7,0x4f,0xeb,0xc2,
+  0x46,0x3d,0x78,0x40,0xb7,0x9f,0x4b,0x93,0xad,0x30,0x8f,0xde,0x2e,0xf0,0x8e,0xd6,
+  0x29,0x96,0x8f,0x98,0x75,0x9d,0x7d,0xc2,0x4d,0x42,0x67,0x6a,0x0f,0xd8,0xf5,0x14,
+  0x84,0x2c,0x5e,0x36,0xc1,0x32,0x50,0x96,0x01,0xde,0x79,0xc9,0x77,0x69,0x30,0x49,
+  0xbc,0x7e,0x8a,0xe7,0xc5,0x33,0xc6,0x77,0x35,0x33,0x7a,0xd3,0x02,0x33,0x73,0xbc,
+  0x73,0x1d,0x3e,0x47,0x30,0x89,0xb8,0x6e,0x22,0x2f,0x0a,0xa3,0x1d,0xbe,0xc2,0xe2,
+  0x52,0x3d,0xd0,0xed,0x1e,0x4a,0x7c,0xf7,0xe2,0xfd,0xbb,0x7f,0xd3,0xec,0x2f,0x4a,
+  0xbc,0x78,0xf3,0xfc,0xcf,0x2f,0xde,0x97,0x5f,0x59,0x40,0x74,0x7f,0x4e,0x23,0xcd,
+  0xf6,0x49,0x52,0x54,0x9e,0x68,0xac,0x62,0x01,0x87,0xbe,0x4f,0x98,0x38,0x15,0x6d,
+  0x24,0xdb,0xdb,0x3d,0x90,0x6e,0x47,0x3d,0x75,0x6a,0xb9,0x75,0x9d,0x0d,0x76,0x76,
+  0x5a,0xdb,0xaa,0xd4,0x34,0xc9,0x72,0xd2,0xbe,0xad,0x41,0x6b,0x1b,0xab,0x6c,0xb7,
+  0x76,0xae,0x69,0xbb,0xa8,0xc0,0x80,0xae,0xed,0x45,0x32,0xbe,0x4b,0xa2,0x40,0x5c,
+  0x03,0xd1,0x66,0xbe,0xe0,0x62,0xbf,0xd8,0x84,0x87,0x49,0xaf,0x74,0x18,0xe4,0x56,
+  0x6e,0x95,0x30,0xfd,0xaa,0x5a,0x45,0xdc,0xcc,0x6b,0xb8,0x30,0x86,0xa4,0x6d,0xf9,
+  0xe9,0x0e,0x75,0xb8,0x51,0xfe,0x1a,0xd4,0x5c,0xd4,0x01,0xb3,0x60,0x2e,0x6f,0x3c,
+  0x13,0x67,0x1a,0x1f,0x16,0xcb,0x67,0x23,0x87,0xf0,0xd2,0x32,0x0b,0xdd,0x9e,0x89,
+  0x13,0x8c,0xbf,0x60,0x89,0x1f,0x6e,0xdf,0x86,0x7e,0xe3,0x3d,0x18,0x6d,0x6a,0xa2,
+  0xcd,0xe6,0xda,0x3d,0x06,0x4c,0x94,0xc6,0x75,0xfb,0x39,0xbd,0x65,0x82,0x65,0x8e,
+  0xdd,0x7e,0x57,0xfe,0x7e,0xea,0xf6,0xfb,0x76,0x5d,0x33,0xd5,0x8b,0x55,0xaa,0x0d,
+  0xdc,0x99,0xcb,0x93,0x24,0xc6,0x51,0xb2,0x66,0x62,0x64,0x66,0xa0,0x42,0x51,0xe0,
+  0xc2,0x67,0xf3,0x8d,0xba,0x7a,0x84,0x0f,0xaf,0x34,0x81,0x46,0x83,0xac,0x34,0x96,
+  0x62,0x47,0x09,0x6d,0x6e,0xed,0xbd,0x5f,0x61,0x74,0x87,0x36,0x0b,0x4b,0xa6,0x9d,
+  0x04,0x73,0x52,0x40,0x04,0x83,0x70,0x32,0xcf,0xb8,0x3d,0xa8,0xac,0xea,0x4a,0xeb,
+  0xa8,0x34,0xb4,0x8b,0x08,0x78,0x42,0xd9,0xfa,0x70,0x1f,0x3e,0xd4,0x76,0x72,0x74,
+  0xf5,0x6c,0x61,0x3a,0xd2,0x96,0x5f,0x3d,0x60,0x2b,0xad,0xef,0x19,0xca,0xbe,0x71,
+  0xbd,0x53,0x6b,0xa8,0x78,0xf5,0x5b,0x20,0xe6,0xee,0x52,0x69,0x6b,0x49,0x98,0x18,
+  0xee,0x92,0x0c,0xe6,0x41,0x19,0xd1,0x36,0x0b,0xfd,0x81,0x47,0xc3,0x59,0x6c,0xd4,
+  0x34,0xca,0xfc,0xbb,0x61,0x8d,0x2b,0xa8,0xd1,0x96,0xd3,0x37,0x55,0x74,0x1d,0x65,
+  0xd7,0x6a,0x8d,0xfa,0xa5,0x6b,0x43,0x80,0x82,0x18,0x24,0x2e,0x1c,0xed,0x92,0x64,
+  0x00,0x0e,0x6f,0x33,0x95,0x39,0x94,0xec,0x24,0x82,0x69,0x2a,0xa5,0x4f,0xa9,0xb4,
+  0xca,0x36,0x38,0x19,0x86,0x3f,0x06,0xeb,0x83,0xd8,0x59,0x70,0xf3,0x43,0xab,0xf5,
+  0x6b,0x30,0xba,0x20,0x49,0xdd,0xc2,0x9b,0x80,0xf8,0x61,0x13,0x5b,0x0b,0xb3,0x03,
+  0x41,0x7a,0x9d,0x09,0x7b,0xfc,0x3a,0xa3,0x9b,0x7d,0x54,0x15,0x4b,0xc9,0x51,0xc3,
+  0xf2,0xd0,0x19,0xf0,0x3a,0x73,0x46,0x60,0x66,0xa4,0xb7,0xef,0x29,0x9a,0xc0,0x43,
+  0x59,0x33,0x5a,0x4c,0x26,0x14,0x7d,0xa3,0x4b,0x68,0x68,0x84,0x4a,0x27,0x31,0xaa,
+  0x0b,0x97,0xab,0xf9,0x42,0xd8,0x73,0xab,0x5f,0x4c,0x93,0x8b,0xc5,0x08,0x9f,0x5e,
+  0x1c,0x71,0x35,0x25,0xeb,0x89,0xc7,0x26,0x5c,0x50,0xa3,0xca,0x46,0x10,0xd2,0x28,
+  0xb8,0x22,0x93,0xea,0xa1,0x7e,0xbd,0x2c,0xf3,0x53,0xef,0xfa,0x2d,0x07,0x78,0x8a,
+  0x93,0xc9,0x12,0xa5,0x0c,0xc7,0x15,0xf5,0x5b,0xc8,0x00,0xed,0xe1,0x26,0x59,0xb4,
+  0xe8,0x77,0xd5,0xb5,0x8c,0xc4,0x61,0x02,0xa9,0xc2,0xaf,0x2c,0xb1,0x1d,0xe3,0x0b,
+  0xf3,0x95,0x6e,0x0a,0x9d,0x56,0x51,0x5d,0xe6,0x1b,0x3e,0x85,0xba,0xb3,0x87,0xba,
+  0xee,0xd3,0x9e,0x4b,0xd1,0x06,0xbb,0xcd,0xf6,0x85,0x06,0x47,0x04,0x40,0x87,0xcf,
+  0xb9,0x6d,0x06,0xbd,0xcc,0xc0,0x36,0xcd,0x00,0x47,0x2f,0x26,0xbd,0xad,0x69,0x78,
+  0x7a,0x29,0xfd,0xfc,0xc5,0x8f,0x92,0xe4,0xcc,0x8a,0x02,0xff,0x53,0x46,0xaf,0xa1,
+  0x93,0xa2,0xe7,0xa3,0xca,0xb8,0x18,0x42,0xeb,0x05,0x75,0x38,0x75,0x59,0x28,0x7e,
+  0xcd,0x12,0xa0,0x1b,0x2b,0xc9,0x12,0x90,0x9a,0x9c,0x8b,0xa2,0xb7,0xef,0x5e,0xfc,
+  0x72,0xf6,0xe2,0xd7,0x4f,0xa7,0x6f,0x2f,0xdc,0xde,0xbe,0xae,0x9f,0x2b,0xe3,0xac,
+  0x22,0x3e,0x50,0x2c,0x58,0x85,0xc4,0x7c,0x13,0xb7,0xc8,0x8e,0x37,0x53,0x54,0x70,
+  0x93,0xba,0x73,0x49,0x13,0xb2,0xfc,0x4d,0x74,0x21,0x66,0xc7,0x36,0x1b,0x97,0xe3,
+  0x42,0xe2,0x93,0x96,0x0a,0x08,0xe1,0xb3,0x53,0x1b,0x0f,0x6c,0x4c,0xfb,0x74,0x70,
+  0x91,0x7c,0x4b,0x6a,0x00,0xf4,0x51,0xcf,0x36,0xf2,0xe8,0x62,0x9c,0xca,0xf6,0x1f,
+  0x27,0xd9,0x00,0x9a,0xd1,0xfa,0x3f,0xc0,0xc0,0x5d,0xe0,0x9d,0x6c,0xb0,0xcb,0xf0,
+  0xea,0x68,0x69,0x76,0x5a,0x49,0x7c,0x5f,0x4d,0x81,0x8e,0x17,0x7d,0x24,0xf8,0x99,
+  0x1c,0x1c,0xda,0x97,0x32,0x58,0x0f,0x85,0xca,0x15,0x06,0x56,0x01,0xad,0x7b,0xbc,
+  0xe1,0x36,0x9b,0x44,0xde,0x65,0x86,0x3b,0x8d,0x7f,0x61,0x8b,0xdd,0x7e,0x9b,0xe5,
+  0xaf,0x32,0xfe,0x83,0xdb,0x61,0x8b,0xde,0x01,0x30,0x41,0x98,0xe7,0x30,0xaa,0xd0,
+  0xaf,0xd0,0x8b,0xed,0x36,0x0e,0x6f,0x2c,0xf2,0x47,0xb7,0xb8,0x4d,0xdd,0x75,0x9c,
+  0xfe,0x3e,0x98,0xa2,0xb8,0x55,0x4d,0x97,0xb7,0x82,0xbd,0x87,0xe0,0x8b,0xb1,0xad,
+  0x4c,0x3b,0x10,0x07,0x5a,0x3c,0x2e,0x0a,0x98,0x1f,0x61,0x6a,0xfd,0x02,0xf9,0x94,
+  0xc5,0x65,0x1e,0xfc,0x72,0xb0,0x85,0x73,0xda,0xad,0x78,0xda,0xdb,0x43,0x5b,0xc3,
+  0xc7,0xab,0x6b,0x7e,0x0e,0xe3,0xfc,0xc8,0xea,0xda,0x30,0xb9,0x0f,0x0f,0x4a,0xa9,
+  0x3d,0x4c,0xed,0x95,0xf7,0x61,0xe8,0x76,0x26,0xad,0x54,0x1f,0x3a,0x12,0x17,0x09,
+  0xbd,0x03,0xab,0xd7,0x6f,0x8b,0x20,0x2c,0xb1,0xb2,0x0b,0x8e,0x7b,0x08,0xda,0xc4,
+  0x02,0x61,0xef,0x6d,0xc7,0xda,0x6d,0x6b,0x6b,0x98,0xed,0xe1,0x18,0x81,0x8c,0x1b,
+  0xe2,0x94,0xca,0x68,0x5e,0xba,0x63,0x44,0x89,0x46,0xf5,0x26,0xb7,0x5a,0x7d,0x5f,
+  0x0b,0x35,0x49,0xae,0x5f,0x42,0x36,0x3f,0xd5,0xb6,0x83,0x63,0x14,0x44,0x11,0x24,
+  0xd0,0xe9,0xb4,0x1d,0x2d,0xee,0x82,0x9e,0xd0,0xb8,0x74,0x48,0x7c,0xbc,0xc3,0x1b,
+  0x12,0xbb,0x6d,0xec,0xce,0xf7,0x08,0xa0,0x2d,0xca,0xb7,0xf1,0x03,0xcb,0x81,0xb1,
+  0x67,0xa1,0xc0,0x0f,0xdd,0xee,0x30,0x7c,0x1a,0x0f,0xc3,0xed,0x6d,0x35,0x32,0x57,
+  0x3a,0xc5,0xa0,0xdb,0x78,0xa7,0xc3,0x25,0x3e,0xd7,0x11,0x5d,0xd0,0x21,0xbe,0x56,
+  0x7a,0x39,0xb2,0x5a,0xdb,0x57,0xdb,0xad,0x76,0x6b,0x9b,0x10,0xa0,0x73,0x6f,0xd6,
+  0xd5,0xf7,0x5d,0xe7,0x68,0xdf,0xae,0x4b,0x3e,0x10,0xf7,0x82,0x70,0x30,0x84,0x5d,
+  0xf8,0x3d,0x76,0x64,0x5b,0xf0,0x24,0x61,0xb9,0xbd,0xd7,0xd6,0x03,0x49,0x30,0xbf,
+  0x83,0x23,0x86,0x79,0x9d,0x23,0xbb,0xba,0x40,0xad,0x5d,0x86,0x2e,0x1b,0xd4,0x77,
+  0xad,0x3b,0xd9,0x28,0x31,0x6c,0x74,0xf2,0xde,0xad,0x5c,0x37,0x37,0xf9,0x62,0xd7,
+  0x79,0x5b,0xc9,0xd9,0xfa,0x1f,0xef,0x50,0x25,0xaa,0x92,0x42,0xf8,0x35,0x4c,0x85,
+  0xf3,0x7b,0x2c,0x96,0x12,0x0f,0x2c,0x49,0xee,0x42,0x30,0x67,0x14,0x4d,0x56,0x1b,
+  0x5b,0xc6,0xb3,0xd0,0x45,0x40,0x3f,0x36,0x8d,0x70,0x6d,0x08,0xe6,0x37,0x1c,0xd1,
+  0x02,0x62,0x11,0xcb,0xba,0x79,0xa0,0x4a,0xb1,0x3e,0xaf,0xaf,0x83,0x11,0x42,0x77,
+  0xf5,0x61,0x26,0xd5,0x78,0xd5,0xfa,0x4d,0xa7,0x3b,0x5b,0x7f,0x67,0xe5,0x9e,0x31,
+  0x11,0xcd,0x87,0x8a,0x95,0x0f,0x46,0xbb,0x99,0x08,0xd9,0xde,0x80,0x9d,0xcc,0x15,
+  0x68,0xca,0xb1,0x65,0x91,0x95,0x80,0xf9,0xdc,0xd1,0xe0,0xd6,0xc7,0xbb,0xa1,0xd6,
+  0xb9,0x02,0xb5,0x73,0xb5,0xe9,0x58,0x36,0x44,0xc9,0xdc,0x83,0x90,0x0f,0xd8,0xba,
+  0x28,0x3b,0x40,0x0a,0xf3,0x6c,0x2a,0xf1,0x0f,0x44,0xec,0xce,0xc6,0xa0,0x8c,0x92,
+  0xef,0x9b,0x9e,0x67,0x53,0x57,0xc9,0xad,0x8f,0xc0,0x53,0x81,0x5e,0xab,0xe3,0xef,
+  0x88,0x93,0xeb,0xc3,0xde,0xe8,0x88,0xb4,0x8c,0x78,0xa3,0x0f,0x71,0x33,0x91,0x7e,
+  0x5f,0x1d,0x37,0xa3,0x1b,0x4d,0xd6,0x22,0xdc,0x0c,0x17,0xb7,0x66,0x4c,0x84,0xba,
+  0x03,0xaf,0x7a,0xff,0x9d,0xe1,0x4b,0x54,0x37,0x65,0x09,0x76,0x2c,0x9e,0x80,0xb2,
+  0xdb,0xe4,0x0a,0x32,0xd2,0xb5,0xd7,0x95,0x78,0x15,0x5b,0x54,0x2d,0x62,0x82,0x1e,
+  0x6a,0x0d,0x52,0x41,0x01,0xc4,0x96,0xd0,0x9a,0x8a,0xa2,0x08,0x2b,0x0d,0x4b,0xc3,
+  0x8b,0x40,0x5c,0x3b,0x68,0x95,0xb5,0x97,0x06,0x8a,0xd7,0xf6,0xb4,0xe1,0x1c,0x56,
+  0x41,0x03,0xda,0xea,0x88,0xbc,0xd8,0x71,0xaf,0x05,0xa8,0xed,0xf8,0x88,0xa3,0xfd,
+  0xf3,0x34,0x99,0xcd,0x41,0xc1,0x93,0xcf,0xd9,0x38,0xd7,0x3f,0x90,0x86,0x03,0x5f,
+  0x67,0x9b,0x20,0xc6,0x93,0x4b,0x97,0x3c,0x3c,0xfc,0xb5,0xad,0x62,0x07,0x5c,0x8b,
+  0x3d,0xe3,0x2b,0xe5,0x36,0x73,0x1c,0x3a,0x6f,0x72,0x37,0xd4,0x1e,0x18,0x15,0x0f,
+  0x6e,0xe2,0x49,0xff,0xb6,0x7c,0x7c,0xd3,0x1e,0x6e,0xca,0xa7,0x3b,0xd0,0xdf,0x56,
+  0x7b,0xc9,0xcc,0x90,0x32,0x76,0x9f,0x98,0x32,0x42,0x71,0xc0,0x4a,0x06,0x32,0x26,
+  0xda,0xda,0xfe,0x4c,0x56,0x99,0x03,0x0d,0x43,0xc2,0x03,0x28,0x71,0x86,0x76,0xb8,
+  0x20,0xc7,0xa7,0x0f,0x81,0x25,0x01,0xd1,0xc0,0x57,0x24,0xc5,0x91,0xd6,0x5f,0xe0,
+  0xc2,0xcd,0xac,0x38,0xd1,0xe2,0xeb,0xf0,0xe4,0x96,0x0a,0xae,0x94,0xa7,0x0f,0x4a,
+  0xf1,0x95,0x62,0x0c,0xc1,0x0c,0xa7,0x38,0x9b,0xdf,0xf5,0xfb,0xef,0x7e,0xcf,0x40,
+  0xbd,0xf0,0xe7,0x76,0x95,0xe7,0xeb,0x44,0xa4,0x0e,0x38,0x93,0x89,0x98,0x9b,0x13,
+  0x3d,0xd4,0xb2,0x83,0x5e,0xc5,0x4e,0x4f,0x17,0xbd,0x31,0x21,0xe9,0x22,0x32,0x7f,
+  0xeb,0x26,0x82,0x6b,0xbc,0x95,0x87,0xcc,0x4e,0xc8,0x1f,0x73,0xb7,0xb0,0x25,0x9a,
+  0x5a,0x1f,0x21,0xa4,0xde,0x85,0x64,0x5a,0x3c,0x49,0xdd,0xa1,0x16,0x02,0x6f,0xaf,
+  0x38,0x51,0xc2,0x0b,0x14,0x37,0xc4,0x0a,0x14,0xe4,0xbe,0xce,0x6a,0xb9,0x2b,0x82,
+  0x4c,0x61,0xb8,0x69,0x9d,0x2a,0x5f,0x0d,0xc3,0x88,0xfa,0x4c,0x44,0x30,0xf1,0x3b,
+  0x00,0x5e,0x25,0x3e,0x05,0x9f,0xf2,0x97,0x03,0xc9,0x35,0x61,0x5c,0x1b,0x30,0x14,
+  0x77,0x0c,0x34,0xc6,0x92,0x36,0xc7,0xde,0xb3,0xd2,0x54,0xa2,0x17,0xad,0xf8,0x5f,
+  0x8a,0x3a,0xad,0xca,0xd8,0x80,0xbf,0xc2,0xa9,0x09,0x0a,0x53,0xc2,0x6a,0xf0,0xf8,
+  0x3b,0x99,0x6d,0xf1,0xd7,0xae,0x95,0x65,0xe5,0x6b,0x39,0x7c,0xb2,0xb0,0x14,0x08,
+  0x5f,0xbb,0xc9,0xa3,0x32,0xbf,0x57,0xcc,0x6b,0x0e,0xf6,0xef,0x32,0xb5,0x97,0xa1,
+  0x7f,0x47,0x53,0xbb,0x49,0xa8,0xde,0x77,0xe0,0xe8,0x14,0x0e,0x1f,0x7b,0x7a,0x44,
+  0xee,0xe7,0x33,0x96,0x27,0x89,0x88,0xa4,0x4e,0x93,0x39,0xf3,0x62,0x0a,0x16,0xed,
+  0xcc,0xc2,0x2c,0x43,0x97,0xc7,0xd9,0x8f,0x19,0x0f,0xc3,0x29,0xd8,0x51,0xcd,0x37,
+  0xb0,0x6d,0x42,0xff,0xcc,0x47,0xdb,0x0f,0x17,0xa1,0x17,0x41,0x6e,0xd5,0xd8,0x8d,
+  0xa6,0x97,0xd2,0x8c,0x45,0xaf,0xe1,0x75,0xf1,0x9e,0x21,0x5e,0x42,0x2e,0xe1,0x3b,
+  0x53,0x2f,0xb3,0x24,0xa4,0xaf,0x64,0x3d,0x20,0xd4,0xb7,0x14,0x0a,0xc5,0xac,0xde,
+  0x7c,0xf2,0x95,0x59,0xcd,0x78,0xdd,0xb7,0x29,0xee,0x5a,0x4c,0x01,0x93,0x75,0xef,
+  0x37,0x0b,0x0a,0xcf,0x3c,0x68,0x7f,0xc3,0xc2,0xaa,0xb0,0x88,0xd8,0x87,0x75,0x0d,
+  0x96,0x22,0x2e,0x9b,0xd9,0x6c,0x26,0x9f,0x2e,0x55,0xe1,0x3f,0x85,0xa7,0x14,0x7d,
+  0x73,0x06,0xe8,0xcd,0x20,0x09,0xeb,0x4a,0x73,0xa3,0xf1,0x47,0x31,0xd9,0x0e,0xe3,
+  0x3a,0x5a,0x78,0xbf,0xcc,0x5b,0xe0,0x4d,0xf5,0x5d,0xc4,0x50,0x9f,0xbb,0xe2,0x8e,
+  0xf1,0xd6,0x79,0x61,0x14,0x9e,0xaa,0xc4,0x53,0xf5,0xee,0xe9,0x1b,0xfe,0x7c,0x27,
+  0x49,0x5e,0xa6,0x5d,0x80,0xca,0x39,0x5d,0xdc,0x8c,0x2a,0x5e,0xeb,0xd6,0xb2,0x7f,
+  0xf1,0x22,0xb1,0x2f,0xc6,0x43,0x9b,0xf1,0x31,0x9b,0x80,0x9f,0x08,0x43,0x0d,0x29,
+  0x6f,0x76,0xa5,0xd7,0x76,0xe9,0x0a,0x60,0xad,0x6e,0x71,0x5f,0x7d,0xf6,0x2e,0xb9,
+  0x5e,0xf7,0x7c,0x5c,0xf5,0x9a,0x6c,0xa7,0x78,0xd4,0xc7,0xfe,0xc8,0x6f,0x40,0x4e,
+  0x57,0x5c,0x8a,0x9d,0xea,0x77,0x62,0x7f,0xf9,0xd2,0xea,0xf0,0x43,0x23,0xc3,0x95,
+  0xd7,0xfa,0xab,0x4b,0x8c,0x51,0xa9,0xc8,0x4b,0x8b,0xfd,0xba,0xab,0xe4,0x71,0x22,
+  0x68,0x17,0xdd,0xb7,0x8a,0x03,0x58,0x38,0x25,0xa8,0x8b,0xc6,0x65,0x90,0xfc,0xbd,
+  0x1d,0x4a,0x2f,0xcf,0xbe,0x15,0xf7,0x7f,0xeb,0xba,0x0e,0x5f,0xa8,0x29,0x8d,0x05,
+  0x1e,0x12,0x2e,0x1e,0xe8,0xd1,0xef,0xf8,0x3e,0x11,0x35,0x8c,0x6b,0xbe,0xcd,0x37,
+  0xdf,0x78,0x7e,0x71,0x51,0x7a,0xb1,0xea,0x44,0x2b,0x71,0xc9,0xae,0x06,0x3d,0x75,
+  0x13,0xf7,0x60,0xc9,0x8c,0x7b,0x74,0x2d,0x13,0x8f,0x93,0x93,0x9e,0x03,0xe0,0x41,
+  0x86,0xcb,0x5b,0x35,0x8b,0x5b,0xbd,0x07,0xe7,0x4e,0xe5,0x86,0x6f,0x48,0x13,0x17,
+  0xa1,0xde,0x15,0x4f,0x00,0x1a,0x95,0x4e,0x6b,0x2a,0x9d,0xaa,0x4a,0xe2,0x19,0x2b,
+  0x3e,0x58,0x80,0xad,0x79,0xaa,0x8d,0x84,0x26,0xc8,0x20,0x31,0x3d,0x20,0x5f,0xbc,
+  0xa3,0x65,0x3d,0x44,0x83,0xb6,0xd8,0x70,0x84,0x2f,0x74,0xef,0x27,0xa3,0xdf,0xe9,
+  0x89,0x1c,0xb5,0x39,0x8b,0x56,0x9c,0x07,0xc2,0x82,0xa7,0x0f,0x8b,0xba,0x62,0x4f,
+  0x05,0x41,0x3c,0xd4,0xcf,0x3f,0x17,0x55,0xa5,0xd2,0x28,0xbd,0x26,0xac,0xdd,0xc3,
+  0x4c,0x03,0xc2,0x6f,0x04,0xce,0x60,0x39,0x29,0x71,0xc9,0x8a,0x0e,0x6b,0xc1,0xc5,
+  0xd5,0x23,0x37,0x99,0xdc,0x73,0xa5,0xd3,0x6d,0xe2,0xc3,0xa1,0x28,0x00,0xdc,0x70,
+  0x6d,0xbc,0x3b,0x56,0x4b,0xe7,0xbb,0xbf,0xda,0x2e,0xab,0xea,0xa1,0x44,0x4d,0x3b,
+  0x38,0x6e,0xf3,0xce,0x1a,0x39,0xaa,0xdb,0x45,0xbf,0x47,0xb0,0xf4,0xa3,0x88,0xc7,
+  0xb9,0x77,0x8b,0xeb,0x40,0xed,0xda,0xe7,0xcd,0xef,0x7b,0xae,0xd9,0xf9,0xe5,0x90,
+  0x45,0xd9,0x96,0x36,0xea,0x5c,0x0a,0x55,0xc3,0x98,0xc7,0xc9,0xfc,0xf6,0x7d,0xf2,
+  0x3c,0x0a,0xe7,0xa3,0xc4,0x4b,0x7d,0x0b,0x7d,0x5e,0xea,0x55,0x74,0x61,0x44,0x80,
+  0xb6,0x0b,0x41,0x24,0x26,0xa9,0x33,0x96,0xe5,0x1c,0xba,0xbf,0xf2,0x3d,0x3a,0x4d,
+  0xa9,0x86,0x12,0x05,0xfa,0xea,0x57,0x3d,0xa9,0xa8,0xc4,0xff,0x5d,0x35,0x7e,0xcd,
+  0xf3,0x4f,0x41,0x84,0x16,0x08,0x14,0x8d,0x8b,0x20,0x7d,0xb7,0x19,0x09,0xac,0x4d,
+  0x38,0x68,0xed,0x57,0x1a,0x17,0x8e,0x44,0x83,0xe5,0x69,0x4b,0x8f,0x2b,0x8e,0xc0,
+  0x2f,0xf1,0x3d,0x1e,0x87,0x51,0x52,0x3c,0x13,0xaf,0xa2,0xeb,0x77,0x5e,0x0b,0x99,
+  0xf5,0xf5,0x57,0x73,0x6b,0x62,0xee,0xdb,0xca,0xf6,0x7f,0x06,0xb9,0xae,0x5d,0x7d,
+  0xac,0xe4,0x7a,0x21,0xd3,0xef,0x2f,0xd1,0xc9,0x11,0x16,0xcf,0x71,0xb9,0x1f,0xcf,
+  0xcd,0x48,0x8c,0xe6,0x4b,0xc9,0xf5,0xc7,0xae,0x6a,0x5b,0x24,0xf8,0x1f,0x48,0x0d,
+  0x50,0xa9,0x8f,0x85,0x77,0xeb,0x32,0xb0,0x8d,0x77,0xac,0x54,0xb3,0x22,0x5c,0x47,
+  0x2d,0x8b,0x4c,0x91,0x55,0xb8,0x09,0x61,0x5a,0x67,0xee,0x87,0x0f,0xb4,0x03,0x54,
+  0x08,0x86,0x8f,0x6d,0xf6,0x81,0xf6,0x8e,0x75,0x89,0xf0,0x91,0x5e,0x0e,0xa1,0x1a,
+  0xc5,0x0d,0x25,0x1f,0x64,0xa8,0x0a,0xa6,0x7f,0xb4,0x4d,0x9d,0xdd,0xf0,0xfc,0x10,
+  0x3d,0x4c,0x13,0x44,0x7a,0x00,0x48,0x64,0x12,0xab,0x74,0x5d,0xf8,0x8a,0xc8,0x15,
+  0xfd,0x66,0x06,0xc8,0x5e,0xf7,0x84,0x0a,0xd3,0x6f,0xea,0x36,0x83,0x59,0x8a,0x4b,
+  0x56,0x90,0xc3,0x11,0x58,0xdd,0xc3,0xb7,0xb5,0xbc,0x5c,0xcf,0xbf,0xc8,0xb9,0xc0,
+  0x71,0x73,0x47,0x5e,0xb2,0x90,0x96,0xd8,0x2b,0xfd,0x6a,0xe6,0xa2,0x1f,0x75,0x2f,
+  0xa8,0x60,0x72,0x71,0x56,0xfa,0xe1,0x43,0xc5,0x0d,0x7c,0xfb,0xb0,0xcc,0x94,0x45,
+  0x94,0x8b,0xce,0x84,0xe9,0x3d,0x59,0x90,0x6e,0x32,0xd1,0xf0,0x29,0xc4,0x7c,0x23,
+  0x67,0xb2,0xe2,0x71,0x96,0xfa,0xd3,0xca,0xe6,0xfd,0xbf,0x4b,0xfd,0x08,0x60,0x71,
+  0x6f,0x26,0xfd,0x41,0x47,0x96,0x8d,0x0f,0x19,0x25,0xd7,0xb4,0x4e,0x7b,0xc1,0x97,
+  0x14,0x52,0x59,0x43,0x6e,0xab,0x38,0xaf,0xf7,0x0c,0x65,0x29,0x1e,0xb8,0x4c,0x70,
+  0x73,0x6b,0xc6,0x8f,0xe1,0xd5,0xc8,0x57,0x05,0xb8,0xa8,0x49,0x7e,0xa4,0xc5,0x68,
+  0x16,0xd2,0x61,0x5c,0xf1,0xd4,0xb6,0x25,0x8c,0x06,0xda,0xf7,0x54,0xaa,0x53,0x97,
+  0x99,0x6e,0xe9,0x49,0x99,0xe1,0xbd,0xac,0x79,0x75,0x6a,0x11,0x77,0x8e,0xbb,0x6d,
+  0xdd,0xdc,0x92,0x66,0x56,0xfb,0xd2,0x28,0x89,0x24,0x78,0x0b,0x4a,0x2a,0x04,0x81,
+  0x07,0xac,0xa9,0x85,0x00,0xa4,0xed,0x3d,0x11,0x54,0x63,0x40,0xed,0xb5,0x75,0x7b,
+  0xec,0xb4,0x0c,0x55,0x5b,0x7e,0x45,0xe4,0x1d,0x85,0xf5,0x97,0xf8,0x51,0x10,0xe7,
+  0x39,0x2e,0x90,0xd0,0x7d,0x06,0x66,0x2b,0x88,0x52,0x5c,0x89,0x71,0x1a,0x94,0x16,
+  0x4e,0x34,0xe6,0x8d,0xab,0x40,0x7d,0xdc,0xef,0xb1,0x06,0x7c,0x40,0x1b,0x53,0x65,
+  0x67,0x48,0xc2,0x97,0x51,0xfa,0x02,0x6a,0x8d,0x83,0x14,0x6d,0x83,0xf2,0xe1,0x5c,
+  0xc9,0x02,0xea,0xf6,0x55,0x4e,0xb8,0x5a,0x43,0x44,0x5a,0x5a,0xc9,0x67,0xe8,0x5a,
+  0xc9,0x95,0xfb,0x1c,0x2a,0xc8,0x43,0xa1,0xd8,0xc4,0x00,0x3a,0x26,0x6c,0x91,0xd2,
+  0xda,0x39,0xb8,0xe1,0x8c,0x88,0x5d,0x94,0x3f,0x6b,0x67,0x89,0x9f,0x70,0x9e,0xe5,
+  0x3d,0xc4,0xb5,0x1c,0x75,0x40,0x46,0x71,0x56,0x4c,0x15,0x89,0x1e,0x37,0x9a,0xa8,
+  0x30,0x88,0x88,0x12,0x9e,0x6f,0xbd,0x2c,0x0f,0x4c,0x44,0xc9,0x48,0x14,0x11,0xd9,
+  0x05,0x00,0xed,0x45,0x31,0x6c,0x1a,0x49,0xcb,0x6d,0x17,0x6e,0x0d,0xc1,0xa7,0x16,
+  0x1d,0x23,0x7b,0x2a,0x6c,0x1d,0x3a,0x79,0x6a,0xb5,0xce,0x62,0x32,0xe6,0xa9,0x99,
+  0x56,0xe9,0x1a,0x2c,0x4e,0x6f,0x18,0x63,0xb7,0xc6,0xe0,0x27,0xc9,0x03,0x79,0x76,
+  0x05,0x14,0x47,0x1c,0x4f,0x3b,0x60,0xb6,0x09,0xb2,0xc9,0x8c,0x2a,0x79,0xee,0xc2,
+  0x99,0xa2,0xbf,0xfa,0x59,0xba,0x59,0x03,0xc5,0xfe,0x05,0x30,0x48,0x14,0x3c,0x93,
+  0xf3,0x46,0x67,0x33,0xf1,0xe6,0xd9,0x06,0x0f,0xda,0x99,0x61,0x73,0xa6,0xad,0x52,
+  0xb8,0x4e,0x5b,0x19,0xb5,0x25,0x9e,0xc8,0xa6,0xe0,0x07,0x6a,0x41,0x99,0xd1,0xe2,
+  0x3d,0x33,0xfe,0xf0,0xf1,0x03,0xed,0xed,0xbd,0xbd,0xfb,0xbd,0xaa,0xb7,0xa7,0x3f,
+  0x95,0x85,0xd5,0x4f,0xf0,0x1f,0x9e,0x3d,0xa8,0x42,0x7a,0xfc,0xb8,0x92,0xf4,0xa1,
+  0xfb,0xf1,0xa4,0x2e,0x51,0xc0,0xe8,0x96,0x08,0x69,0x44,0x64,0x9e,0xc5,0x4a,0x57,
+  0x5b,0xea,0x79,0xb2,0x33,0xfe,0x70,0xb0,0x8f,0xee,0xc4,0xa0,0xcd,0xb8,0xb6,0xd2,
+  0x66,0x34,0x57,0xf9,0x5a,0x71,0x19,0x58,0x01,0x29,0xd5,0x77,0x94,0x41,0x45,0x64,
+  0x1b,0x6b,0x77,0x7a,0xf9,0x30,0x21,0x5c,0xb0,0x2a,0x03,0x7b,0x19,0xeb,0xdb,0x9b,
+  0x39,0x25,0xd6,0x9a,0xad,0xca,0xec,0xe4,0x76,0xab,0xea,0x24,0xbe,0x44,0x57,0x3c,
+  0x6e,0xae,0xb9,0x17,0xd2,0x7b,0xd8,0x0a,0x5f,0xbe,0xa4,0x2b,0x34,0x38,0xd7,0xcf,
+  0x6b,0x8b,0x49,0xb3,0x42,0xb9,0x2a,0x84,0x9f,0x5f,0x78,0x2b,0x90,0x86,0x61,0xbc,
+  0x10,0xe7,0x11,0x1a,0x5c,0x15,0x76,0xe5,0x35,0xe1,0x92,0x3d,0x22,0xbd,0x14,0xd2,
+  0x22,0xd1,0xdf,0x76,0x33,0xdf,0x81,0x4d,0x37,0xb4,0x49,0x98,0x61,0x94,0x68,0x48,
+  0x35,0x99,0x25,0x12,0x05,0xd9,0xe8,0x08,0x84,0xe7,0x67,0xfd,0xad,0xf6,0x46,0x96,
+  0xe5,0x41,0xc4,0x26,0xb3,0x62,0xb4,0x69,0xc1,0xa6,0x1b,0x72,0xb8,0x0f,0x36,0xa4,
+  0xcf,0xd7,0xf4,0x1a,0x80,0x61,0x75,0x19,0x78,0x11,0x00,0x11,0x80,0xee,0xb0,0x7a,
+  0x90,0x3e,0x65,0x15,0x2c,0x2e,0x6f,0x02,0xe1,0x36,0xf3,0x86,0x8f,0x80,0x72,0xd9,
+  0x72,0xe6,0xdf,0xb8,0xb5,0x52,0xad,0xd6,0x36,0x17,0x35,0xa4,0xbb,0x51,0xbc,0x68,
+  0x29,0x3c,0x39,0x38,0x67,0x04,0x54,0x72,0xf9,0x50,0x3c,0x7f,0x86,0xda,0x09,0x03,
+  0xfe,0xc3,0xcf,0x01,0xd9,0x5f,0xf8,0x38,0x10,0x95,0x07,0x10,0xab,0x6c,0xfb,0xd2,
+  0x0b,0x89,0x67,0xc5,0x13,0xb3,0x65,0xf3,0x5e,0x20,0xf3,0x32,0x58,0xa4,0x61,0x96,
+  0x87,0xe3,0x01,0x0c,0xc5,0xf8,0x33,0xba,0x7a,0xce,0x5e,0xbf,0xe7,0x6d,0xb1,0xeb,
+  0x29,0x9a,0x29,0xe4,0xbb,0xc4,0xd5,0x2b,0xb9,0xe9,0xa5,0x74,0xc5,0x7d,0xbf,0x16,
+  0x21,0x86,0x36,0x07,0x72,0xe7,0x24,0x4c,0xa1,0x6d,0xa8,0xfd,0x60,0x83,0xe7,0x4c,
+  0xff,0xe6,0xa7,0x4c,0x49,0x81,0x7b,0x29,0xbe,0xe6,0x03,0x7c,0x20,0xfd,0xb0,0xc8,
+  0xce,0xf4,0xba,0xa9,0xe9,0x6e,0xc4,0x32,0xf8,0xb2,0x7d,0xe5,0x91,0x53,0xbe,0xbb,
+  0xc0,0xdf,0x38,0xdd,0x78,0xcd,0x6c,0xc9,0xb7,0xcb,0xe5,0x6b,0xc7,0xb5,0x6f,0x98,
+  0xab,0xa7,0x90,0x87,0x72,0xd1,0xac,0xd0,0x25,0x57,0x25,0xe1,0xc4,0xfb,0xa8,0xb7,
+  0x1f,0xab,0xb5,0x46,0x19,0x0b,0xd2,0x7a,0xb0,0xc8,0x6f,0x95,0x34,0x9f,0xc2,0x2e,
+  0xae,0xd1,0x81,0x5f,0xbe,0xe8,0xa9,0x7c,0xbc,0x10,0x23,0x44,0x59,0xe0,0x00,0xfa,
+  0x46,0xba,0x3c,0x29,0xe4,0x57,0x62,0xf9,0x90,0xa8,0x2a,0x28,0x79,0xff,0x89,0xa9,
+  0xe0,0x94,0x67,0x9a,0xb2,0x82,0xcf,0x66,0x33,0x10,0xe2,0x20,0xc3,0x81,0xc5,0xd1,
+  0xb4,0x66,0xcf,0x4f,0x7f,0xea,0xd3,0x7c,0xa0,0x4d,0x7c,0x72,0xa1,0x91,0xf7,0x5c,
+  0x1e,0xa1,0x2b,0x5c,0xf1,0x6a,0xb9,0xc0,0x53,0x2a,0x8b,0x86,0xea,0x9b,0x54,0x18,
+  0x79,0xd1,0xac,0x04,0xf5,0x4b,0x13,0xbf,0xf9,0x8a,0x56,0x51,0x42,0xd3,0x62,0x7f,
+  0xfb,0xda,0x96,0x89,0xc5,0xad,0xda,0x7c,0x73,0x1b,0x16,0xb9,0x27,0x96,0xb6,0xca,
+  0xad,0x3c,0x71,0xa9,0xd6,0x99,0xf6,0xb0,0xf2,0x9c,0x65,0x31,0x84,0xe2,0x51,0x4b,
+  0x2f,0xba,0x93,0x07,0x9b,0xc4,0x2a,0x2f,0xca,0x12,0xb5,0x75,0x92,0xe0,0x18,0x48,
+  0xb1,0x16,0xf2,0x88,0x66,0x5c,0x35,0x82,0x01,0x16,0x64,0x79,0x27,0x98,0x4c,0x12,
+  0xbe,0xfd,0xcf,0xdf,0x53,0xfd,0x9b,0x9f,0x52,0xdd,0xf8,0xfd,0x4f,0x8a,0x0a,0x34,
+  0x78,0xd2,0x0c,0xd0,0xff,0x8f,0x79,0x1b,0x94,0x31,0xed,0x62,0x9c,0x1f,0xc5,0x0e,
+  0x65,0x40,0x81,0x9b,0x03,0xc6,0xc5,0x36,0x46,0x1a,0xb3,0xce,0x31,0x9e,0x34,0x85,
+  0x15,0x2e,0xfe,0xea,0x19,0x9c,0x1a,0xe1,0x1d,0x70,0xc6,0x71,0x1e,0xfb,0xa4,0x3b,
+  0xe8,0xc9,0x95,0xa8,0x7a,0x56,0x54,0xe9,0xa0,0xea,0xb3,0xa2,0xe2,0xe8,0x4d,0xe0,
+  0x1e,0x97,0x2e,0x76,0x51,0x9a,0x93,0xcf,0x4d,0x6d,0x7d,0x29,0x76,0x48,0xaa,0xcf,
+  0x31,0xa7,0x20,0x4d,0xb8,0x65,0x5f,0xcd,0xb0,0xa0,0xfb,0x49,0xfc,0x1c,0x23,0xe5,
+  0x6c,0x21,0xea,0x2e,0x21,0x19,0x26,0x22,0xce,0x0b,0xfc,0x69,0xde,0x46,0x6c,0xc6,
+  0xd2,0xf6,0x8f,0x78,0x30,0xad,0x58,0x31,0xac,0xbf,0x88,0x71,0x54,0xba,0x7e,0x71,
+  0xa4,0x5f,0xba,0xe8,0x27,0x39,0xa6,0xe8,0x21,0xa0,0xf2,0x6e,0x5c,0xac,0x29,0xf9,
+  0x07,0xd5,0x97,0x9e,0xbe,0xf2,0x4a,0x45,0xd1,0x37,0x2b,0x6c,0x8f,0x6c,0xd1,0x1f,
+  0xe3,0xe6,0x42,0x7a,0x38,0x4e,0xa7,0x8c,0x78,0x7b,0xf8,0x06,0xe6,0x4e,0x16,0x5e,
+  0x05,0x16,0x56,0x41,0x19,0x8a,0x0a,0xce,0x24,0x10,0xcf,0xb1,0x87,0x28,0x95,0x08,
+  0x70,0x8d,0x54,0xc2,0x2e,0xa1,0x3c,0xd2,0x27,0x89,0x8a,0xf8,0x17,0xc7,0xf0,0xb4,
+  0xa9,0x81,0x8d,0x70,0x65,0x3a,0x44,0x16,0x47,0xd2,0x60,0xaf,0x40,0xb1,0x5c,0x5e,
+  0xe2,0x39,0x18,0x20,0x59,0x1b,0xcf,0x4f,0x03,0x87,0xde,0x09,0x65,0x7b,0x8e,0x76,
+  0x51,0xa7,0xd7,0x66,0xa7,0xfc,0xc7,0x50,0x9a,0x22,0x34,0xba,0xad,0xf3,0x4f,0xc0,
+  0x1e,0xf8,0x13,0xc8,0x11,0xa2,0x5f,0x93,0xca,0x5b,0xe7,0xfc,0x96,0xc0,0xd0,0x3e,
+  0xe9,0xf4,0x06,0xe1,0xb0,0xd2,0x6b,0xbd,0x1e,0x96,0xe5,0xb3,0x09,0x7f,0x1d,0xd3,
+  0xad,0x1c,0x8d,0x56,0x1c,0x79,0x60,0x79,0x0d,0xe9,0x1d,0xd3,0xb0,0x39,0x2d,0x63,
+  0x43,0x48,0x5b,0xa7,0xeb,0xb0,0xd1,0xea,0x9d,0x2a,0x6c,0x4e,0x37,0xc0,0x06,0x9d,
+  0xbf,0xa7,0x1a,0x36,0xf5,0x5e,0x3a,0x79,0x80,0x5f,0x77,0xcf,0x35,0x86,0x8a,0x65,
+  0x58,0x78,0x93,0x23,0xf8,0x59,0xcd,0x2d,0x83,0x9a,0x17,0x5b,0xe9,0x9c,0x4c,0x6e,
+  0x63,0x49,0xf1,0xf9,0x1d,0x92,0xbf,0xee,0x18,0x64,0x56,0xbd,0x1d,0xb9,0xc6,0xa7,
+  0x4c,0x9e,0x38,0x43,0x12,0x47,0xf3,0x4a,0x6c,0xa5,0x02,0x25,0xb7,0xea,0x4e,0x58,
+  0x29,0x89,0x87,0x59,0x0a,0x38,0xd1,0xbc,0x7a,0x64,0x72,0xae,0x6d,0xc1,0x94,0x76,
+  0xf2,0x8c,0x9c,0xca,0x5e,0x5e,0xed,0x11,0xc6,0xf3,0x8d,0x8e,0x30,0xaa,0xe5,0x0c,
+  0xdf,0xdb,0x2f,0xf6,0x01,0x24,0x29,0x95,0xf3,0x52,0x23,0xe6,0x69,0x03,0x31,0x6b,
+  0xae,0x86,0xae,0x23,0xe7,0x69,0x99,0x9c,0x93,0x3a,0x72,0x2a,0x60,0x3a,0x41,0x4b,
+  0x89,0x06,0x49,0x27,0x7f,0x77,0x92,0x9e,0x7e,0x05,0x49,0x85,0xad,0xc6,0x63,0x2c,
+  0x84,0x57,0x58,0x20,0x3f,0xba,0x65,0x6f,0xcf,0x7e,0xcc,0x4c,0xbf,0x01,0x06,0x08,
+  0x2d,0x59,0xc6,0xb7,0xdc,0xfb,0xa0,0x10,0x41,0x59,0xc2,0x0f,0x90,0x47,0x33,0xef,
+  0x06,0x7e,0xf4,0xf9,0x3e,0xb8,0xc1,0x89,0x8a,0xf9,0xea,0xb6,0x8e,0x4d,0xb6,0x5c,
+  0xcd,0x97,0x62,0x38,0xc0,0xd8,0xc3,0xa0,0x0f,0xb2,0xc6,0xb5,0x3b,0xa4,0x73,0x17,
+  0xb9,0xd6,0x78,0x85,0x5a,0xac,0x4c,0x0b,0xdb,0x3c,0xcc,0xe9,0xd2,0x72,0x22,0x87,
+  0xba,0xb6,0xdc,0xc0,0xf8,0x32,0x73,0x45,0x03,0x08,0x1f,0x6f,0x81,0xe6,0xdb,0x5d,
+  0xda,0x31,0xbc,0xcb,0x6c,0xed,0x50,0xd4,0x1d,0xd0,0x55,0xd0,0x40,0xeb,0x67,0x86,
+  0xad,0x7b,0x09,0x44,0x34,0x5b,0x9d,0xa9,0xfb,0x18,0x64,0x9b,0x58,0xe4,0x6b,0x5b,
+  0x85,0xba,0x6d,0x82,0x50,0x6a,0xd5,0xbb,0x29,0xb5,0xea,0xdd,0x94,0x5b,0xf5,0x6e,
+  0xbe,0xbe,0x55,0xef,0xa6,0x4d,0x10,0xe4,0xf5,0xd4,0xda,0xee,0xb5,0xe1,0x50,0xaf,
+  0x5c,0xfd,0x97,0x07,0x66,0xe0,0x76,0x50,0x0c,0x20,0xdf,0xe6,0xae,0xbb,0xd5,0x32,
+  0x8c,0x43,0xc3,0x6d,0x8e,0x97,0x58,0xe0,0x71,0x13,0x65,0xa3,0x80,0xc9,0x29,0x0c,
+  0x14,0x7a,0x6f,0x96,0xfc,0xf6,0x20,0x18,0xde,0xf0,0x72,0x85,0x6f,0x61,0x0a,0x0b,
+  0x1e,0x91,0xe8,0xaa,0x23,0x1c,0x02,0x9a,0x2d,0xc1,0x36,0x9c,0x69,0xb9,0x2b,0xee,
+  0xaf,0x24,0xc1,0x72,0x41,0x4b,0x6a,0xab,0xd0,0x8b,0xe8,0xa4,0xe0,0xfa,0xca,0xd2,
+  0xc4,0xbe,0x94,0x43,0x66,0xee,0xa9,0xca,0xad,0x73,0x37,0xf0,0x0d,0x98,0x7a,0xf1,
+  0x25,0x74,0xb0,0xbe,0x0e,0x43,0xf2,0xbc,0xf7,0x46,0xb4,0x95,0xa3,0x9b,0x89,0xb4,
+  0x4b,0xf1,0x2a,0xc1,0x77,0x66,0x63,0x58,0x24,0xf0,0x80,0xb0,0xa6,0xeb,0x31,0x86,
+  0xe6,0xe9,0xdb,0xc2,0xd5,0x31,0xbf,0x72,0xcd,0xa3,0x8b,0xdc,0xda,0xc7,0x37,0xd4,
+  0xe7,0x2b,0x4f,0x57,0x94,0x8f,0x48,0x16,0x11,0x91,0x74,0x5e,0xa7,0x1c,0x78,0xe6,
+  0x49,0x73,0x16,0xcd,0xc9,0x22,0xe6,0x71,0x94,0xc7,0xbc,0xa4,0x88,0xc8,0xe7,0x1f,
+  0x02,0x0b,0xf5,0x6d,0x2f,0x8b,0x82,0x2b,0x8e,0x8f,0x58,0xfc,0x2d,0xec,0xc0,0x41,
+  0xdc,0xa0,0x84,0xb8,0xcb,0x16,0x7b,0x5f,0x6c,0x5e,0x0c,0x4b,0xa7,0x62,0x00,0x30,
+  0x47,0x51,0x60,0xc0,0x3f,0x0a,0x0c,0xf8,0x37,0xc7,0x80,0xff,0xfe,0x5a,0x0c,0xe4,
+  0x06,0x51,0x81,0x81,0x24,0x96,0xda,0xb1,0xaa,0xa3,0x0f,0x3f,0xbc,0x50,0x3a,0xc9,
+  0x20,0xb1,0xe3,0xdf,0x1c,0x3b,0xfe,0xfb,0xeb,0xb0,0x33,0x0e,0x0f,0xd4,0x90,0x48,
+  0x9c,0x94,0xa8,0x3d,0x37,0x51,0x24,0x28,0x3c,0xf0,0xe3,0xeb,0x10,0x29,0x05,0x55,
+  0x96,0x51,0x99,0x78,0x57,0xb4,0xf7,0x27,0x02,0x21,0xe9,0xb7,0x40,0x43,0x7e,0x02,
+  0x12,0xf2,0xe7,0xd7,0xa1,0x50,0xd9,0x44,0x54,0x38,0xe0,0xa9,0x1f,0xb4,0x60,0xc1,
+  0x42,0xd9,0xe8,0xc9,0x45,0xf3,0x12,0x7c,0xb7,0xa8,0x2e,0xe9,0x66,0x63,0x7a,0xf9,
+  0x65,0xc4,0x75,0x27,0x24,0xb8,0x2f,0x2c,0xbd,0x65,0xd2,0x72,0x42,0x57,0x90,0xb8,
+  0xcc,0x25,0xcc,0x58,0xba,0x88,0xf1,0xe2,0x81,0x36,0x13,0x2f,0x36,0x72,0x17,0x10,
+  0xfa,0x12,0x16,0x99,0xb0,0xc0,0xf8,0x82,0x04,0x43,0x6f,0xdf,0xc4,0xae,0x3a,0xfc,
+  0x5d,0xbd,0xd3,0x68,0x58,0xbe,0x77,0x66,0xdd,0x29,0xa2,0x0d,0x4c,0x6e,0xdc,0xc4,
+  0x77,0x68,0xcb,0xb2,0xc1,0xf8,0x16,0x78,0x51,0x38,0x41,0xe6,0xf0,0x0f,0xf2,0x99,
+  0xf0,0xdd,0x3c,0xe9,0x3c,0x11,0xbe,0x4a,0xca,0x2e,0x4e,0x67,0x7f,0x2e,0xb6,0x18,
+  0xd5,0x83,0x95,0xc5,0x51,0x8b,0x82,0x3a,0x0e,0xdf,0x99,0xc7,0x0d,0x7b,0x75,0xb3,
+  0x2f,0x3d,0x3f,0x8c,0x47,0xd0,0x88,0x94,0x0e,0x7b,0x2e,0x36,0x1c,0xf4,0xc7,0x2d,
+  0x8d,0x08,0x77,0xe8,0x68,0xcb,0xd8,0x48,0x54,0xa8,0x7d,0xa3,0xbd,0x78,0xa6,0x76,
+  0xac,0xa3,0xe4,0x12,0x3a,0x22,0x51,0x46,0x3f,0x1f,0x34,0xbe,0x94,0x01,0x95,0x97,
+  0x2a,0x56,0xf2,0x5c,0x0b,0x81,0x3c,0xbd,0x53,0x60,0x28,0x6c,0x2b,0xf6,0x59,0x5d,
+  0xf4,0x80,0x28,0xb2,0xf9,0xbe,0xff,0xfd,0x76,0xfe,0xef,0xb3,0xf7,0xbf,0xe6,0x48,
+  0x03,0xd3,0x2e,0x1e,0x4e,0xd3,0xca,0x7e,0x3e,0xdf,0x82,0x5d,0xbd,0x75,0x4f,0xf6,
+  0xbc,0x7e,0xd7,0x70,0x75,0x12,0xaa,0x78,0x3c,0xe9,0x5f,0x92,0x52,0x5a,0x50,0x9b,
+  0x9e,0xdc,0xe0,0x2b,0x59,0x3c,0x19,0x03,0x42,0x9b,0x6e,0x41,0x97,0x7c,0x63,0xeb,
+  0x62,0xf3,0x27,0x35,0xe7,0x05,0x0f,0x14,0x53,0xff,0x27,0x2e,0x2c,0x7f,0xba,0xbf,
+  0x24,0x71,0xb1,0x1a,0xd8,0x02,0x5f,0x2b,0x37,0x96,0x6b,0x98,0xd4,0x18,0x36,0x6d,
+  0x72,0xcb,0xc0,0x49,0x60,0xbc,0x6f,0x7f,0x34,0xe3,0xd2,0x66,0x77,0x1b,0x73,0x01,
+  0x8d,0x09,0x97,0x2b,0x30,0x08,0xf2,0x04,0x06,0xcc,0x72,0xf8,0x49,0x07,0xaf,0xf0,
+  0xd8,0xc5,0x38,0xf2,0x66,0x73,0x80,0x2e,0x6a,0xac,0xbf,0xb0,0x4c,0xb0,0xc7,0x8a,
+  0x83,0x33,0xda,0x40,0xde,0x27,0x5e,0x44,0x63,0xba,0xa5,0x3e,0x6c,0x26,0xa7,0x49,
+  0x8b,0xe0,0x14,0xb7,0x81,0x3a,0x88,0xe3,0x80,0xf1,0x63,0x2a,0xb8,0xc1,0x95,0xd3,
+  0x7e,0xb4,0x3a,0x25,0xd3,0xa6,0x6d,0x2e,0x4f,0x1c,0x8a,0x9e,0x84,0x97,0xc2,0xc9,
+  0x44,0xe5,0xde,0x7c,0x76,0xc5,0xe3,0x6b,0x50,0xbe,0xf8,0x18,0x4f,0x2e,0xe5,0x87,
+  0xbc,0xe2,0x5c,0x96,0x07,0xa9,0xd9,0x48,0x9a,0xa5,0x09,0x94,0xe3,0xa9,0x51,0xb3,
+  0x7a,0x8a,0x86,0xb7,0x6a,0x06,0xbb,0x6a,0x98,0x28,0x08,0xea,0xb0,0x66,0xaa,0xda,
+  0xff,0x9a,0x7b,0x14,0x69,0x3b,0x00,0x55,0x8a,0x82,0x87,0x5e,0x3a,0x05,0xb2,0x50,
+  0x2c,0x74,0xb3,0x15,0x66,0x81,0xa2,0x13,0xef,0x46,0x60,0x1d,0x65,0x46,0x8b,0x03,
+  0x6a,0x28,0x64,0x88,0x54,0xa2,0x07,0xf2,0x98,0xb6,0x4e,0xbf,0xf2,0xcd,0x76,0x66,
+  0x1e,0x74,0x4f,0x5b,0x8b,0xf0,0x87,0x52,0xf8,0x2a,0x07,0x09,0xff,0x74,0x07,0x2d,
+  0xe6,0x79,0x7e,0xfc,0xe0,0xe9,0x0e,0xce,0x05,0xfc,0x3b,0xcd,0x67,0xd1,0xf1,0x83,
+  0xff,0x07,0x8a,0xff,0xb2,0x9a,0xb0,0xee,0x00,0x00,
+};
+static const size_t INDEX_HTML_GZ_LEN = sizeof(INDEX_HTML_GZ);
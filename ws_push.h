@@ -0,0 +1,256 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "anim_schema.h"
+#include "json_writer.h"
+
+// WebSocket push channel for the web UI (RFC 6455, server side). Instead of polling
+// /api/auto/config and /api/state, the UI keeps one socket open and the leader pushes compact
+// JSON deltas: the auto banner (on, current favorite, remaining seconds) whenever the
+// countdown restarts, and the animation / parameters that changed, whoever changed them.
+// Clients only send ping and close. Header-only so the test-ui server speaks the same thing.
+//
+//   {"auto":{"on":true,"id":2,"name":"Sunset","remaining":60,"interval":1},
+//    "leader":{"params":[{"id":1,"value":2.50000}]},"follower":{"animIndex":3,"params":[...]}}
+//
+// A role's animIndex, and then every parameter, is only sent when the animation changed.
+#ifndef WS_PORT
+#define WS_PORT 81 // WebSocket push port; the UI connects to its HTTP port + 1
+#endif
+#ifndef WS_MAX_CLIENTS
+#define WS_MAX_CLIENTS 4 // open push sockets, further connections are refused
+#endif
+#ifndef WS_PUSH_MS
+#define WS_PUSH_MS 250 // how often the leader compares state for a push
+#endif
+#ifndef WS_FRAME_BYTES
+#define WS_FRAME_BYTES 2048 // largest pushed message; a longer delta goes out as {"reload":true}
+#endif
+
+namespace Ws {
+
+// --- handshake ---
+
+struct Sha1 {
+  uint32_t h[5] = { 0x67452301u, 0xEFCDAB89u, 0x98BADCFEu, 0x10325476u, 0xC3D2E1F0u };
+  uint8_t block[64];
+  uint64_t bytes = 0;
+
+  void update(const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) { block[bytes++ & 63] = *p++; if (!(bytes & 63)) compress(); }
+  }
+  void final(uint8_t out[20]) {
+    uint64_t bits = bytes * 8;
+    uint8_t pad = 0x80;
+    update(&pad, 1);
+    pad = 0;
+    while ((bytes & 63) != 56) update(&pad, 1);
+    for (int i = 7; i >= 0; --i) { uint8_t b = (uint8_t)(bits >> (i * 8)); update(&b, 1); }
+    for (int i = 0; i < 20; ++i) out[i] = (uint8_t)(h[i / 4] >> (24 - (i % 4) * 8));
+  }
+
+ private:
+  static uint32_t rol(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+  void compress() {
+    uint32_t w[80];
+    for (int i = 0; i < 16; ++i) w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 | (uint32_t)block[i * 4 + 2] << 8 | block[i * 4 + 3];
+    for (int i = 16; i < 80; ++i) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; ++i) {
+      uint32_t f, k;
+      if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999u; }
+      else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1u; }
+      else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDCu; }
+      else { f = b ^ c ^ d; k = 0xCA62C1D6u; }
+      uint32_t t = rol(a, 5) + f + e + k + w[i];
+      e = d; d = c; c = rol(b, 30); b = a; a = t;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+  }
+};
+
+// Sec-WebSocket-Accept for a client key: base64(SHA-1(key + GUID)), 28 chars + NUL
+inline void acceptKey(const char *key, size_t keyLen, char out[29]) {
+  static const char guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  Sha1 s;
+  s.update(key, keyLen);
+  s.update(guid, sizeof(guid) - 1);
+  uint8_t d[21];
+  s.final(d);
+  d[20] = 0;
+  for (int i = 0, o = 0; i < 21; i += 3, o += 4) {
+    uint32_t v = (uint32_t)d[i] << 16 | (uint32_t)d[i + 1] << 8 | (i + 2 < 21 ? d[i + 2] : 0);
+    out[o] = b64[v >> 18]; out[o + 1] = b64[(v >> 12) & 63]; out[o + 2] = b64[(v >> 6) & 63]; out[o + 3] = b64[v & 63];
+  }
+  out[27] = '=';
+  out[28] = 0;
+}
+
+// Sec-WebSocket-Key in a complete request head; false if it is not an upgrade request
+inline bool requestKey(const char *req, size_t len, const char *&key, size_t &keyLen) {
+  static const char name[] = "sec-websocket-key:";
+  const size_t n = sizeof(name) - 1;
+  for (size_t i = 0; i + n < len; ++i) {
+    if (i && req[i - 1] != '\n') continue;
+    size_t k = 0;
+    while (k < n && (req[i + k] | 0x20) == name[k]) k++;
+    if (k < n) continue;
+    size_t s = i + n, e;
+    while (s < len && req[s] == ' ') s++;
+    for (e = s; e < len && req[e] != '\r' && req[e] != '\n' && req[e] != ' '; ++e) {}
+    key = req + s; keyLen = e - s;
+    return keyLen > 0;
+  }
+  return false;
+}
+
+// The 101 response for a request head; 0 if it carries no key (answer 400)
+inline size_t handshake(const char *req, size_t len, char *out, size_t cap) {
+  const char *key; size_t keyLen;
+  if (!requestKey(req, len, key, keyLen)) return 0;
+  char accept[29];
+  acceptKey(key, keyLen, accept);
+  int n = snprintf(out, cap, "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n", accept);
+  return n > 0 && (size_t)n < cap ? (size_t)n : 0;
+}
+
+// --- frames ---
+
+enum Opcode : uint8_t { OP_CONT = 0, OP_TEXT = 1, OP_BINARY = 2, OP_CLOSE = 8, OP_PING = 9, OP_PONG = 10 };
+
+// Header of an unmasked server frame (FIN set); returns its length, 2..10 bytes
+inline size_t frameHeader(uint8_t op, size_t len, uint8_t hdr[10]) {
+  hdr[0] = (uint8_t)(0x80 | op);
+  if (len < 126) { hdr[1] = (uint8_t)len; return 2; }
+  if (len <= 0xFFFF) { hdr[1] = 126; hdr[2] = (uint8_t)(len >> 8); hdr[3] = (uint8_t)len; return 4; }
+  hdr[1] = 127;
+  for (int i = 0; i < 8; ++i) hdr[2 + i] = (uint8_t)((uint64_t)len >> (56 - i * 8));
+  return 10;
+}
+
+struct Frame { uint8_t op; bool fin; uint8_t *payload; size_t len; };
+static const size_t BAD_FRAME = (size_t)-1;
+
+// One client frame at buf, payload unmasked in place. Returns the bytes it takes, 0 while it
+// is incomplete, BAD_FRAME for an unmasked client frame (the connection must be closed).
+inline size_t parseFrame(uint8_t *buf, size_t len, Frame &f) {
+  if (len < 2) return 0;
+  if (!(buf[1] & 0x80)) return BAD_FRAME;
+  size_t n = buf[1] & 0x7F, pos = 2;
+  if (n == 126) { if (len < 4) return 0; n = (size_t)buf[2] << 8 | buf[3]; pos = 4; }
+  else if (n == 127) {
+    if (len < 10) return 0;
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i) v = v << 8 | buf[2 + i];
+    if (v > len) return 0;
+    n = (size_t)v; pos = 10;
+  }
+  if (len < pos + 4 + n) return 0;
+  const uint8_t *mask = buf + pos;
+  pos += 4;
+  for (size_t i = 0; i < n; ++i) buf[pos + i] ^= mask[i & 3];
+  f.op = buf[0] & 0x0F; f.fin = (buf[0] & 0x80) != 0; f.payload = buf + pos; f.len = n;
+  return pos + n;
+}
+
+// --- state deltas ---
+
+enum Role : uint8_t { LEADER = 0, FOLLOWER = 1 };
+
+// What the UI shows; compared field by field between pushes
+struct Snapshot {
+  bool autoOn = false;
+  int16_t autoId = -1;      // current favorite
+  uint32_t autoMark = 0;    // changes whenever the countdown restarts
+  uint32_t remaining = 0;   // seconds, sent with the auto block only
+  uint32_t intervalSec = 0;
+  char name[40] = "";       // JSON-escaped, as cut out of the stored favorite
+  uint8_t anim[2] = { 0, 0 };
+  Anim::ParamSet params[2];
+
+  // Copies an already escaped name, cut on a code point (Json::escapedPrefix)
+  void setName(const char *s, size_t len) {
+    len = Json::escapedPrefix(s, len, sizeof(name) - 1);
+    memcpy(name, s, len);
+    name[len] = 0;
+  }
+};
+
+inline bool autoChanged(const Snapshot &a, const Snapshot &b) {
+  return a.autoOn != b.autoOn || a.autoId != b.autoId || a.autoMark != b.autoMark || a.intervalSec != b.intervalSec || strcmp(a.name, b.name) != 0;
+}
+inline bool paramChanged(const Snapshot &a, const Snapshot &b, uint8_t r, uint8_t id) {
+  return Anim::getParamField(a.params[r], id) != Anim::getParamField(b.params[r], id);
+}
+
+// Writes the delta from prev to cur as one JSON object; prev == nullptr writes everything
+// (first message on a new socket). Returns false, writing nothing, when nothing changed.
+template<size_t N>
+bool writeDelta(Json::Writer<N> &w, const Snapshot *prev, const Snapshot &cur) {
+  bool sendAuto = !prev || autoChanged(*prev, cur);
+  bool sendRole[2];
+  for (uint8_t r = 0; r < 2; ++r) {
+    sendRole[r] = !prev || prev->anim[r] != cur.anim[r];
+    for (uint8_t i = 0; !sendRole[r] && i < AnimSchema::PARAM_COUNT; ++i) sendRole[r] = paramChanged(*prev, cur, r, AnimSchema::PARAMS[i].id);
+  }
+  if (!sendAuto && !sendRole[0] && !sendRole[1]) return false;
+
+  w.beginObject();
+  if (sendAuto) {
+    w.key("auto").beginObject().key("on").boolean(cur.autoOn).key("id").num((int)cur.autoId).key("name").rawStr(cur.name, strlen(cur.name))
+     .key("remaining").num((unsigned long)cur.remaining).key("interval").num((unsigned long)(cur.intervalSec / 60)).endObject();
+  }
+  static const char *const roles[] = { "leader", "follower" };
+  for (uint8_t r = 0; r < 2; ++r) {
+    if (!sendRole[r]) continue;
+    bool all = !prev || prev->anim[r] != cur.anim[r];
+    w.key(roles[r]).beginObject();
+    if (all) w.key("animIndex").num((int)cur.anim[r]);
+    w.key("params").beginArray();
+    for (uint8_t i = 0; i < AnimSchema::PARAM_COUNT; ++i) {
+      uint8_t id = AnimSchema::PARAMS[i].id;
+      if (all || paramChanged(*prev, cur, r, id)) w.beginObject().key("id").num((int)id).key("value").num(Anim::getParamField(cur.params[r], id), 5).endObject();
+    }
+    w.endArray().endObject();
+  }
+  w.endObject();
+  return true;
+}
+
+// Collects one message for sending as a single frame; on overflow the message becomes
+// {"reload":true} so clients refetch /api/state instead.
+struct Message {
+  uint8_t buf[10 + WS_FRAME_BYTES]; // room for the frame header in front
+  size_t len = 0;
+  bool overflow = false;
+
+  static void sink(void *user, const char *data, size_t n) {
+    Message *m = static_cast<Message *>(user);
+    if (m->len + n > WS_FRAME_BYTES) { m->overflow = true; return; }
+    memcpy(m->buf + 10 + m->len, data, n);
+    m->len += n;
+  }
+  // Frame around the collected text: returns its start and sets size
+  const uint8_t *frame(size_t &size) {
+    if (overflow) { static const char kReload[] = "{\"reload\":true}"; memcpy(buf + 10, kReload, sizeof(kReload) - 1); len = sizeof(kReload) - 1; overflow = false; }
+    uint8_t hdr[10];
+    size_t h = frameHeader(OP_TEXT, len, hdr);
+    memcpy(buf + 10 - h, hdr, h);
+    size = h + len;
+    return buf + 10 - h;
+  }
+};
+
+// Builds the push for prev -> cur into m; false if there is nothing to send
+inline bool buildPush(Message &m, const Snapshot *prev, const Snapshot &cur) {
+  m.len = 0; m.overflow = false;
+  Json::Writer<256> w(&Message::sink, &m);
+  if (!writeDelta(w, prev, cur)) return false;
+  w.flush();
+  return true;
+}
+
+} // namespace Ws